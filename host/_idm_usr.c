@@ -0,0 +1,275 @@
+/** ============================================================================
+ *  @file   _idm_usr.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/api/
+ *
+ *  @desc   Implementation of the user side of the ID Manager (IDM).
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+#include <_idm_usr.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_API_IDM, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_init
+ *
+ *  @desc   Initializes the IDM component.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_init (Void)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_0ENTER ("_IDM_USR_init") ;
+
+    status = DRV_INVOKE (DRV_handle, CMD_IDM_INIT, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    TRC_1LEAVE ("_IDM_USR_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_exit
+ *
+ *  @desc   Finalizes the IDM component.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_exit (Void)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_0ENTER ("_IDM_USR_exit") ;
+
+    status = DRV_INVOKE (DRV_handle, CMD_IDM_EXIT, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    TRC_1LEAVE ("_IDM_USR_exit", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_create
+ *
+ *  @desc   Creates an IDM object.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_create (IN Uint32 key, IN IDM_Attrs * attrs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("_IDM_USR_create", key, attrs) ;
+
+    if (attrs == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.idmCreateArgs.key   = key ;
+        args.apiArgs.idmCreateArgs.attrs = attrs ;
+        status = DRV_INVOKE (DRV_handle, CMD_IDM_CREATE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("_IDM_USR_create", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_delete
+ *
+ *  @desc   Deletes an IDM object.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_delete (IN Uint32 key)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("_IDM_USR_delete", key) ;
+
+    args.apiArgs.idmDeleteArgs.key = key ;
+    status = DRV_INVOKE (DRV_handle, CMD_IDM_DELETE, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    TRC_1LEAVE ("_IDM_USR_delete", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_acquireId
+ *
+ *  @desc   Acquires the identifier of a key string.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_acquireId (IN Uint32 key, IN Pstr idKey, OUT Uint32 * id)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("_IDM_USR_acquireId", key, idKey, id) ;
+
+    if ((idKey == NULL) || (id == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.idmAcquireIdArgs.key   = key ;
+        args.apiArgs.idmAcquireIdArgs.idKey = idKey ;
+        args.apiArgs.idmAcquireIdArgs.id    = id ;
+        status = DRV_INVOKE (DRV_handle, CMD_IDM_ACQUIREID, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("_IDM_USR_acquireId", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_releaseId
+ *
+ *  @desc   Releases an identifier.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_releaseId (IN Uint32 key, IN Uint32 id)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("_IDM_USR_releaseId", key, id) ;
+
+    args.apiArgs.idmReleaseIdArgs.key = key ;
+    args.apiArgs.idmReleaseIdArgs.id  = id ;
+    status = DRV_INVOKE (DRV_handle, CMD_IDM_RELEASEID, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    TRC_1LEAVE ("_IDM_USR_releaseId", status) ;
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,679 @@
+/** ============================================================================
+ *  @file   _sync_host.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the process-shared synchronization objects used by the
+ *          host loopback backend. All objects defined here live in shared
+ *          memory and may be used by any process attached to the backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (_SYNC_HOST_H)
+#define _SYNC_HOST_H
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <pthread.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  SYNC_HOST_TICKNS
+ *
+ *  @desc   Length in nanoseconds of a tick of SYNC_HOST_ticks.
+ *  ============================================================================
+ */
+#define SYNC_HOST_TICKNS    16u
+
+/** ============================================================================
+ *  @name   SYNC_HostTicks
+ *
+ *  @desc   Time in ticks of SYNC_HOST_TICKNS nanoseconds, wide enough never
+ *          to wrap around.
+ *  ============================================================================
+ */
+typedef unsigned long long SYNC_HostTicks ;
+
+/** ============================================================================
+ *  @name   SYNC_HostLock
+ *
+ *  @desc   Process-shared mutual exclusion lock.
+ *
+ *  @field  mutex
+ *              Process-shared pthread mutex.
+ *  ============================================================================
+ */
+typedef struct SYNC_HostLock_tag {
+    pthread_mutex_t   mutex ;
+} SYNC_HostLock ;
+
+/** ============================================================================
+ *  @name   SYNC_HostCond
+ *
+ *  @desc   Process-shared condition used together with a SYNC_HostLock.
+ *
+ *  @field  cond
+ *              Process-shared pthread condition variable (CLOCK_MONOTONIC).
+ *  ============================================================================
+ */
+typedef struct SYNC_HostCond_tag {
+    pthread_cond_t    cond ;
+} SYNC_HostCond ;
+
+/** ============================================================================
+ *  @name   SYNC_HostEvent
+ *
+ *  @desc   Process-shared counting event.
+ *
+ *  @field  lock
+ *              Lock protecting the count.
+ *  @field  cond
+ *              Condition signalled on every post.
+ *  @field  count
+ *              Number of posts not yet consumed by a pend.
+ *  ============================================================================
+ */
+typedef struct SYNC_HostEvent_tag {
+    SYNC_HostLock     lock  ;
+    SYNC_HostCond     cond  ;
+    Uint32            count ;
+} SYNC_HostEvent ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_createLock
+ *
+ *  @desc   Initializes a process-shared lock in place.
+ *
+ *  @arg    lock
+ *              Lock to be initialized.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              The lock could not be initialized.
+ *
+ *  @enter  lock must be a valid pointer into shared memory.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_deleteLock
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_createLock (IN SYNC_HostLock * lock) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deleteLock
+ *
+ *  @desc   Finalizes a process-shared lock.
+ *
+ *  @arg    lock
+ *              Lock to be finalized.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  lock must have been created.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_createLock
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_deleteLock (IN SYNC_HostLock * lock) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_enter
+ *
+ *  @desc   Acquires a process-shared lock.
+ *
+ *  @arg    lock
+ *              Lock to be acquired.
+ *
+ *  @ret    None
+ *
+ *  @enter  lock must have been created.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_leave
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_enter (IN SYNC_HostLock * lock) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_tryEnter
+ *
+ *  @desc   Attempts to acquire a process-shared lock without blocking.
+ *
+ *  @arg    lock
+ *              Lock to be acquired.
+ *
+ *  @ret    TRUE
+ *              The lock has been acquired.
+ *          FALSE
+ *              The lock is held by another thread.
+ *
+ *  @enter  lock must have been created.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_enter
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+SYNC_HOST_tryEnter (IN SYNC_HostLock * lock) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_leave
+ *
+ *  @desc   Releases a process-shared lock.
+ *
+ *  @arg    lock
+ *              Lock to be released.
+ *
+ *  @ret    None
+ *
+ *  @enter  lock must be held by the caller.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_enter
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_leave (IN SYNC_HostLock * lock) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_createCond
+ *
+ *  @desc   Initializes a process-shared condition in place.
+ *
+ *  @arg    cond
+ *              Condition to be initialized.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              The condition could not be initialized.
+ *
+ *  @enter  cond must be a valid pointer into shared memory.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_deleteCond
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_createCond (IN SYNC_HostCond * cond) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deleteCond
+ *
+ *  @desc   Finalizes a process-shared condition.
+ *
+ *  @arg    cond
+ *              Condition to be finalized.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  cond must have been created.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_createCond
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_deleteCond (IN SYNC_HostCond * cond) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_wait
+ *
+ *  @desc   Waits on a condition with the associated lock held. The lock is
+ *          released while waiting and re-acquired before returning.
+ *
+ *  @arg    cond
+ *              Condition to wait on.
+ *  @arg    lock
+ *              Lock held by the caller.
+ *  @arg    timeout
+ *              Timeout in milliseconds, WAIT_FOREVER or WAIT_NONE.
+ *
+ *  @ret    DSP_SOK
+ *              The condition was signalled (or a spurious wakeup occurred).
+ *          DSP_ETIMEOUT
+ *              The timeout expired.
+ *          DSP_ENOTCOMPLETE
+ *              WAIT_NONE was specified.
+ *
+ *  @enter  lock must be held by the caller.
+ *
+ *  @leave  lock is held by the caller.
+ *
+ *  @see    SYNC_HOST_signal, SYNC_HOST_broadcast
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_wait (IN SYNC_HostCond * cond,
+                IN SYNC_HostLock * lock,
+                IN Uint32          timeout) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_waitUntil
+ *
+ *  @desc   Waits on a condition until an absolute CLOCK_MONOTONIC deadline.
+ *          Used by callers that loop around SYNC_HOST_wait and must not
+ *          extend the overall timeout on spurious wakeups.
+ *
+ *  @arg    cond
+ *              Condition to wait on.
+ *  @arg    lock
+ *              Lock held by the caller.
+ *  @arg    deadline
+ *              Absolute deadline, NULL to wait forever.
+ *
+ *  @ret    DSP_SOK
+ *              The condition was signalled (or a spurious wakeup occurred).
+ *          DSP_ETIMEOUT
+ *              The deadline passed.
+ *
+ *  @enter  lock must be held by the caller.
+ *
+ *  @leave  lock is held by the caller.
+ *
+ *  @see    SYNC_HOST_deadline
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_waitUntil (IN     SYNC_HostCond *         cond,
+                     IN     SYNC_HostLock *         lock,
+                     IN OPT const struct timespec * deadline) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deadline
+ *
+ *  @desc   Converts a relative timeout in milliseconds to an absolute
+ *          CLOCK_MONOTONIC deadline.
+ *
+ *  @arg    timeout
+ *              Timeout in milliseconds. Must not be WAIT_FOREVER.
+ *  @arg    deadline
+ *              Location to receive the deadline.
+ *
+ *  @ret    None
+ *
+ *  @enter  deadline must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_waitUntil
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_deadline (IN Uint32 timeout, OUT struct timespec * deadline) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_usecs
+ *
+ *  @desc   Returns the CLOCK_MONOTONIC time in microseconds. The value wraps
+ *          around every 2^32 microseconds, so only differences between two
+ *          readings are meaningful.
+ *
+ *  @arg    None
+ *
+ *  @ret    Current time in microseconds.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_deadline
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+SYNC_HOST_usecs (Void) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_ticks
+ *
+ *  @desc   Returns the CLOCK_MONOTONIC time in ticks of SYNC_HOST_TICKNS
+ *          nanoseconds.
+ *
+ *  @arg    None
+ *
+ *  @ret    Current time in ticks.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_usecs
+ *  ============================================================================
+ */
+NORMAL_API
+SYNC_HostTicks
+SYNC_HOST_ticks (Void) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_signal
+ *
+ *  @desc   Wakes up one waiter on a condition.
+ *
+ *  @arg    cond
+ *              Condition to be signalled.
+ *
+ *  @ret    None
+ *
+ *  @enter  cond must have been created.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_wait
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_signal (IN SYNC_HostCond * cond) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_broadcast
+ *
+ *  @desc   Wakes up all waiters on a condition.
+ *
+ *  @arg    cond
+ *              Condition to be signalled.
+ *
+ *  @ret    None
+ *
+ *  @enter  cond must have been created.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_wait
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_broadcast (IN SYNC_HostCond * cond) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_createEvent
+ *
+ *  @desc   Initializes a process-shared counting event in place.
+ *
+ *  @arg    event
+ *              Event to be initialized.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              The event could not be initialized.
+ *
+ *  @enter  event must be a valid pointer into shared memory.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_deleteEvent
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_createEvent (IN SYNC_HostEvent * event) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deleteEvent
+ *
+ *  @desc   Finalizes a process-shared counting event.
+ *
+ *  @arg    event
+ *              Event to be finalized.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  event must have been created.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_createEvent
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_deleteEvent (IN SYNC_HostEvent * event) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_post
+ *
+ *  @desc   Posts a counting event, waking up one waiter.
+ *
+ *  @arg    event
+ *              Event to be posted.
+ *
+ *  @ret    None
+ *
+ *  @enter  event must have been created.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_pend
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_post (IN SYNC_HostEvent * event) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_pend
+ *
+ *  @desc   Waits for a counting event to be posted and consumes one post.
+ *
+ *  @arg    event
+ *              Event to wait on.
+ *  @arg    timeout
+ *              Timeout in milliseconds, WAIT_FOREVER or WAIT_NONE.
+ *
+ *  @ret    DSP_SOK
+ *              A post was consumed.
+ *          DSP_ETIMEOUT
+ *              The timeout expired.
+ *          DSP_ENOTCOMPLETE
+ *              WAIT_NONE was specified and no post was pending.
+ *
+ *  @enter  event must have been created.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_post
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_pend (IN SYNC_HostEvent * event, IN Uint32 timeout) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_createPollFd
+ *
+ *  @desc   Creates a non-blocking eventfd of the calling process, to be
+ *          waited on with poll, select or epoll. It is not readable until
+ *          raised.
+ *
+ *  @arg    fd
+ *              Location to receive the file descriptor.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              Out of memory.
+ *          DSP_ERESOURCE
+ *              The process is out of file descriptors, or the descriptor
+ *              is above the bound on the pollable descriptors.
+ *
+ *  @enter  fd must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_deletePollFd
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_createPollFd (OUT Int32 * fd) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deletePollFd
+ *
+ *  @desc   Closes an eventfd created by SYNC_HOST_createPollFd.
+ *
+ *  @arg    fd
+ *              File descriptor.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_createPollFd
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_deletePollFd (IN Int32 fd) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_raisePollFd
+ *
+ *  @desc   Makes an eventfd readable. Raises accumulate until the eventfd is
+ *          cleared. Does nothing if the eventfd has been deleted.
+ *
+ *  @arg    fd
+ *              File descriptor, valid in the calling process.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_clearPollFd
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_raisePollFd (IN Int32 fd) ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_clearPollFd
+ *
+ *  @desc   Consumes all the raises of an eventfd, making it unreadable again.
+ *          Does nothing if the eventfd is not raised.
+ *
+ *  @arg    fd
+ *              File descriptor, valid in the calling process.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_raisePollFd
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_clearPollFd (IN Int32 fd) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (_SYNC_HOST_H) */
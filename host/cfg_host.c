@@ -0,0 +1,414 @@
+/** ============================================================================
+ *  @file   cfg_host.c
+ *
+ *  @path   $(DSPLINK)/config/all/
+ *
+ *  @desc   Default configuration of the host backend: a single emulated
+ *          loopback DSP sharing memory with the GPP through POSIX shared
+ *          memory segments.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <procdefs.h>
+
+/*  ----------------------------------- Host backend                */
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @name   LINKCFG_memTable_00
+ *
+ *  @desc   Memory table of the DSP.
+ *  ============================================================================
+ */
+STATIC LINKCFG_MemEntry LINKCFG_memTable_00 [] =
+{
+    {
+        0,                     /* ENTRY          : Entry number */
+        "DDR2",                /* NAME           : Name of the memory region */
+        0x87000000,            /* ADDRPHYS       : Physical address */
+        0x87000000,            /* ADDRDSPVIRT    : DSP virtual address */
+        (Uint32) -1,           /* ADDRGPPVIRT    : GPP virtual address (if known) */
+        0x00400000,            /* SIZE           : Size of the memory region */
+        TRUE,                  /* SHARED         : Shared access memory? */
+        FALSE,                 /* SYNCED         : Synchronized? */
+        0x0                    /* PAGESIZE       : GPP page size, 0 default */
+    },
+    {
+        1,                     /* ENTRY          : Entry number */
+        "DSPLINKMEM",          /* NAME           : Name of the memory region */
+        0x87400000,            /* ADDRPHYS       : Physical address */
+        0x87400000,            /* ADDRDSPVIRT    : DSP virtual address */
+        (Uint32) -1,           /* ADDRGPPVIRT    : GPP virtual address (if known) */
+        0x00100000,            /* SIZE           : Size of the memory region */
+        TRUE,                  /* SHARED         : Shared access memory? */
+        FALSE,                 /* SYNCED         : Synchronized? */
+        0x0                    /* PAGESIZE       : GPP page size, 0 default */
+    },
+    {
+        2,                     /* ENTRY          : Entry number */
+        "POOLMEM",             /* NAME           : Name of the memory region */
+        0x87500000,            /* ADDRPHYS       : Physical address */
+        0x87500000,            /* ADDRDSPVIRT    : DSP virtual address */
+        (Uint32) -1,           /* ADDRGPPVIRT    : GPP virtual address (if known) */
+        0x02000000,            /* SIZE           : Size of the memory region */
+        TRUE,                  /* SHARED         : Shared access memory? */
+        FALSE,                 /* SYNCED         : Synchronized? */
+        0x00200000             /* PAGESIZE       : GPP page size, 0 default */
+    }
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_memTables
+ *
+ *  @desc   Array of memory tables in the system.
+ *  ============================================================================
+ */
+STATIC LINKCFG_MemEntry * LINKCFG_memTables [] =
+{
+    LINKCFG_memTable_00
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_ipsTable_00
+ *
+ *  @desc   IPS table of the DSP.
+ *  ============================================================================
+ */
+STATIC LINKCFG_Ips LINKCFG_ipsTable_00 [] =
+{
+    {
+        "IPS",                 /* NAME           : Name of the IPS */
+        32,                    /* NUMIPSEVENTS   : Number of IPS events */
+        1,                     /* MEMENTRY       : Memory entry ID */
+        (Uint32) -1,           /* GPPINTID       : Interrupt no. to GPP */
+        (Uint32) -1,           /* DSPINTID       : Interrupt no. to DSP */
+        (Uint32) -1,           /* DSPINTVECTORID : DSP interrupt vector no. */
+        50,                    /* ARGUMENT1      : Poll value */
+        0                      /* ARGUMENT2      : Reserved */
+    }
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_ipsTables
+ *
+ *  @desc   Array of IPS tables in the system.
+ *  ============================================================================
+ */
+STATIC LINKCFG_Ips * LINKCFG_ipsTables [] =
+{
+    LINKCFG_ipsTable_00
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_poolTable_00
+ *
+ *  @desc   POOL table of the DSP.
+ *  ============================================================================
+ */
+STATIC LINKCFG_Pool LINKCFG_poolTable_00 [] =
+{
+    {
+        "SMAPOOL",             /* NAME           : Name of the pool */
+        1,                     /* MEMENTRY       : Memory entry ID */
+        0x01800000,            /* POOLSIZE       : Size of the pool */
+        (Uint32) -1,           /* IPSID          : ID of the IPS used */
+        (Uint32) -1,           /* IPSEVENTNO     : IPS Event number */
+        2,                     /* POOLMEMENTRY   : Pool memory region section ID */
+        0x0,                   /* ARGUMENT1      : First Pool-specific argument */
+        0x0                    /* ARGUMENT2      : Second Pool-specific argument */
+    },
+    {
+        "SMAPOOL",             /* NAME           : Name of the pool */
+        1,                     /* MEMENTRY       : Memory entry ID */
+        0x00800000,            /* POOLSIZE       : Size of the pool */
+        (Uint32) -1,           /* IPSID          : ID of the IPS used */
+        (Uint32) -1,           /* IPSEVENTNO     : IPS Event number */
+        2,                     /* POOLMEMENTRY   : Pool memory region section ID */
+        0x0,                   /* ARGUMENT1      : First Pool-specific argument */
+        0x0                    /* ARGUMENT2      : Second Pool-specific argument */
+    }
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_poolTables
+ *
+ *  @desc   Array of Pool tables in the system.
+ *  ============================================================================
+ */
+STATIC LINKCFG_Pool * LINKCFG_poolTables [] =
+{
+    LINKCFG_poolTable_00
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_dataTable_00
+ *
+ *  @desc   Data driver table of the DSP.
+ *  ============================================================================
+ */
+STATIC LINKCFG_DataDrv LINKCFG_dataTable_00 [] =
+{
+    {
+        "ZCPYDATA",            /* NAME           : Name of the data driver */
+        0,                     /* BASECHANNELID  : Base channel ID */
+        16,                    /* NUMCHANNELS    : Number of channels */
+        0,                     /* MAXBUFSIZE     : Maximum size of buffer */
+        1,                     /* MEMENTRY       : Memory entry ID */
+        0,                     /* POOLID         : Pool id for allocating buffers */
+        16,                    /* QUEUEPERCHNL   : Buffers queued per channel */
+        0,                     /* IPSID          : ID of the IPS used */
+        0,                     /* IPSEVENTNO     : IPS Event number */
+        0x0,                   /* ARGUMENT1      : First argument */
+        0x0                    /* ARGUMENT2      : Second argument */
+    }
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_dataTables
+ *
+ *  @desc   Array of Data driver tables in the system.
+ *  ============================================================================
+ */
+STATIC LINKCFG_DataDrv * LINKCFG_dataTables [] =
+{
+    LINKCFG_dataTable_00
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_mqtObjects
+ *
+ *  @desc   Array of MQT objects in the system.
+ *  ============================================================================
+ */
+STATIC LINKCFG_Mqt LINKCFG_mqtObjects [] =
+{
+    {
+        "RINGMQT",             /* NAME           : Name of the MQT */
+        1,                     /* MEMENTRY       : Memory entry ID */
+        0x4000,                /* MAXMSGSIZE     : Maximum message size */
+        0,                     /* IPSID          : ID of the IPS used */
+        1,                     /* IPSEVENTNO     : IPS Event number */
+        0x100,                 /* ARGUMENT1      : First argument */
+        0x0                    /* ARGUMENT2      : Second argument */
+    }
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_ringIoObjects
+ *
+ *  @desc   Array of RINGIO objects in the system.
+ *  ============================================================================
+ */
+STATIC LINKCFG_RingIo LINKCFG_ringIoObjects [] =
+{
+    {
+        "RINGIOTABLE",         /* NAME           : Name of the RingIO Table */
+        1,                     /* MEMENTRY       : Memory entry ID */
+        64,                    /* NUMENTRIES     : Number of RingIO entries */
+        0,                     /* IPSID          : ID of the IPS used */
+        2                      /* IPSEVENTNO     : IPS Event number */
+    }
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_mplistObjects
+ *
+ *  @desc   Array of MPLIST objects in the system.
+ *  ============================================================================
+ */
+STATIC LINKCFG_MpList LINKCFG_mplistObjects [] =
+{
+    {
+        "MPLISTTABLE",         /* NAME           : Name of the MPLIST Table */
+        1,                     /* MEMENTRY       : Memory entry ID */
+        64,                    /* NUMENTRIES     : Number of MPLIST entries */
+        0,                     /* IPSID          : ID of the IPS used */
+        3                      /* IPSEVENTNO     : IPS Event number */
+    }
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_mpcsObjects
+ *
+ *  @desc   Array of MPCS objects in the system.
+ *  ============================================================================
+ */
+STATIC LINKCFG_Mpcs LINKCFG_mpcsObjects [] =
+{
+    {
+        "MPCSTABLE",           /* NAME           : Name of the MPCS Table */
+        1,                     /* MEMENTRY       : Memory entry ID */
+        256,                   /* NUMENTRIES     : Number of MPCS entries */
+        0,                     /* IPSID          : ID of the IPS used */
+        4                      /* IPSEVENTNO     : IPS Event number */
+    }
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_linkDrvObjects
+ *
+ *  @desc   Array of Link driver objects in the system.
+ *  ============================================================================
+ */
+STATIC LINKCFG_LinkDrv LINKCFG_linkDrvObjects [] =
+{
+    {
+        "SHMDRV",              /* NAME           : Name of the link driver */
+        10000000,              /* HSHKPOLLCOUNT  : Handshake poll count */
+        1,                     /* MEMENTRY       : Memory entry ID */
+        0,                     /* IPSTABLEID     : ID of the IPS table used */
+        1,                     /* IPSENTRIES     : Number of IPS entries */
+        0,                     /* POOLTABLEID    : ID of the POOL table */
+        2,                     /* NUMPOOLS       : Number of POOLs */
+        0,                     /* DATATABLEID    : ID of the data driver table */
+        1,                     /* NUMDATADRIVERS : Number of data drivers */
+        0,                     /* MQTID          : ID of the MQT */
+        0,                     /* RINGIOTABLEID  : RingIO Table Id */
+        0,                     /* MPLISTTABLEID  : MpList Table Id */
+        0                      /* MPCSTABLEID    : MPCS Table Id */
+    }
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_dspObject
+ *
+ *  @desc   Configuration of the DSP.
+ *  ============================================================================
+ */
+STATIC LINKCFG_Dsp LINKCFG_dspObject =
+{
+    "LOOPDSP",                 /* NAME           : Name of the DSP */
+    DspArch_C64x,              /* DSPARCHITECTURE: DSP architecture */
+    "NONE",                    /* LOADERNAME     : Name of the DSP executable loader */
+    FALSE,                     /* AUTOSTART      : Autostart the DSP */
+    "DEFAULT.OUT",             /* EXECUTABLE     : Executable for autostart */
+    DSP_BootMode_NoBoot,       /* DOPOWERCTRL    : Link does the power control */
+    0,                         /* RESUMEADDR     : Resume address */
+    0,                         /* RESETVECTOR    : Reset vector */
+    0,                         /* RESETCODESIZE  : Size of code at reset vector */
+    1,                         /* MADUSIZE       : DSP minimum addressable unit */
+    0,                         /* CPUFREQUENCY   : DSP frequency in KHz */
+    Endianism_Little,          /* ENDIANISM      : DSP endianism */
+    FALSE,                     /* WORDSWAP       : Words must be swapped */
+    0,                         /* MEMTABLEID     : ID of the memory table */
+    3,                         /* MEMENTRIES     : Number of memory entries */
+    0,                         /* LINKDRVID      : ID of the link driver */
+    4,                         /* ARG1           : Number of DSP message queues */
+    0,                         /* ARG2           : Reserved */
+    0,                         /* ARG3           : Reserved */
+    0,                         /* ARG4           : Reserved */
+    0                          /* ARG5           : Reserved */
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_dspConfig
+ *
+ *  @desc   DSP configuration object.
+ *  ============================================================================
+ */
+STATIC LINKCFG_DspConfig LINKCFG_dspConfig =
+{
+    &LINKCFG_dspObject,        /* DSPOBJECT      : DSP object */
+    1,                         /* NUMDRVS        : Number of link drivers */
+    LINKCFG_linkDrvObjects,    /* LINKDRVOBJECTS : Link driver objects */
+    1,                         /* NUMMEMTABLES   : Number of memory tables */
+    LINKCFG_memTables,         /* MEMTABLES      : Memory tables */
+    1,                         /* NUMIPSTABLES   : Number of IPS tables */
+    LINKCFG_ipsTables,         /* IPSTABLES      : IPS tables */
+    1,                         /* NUMPOOLTABLES  : Number of POOL tables */
+    LINKCFG_poolTables,        /* POOLTABLES     : POOL tables */
+    1,                         /* NUMDATATABLES  : Number of data driver tables */
+    LINKCFG_dataTables,        /* DATATABLES     : Data driver tables */
+    1,                         /* NUMMQTS        : Number of MQTs */
+    LINKCFG_mqtObjects,        /* MQTOBJECTS     : MQT objects */
+    1,                         /* NUMRINGIO      : Number of RingIO tables */
+    LINKCFG_ringIoObjects,     /* RINGIOOBJECTS  : RingIO tables */
+    1,                         /* NUMMPLIST      : Number of MPLIST tables */
+    LINKCFG_mplistObjects,     /* MPLISTOBJECTS  : MPLIST tables */
+    1,                         /* NUMMPCS        : Number of MPCS tables */
+    LINKCFG_mpcsObjects,       /* MPCSOBJECTS    : MPCS tables */
+    NULL                       /* LOGOBJECT      : Log object */
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_gppObject
+ *
+ *  @desc   Configuration of the GPP.
+ *  ============================================================================
+ */
+STATIC LINKCFG_Gpp LINKCFG_gppObject =
+{
+    "HOST",                    /* NAME           : Name of the GPP */
+    64,                        /* MAXMSGQS       : Maximum MSGQs on the GPP */
+    16,                        /* MAXCHNLQUEUE   : Maximum queued CHNL buffers */
+    0,                         /* POOLTABLEID    : ID of the POOL table */
+    0,                         /* NUMPOOLS       : Number of GPP POOLs */
+    NULL                       /* GPPOSOBJECT    : OS-specific configuration */
+} ;
+
+/** ============================================================================
+ *  @name   LINKCFG_config
+ *
+ *  @desc   Default configuration of the host backend.
+ *  ============================================================================
+ */
+LINKCFG_Object LINKCFG_config =
+{
+    &LINKCFG_gppObject,        /* GPPOBJECT      : GPP object */
+    {
+        &LINKCFG_dspConfig     /* DSPCONFIGS     : DSP configurations */
+    }
+} ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,571 @@
+/** ============================================================================
+ *  @file   chnl.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/api/
+ *
+ *  @desc   Implementation of the API sub-component CHNL.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Profiling                   */
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* #if defined (DDSP_PROFILE) */
+
+/*  ----------------------------------- User API                    */
+#include <chnl.h>
+
+/*  ----------------------------------- Host backend                */
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_API_CHNL, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/** ============================================================================
+ *  @func   CHNL_create
+ *
+ *  @desc   Creates resources used for transferring data between GPP and DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_create (IN ProcessorId      procId,
+             IN ChannelId        chnlId,
+             IN ChannelAttrs *   attrs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("CHNL_create", procId, chnlId, attrs) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (attrs == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlCreateArgs.procId = procId ;
+        args.apiArgs.chnlCreateArgs.chnlId = chnlId ;
+        args.apiArgs.chnlCreateArgs.attrs  = attrs ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_CREATE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_create", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   CHNL_delete
+ *
+ *  @desc   Releases channel resources used for transferring data between GPP
+ *          and DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_delete (IN ProcessorId    procId,
+             IN ChannelId      chnlId)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("CHNL_delete", procId, chnlId) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlDeleteArgs.procId = procId ;
+        args.apiArgs.chnlDeleteArgs.chnlId = chnlId ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_DELETE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_delete", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   CHNL_allocateBuffer
+ *
+ *  @desc   Allocates an array of buffers of specified size and returns them
+ *          to the client.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_allocateBuffer (IN  ProcessorId procId,
+                     IN  ChannelId   chnlId,
+                     OUT Char8 **    bufArray,
+                     IN  Uint32      size,
+                     IN  Uint32      numBufs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_5ENTER ("CHNL_allocateBuffer", procId, chnlId, bufArray, size, numBufs) ;
+
+    if (    (!IS_VALID_PROCID (procId))
+        ||  (bufArray == NULL)
+        ||  (size == 0u)
+        ||  (numBufs == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlAllocateBufferArgs.procId   = procId ;
+        args.apiArgs.chnlAllocateBufferArgs.chnlId   = chnlId ;
+        args.apiArgs.chnlAllocateBufferArgs.bufArray = bufArray ;
+        args.apiArgs.chnlAllocateBufferArgs.size     = size ;
+        args.apiArgs.chnlAllocateBufferArgs.numBufs  = numBufs ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_ALLOCATEBUFFER, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_allocateBuffer", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   CHNL_freeBuffer
+ *
+ *  @desc   Frees buffer(s) allocated by CHNL_allocateBuffer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_freeBuffer (IN ProcessorId procId,
+                 IN ChannelId   chnlId,
+                 IN Char8 **    bufArray,
+                 IN Uint32      numBufs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_4ENTER ("CHNL_freeBuffer", procId, chnlId, bufArray, numBufs) ;
+
+    if (    (!IS_VALID_PROCID (procId))
+        ||  (bufArray == NULL)
+        ||  (numBufs == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlFreeBufferArgs.procId   = procId ;
+        args.apiArgs.chnlFreeBufferArgs.chnlId   = chnlId ;
+        args.apiArgs.chnlFreeBufferArgs.bufArray = bufArray ;
+        args.apiArgs.chnlFreeBufferArgs.numBufs  = numBufs ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_FREEBUFFER, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_freeBuffer", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   CHNL_issue
+ *
+ *  @desc   Issues an input or output request on a specified channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_issue (IN ProcessorId      procId,
+            IN ChannelId        chnlId,
+            IN ChannelIOInfo *  ioReq)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("CHNL_issue", procId, chnlId, ioReq) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (ioReq == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlIssueArgs.procId = procId ;
+        args.apiArgs.chnlIssueArgs.chnlId = chnlId ;
+        args.apiArgs.chnlIssueArgs.ioReq  = ioReq ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_ISSUE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_issue", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   CHNL_reclaim
+ *
+ *  @desc   Gets the buffer back that has been issued to this channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_reclaim (IN     ProcessorId       procId,
+              IN     ChannelId         chnlId,
+              IN     Uint32            timeout,
+              IN OUT ChannelIOInfo *   ioReq)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_4ENTER ("CHNL_reclaim", procId, chnlId, timeout, ioReq) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (ioReq == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlReclaimArgs.procId  = procId ;
+        args.apiArgs.chnlReclaimArgs.chnlId  = chnlId ;
+        args.apiArgs.chnlReclaimArgs.timeout = timeout ;
+        args.apiArgs.chnlReclaimArgs.ioReq   = ioReq ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_RECLAIM, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_reclaim", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   CHNL_idle
+ *
+ *  @desc   In case of input mode channel this function discards all pending
+ *          input requests from the channel. In case of output mode channel,
+ *          action of this function depends upon the flush parameter.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_idle (IN ProcessorId  procId,
+           IN ChannelId    chnlId)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("CHNL_idle", procId, chnlId) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlIdleArgs.procId = procId ;
+        args.apiArgs.chnlIdleArgs.chnlId = chnlId ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_IDLE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_idle", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   CHNL_flush
+ *
+ *  @desc   Discards all the requested buffers that are pending for transfer
+ *          both in case of input mode channel as well as output mode channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_flush (IN ProcessorId         procId,
+            IN ChannelId           chnlId)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("CHNL_flush", procId, chnlId) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlFlushArgs.procId = procId ;
+        args.apiArgs.chnlFlushArgs.chnlId = chnlId ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_FLUSH, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_flush", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   CHNL_getPollFd
+ *
+ *  @desc   Returns a file descriptor that is readable while completed buffers
+ *          of the channel wait to be reclaimed.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_getPollFd (IN  ProcessorId procId,
+                IN  ChannelId   chnlId,
+                OUT Int32 *     fd)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("CHNL_getPollFd", procId, chnlId, fd) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (fd == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlGetPollFdArgs.procId = procId ;
+        args.apiArgs.chnlGetPollFdArgs.chnlId = chnlId ;
+        args.apiArgs.chnlGetPollFdArgs.fd     = fd ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_GETPOLLFD, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_getPollFd", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   CHNL_control
+ *
+ *  @desc   Provides a hook to perform device dependent control operations on
+ *          channels.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_control (IN  ProcessorId    procId,
+              IN  ChannelId      chnlId,
+              IN  Int32          cmd,
+              OPT Pvoid          arg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_4ENTER ("CHNL_control", procId, chnlId, cmd, arg) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlControlArgs.procId = procId ;
+        args.apiArgs.chnlControlArgs.chnlId = chnlId ;
+        args.apiArgs.chnlControlArgs.cmd    = cmd ;
+        args.apiArgs.chnlControlArgs.arg    = arg ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_CONTROL, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_control", status) ;
+
+    return status ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   CHNL_instrument
+ *
+ *  @desc   Gets the instrumentation data associated with the specified
+ *          channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_instrument (IN  ProcessorId       procId,
+                 IN  ChannelId         chnlId,
+                 OUT CHNL_Instrument * retVal)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("CHNL_instrument", procId, chnlId, retVal) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (retVal == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.chnlInstrumentArgs.procId    = procId ;
+        args.apiArgs.chnlInstrumentArgs.chnlId    = chnlId ;
+        args.apiArgs.chnlInstrumentArgs.chnlStats = retVal ;
+        status = DRV_INVOKE (DRV_handle, CMD_CHNL_INSTRUMENT, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_instrument", status) ;
+
+    return status ;
+}
+#endif /* #if defined (DDSP_PROFILE) */
+
+
+#if defined (DDSP_DEBUG)
+/** ============================================================================
+ *  @func   CHNL_debug
+ *
+ *  @desc   Prints the current status of this subcomponent.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+CHNL_debug (IN ProcessorId procId,
+            IN ChannelId   chnlId)
+{
+    CMD_Args args ;
+
+    TRC_2ENTER ("CHNL_debug", procId, chnlId) ;
+
+    if (IS_VALID_PROCID (procId)) {
+        args.apiArgs.chnlDebugArgs.procId = procId ;
+        args.apiArgs.chnlDebugArgs.chnlId = chnlId ;
+        DRV_INVOKE (DRV_handle, CMD_CHNL_DEBUG, &args) ;
+    }
+
+    TRC_0LEAVE ("CHNL_debug") ;
+}
+#endif /* defined (DDSP_DEBUG) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,1094 @@
+/** ============================================================================
+ *  @file   drv_api.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the driver interface of the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <pthread.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+#include <notify.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_proc.h>
+#include <ldrv_ips.h>
+#include <ldrv_pool.h>
+#include <ldrv_msgq.h>
+#include <ldrv_chnl.h>
+#include <ldrv_mpcs.h>
+#include <ldrv_ringio.h>
+#include <ldrv_mplist.h>
+#include <ldrv_idm.h>
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_OSAL_DRV_API, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/** ============================================================================
+ *  @name   DRV_handle
+ *
+ *  @desc   Driver object of the calling process, NULL if not initialized.
+ *  ============================================================================
+ */
+DRV_Object * DRV_handle = NULL ;
+
+/*  ============================================================================
+ *  @name   DRV_object
+ *
+ *  @desc   Storage of the driver object of the calling process.
+ *  ============================================================================
+ */
+STATIC DRV_Object DRV_object ;
+
+/*  ============================================================================
+ *  @name   DRV_lock
+ *
+ *  @desc   Serializes the setup and destroy of the driver in the calling
+ *          process.
+ *  ============================================================================
+ */
+STATIC pthread_mutex_t DRV_lock = PTHREAD_MUTEX_INITIALIZER ;
+
+
+/*  ============================================================================
+ *  @func   DRV_notifyThread
+ *
+ *  @desc   Dispatches the events pending delivery to the NOTIFY clients of the
+ *          calling process, until the event queue is deactivated.
+ *
+ *  @arg    arg
+ *              Not used.
+ *
+ *  @ret    NULL
+ *
+ *  @enter  The event queue of the process is active.
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_setup
+ *  ============================================================================
+ */
+STATIC
+Pvoid
+DRV_notifyThread (IN Pvoid arg)
+{
+    DSP_STATUS         status ;
+    LDRV_IPS_UserEvent event ;
+
+    (Void) arg ;
+
+    status = LDRV_IPS_userWait (&event) ;
+    while (DSP_SUCCEEDED (status)) {
+        event.fnNotifyCbck (event.eventNo,
+                            event.cbckArg,
+                            LDRV_UINT32_TO_PTR (event.payload)) ;
+        status = LDRV_IPS_userWait (&event) ;
+    }
+
+    return NULL ;
+}
+
+
+#if defined (MSGQ_COMPONENT)
+/*  ============================================================================
+ *  @func   DRV_largeToPhy
+ *
+ *  @desc   Translates the scatter list of a large message returned to the
+ *          user layer to physical addresses.
+ *
+ *  @arg    largeMsg
+ *              Large message.
+ *
+ *  @ret    None
+ *
+ *  @enter  largeMsg must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_getLarge
+ *  ============================================================================
+ */
+STATIC
+Void
+DRV_largeToPhy (IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    Uint32 i ;
+
+    for (i = 0u ;
+         (i < largeMsg->numFrags) && (i < largeMsg->maxFrags) ;
+         i++) {
+        largeMsg->frags [i].msg  = DRV_ADDR_TO_PTR (
+                                  DRV_usrToPhy (largeMsg->frags [i].msg)) ;
+        largeMsg->frags [i].data = DRV_ADDR_TO_PTR (
+                                  DRV_usrToPhy (largeMsg->frags [i].data)) ;
+    }
+}
+#endif /* if defined (MSGQ_COMPONENT) */
+
+
+/*  ============================================================================
+ *  @func   DRV_setup
+ *
+ *  @desc   Sets up the link driver in the calling process, and starts the
+ *          dispatch of the NOTIFY callbacks on the first setup.
+ *
+ *  @arg    drvObj
+ *              Driver object.
+ *  @arg    linkCfg
+ *              Configuration of the link, NULL for the default one.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SALREADYSETUP
+ *              The link driver is already set up in the process.
+ *          DSP_EFAIL
+ *              The dispatch thread cannot be started.
+ *
+ *  @enter  drvObj must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_destroy
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+DRV_setup (IN DRV_Object * drvObj, IN OPT LINKCFG_Object * linkCfg)
+{
+    DSP_STATUS status ;
+
+    pthread_mutex_lock (&DRV_lock) ;
+
+    status = LDRV_init ((linkCfg != NULL) ? linkCfg : &LINKCFG_config) ;
+    if (DSP_SUCCEEDED (status) && (drvObj->setupCount == 0u)) {
+        LDRV_IPS_userOpen () ;
+        if (pthread_create (&drvObj->notifyThread,
+                            NULL,
+                            DRV_notifyThread,
+                            NULL) != 0) {
+            LDRV_IPS_userClose () ;
+            LDRV_exit () ;
+            status = DSP_EFAIL ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        drvObj->setupCount++ ;
+    }
+
+    pthread_mutex_unlock (&DRV_lock) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   DRV_destroy
+ *
+ *  @desc   Destroys the link driver in the calling process, and stops the
+ *          dispatch of the NOTIFY callbacks on the last destroy.
+ *
+ *  @arg    drvObj
+ *              Driver object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SDESTROYED
+ *              The link driver has been finalized for all the processes.
+ *          DSP_ESETUP
+ *              The link driver is not set up in the process.
+ *
+ *  @enter  drvObj must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_setup
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+DRV_destroy (IN DRV_Object * drvObj)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    pthread_mutex_lock (&DRV_lock) ;
+
+    if (drvObj->setupCount == 0u) {
+        status = DSP_ESETUP ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        drvObj->setupCount-- ;
+        if (drvObj->setupCount == 0u) {
+            LDRV_IPS_userClose () ;
+            pthread_join (drvObj->notifyThread, NULL) ;
+        }
+        status = LDRV_exit () ;
+    }
+
+    pthread_mutex_unlock (&DRV_lock) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   DRV_Initialize
+ *
+ *  @desc   Initializes the driver object of the calling process.
+ *
+ *  @modif  DRV_object
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+DRV_Initialize (OUT DRV_Object ** drvObj, IN OPT Pvoid arg)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_2ENTER ("DRV_Initialize", drvObj, arg) ;
+
+    DBC_Require (drvObj != NULL) ;
+
+    pthread_mutex_lock (&DRV_lock) ;
+    if (DRV_object.refCount == 0u) {
+        DRV_object.signature  = SIGN_DRV ;
+        DRV_object.setupCount = 0u ;
+    }
+    DRV_object.refCount++ ;
+    *drvObj = &DRV_object ;
+    pthread_mutex_unlock (&DRV_lock) ;
+
+    TRC_1LEAVE ("DRV_Initialize", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   DRV_Finalize
+ *
+ *  @desc   Finalizes the driver object of the calling process.
+ *
+ *  @modif  DRV_object
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+DRV_Finalize (IN DRV_Object * drvObj, IN OPT Pvoid arg)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_2ENTER ("DRV_Finalize", drvObj, arg) ;
+
+    pthread_mutex_lock (&DRV_lock) ;
+    if (    (drvObj != &DRV_object)
+        ||  (drvObj->signature != SIGN_DRV)
+        ||  (drvObj->refCount == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        drvObj->refCount-- ;
+        if (drvObj->refCount == 0u) {
+            drvObj->signature = SIGN_NULL ;
+        }
+    }
+    pthread_mutex_unlock (&DRV_lock) ;
+
+    TRC_1LEAVE ("DRV_Finalize", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   DRV_Invoke
+ *
+ *  @desc   Executes a command of drvdefs.h.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+DRV_Invoke (IN     DRV_Object * drvObj,
+            IN     Uint32       cmdId,
+            IN OUT Pvoid        arg1,
+            IN OUT Pvoid        arg2)
+{
+    DSP_STATUS status    = DSP_SOK ;
+    DSP_STATUS apiStatus = DSP_SOK ;
+    CMD_Args * args      = (CMD_Args *) arg1 ;
+#if defined (MSGQ_COMPONENT)
+    MSGQ_Msg        msg ;
+    MSGQ_LargeMsg * largeMsg ;
+    Uint32          i ;
+#endif /* if defined (MSGQ_COMPONENT) */
+
+    TRC_3ENTER ("DRV_Invoke", drvObj, cmdId, arg1) ;
+
+    DBC_Require (args != NULL) ;
+
+    (Void) arg2 ;
+
+    if ((drvObj == NULL) || (drvObj->signature != SIGN_DRV)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (   (cmdId != CMD_PROC_SETUP)
+             && (cmdId != CMD_PROC_ISLASTDESTROY)
+             && (LDRV_Obj == NULL)) {
+        args->apiStatus = DSP_ESETUP ;
+    }
+    else {
+        switch (cmdId) {
+        case CMD_PROC_SETUP:
+            apiStatus = DRV_setup (drvObj,
+                                   args->apiArgs.procSetupArgs.linkCfg) ;
+            break ;
+
+        case CMD_PROC_DESTROY:
+            apiStatus = DRV_destroy (drvObj) ;
+            break ;
+
+        case CMD_PROC_ATTACH:
+            apiStatus = LDRV_PROC_attach (args->apiArgs.procAttachArgs.procId,
+                                          args->apiArgs.procAttachArgs.attr) ;
+            break ;
+
+        case CMD_PROC_DETACH:
+            apiStatus = LDRV_PROC_detach (args->apiArgs.procDetachArgs.procId) ;
+            break ;
+
+        case CMD_PROC_LOAD:
+            apiStatus = LDRV_PROC_load (args->apiArgs.procLoadArgs.procId,
+                                        args->apiArgs.procLoadArgs.imagePath,
+                                        args->apiArgs.procLoadArgs.argc,
+                                        args->apiArgs.procLoadArgs.argv) ;
+            break ;
+
+        case CMD_PROC_LOADSECTION:
+            /* The DSP executable is not made of loadable sections. */
+            apiStatus = DSP_ENOTSUPPORTED ;
+            break ;
+
+        case CMD_PROC_START:
+            apiStatus = LDRV_PROC_start (args->apiArgs.procStartArgs.procId) ;
+            break ;
+
+        case CMD_PROC_STOP:
+            apiStatus = LDRV_PROC_stop (args->apiArgs.procStopArgs.procId) ;
+            break ;
+
+        case CMD_PROC_GETSTATE:
+            apiStatus = LDRV_PROC_getState (
+                                  args->apiArgs.procGetStateArgs.procId,
+                                  args->apiArgs.procGetStateArgs.procState) ;
+            break ;
+
+        case CMD_PROC_CONTROL:
+            apiStatus = LDRV_PROC_control (
+                                  args->apiArgs.procControlArgs.procId,
+                                  args->apiArgs.procControlArgs.cmd,
+                                  args->apiArgs.procControlArgs.arg) ;
+            break ;
+
+        case CMD_PROC_READ:
+            apiStatus = LDRV_PROC_read (args->apiArgs.procReadArgs.procId,
+                                        args->apiArgs.procReadArgs.dspAddr,
+                                        args->apiArgs.procReadArgs.numBytes,
+                                        args->apiArgs.procReadArgs.buffer) ;
+            break ;
+
+        case CMD_PROC_WRITE:
+            apiStatus = LDRV_PROC_write (args->apiArgs.procWriteArgs.procId,
+                                         args->apiArgs.procWriteArgs.dspAddr,
+                                         args->apiArgs.procWriteArgs.numBytes,
+                                         args->apiArgs.procWriteArgs.buffer) ;
+            break ;
+
+        case CMD_PROC_GETSYMBOLADDRESS:
+            apiStatus = LDRV_PROC_getSymbolAddress (
+                           args->apiArgs.procGetSymbolAddressArgs.procId,
+                           args->apiArgs.procGetSymbolAddressArgs.symbolName,
+                           args->apiArgs.procGetSymbolAddressArgs.dspAddr) ;
+            break ;
+
+        case CMD_PROC_ISLASTDESTROY:
+            args->apiArgs.procIsLastDestroyArgs.lastDestroy =
+                   (LDRV_Obj == NULL) ? FALSE : LDRV_isLastExit () ;
+            break ;
+
+        case CMD_PROC_ISLASTDETACH:
+            args->apiArgs.procIsLastDetachArgs.lastDetach =
+                 LDRV_PROC_isLastDetach (
+                                    args->apiArgs.procIsLastDetachArgs.procId) ;
+            break ;
+
+        case CMD_PROC_CLEANUP:
+            LDRV_PROC_cleanup () ;
+            break ;
+
+        case CMD_PROC_ADDRTRANSLATE:
+            /* User addresses do not fit in the 32 bits of bufAddr. */
+            apiStatus = DSP_ENOTSUPPORTED ;
+            break ;
+
+#if defined (DDSP_PROFILE)
+        case CMD_PROC_INSTRUMENT:
+            apiStatus = LDRV_PROC_instrument (
+                                  args->apiArgs.procInstrumentArgs.procId,
+                                  args->apiArgs.procInstrumentArgs.procStats) ;
+            break ;
+#endif /* if defined (DDSP_PROFILE) */
+
+#if defined (DDSP_DEBUG)
+        case CMD_PROC_DEBUG:
+            break ;
+#endif /* if defined (DDSP_DEBUG) */
+
+#if defined (CHNL_COMPONENT)
+        case CMD_CHNL_CREATE:
+            apiStatus = LDRV_CHNL_create (args->apiArgs.chnlCreateArgs.procId,
+                                          args->apiArgs.chnlCreateArgs.chnlId,
+                                          args->apiArgs.chnlCreateArgs.attrs) ;
+            break ;
+
+        case CMD_CHNL_DELETE:
+            apiStatus = LDRV_CHNL_delete (args->apiArgs.chnlDeleteArgs.procId,
+                                          args->apiArgs.chnlDeleteArgs.chnlId) ;
+            break ;
+
+        case CMD_CHNL_ISSUE:
+            apiStatus = LDRV_CHNL_issue (args->apiArgs.chnlIssueArgs.procId,
+                                         args->apiArgs.chnlIssueArgs.chnlId,
+                                         args->apiArgs.chnlIssueArgs.ioReq) ;
+            break ;
+
+        case CMD_CHNL_RECLAIM:
+            apiStatus = LDRV_CHNL_reclaim (
+                                       args->apiArgs.chnlReclaimArgs.procId,
+                                       args->apiArgs.chnlReclaimArgs.chnlId,
+                                       args->apiArgs.chnlReclaimArgs.timeout,
+                                       args->apiArgs.chnlReclaimArgs.ioReq) ;
+            break ;
+
+        case CMD_CHNL_ALLOCATEBUFFER:
+            apiStatus = LDRV_CHNL_allocateBuffer (
+                               args->apiArgs.chnlAllocateBufferArgs.procId,
+                               args->apiArgs.chnlAllocateBufferArgs.chnlId,
+                               args->apiArgs.chnlAllocateBufferArgs.bufArray,
+                               args->apiArgs.chnlAllocateBufferArgs.size,
+                               args->apiArgs.chnlAllocateBufferArgs.numBufs) ;
+            break ;
+
+        case CMD_CHNL_FREEBUFFER:
+            apiStatus = LDRV_CHNL_freeBuffer (
+                                   args->apiArgs.chnlFreeBufferArgs.procId,
+                                   args->apiArgs.chnlFreeBufferArgs.chnlId,
+                                   args->apiArgs.chnlFreeBufferArgs.bufArray,
+                                   args->apiArgs.chnlFreeBufferArgs.numBufs) ;
+            break ;
+
+        case CMD_CHNL_IDLE:
+            apiStatus = LDRV_CHNL_idle (args->apiArgs.chnlIdleArgs.procId,
+                                        args->apiArgs.chnlIdleArgs.chnlId) ;
+            break ;
+
+        case CMD_CHNL_FLUSH:
+            apiStatus = LDRV_CHNL_flush (args->apiArgs.chnlFlushArgs.procId,
+                                         args->apiArgs.chnlFlushArgs.chnlId) ;
+            break ;
+
+        case CMD_CHNL_CONTROL:
+            apiStatus = LDRV_CHNL_control (
+                                       args->apiArgs.chnlControlArgs.procId,
+                                       args->apiArgs.chnlControlArgs.chnlId,
+                                       args->apiArgs.chnlControlArgs.cmd,
+                                       args->apiArgs.chnlControlArgs.arg) ;
+            break ;
+
+        case CMD_CHNL_GETPOLLFD:
+            apiStatus = LDRV_CHNL_getPollFd (
+                                       args->apiArgs.chnlGetPollFdArgs.procId,
+                                       args->apiArgs.chnlGetPollFdArgs.chnlId,
+                                       args->apiArgs.chnlGetPollFdArgs.fd) ;
+            break ;
+
+#if defined (DDSP_PROFILE)
+        case CMD_CHNL_INSTRUMENT:
+            apiStatus = LDRV_CHNL_instrument (
+                                  args->apiArgs.chnlInstrumentArgs.procId,
+                                  args->apiArgs.chnlInstrumentArgs.chnlId,
+                                  args->apiArgs.chnlInstrumentArgs.chnlStats) ;
+            break ;
+#endif /* if defined (DDSP_PROFILE) */
+
+#if defined (DDSP_DEBUG)
+        case CMD_CHNL_DEBUG:
+            LDRV_CHNL_debug (args->apiArgs.chnlDebugArgs.procId,
+                             args->apiArgs.chnlDebugArgs.chnlId) ;
+            break ;
+#endif /* if defined (DDSP_DEBUG) */
+
+        case CMD_DRV_GETCHNLMAPTABLE_ADDRESS:
+            /* The channels are not mapped into user space through a table. */
+            apiStatus = DSP_ENOTSUPPORTED ;
+            break ;
+#endif /* if defined (CHNL_COMPONENT) */
+
+#if defined (MSGQ_COMPONENT)
+        case CMD_MSGQ_TRANSPORTOPEN:
+            apiStatus = LDRV_MSGQ_transportOpen (
+                                     args->apiArgs.msgqTransportOpenArgs.procId,
+                                     args->apiArgs.msgqTransportOpenArgs.attrs) ;
+            break ;
+
+        case CMD_MSGQ_TRANSPORTCLOSE:
+            apiStatus = LDRV_MSGQ_transportClose (
+                                  args->apiArgs.msgqTransportCloseArgs.procId) ;
+            break ;
+
+        case CMD_MSGQ_OPEN:
+            apiStatus = LDRV_MSGQ_open (args->apiArgs.msgqOpenArgs.queueName,
+                                        args->apiArgs.msgqOpenArgs.msgqQueue,
+                                        args->apiArgs.msgqOpenArgs.attrs) ;
+            break ;
+
+        case CMD_MSGQ_CLOSE:
+            apiStatus = LDRV_MSGQ_close (args->apiArgs.msgqCloseArgs.msgqQueue) ;
+            break ;
+
+        case CMD_MSGQ_LOCATE:
+            apiStatus = LDRV_MSGQ_locate (
+                                       args->apiArgs.msgqLocateArgs.queueName,
+                                       args->apiArgs.msgqLocateArgs.msgqQueue,
+                                       args->apiArgs.msgqLocateArgs.attrs) ;
+            break ;
+
+        case CMD_MSGQ_LOCATEASYNC:
+            apiStatus = LDRV_MSGQ_locateAsync (
+                                  args->apiArgs.msgqLocateAsyncArgs.queueName,
+                                  args->apiArgs.msgqLocateAsyncArgs.replyQueue,
+                                  args->apiArgs.msgqLocateAsyncArgs.attrs) ;
+            break ;
+
+        case CMD_MSGQ_RELEASE:
+            apiStatus = LDRV_MSGQ_release (
+                                     args->apiArgs.msgqReleaseArgs.msgqQueue) ;
+            break ;
+
+        case CMD_MSGQ_ALLOC:
+            apiStatus = LDRV_MSGQ_alloc (args->apiArgs.msgqAllocArgs.poolId,
+                                         args->apiArgs.msgqAllocArgs.size,
+                                         &msg) ;
+            if (DSP_SUCCEEDED (apiStatus)) {
+                args->apiArgs.msgqAllocArgs.msgAddr = DRV_usrToPhy (msg) ;
+            }
+            break ;
+
+        case CMD_MSGQ_FREE:
+            apiStatus = LDRV_MSGQ_free (args->apiArgs.msgqFreeArgs.msg) ;
+            break ;
+
+        case CMD_MSGQ_PUT:
+            apiStatus = LDRV_MSGQ_put (args->apiArgs.msgqPutArgs.msgqQueue,
+                                       args->apiArgs.msgqPutArgs.msg) ;
+            break ;
+
+        case CMD_MSGQ_GET:
+            apiStatus = LDRV_MSGQ_get (args->apiArgs.msgqGetArgs.msgqQueue,
+                                       args->apiArgs.msgqGetArgs.timeout,
+                                       &msg) ;
+            if (DSP_SUCCEEDED (apiStatus)) {
+                args->apiArgs.msgqGetArgs.poolId  = msg->poolId ;
+                args->apiArgs.msgqGetArgs.msgAddr = DRV_usrToPhy (msg) ;
+            }
+            break ;
+
+        case CMD_MSGQ_PUTV:
+            apiStatus = LDRV_MSGQ_putv (
+                                    args->apiArgs.msgqPutvArgs.msgqQueue,
+                                    args->apiArgs.msgqPutvArgs.msgArray,
+                                    args->apiArgs.msgqPutvArgs.numMsgs,
+                                    &(args->apiArgs.msgqPutvArgs.numPut)) ;
+            break ;
+
+        case CMD_MSGQ_GETV:
+            apiStatus = LDRV_MSGQ_getv (
+                                    args->apiArgs.msgqGetvArgs.msgqQueue,
+                                    args->apiArgs.msgqGetvArgs.timeout,
+                                    args->apiArgs.msgqGetvArgs.msgArray,
+                                    args->apiArgs.msgqGetvArgs.maxMsgs,
+                                    &(args->apiArgs.msgqGetvArgs.numMsgs)) ;
+            for (i = 0u ; i < args->apiArgs.msgqGetvArgs.numMsgs ; i++) {
+                msg = args->apiArgs.msgqGetvArgs.msgArray [i] ;
+                args->apiArgs.msgqGetvArgs.msgArray [i] =
+                                    DRV_ADDR_TO_PTR (DRV_usrToPhy (msg)) ;
+            }
+            break ;
+
+        case CMD_MSGQ_SETERRORHANDLER:
+            apiStatus = LDRV_MSGQ_setErrorHandler (
+                                  args->apiArgs.msgqSetErrorHandlerArgs.errorQueue,
+                                  args->apiArgs.msgqSetErrorHandlerArgs.poolId) ;
+            break ;
+
+        case CMD_MSGQ_COUNT:
+            apiStatus = LDRV_MSGQ_count (args->apiArgs.msgqCountArgs.msgqQueue,
+                                         args->apiArgs.msgqCountArgs.count) ;
+            break ;
+
+        case CMD_MSGQ_COUNTLANE:
+            apiStatus = LDRV_MSGQ_countLane (
+                                  args->apiArgs.msgqCountLaneArgs.msgqQueue,
+                                  args->apiArgs.msgqCountLaneArgs.lane,
+                                  args->apiArgs.msgqCountLaneArgs.count) ;
+            break ;
+
+        case CMD_MSGQ_ALLOCLARGE:
+            largeMsg  = args->apiArgs.msgqAllocLargeArgs.largeMsg ;
+            apiStatus = LDRV_MSGQ_allocLarge (
+                                  args->apiArgs.msgqAllocLargeArgs.poolId,
+                                  args->apiArgs.msgqAllocLargeArgs.size,
+                                  args->apiArgs.msgqAllocLargeArgs.fragSize,
+                                  largeMsg) ;
+            DRV_largeToPhy (largeMsg) ;
+            break ;
+
+        case CMD_MSGQ_FREELARGE:
+            apiStatus = LDRV_MSGQ_freeLarge (
+                                  args->apiArgs.msgqFreeLargeArgs.largeMsg) ;
+            break ;
+
+        case CMD_MSGQ_PUTLARGE:
+            apiStatus = LDRV_MSGQ_putLarge (
+                                  args->apiArgs.msgqPutLargeArgs.msgqQueue,
+                                  args->apiArgs.msgqPutLargeArgs.largeMsg) ;
+            break ;
+
+        case CMD_MSGQ_GETLARGE:
+            largeMsg  = args->apiArgs.msgqGetLargeArgs.largeMsg ;
+            apiStatus = LDRV_MSGQ_getLarge (
+                                  args->apiArgs.msgqGetLargeArgs.msgqQueue,
+                                  args->apiArgs.msgqGetLargeArgs.timeout,
+                                  largeMsg) ;
+            DRV_largeToPhy (largeMsg) ;
+            break ;
+
+        case CMD_MSGQ_GETPOLLFD:
+            apiStatus = LDRV_MSGQ_getPollFd (
+                                  args->apiArgs.msgqGetPollFdArgs.msgqQueue,
+                                  args->apiArgs.msgqGetPollFdArgs.fd) ;
+            break ;
+
+#if defined (DDSP_PROFILE)
+        case CMD_MSGQ_INSTRUMENT:
+            apiStatus = LDRV_MSGQ_instrument (
+                                  args->apiArgs.msgqInstrumentArgs.msgqQueue,
+                                  args->apiArgs.msgqInstrumentArgs.retVal) ;
+            break ;
+#endif /* if defined (DDSP_PROFILE) */
+
+#if defined (DDSP_DEBUG)
+        case CMD_MSGQ_DEBUG:
+            LDRV_MSGQ_debug (args->apiArgs.msgqDebugArgs.msgqQueue) ;
+            break ;
+#endif /* if defined (DDSP_DEBUG) */
+#endif /* if defined (MSGQ_COMPONENT) */
+
+#if defined (POOL_COMPONENT)
+        case CMD_POOL_OPEN:
+            apiStatus = LDRV_POOL_open (
+                        args->apiArgs.poolOpenArgs.poolId,
+                        (POOL_OpenParams *) args->apiArgs.poolOpenArgs.params) ;
+            break ;
+
+        case CMD_POOL_CLOSE:
+            apiStatus = LDRV_POOL_close (args->apiArgs.poolCloseArgs.poolId) ;
+            break ;
+
+        case CMD_POOL_ALLOC:
+            apiStatus = LDRV_POOL_alloc (args->apiArgs.poolAllocArgs.poolId,
+                                         args->apiArgs.poolAllocArgs.bufPtr,
+                                         args->apiArgs.poolAllocArgs.size) ;
+            break ;
+
+        case CMD_POOL_FREE:
+            apiStatus = LDRV_POOL_free (args->apiArgs.poolFreeArgs.poolId,
+                                        args->apiArgs.poolFreeArgs.bufPtr,
+                                        args->apiArgs.poolFreeArgs.size) ;
+            break ;
+
+        case CMD_POOL_TRANSLATEADDR:
+            apiStatus = LDRV_POOL_translateAddr (
+                              args->apiArgs.poolTranslateAddrArgs.poolId,
+                              args->apiArgs.poolTranslateAddrArgs.dstAddr,
+                              args->apiArgs.poolTranslateAddrArgs.dstAddrType,
+                              args->apiArgs.poolTranslateAddrArgs.srcAddr,
+                              args->apiArgs.poolTranslateAddrArgs.srcAddrType) ;
+            break ;
+
+        case CMD_POOL_WRITEBACK:
+            apiStatus = LDRV_POOL_writeback (args->apiArgs.poolWBArgs.poolId,
+                                             args->apiArgs.poolWBArgs.bufPtr,
+                                             args->apiArgs.poolWBArgs.size) ;
+            break ;
+
+        case CMD_POOL_INVALIDATE:
+            apiStatus = LDRV_POOL_invalidate (args->apiArgs.poolInvArgs.poolId,
+                                              args->apiArgs.poolInvArgs.bufPtr,
+                                              args->apiArgs.poolInvArgs.size) ;
+            break ;
+
+        case CMD_POOL_RECONFIGURE:
+            apiStatus = LDRV_POOL_reconfigure (
+                                    args->apiArgs.poolReconfigureArgs.poolId,
+                                    args->apiArgs.poolReconfigureArgs.args) ;
+            break ;
+
+        case CMD_POOL_CACHEV:
+            apiStatus = LDRV_POOL_cachev (
+                                    args->apiArgs.poolCacheVArgs.poolId,
+                                    args->apiArgs.poolCacheVArgs.op,
+                                    args->apiArgs.poolCacheVArgs.ranges,
+                                    args->apiArgs.poolCacheVArgs.numRanges) ;
+            break ;
+
+        case CMD_POOL_GETOWNERS:
+            apiStatus = LDRV_POOL_getOwners (
+                                    args->apiArgs.poolGetOwnersArgs.poolId,
+                                    args->apiArgs.poolGetOwnersArgs.stats,
+                                    args->apiArgs.poolGetOwnersArgs.owners,
+                                    args->apiArgs.poolGetOwnersArgs.numOwners) ;
+            break ;
+
+#if defined (DDSP_PROFILE)
+        case CMD_POOL_INSTRUMENT:
+            apiStatus = LDRV_POOL_instrument (
+                                    args->apiArgs.poolInstrumentArgs.poolId,
+                                    args->apiArgs.poolInstrumentArgs.retVal) ;
+            break ;
+#endif /* if defined (DDSP_PROFILE) */
+#endif /* if defined (POOL_COMPONENT) */
+
+#if defined (MPCS_COMPONENT)
+        case CMD_MPCS_MAPREGION:
+            apiStatus = LDRV_MPCS_mapRegion (
+                                     &args->apiArgs.mpcsMapArgs.mpcsRegionArgs) ;
+            break ;
+
+        case CMD_MPCS_UNMAPREGION:
+            apiStatus = LDRV_MPCS_unmapRegion (
+                                     &args->apiArgs.mpcsMapArgs.mpcsRegionArgs) ;
+            break ;
+#endif /* if defined (MPCS_COMPONENT) */
+
+#if defined (RINGIO_COMPONENT)
+        case CMD_RINGIO_MAPREGION:
+            apiStatus = LDRV_RINGIO_mapRegion (
+                                    &args->apiArgs.ringIoArgs.ringioRegionArgs) ;
+            break ;
+
+        case CMD_RINGIO_UNMAPREGION:
+            apiStatus = LDRV_RINGIO_unmapRegion (
+                                    &args->apiArgs.ringIoArgs.ringioRegionArgs) ;
+            break ;
+#endif /* if defined (RINGIO_COMPONENT) */
+
+#if defined (MPLIST_COMPONENT)
+        case CMD_MPLIST_MAPREGION:
+            apiStatus = LDRV_MPLIST_mapRegion (
+                                    &args->apiArgs.mplistArgs.mplistRegionArgs) ;
+            break ;
+
+        case CMD_MPLIST_UNMAPREGION:
+            apiStatus = LDRV_MPLIST_unmapRegion (
+                                    &args->apiArgs.mplistArgs.mplistRegionArgs) ;
+            break ;
+#endif /* if defined (MPLIST_COMPONENT) */
+
+#if defined (NOTIFY_COMPONENT)
+        case CMD_NOTIFY_INITIALIZE:
+            if (!IS_VALID_PROCID (args->apiArgs.notifyInitializeArgs.dspId)) {
+                apiStatus = DSP_EINVALIDARG ;
+            }
+            break ;
+
+        case CMD_NOTIFY_FINALIZE:
+            if (!IS_VALID_PROCID (args->apiArgs.notifyFinalizeArgs.dspId)) {
+                apiStatus = DSP_EINVALIDARG ;
+            }
+            break ;
+
+        case CMD_NOTIFY_REGISTER:
+            apiStatus = LDRV_IPS_userRegister (
+                  args->apiArgs.notifyRegisterArgs.dspId,
+                  args->apiArgs.notifyRegisterArgs.ipsId,
+                  args->apiArgs.notifyRegisterArgs.eventNo,
+                  (FnNotifyCbck) args->apiArgs.notifyRegisterArgs.fnNotifyCbck,
+                  args->apiArgs.notifyRegisterArgs.cbckArg) ;
+            break ;
+
+        case CMD_NOTIFY_UNREGISTER:
+            apiStatus = LDRV_IPS_userUnregister (
+                args->apiArgs.notifyUnregisterArgs.dspId,
+                args->apiArgs.notifyUnregisterArgs.ipsId,
+                args->apiArgs.notifyUnregisterArgs.eventNo,
+                (FnNotifyCbck) args->apiArgs.notifyUnregisterArgs.fnNotifyCbck,
+                args->apiArgs.notifyUnregisterArgs.cbckArg) ;
+            break ;
+
+        case CMD_NOTIFY_NOTIFY:
+            apiStatus = LDRV_IPS_notify (args->apiArgs.notifyNotifyArgs.dspId,
+                                         args->apiArgs.notifyNotifyArgs.ipsId,
+                                         args->apiArgs.notifyNotifyArgs.eventNo,
+                                         args->apiArgs.notifyNotifyArgs.payload) ;
+            break ;
+#endif /* if defined (NOTIFY_COMPONENT) */
+
+#if defined (DDSP_PROFILE)
+        case CMD_NOTIFY_INSTRUMENT:
+            apiStatus = LDRV_IPS_instrument (
+                                    args->apiArgs.ipsInstrumentArgs.dspId,
+                                    args->apiArgs.ipsInstrumentArgs.ipsId,
+                                    args->apiArgs.ipsInstrumentArgs.ipsStats) ;
+            break ;
+#endif /* if defined (DDSP_PROFILE) */
+
+        case CMD_IDM_INIT:
+        case CMD_IDM_EXIT:
+            break ;
+
+        case CMD_IDM_CREATE:
+            apiStatus = LDRV_IDM_create (args->apiArgs.idmCreateArgs.key,
+                                         args->apiArgs.idmCreateArgs.attrs) ;
+            break ;
+
+        case CMD_IDM_DELETE:
+            apiStatus = LDRV_IDM_delete (args->apiArgs.idmDeleteArgs.key) ;
+            break ;
+
+        case CMD_IDM_ACQUIREID:
+            apiStatus = LDRV_IDM_acquireId (
+                                         args->apiArgs.idmAcquireIdArgs.key,
+                                         args->apiArgs.idmAcquireIdArgs.idKey,
+                                         args->apiArgs.idmAcquireIdArgs.id) ;
+            break ;
+
+        case CMD_IDM_RELEASEID:
+            apiStatus = LDRV_IDM_releaseId (
+                                          args->apiArgs.idmReleaseIdArgs.key,
+                                          args->apiArgs.idmReleaseIdArgs.id) ;
+            break ;
+
+        default:
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+            break ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            args->apiStatus = apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("DRV_Invoke", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   DRV_phyToUsr
+ *
+ *  @desc   Translates a physical address of the memory shared with a DSP to
+ *          an address in the calling process.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Pvoid
+DRV_phyToUsr (IN Uint32 physAddr)
+{
+    Pvoid       usrAddr = NULL ;
+    ProcessorId dspId ;
+
+    for (dspId = 0u ; (dspId < MAX_DSPS) && (usrAddr == NULL) ; dspId++) {
+        usrAddr = LDRV_phyToUsr (dspId, physAddr) ;
+    }
+
+    return usrAddr ;
+}
+
+
+/** ============================================================================
+ *  @func   DRV_usrToPhy
+ *
+ *  @desc   Translates an address in the calling process to a physical
+ *          address of the memory shared with a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+DRV_usrToPhy (IN Pvoid usrAddr)
+{
+    Uint32      physAddr = LDRV_INVALID_ADDR ;
+    ProcessorId dspId ;
+
+    for (dspId = 0u ;
+         (dspId < MAX_DSPS) && (physAddr == LDRV_INVALID_ADDR) ;
+         dspId++) {
+        physAddr = LDRV_usrToPhy (dspId, usrAddr) ;
+    }
+
+    return (physAddr == LDRV_INVALID_ADDR) ? 0u : physAddr ;
+}
+
+
+/** ============================================================================
+ *  @func   DRV_pageSize
+ *
+ *  @desc   Gets the size of the GPP pages backing a physical address of the
+ *          memory shared with a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+DRV_pageSize (IN Uint32 physAddr)
+{
+    Uint32      pageSize = 0u ;
+    ProcessorId dspId ;
+
+    for (dspId = 0u ; (dspId < MAX_DSPS) && (pageSize == 0u) ; dspId++) {
+        pageSize = LDRV_pageSize (dspId, physAddr) ;
+    }
+
+    return pageSize ;
+}
+
+
+/** ============================================================================
+ *  @func   DRV_mapMirror
+ *
+ *  @desc   Maps a range of the memory shared with a DSP twice back-to-back in
+ *          the calling process.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+DRV_mapMirror (IN Uint32 physAddr, IN Uint32 size, OUT Pvoid * mirror)
+{
+    DSP_STATUS  status = DSP_EINVALIDARG ;
+    ProcessorId dspId ;
+
+    *mirror = NULL ;
+    for (dspId = 0u ; (dspId < MAX_DSPS) && (*mirror == NULL) ; dspId++) {
+        if (LDRV_pageSize (dspId, physAddr) != 0u) {
+            status = LDRV_mapMirror (dspId, physAddr, size, mirror) ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   DRV_unmapMirror
+ *
+ *  @desc   Unmaps a range mapped by DRV_mapMirror.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+DRV_unmapMirror (IN Pvoid mirror, IN Uint32 size)
+{
+    LDRV_unmapMirror (mirror, size) ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,351 @@
+/** ============================================================================
+ *  @file   drv_api.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the driver interface of the host backend. The commands of
+ *          drvdefs.h are executed directly in the calling process, on the
+ *          state shared by all the processes through the driver segment.
+ *          Address fields of CMD_Args that are only 32 bits wide carry
+ *          physical addresses, translated by the user side with
+ *          DRV_phyToUsr.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (DRV_API_H)
+#define DRV_API_H
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <pthread.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <linkcfgdefs.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @macro  DRV_ADDR_TO_PTR
+ *
+ *  @desc   Stores a physical address in a pointer field of a structure shared
+ *          with the DSP.
+ *  ============================================================================
+ */
+#define DRV_ADDR_TO_PTR(addr)   ((Pvoid) (unsigned long) (Uint32) (addr))
+
+/** ============================================================================
+ *  @macro  DRV_PTR_TO_ADDR
+ *
+ *  @desc   Retrieves a physical address stored in a pointer field of a
+ *          structure shared with the DSP.
+ *  ============================================================================
+ */
+#define DRV_PTR_TO_ADDR(ptr)    ((Uint32) (unsigned long) (ptr))
+
+
+/** ============================================================================
+ *  @name   DRV_Object
+ *
+ *  @desc   Driver object of the calling process.
+ *
+ *  @field  signature
+ *              Signature of the object.
+ *  @field  refCount
+ *              Number of DRV_Initialize calls not finalized yet.
+ *  @field  setupCount
+ *              Number of successful CMD_PROC_SETUP not destroyed yet.
+ *  @field  notifyThread
+ *              Thread dispatching the NOTIFY callbacks of the process.
+ *  ============================================================================
+ */
+typedef struct DRV_Object_tag {
+    Uint32      signature    ;
+    Uint32      refCount     ;
+    Uint32      setupCount   ;
+    pthread_t   notifyThread ;
+} DRV_Object ;
+
+
+/** ============================================================================
+ *  @name   DRV_handle
+ *
+ *  @desc   Driver object of the calling process, NULL if not initialized.
+ *  ============================================================================
+ */
+extern DRV_Object * DRV_handle ;
+
+/** ============================================================================
+ *  @name   LINKCFG_config
+ *
+ *  @desc   Default configuration of the host backend, used by PROC_setup
+ *          when no configuration is specified.
+ *  ============================================================================
+ */
+extern LINKCFG_Object LINKCFG_config ;
+
+
+/** ============================================================================
+ *  @func   DRV_Initialize
+ *
+ *  @desc   Initializes the driver object of the calling process.
+ *
+ *  @arg    drvObj
+ *              Location to receive the driver object.
+ *  @arg    arg
+ *              Reserved.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  drvObj must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_Finalize
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+DRV_Initialize (OUT DRV_Object ** drvObj, IN OPT Pvoid arg) ;
+
+
+/** ============================================================================
+ *  @func   DRV_Finalize
+ *
+ *  @desc   Finalizes the driver object of the calling process.
+ *
+ *  @arg    drvObj
+ *              Driver object.
+ *  @arg    arg
+ *              Reserved.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid driver object.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_Initialize
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+DRV_Finalize (IN DRV_Object * drvObj, IN OPT Pvoid arg) ;
+
+
+/** ============================================================================
+ *  @func   DRV_Invoke
+ *
+ *  @desc   Executes a command of drvdefs.h.
+ *
+ *  @arg    drvObj
+ *              Driver object.
+ *  @arg    cmdId
+ *              Command identifier.
+ *  @arg    arg1
+ *              Arguments of the command (CMD_Args). The status of the command
+ *              is returned in its apiStatus field.
+ *  @arg    arg2
+ *              Reserved.
+ *
+ *  @ret    DSP_SOK
+ *              The command has been executed.
+ *          DSP_EINVALIDARG
+ *              Invalid driver object or unknown command.
+ *
+ *  @enter  arg1 must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+DRV_Invoke (IN     DRV_Object * drvObj,
+            IN     Uint32       cmdId,
+            IN OUT Pvoid        arg1,
+            IN OUT Pvoid        arg2) ;
+
+
+/** ============================================================================
+ *  @func   DRV_phyToUsr
+ *
+ *  @desc   Translates a physical address of the memory shared with a DSP to
+ *          an address in the calling process.
+ *
+ *  @arg    physAddr
+ *              Physical address.
+ *
+ *  @ret    Address in the calling process, NULL if the address is not
+ *          mapped.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_usrToPhy
+ *  ============================================================================
+ */
+EXPORT_API
+Pvoid
+DRV_phyToUsr (IN Uint32 physAddr) ;
+
+
+/** ============================================================================
+ *  @func   DRV_usrToPhy
+ *
+ *  @desc   Translates an address in the calling process to a physical
+ *          address of the memory shared with a DSP.
+ *
+ *  @arg    usrAddr
+ *              Address in the calling process.
+ *
+ *  @ret    Physical address, 0 if the address is not in shared memory.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_phyToUsr
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+DRV_usrToPhy (IN Pvoid usrAddr) ;
+
+
+/** ============================================================================
+ *  @func   DRV_pageSize
+ *
+ *  @desc   Gets the size of the GPP pages backing a physical address of the
+ *          memory shared with a DSP.
+ *
+ *  @arg    physAddr
+ *              Physical address.
+ *
+ *  @ret    Size of the pages, 0 if the address is not mapped.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_mapMirror
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+DRV_pageSize (IN Uint32 physAddr) ;
+
+
+/** ============================================================================
+ *  @func   DRV_mapMirror
+ *
+ *  @desc   Maps a range of the memory shared with a DSP twice back-to-back in
+ *          the calling process.
+ *
+ *  @arg    physAddr
+ *              Physical address of the range.
+ *  @arg    size
+ *              Size of the range.
+ *  @arg    mirror
+ *              Location to receive the address of the first mapping.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The range is not in shared memory, or its address or size is
+ *              not a multiple of the size of the pages backing it.
+ *          DSP_EMEMORY
+ *              The range cannot be mapped.
+ *
+ *  @enter  mirror must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_unmapMirror, DRV_pageSize
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+DRV_mapMirror (IN Uint32 physAddr, IN Uint32 size, OUT Pvoid * mirror) ;
+
+
+/** ============================================================================
+ *  @func   DRV_unmapMirror
+ *
+ *  @desc   Unmaps a range mapped by DRV_mapMirror.
+ *
+ *  @arg    mirror
+ *              Address of the first mapping.
+ *  @arg    size
+ *              Size of the range.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_mapMirror
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+DRV_unmapMirror (IN Pvoid mirror, IN Uint32 size) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (DRV_API_H) */
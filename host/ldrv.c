@@ -0,0 +1,1557 @@
+/** ============================================================================
+ *  @file   ldrv.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the link driver core of the host loopback
+ *          backend: shared memory segments, process table, configuration and
+ *          address translation.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <errno.h>
+#include <fcntl.h>
+#include <mntent.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <_signature.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_proc.h>
+#include <ldrv_ips.h>
+#include <ldrv_pool.h>
+#include <ldrv_msgq.h>
+#include <ldrv_chnl.h>
+#include <ldrv_mpcs.h>
+#include <ldrv_ringio.h>
+#include <ldrv_mplist.h>
+#include <ldrv_idm.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @const  LDRV_SHM_NAMELEN
+ *
+ *  @desc   Maximum length of the name of a shared memory object.
+ *  ============================================================================
+ */
+#define LDRV_SHM_NAMELEN        (DSP_MAX_STRLEN * 3u)
+
+/*  ============================================================================
+ *  @const  LDRV_HEAP_ALIGN
+ *
+ *  @desc   Alignment of the allocations in the driver segment and the link
+ *          driver memory entry.
+ *  ============================================================================
+ */
+#define LDRV_HEAP_ALIGN         DSPLINK_BUF_ALIGN
+
+/*  ============================================================================
+ *  @const  LDRV_HUGE_PATHLEN
+ *
+ *  @desc   Maximum length of the path of a file on a hugetlbfs mount.
+ *  ============================================================================
+ */
+#define LDRV_HUGE_PATHLEN       256u
+
+/*  ============================================================================
+ *  @const  LDRV_HUGETLBFS_MAGIC
+ *
+ *  @desc   File system type reported by statfs for hugetlbfs.
+ *  ============================================================================
+ */
+#define LDRV_HUGETLBFS_MAGIC    0x958458f6u
+
+/*  ============================================================================
+ *  @macro  LDRV_MAPSIZE
+ *
+ *  @desc   Size of the mapping of a memory entry, whole pages of the size
+ *          backing it.
+ *  ============================================================================
+ */
+#define LDRV_MAPSIZE(entry)     (  ((entry)->size + (entry)->pageSize - 1u)    \
+                                 & ~((entry)->pageSize - 1u))
+
+
+/*  ============================================================================
+ *  @name   LDRV_ProcessState
+ *
+ *  @desc   Process-local state of the link driver core.
+ *
+ *  @field  refCount
+ *              Number of LDRV_init calls made by the process.
+ *  @field  drvFd
+ *              File descriptor of the driver segment.
+ *  @field  slot
+ *              Index of the process in the process table.
+ *  @field  mapBase
+ *              Range reserved for the memory entries, NULL if none.
+ *  @field  memBase
+ *              Mapping of every memory entry of every DSP.
+ *  ============================================================================
+ */
+typedef struct LDRV_ProcessState_tag {
+    Uint32  refCount ;
+    int     drvFd ;
+    Uint32  slot ;
+    Uint8 * mapBase ;
+    Uint8 * memBase [MAX_DSPS][LDRV_MAX_MEMENTRIES] ;
+} LDRV_ProcessState ;
+
+
+/** ============================================================================
+ *  @name   LDRV_Obj
+ *
+ *  @desc   Mapping of the driver segment in the calling process.
+ *  ============================================================================
+ */
+LDRV_Object * LDRV_Obj = NULL ;
+
+/*  ============================================================================
+ *  @name   LDRV_procState
+ *
+ *  @desc   Process-local state of the link driver core.
+ *  ============================================================================
+ */
+STATIC LDRV_ProcessState LDRV_procState = { 0u, -1, 0u, NULL, { { NULL } } } ;
+
+
+/*  ============================================================================
+ *  @func   LDRV_shmName
+ *
+ *  @desc   Builds the name of a shared memory object.
+ *
+ *  @arg    name
+ *              Buffer to receive the name.
+ *  @arg    dspId
+ *              DSP identifier, ignored if entryName is NULL.
+ *  @arg    entryName
+ *              Name of the memory entry, NULL for the driver segment.
+ *
+ *  @ret    None
+ *
+ *  @enter  name must be LDRV_SHM_NAMELEN bytes long.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_shmName (OUT Char8 *     name,
+              IN  ProcessorId dspId,
+              IN  Char8 *     entryName)
+{
+    const char * prefix = getenv (LDRV_SHM_PREFIX_ENV) ;
+
+    if ((prefix == NULL) || (prefix [0] == '\0')) {
+        prefix = LDRV_SHM_PREFIX_DEFAULT ;
+    }
+
+    if (entryName == NULL) {
+        snprintf (name, LDRV_SHM_NAMELEN, "/%s.drv", prefix) ;
+    }
+    else {
+        snprintf (name, LDRV_SHM_NAMELEN, "/%s.dsp%u.%s",
+                  prefix, (unsigned) dspId, entryName) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_mapSegment
+ *
+ *  @desc   Opens (and optionally creates) a shared memory object and maps it
+ *          into the calling process at a given address.
+ *
+ *  @arg    name
+ *              Name of the shared memory object.
+ *  @arg    addr
+ *              Address of the mapping, in the range reserved by
+ *              LDRV_reserveMap.
+ *  @arg    size
+ *              Size of the object.
+ *  @arg    create
+ *              TRUE to (re-)create the object.
+ *  @arg    huge
+ *              TRUE if name is the path of a file on a hugetlbfs mount rather
+ *              than the name of a shared memory object.
+ *  @arg    fd
+ *              Location to receive the file descriptor, NULL to close it.
+ *
+ *  @ret    Mapping of the object, NULL on failure.
+ *
+ *  @enter  name must be valid.
+ *          addr and size must be multiples of the page size of a hugetlbfs
+ *          file.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_hugePath, LDRV_reserveMap
+ *  ============================================================================
+ */
+STATIC
+Uint8 *
+LDRV_mapSegment (IN      Char8 *  name,
+                 IN      Uint8 *  addr,
+                 IN      Uint32   size,
+                 IN      Bool     create,
+                 IN      Bool     huge,
+                 OUT OPT int *    fd)
+{
+    Uint8 * seg   = NULL ;
+    int     segFd ;
+    Pvoid   map ;
+
+    if (create == TRUE) {
+        if (huge == TRUE) {
+            unlink (name) ;
+            segFd = open (name, O_RDWR | O_CREAT | O_EXCL, 0600) ;
+        }
+        else {
+            shm_unlink (name) ;
+            segFd = shm_open (name, O_RDWR | O_CREAT | O_EXCL, 0600) ;
+        }
+        if ((segFd >= 0) && (ftruncate (segFd, (off_t) size) != 0)) {
+            close (segFd) ;
+            segFd = -1 ;
+        }
+    }
+    else if (huge == TRUE) {
+        segFd = open (name, O_RDWR, 0600) ;
+    }
+    else {
+        segFd = shm_open (name, O_RDWR, 0600) ;
+    }
+
+    if (segFd >= 0) {
+        map = mmap (addr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+                    segFd, 0) ;
+        if (map != MAP_FAILED) {
+            seg = (Uint8 *) map ;
+        }
+
+        if ((fd != NULL) && (seg != NULL)) {
+            *fd = segFd ;
+        }
+        else {
+            close (segFd) ;
+        }
+    }
+
+    /*  Huge pages are reserved by mmap, which fails when too few are left.
+     *  Do not leave the file behind in that case.
+     */
+    if ((seg == NULL) && (create == TRUE)) {
+        if (huge == TRUE) {
+            unlink (name) ;
+        }
+        else {
+            shm_unlink (name) ;
+        }
+    }
+
+    return seg ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_hugePath
+ *
+ *  @desc   Builds the path of the file backing a memory entry with huge
+ *          pages, on the hugetlbfs mount named by LDRV_HUGETLBFS_ENV or else
+ *          on the first mount listed in /proc/mounts with the page size
+ *          requested.
+ *
+ *  @arg    path
+ *              Buffer to receive the path.
+ *  @arg    pageSize
+ *              Size of the huge pages.
+ *  @arg    name
+ *              Name of the shared memory object of the memory entry.
+ *
+ *  @ret    TRUE if a hugetlbfs mount of that page size was found.
+ *
+ *  @enter  path must be LDRV_HUGE_PATHLEN bytes long.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_mapMemEntries
+ *  ============================================================================
+ */
+STATIC
+Bool
+LDRV_hugePath (OUT Char8 * path, IN Uint32 pageSize, IN Char8 * name)
+{
+    Bool            found  = FALSE ;
+    const char *    dir    = getenv (LDRV_HUGETLBFS_ENV) ;
+    FILE *          mounts = NULL ;
+    struct mntent * mnt ;
+    struct statfs   fs ;
+
+    if ((dir != NULL) && (dir [0] != '\0')) {
+        found = (    (statfs (dir, &fs) == 0)
+                 &&  ((Uint32) fs.f_type == LDRV_HUGETLBFS_MAGIC)
+                 &&  (fs.f_bsize == (long) pageSize)) ;
+    }
+    else {
+        mounts = setmntent ("/proc/mounts", "r") ;
+        while (    (mounts != NULL)
+               &&  (found == FALSE)
+               &&  ((mnt = getmntent (mounts)) != NULL)) {
+            dir   = mnt->mnt_dir ;
+            found = (    (strcmp (mnt->mnt_type, "hugetlbfs") == 0)
+                     &&  (statfs (dir, &fs) == 0)
+                     &&  (fs.f_bsize == (long) pageSize)) ;
+        }
+    }
+
+    if (found == TRUE) {
+        found = (   snprintf (path, LDRV_HUGE_PATHLEN, "%s%s", dir, name)
+                 <  (int) LDRV_HUGE_PATHLEN) ;
+    }
+
+    if (mounts != NULL) {
+        endmntent (mounts) ;
+    }
+
+    return found ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_copyConfig
+ *
+ *  @desc   Copies the configuration into the driver segment.
+ *
+ *  @arg    linkCfg
+ *              Configuration to be copied.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ECONFIG
+ *              The configuration exceeds the backend limits.
+ *
+ *  @enter  LDRV_Obj must be mapped.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LDRV_copyConfig (IN LINKCFG_Object * linkCfg)
+{
+    DSP_STATUS          status = DSP_SOK ;
+    LINKCFG_DspConfig * dspCfg ;
+    LINKCFG_LinkDrv *   linkDrv ;
+    LDRV_DspConfig *    cfg ;
+    ProcessorId         dspId ;
+    Uint32              i ;
+
+    LDRV_Obj->gppObject             = *(linkCfg->gppObject) ;
+    LDRV_Obj->gppObject.gppOsObject = NULL ;
+
+    for (dspId = 0u ; (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ; dspId++) {
+        dspCfg  = linkCfg->dspConfigs [dspId] ;
+        cfg     = &(LDRV_Obj->dspConfig [dspId]) ;
+        linkDrv = &(dspCfg->linkDrvObjects [dspCfg->dspObject->linkDrvId]) ;
+
+        if (    (dspCfg->dspObject->memEntries > LDRV_MAX_MEMENTRIES)
+            ||  (linkDrv->numIpsEntries > LDRV_MAX_IPSENTRIES)
+            ||  (linkDrv->numPools > MAX_POOLENTRIES)
+            ||  (linkDrv->numDataDrivers > LDRV_MAX_DATADRIVERS)) {
+            status = DSP_ECONFIG ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            cfg->dspObject      = *(dspCfg->dspObject) ;
+            cfg->linkDrv        = *linkDrv ;
+            cfg->numMemEntries  = dspCfg->dspObject->memEntries ;
+            for (i = 0u ; i < cfg->numMemEntries ; i++) {
+                cfg->memTable [i] =
+                   dspCfg->memTables [dspCfg->dspObject->memTableId][i] ;
+            }
+            cfg->numIpsEntries  = linkDrv->numIpsEntries ;
+            for (i = 0u ; i < cfg->numIpsEntries ; i++) {
+                cfg->ipsTable [i] = dspCfg->ipsTables [linkDrv->ipsTableId][i] ;
+            }
+            cfg->numPools       = linkDrv->numPools ;
+            for (i = 0u ; i < cfg->numPools ; i++) {
+                cfg->poolTable [i] =
+                                 dspCfg->poolTables [linkDrv->poolTableId][i] ;
+            }
+            cfg->numDataDrivers = linkDrv->numDataDrivers ;
+            for (i = 0u ; i < cfg->numDataDrivers ; i++) {
+                cfg->dataTable [i] =
+                                 dspCfg->dataTables [linkDrv->dataTableId][i] ;
+            }
+            cfg->mqtObject    = dspCfg->mqtObjects    [linkDrv->mqtId] ;
+            cfg->ringIoObject = dspCfg->ringIoObjects [linkDrv->ringIoTableId] ;
+            cfg->mplistObject = dspCfg->mplistObjects [linkDrv->mplistTableId] ;
+            cfg->mpcsObject   = dspCfg->mpcsObjects   [linkDrv->mpcsTableId] ;
+        }
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_reserveMap
+ *
+ *  @desc   Reserves the range of addresses holding the memory entries of
+ *          every DSP. The creator lays the entries out, each aligned to the
+ *          size of the pages it requests, and reserves the range where
+ *          LDRV_MAP_BASE_ENV asks or else where the kernel chooses. The
+ *          other processes reserve it at the same address, so that the
+ *          entries, and the buffers in them, have the same address in
+ *          every process.
+ *
+ *  @arg    create
+ *              TRUE to lay the entries out.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The range could not be reserved, or not at the address used
+ *              by the other processes.
+ *
+ *  @enter  LDRV_Obj must be mapped and hold the configuration.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_mapMemEntries
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LDRV_reserveMap (IN Bool create)
+{
+    DSP_STATUS         status   = DSP_SOK ;
+    Uint32             basePage = (Uint32) sysconf (_SC_PAGESIZE) ;
+    Uint32             align    = basePage ;
+    Uint32             offset   = 0u ;
+    Uint8 *            hint     = NULL ;
+    Uint8 *            base     = NULL ;
+    const char *       env ;
+    LDRV_DspConfig *   cfg ;
+    LINKCFG_MemEntry * entry ;
+    ProcessorId        dspId ;
+    Uint32             i ;
+    size_t             span ;
+    Uint8 *            map ;
+
+    if (create == TRUE) {
+        for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+            cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+            for (i = 0u ; i < cfg->numMemEntries ; i++) {
+                entry = &(cfg->memTable [i]) ;
+                if (entry->pageSize <= basePage) {
+                    entry->pageSize = basePage ;
+                }
+                if (entry->pageSize > align) {
+                    align = entry->pageSize ;
+                }
+                offset = (offset + entry->pageSize - 1u)
+                       & ~(entry->pageSize - 1u) ;
+                LDRV_Obj->mapOffset [dspId][i] = offset ;
+                offset += LDRV_MAPSIZE (entry) ;
+            }
+        }
+        LDRV_Obj->mapSize = offset ;
+
+        env = getenv (LDRV_MAP_BASE_ENV) ;
+        if ((env != NULL) && (env [0] != '\0')) {
+            hint = (Uint8 *) (  (strtoul (env, NULL, 0) + align - 1u)
+                              & ~((unsigned long) align - 1u)) ;
+        }
+
+        /*  Reserve one alignment more than needed and trim both ends, so
+         *  that the entries asking for huge pages are aligned to them.
+         */
+        span = (size_t) LDRV_Obj->mapSize + align ;
+        map  = (Uint8 *) mmap (hint, span, PROT_NONE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                               -1, 0) ;
+        if (map == (Uint8 *) MAP_FAILED) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            base = (Uint8 *) (  ((unsigned long) map + align - 1u)
+                              & ~((unsigned long) align - 1u)) ;
+            if (base != map) {
+                munmap (map, (size_t) (base - map)) ;
+            }
+            if ((base + LDRV_Obj->mapSize) != (map + span)) {
+                munmap (base + LDRV_Obj->mapSize,
+                        (size_t) ((map + span) - (base + LDRV_Obj->mapSize))) ;
+            }
+            LDRV_Obj->mapBase = base ;
+        }
+    }
+    else {
+        base = (Uint8 *) LDRV_Obj->mapBase ;
+        map  = (Uint8 *) mmap (base, LDRV_Obj->mapSize, PROT_NONE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                               -1, 0) ;
+        if (map != base) {
+            if (map != (Uint8 *) MAP_FAILED) {
+                munmap (map, LDRV_Obj->mapSize) ;
+            }
+            base   = NULL ;
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    LDRV_procState.mapBase = base ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_mapMemEntries
+ *
+ *  @desc   Maps (and optionally creates) the memory entries of every DSP
+ *          in the range reserved by LDRV_reserveMap. The creator records
+ *          the size of the pages backing every entry, falling back to the
+ *          default page size when the huge pages requested cannot be used,
+ *          so that the other processes map the same backing.
+ *
+ *  @arg    create
+ *              TRUE to create the segments.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              A segment could not be created or mapped.
+ *
+ *  @enter  LDRV_Obj must be mapped and hold the configuration.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_reserveMap, LDRV_unmapMemEntries
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LDRV_mapMemEntries (IN Bool create)
+{
+    DSP_STATUS         status   = DSP_SOK ;
+    Uint32             basePage = (Uint32) sysconf (_SC_PAGESIZE) ;
+    Char8              name [LDRV_SHM_NAMELEN] ;
+    Char8              path [LDRV_HUGE_PATHLEN] ;
+    LDRV_DspConfig *   cfg ;
+    LINKCFG_MemEntry * entry ;
+    Uint8 *            addr ;
+    Uint8 *            base ;
+    ProcessorId        dspId ;
+    Uint32             i ;
+
+    status = LDRV_reserveMap (create) ;
+
+    for (dspId = 0u ; (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ; dspId++) {
+        cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+        for (i = 0u ; (i < cfg->numMemEntries) && DSP_SUCCEEDED (status) ; i++) {
+            entry = &(cfg->memTable [i]) ;
+            addr  = LDRV_procState.mapBase + LDRV_Obj->mapOffset [dspId][i] ;
+            base  = NULL ;
+            LDRV_shmName (name, dspId, entry->name) ;
+
+            if (entry->pageSize != basePage) {
+                if (LDRV_hugePath (path, entry->pageSize, name) == TRUE) {
+                    base = LDRV_mapSegment (path,
+                                            addr,
+                                            LDRV_MAPSIZE (entry),
+                                            create,
+                                            TRUE,
+                                            NULL) ;
+                }
+                if ((base == NULL) && (create == TRUE)) {
+                    entry->pageSize = basePage ;
+                }
+            }
+
+            if (entry->pageSize == basePage) {
+                base = LDRV_mapSegment (name,
+                                        addr,
+                                        entry->size,
+                                        create,
+                                        FALSE,
+                                        NULL) ;
+            }
+
+            LDRV_procState.memBase [dspId][i] = base ;
+            if (base == NULL) {
+                status = DSP_EMEMORY ;
+                SET_FAILURE_REASON ;
+            }
+        }
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_unmapMemEntries
+ *
+ *  @desc   Unmaps (and optionally unlinks) the memory entries of every DSP,
+ *          and releases the range reserved for them.
+ *
+ *  @arg    destroy
+ *              TRUE to unlink the segments.
+ *
+ *  @ret    None
+ *
+ *  @enter  LDRV_Obj must be mapped and hold the configuration.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_mapMemEntries
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_unmapMemEntries (IN Bool destroy)
+{
+    Uint32             basePage = (Uint32) sysconf (_SC_PAGESIZE) ;
+    Char8              name [LDRV_SHM_NAMELEN] ;
+    Char8              path [LDRV_HUGE_PATHLEN] ;
+    LDRV_DspConfig *   cfg ;
+    LINKCFG_MemEntry * entry ;
+    ProcessorId        dspId ;
+    Uint32             i ;
+
+    if (LDRV_procState.mapBase != NULL) {
+        munmap (LDRV_procState.mapBase, LDRV_Obj->mapSize) ;
+        LDRV_procState.mapBase = NULL ;
+    }
+
+    for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+        cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+        for (i = 0u ; i < cfg->numMemEntries ; i++) {
+            entry = &(cfg->memTable [i]) ;
+            LDRV_procState.memBase [dspId][i] = NULL ;
+            if (destroy == TRUE) {
+                LDRV_shmName (name, dspId, entry->name) ;
+                if (    (entry->pageSize != basePage)
+                    &&  (LDRV_hugePath (path, entry->pageSize, name) == TRUE)) {
+                    unlink (path) ;
+                }
+                else {
+                    shm_unlink (name) ;
+                }
+            }
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_reapProcesses
+ *
+ *  @desc   Frees the process table slots of processes that exited without
+ *          destroying their setup.
+ *
+ *  @arg    None
+ *
+ *  @ret    Number of live processes.
+ *
+ *  @enter  LDRV_Obj must be mapped. The driver segment is locked.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_reapProcesses (Void)
+{
+    Uint32 live = 0u ;
+    Uint32 i ;
+
+    for (i = 0u ; i < LDRV_MAX_PROCESSES ; i++) {
+        if (LDRV_Obj->procPid [i] != 0u) {
+            if (    (kill ((pid_t) LDRV_Obj->procPid [i], 0) != 0)
+                &&  (errno == ESRCH)) {
+                LDRV_Obj->procPid [i]        = 0u ;
+                LDRV_Obj->procSetupCount [i] = 0u ;
+            }
+            else {
+                live++ ;
+            }
+        }
+    }
+
+    return live ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_initComponents
+ *
+ *  @desc   Initializes every link driver component in the calling process.
+ *
+ *  @arg    create
+ *              TRUE if the shared state of the components is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              Shared memory is exhausted.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  The segments are mapped. The driver segment is locked.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_exitComponents
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LDRV_initComponents (IN Bool create)
+{
+    DSP_STATUS status ;
+
+    status = LDRV_PROC_init (create) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_IPS_init (create) ;
+    }
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_POOL_init (create) ;
+    }
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_MSGQ_init (create) ;
+    }
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_CHNL_init (create) ;
+    }
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_MPCS_init (create) ;
+    }
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_RINGIO_init (create) ;
+    }
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_MPLIST_init (create) ;
+    }
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_IDM_init (create) ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_exitComponents
+ *
+ *  @desc   Finalizes every link driver component in the calling process.
+ *
+ *  @arg    destroy
+ *              TRUE if the shared state of the components is to be destroyed.
+ *
+ *  @ret    None
+ *
+ *  @enter  The segments are mapped. The driver segment is locked.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_initComponents
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_exitComponents (IN Bool destroy)
+{
+    /* Stop the DSP run by this process while the link drivers it uses are
+     * still alive.
+     */
+    LDRV_PROC_cleanup () ;
+
+    LDRV_IDM_exit    (destroy) ;
+    LDRV_MPLIST_exit (destroy) ;
+    LDRV_RINGIO_exit (destroy) ;
+    LDRV_MPCS_exit   (destroy) ;
+    LDRV_CHNL_exit   (destroy) ;
+    LDRV_MSGQ_exit   (destroy) ;
+    LDRV_POOL_exit   (destroy) ;
+    LDRV_IPS_exit    (destroy) ;
+    LDRV_PROC_exit   (destroy) ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_init
+ *
+ *  @desc   Maps the driver segment and the memory entries of every DSP into
+ *          the calling process.
+ *
+ *  @modif  LDRV_Obj, LDRV_procState
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_init (IN LINKCFG_Object * linkCfg)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    Bool        create = FALSE ;
+    Char8       name [LDRV_SHM_NAMELEN] ;
+    struct stat segStat ;
+    Pvoid       map ;
+    ProcessorId dspId ;
+    Uint32      slot ;
+    int         fd ;
+
+    TRC_1ENTER ("LDRV_init", linkCfg) ;
+
+    DBC_Require (linkCfg != NULL) ;
+
+    if (LDRV_procState.refCount != 0u) {
+        LDRV_procState.refCount++ ;
+        LDRV_Obj->procSetupCount [LDRV_procState.slot]++ ;
+        status = DSP_SALREADYSETUP ;
+    }
+    else {
+        LDRV_shmName (name, 0u, NULL) ;
+        fd = shm_open (name, O_RDWR | O_CREAT, 0600) ;
+        if (fd < 0) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            /* The file lock serializes setup and destroy across processes. */
+            flock (fd, LOCK_EX) ;
+            fstat (fd, &segStat) ;
+            if (segStat.st_size != (off_t) LDRV_DRV_SEGSIZE) {
+                create = TRUE ;
+                if (ftruncate (fd, 0) != 0 ||
+                    ftruncate (fd, (off_t) LDRV_DRV_SEGSIZE) != 0) {
+                    status = DSP_EMEMORY ;
+                    SET_FAILURE_REASON ;
+                }
+            }
+
+            if (DSP_SUCCEEDED (status)) {
+                map = mmap (NULL, LDRV_DRV_SEGSIZE, PROT_READ | PROT_WRITE,
+                            MAP_SHARED, fd, 0) ;
+                if (map == MAP_FAILED) {
+                    status = DSP_EMEMORY ;
+                    SET_FAILURE_REASON ;
+                }
+                else {
+                    LDRV_Obj = (LDRV_Object *) map ;
+                }
+            }
+
+            if (DSP_SUCCEEDED (status) && (create == FALSE)) {
+                /* Left behind by processes that died: start afresh. */
+                if (    (LDRV_Obj->signature != SIGN_DRV)
+                    ||  (LDRV_Obj->objSize != sizeof (LDRV_Object))
+                    ||  (LDRV_reapProcesses () == 0u)) {
+                    create = TRUE ;
+                }
+            }
+
+            if (DSP_SUCCEEDED (status) && (create == TRUE)) {
+                memset (LDRV_Obj, 0, LDRV_DRV_SEGSIZE) ;
+                LDRV_Obj->objSize = sizeof (LDRV_Object) ;
+                LDRV_Obj->heapCur =   (sizeof (LDRV_Object) + LDRV_HEAP_ALIGN)
+                                    & ~(LDRV_HEAP_ALIGN - 1u) ;
+                status = SYNC_HOST_createLock (&LDRV_Obj->lock) ;
+                if (DSP_SUCCEEDED (status)) {
+                    status = LDRV_copyConfig (linkCfg) ;
+                }
+                for (dspId = 0u ;
+                     (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ;
+                     dspId++) {
+                    LDRV_DspConfig * cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+                    LINKCFG_MemEntry * entry =
+                                      &(cfg->memTable [cfg->linkDrv.memEntry]) ;
+                    LDRV_Obj->smmCur [dspId] = entry->physAddr ;
+                    LDRV_Obj->smmEnd [dspId] = entry->physAddr + entry->size ;
+                }
+            }
+
+            if (DSP_SUCCEEDED (status)) {
+                status = LDRV_mapMemEntries (create) ;
+            }
+
+            if (DSP_SUCCEEDED (status)) {
+                for (slot = 0u ; slot < LDRV_MAX_PROCESSES ; slot++) {
+                    if (LDRV_Obj->procPid [slot] == 0u) {
+                        break ;
+                    }
+                }
+                if (slot == LDRV_MAX_PROCESSES) {
+                    status = DSP_ERESOURCE ;
+                    SET_FAILURE_REASON ;
+                }
+                else {
+                    LDRV_Obj->procPid [slot]        = (Uint32) getpid () ;
+                    LDRV_Obj->procSetupCount [slot] = 1u ;
+                    LDRV_procState.slot             = slot ;
+                    LDRV_procState.drvFd            = fd ;
+                    LDRV_procState.refCount         = 1u ;
+                }
+            }
+
+            if (DSP_SUCCEEDED (status)) {
+                status = LDRV_initComponents (create) ;
+                if (DSP_FAILED (status)) {
+                    LDRV_exitComponents (create) ;
+                    LDRV_Obj->procPid [LDRV_procState.slot] = 0u ;
+                    LDRV_procState.refCount = 0u ;
+                }
+                else if (create == TRUE) {
+                    LDRV_Obj->signature = SIGN_DRV ;
+                }
+            }
+
+            if (DSP_FAILED (status)) {
+                if (LDRV_Obj != NULL) {
+                    LDRV_unmapMemEntries (create) ;
+                    munmap (LDRV_Obj, LDRV_DRV_SEGSIZE) ;
+                    LDRV_Obj = NULL ;
+                }
+                if (create == TRUE) {
+                    shm_unlink (name) ;
+                }
+                flock (fd, LOCK_UN) ;
+                close (fd) ;
+            }
+            else {
+                flock (fd, LOCK_UN) ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_exit
+ *
+ *  @desc   Unmaps the segments from the calling process.
+ *
+ *  @modif  LDRV_Obj, LDRV_procState
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_exit (Void)
+{
+    DSP_STATUS status  = DSP_SOK ;
+    Bool       destroy = FALSE ;
+    Char8      name [LDRV_SHM_NAMELEN] ;
+    Uint32     slot ;
+    int        fd ;
+
+    TRC_0ENTER ("LDRV_exit") ;
+
+    if (LDRV_procState.refCount == 0u) {
+        status = DSP_ESETUP ;
+        SET_FAILURE_REASON ;
+    }
+    else if (LDRV_procState.refCount > 1u) {
+        LDRV_procState.refCount-- ;
+        LDRV_Obj->procSetupCount [LDRV_procState.slot]-- ;
+    }
+    else {
+        fd = LDRV_procState.drvFd ;
+        flock (fd, LOCK_EX) ;
+
+        LDRV_Obj->procPid [LDRV_procState.slot]        = 0u ;
+        LDRV_Obj->procSetupCount [LDRV_procState.slot] = 0u ;
+        destroy = (LDRV_reapProcesses () == 0u) ? TRUE : FALSE ;
+        if (destroy == TRUE) {
+            LDRV_Obj->signature = SIGN_NULL ;
+        }
+
+        LDRV_exitComponents (destroy) ;
+        LDRV_unmapMemEntries (destroy) ;
+
+        if (destroy == TRUE) {
+            for (slot = 0u ; slot < LDRV_MAX_PROCESSES ; slot++) {
+                LDRV_Obj->procPid [slot] = 0u ;
+            }
+            SYNC_HOST_deleteLock (&LDRV_Obj->lock) ;
+            LDRV_shmName (name, 0u, NULL) ;
+            shm_unlink (name) ;
+            status = DSP_SDESTROYED ;
+        }
+
+        munmap (LDRV_Obj, LDRV_DRV_SEGSIZE) ;
+        LDRV_Obj                = NULL ;
+        LDRV_procState.refCount = 0u ;
+        LDRV_procState.drvFd    = -1 ;
+
+        flock (fd, LOCK_UN) ;
+        close (fd) ;
+    }
+
+    TRC_1LEAVE ("LDRV_exit", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_isLastExit
+ *
+ *  @desc   Indicates whether the next LDRV_exit by the calling process would
+ *          finalize the shared state.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_isLastExit (Void)
+{
+    Bool   last = FALSE ;
+    Uint32 live = 0u ;
+    Uint32 slot ;
+
+    if (LDRV_procState.refCount == 1u) {
+        SYNC_HOST_enter (&LDRV_Obj->lock) ;
+        for (slot = 0u ; slot < LDRV_MAX_PROCESSES ; slot++) {
+            if (LDRV_Obj->procPid [slot] != 0u) {
+                live++ ;
+            }
+        }
+        SYNC_HOST_leave (&LDRV_Obj->lock) ;
+        last = (live == 1u) ? TRUE : FALSE ;
+    }
+
+    return last ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_procSlot
+ *
+ *  @desc   Returns the index of the calling process in the process table.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_procSlot (Void)
+{
+    return LDRV_procState.slot ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_isProcessAlive
+ *
+ *  @desc   Indicates whether the process in the specified slot is still
+ *          attached to the backend.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_isProcessAlive (IN Uint32 slot)
+{
+    Bool   alive = FALSE ;
+    Uint32 pid ;
+
+    if (slot < LDRV_MAX_PROCESSES) {
+        pid = LDRV_Obj->procPid [slot] ;
+        if (    (pid != 0u)
+            &&  ((kill ((pid_t) pid, 0) == 0) || (errno != ESRCH))) {
+            alive = TRUE ;
+        }
+    }
+
+    return alive ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_drvAlloc
+ *
+ *  @desc   Allocates zero-initialized private component state in the driver
+ *          segment.
+ *
+ *  @modif  LDRV_Obj->heapCur
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_drvAlloc (IN Uint32 size)
+{
+    Uint32 offset = 0u ;
+    Uint32 aligned ;
+
+    DBC_Require (LDRV_Obj != NULL) ;
+
+    aligned = (size + LDRV_HEAP_ALIGN - 1u) & ~(LDRV_HEAP_ALIGN - 1u) ;
+    if ((LDRV_DRV_SEGSIZE - LDRV_Obj->heapCur) >= aligned) {
+        offset = LDRV_Obj->heapCur ;
+        LDRV_Obj->heapCur += aligned ;
+        memset (((Uint8 *) LDRV_Obj) + offset, 0, aligned) ;
+    }
+
+    return offset ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_drvPtr
+ *
+ *  @desc   Converts an offset in the driver segment to a pointer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Pvoid
+LDRV_drvPtr (IN Uint32 offset)
+{
+    DBC_Require (LDRV_Obj != NULL) ;
+
+    return (offset == 0u) ? NULL : (Pvoid) (((Uint8 *) LDRV_Obj) + offset) ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_compState
+ *
+ *  @desc   Returns the private state of the specified component.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Pvoid
+LDRV_compState (IN LDRV_Component comp)
+{
+    DBC_Require (LDRV_Obj != NULL) ;
+    DBC_Require (comp < LDRV_Comp_Max) ;
+
+    return LDRV_drvPtr (LDRV_Obj->compState [comp]) ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_getDspConfig
+ *
+ *  @desc   Returns the configuration of the specified DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+LDRV_DspConfig *
+LDRV_getDspConfig (IN ProcessorId dspId)
+{
+    DBC_Require (LDRV_Obj != NULL) ;
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    return &(LDRV_Obj->dspConfig [dspId]) ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_SMM_alloc
+ *
+ *  @desc   Allocates zero-initialized memory shared with the DSP from the link
+ *          driver memory entry.
+ *
+ *  @modif  LDRV_Obj->smmCur
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_SMM_alloc (IN  ProcessorId dspId,
+                IN  Uint32      size,
+                OUT Uint32 *    physAddr)
+{
+    DSP_STATUS status = DSP_SOK ;
+    Uint32     aligned ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+    DBC_Require (physAddr != NULL) ;
+
+    aligned = (size + LDRV_HEAP_ALIGN - 1u) & ~(LDRV_HEAP_ALIGN - 1u) ;
+    if ((LDRV_Obj->smmEnd [dspId] - LDRV_Obj->smmCur [dspId]) < aligned) {
+        status = DSP_EMEMORY ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *physAddr = LDRV_Obj->smmCur [dspId] ;
+        LDRV_Obj->smmCur [dspId] += aligned ;
+        memset (LDRV_phyToUsr (dspId, *physAddr), 0, aligned) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_phyToUsr
+ *
+ *  @desc   Translates a physical address to an address in the calling process.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Pvoid
+LDRV_phyToUsr (IN ProcessorId dspId, IN Uint32 physAddr)
+{
+    Pvoid              usrAddr = NULL ;
+    LDRV_DspConfig *   cfg ;
+    LINKCFG_MemEntry * entry ;
+    Uint32             i ;
+
+    cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+    for (i = 0u ; i < cfg->numMemEntries ; i++) {
+        entry = &(cfg->memTable [i]) ;
+        if (    (physAddr >= entry->physAddr)
+            &&  ((physAddr - entry->physAddr) < entry->size)) {
+            usrAddr =   LDRV_procState.memBase [dspId][i]
+                      + (physAddr - entry->physAddr) ;
+            break ;
+        }
+    }
+
+    return usrAddr ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_usrToPhy
+ *
+ *  @desc   Translates an address in the calling process to a physical address.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_usrToPhy (IN ProcessorId dspId, IN Pvoid usrAddr)
+{
+    Uint32             physAddr = LDRV_INVALID_ADDR ;
+    Uint8 *            addr     = (Uint8 *) usrAddr ;
+    LDRV_DspConfig *   cfg ;
+    LINKCFG_MemEntry * entry ;
+    Uint8 *            base ;
+    Uint32             i ;
+
+    cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+    for (i = 0u ; i < cfg->numMemEntries ; i++) {
+        entry = &(cfg->memTable [i]) ;
+        base  = LDRV_procState.memBase [dspId][i] ;
+        if ((addr >= base) && ((Uint32) (addr - base) < entry->size)) {
+            physAddr = entry->physAddr + (Uint32) (addr - base) ;
+            break ;
+        }
+    }
+
+    return physAddr ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_pageSize
+ *
+ *  @desc   Gets the size of the GPP pages backing a physical address.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_pageSize (IN ProcessorId dspId, IN Uint32 physAddr)
+{
+    Uint32             pageSize = 0u ;
+    LDRV_DspConfig *   cfg ;
+    LINKCFG_MemEntry * entry ;
+    Uint32             i ;
+
+    cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+    for (i = 0u ; i < cfg->numMemEntries ; i++) {
+        entry = &(cfg->memTable [i]) ;
+        if (    (physAddr >= entry->physAddr)
+            &&  ((physAddr - entry->physAddr) < entry->size)) {
+            pageSize = entry->pageSize ;
+            break ;
+        }
+    }
+
+    return pageSize ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_mapMirror
+ *
+ *  @desc   Maps a range of a memory entry twice back-to-back in the calling
+ *          process.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_mapMirror (IN  ProcessorId dspId,
+                IN  Uint32      physAddr,
+                IN  Uint32      size,
+                OUT Pvoid *     mirror)
+{
+    DSP_STATUS         status   = DSP_EINVALIDARG ;
+    Uint32             basePage = (Uint32) sysconf (_SC_PAGESIZE) ;
+    LINKCFG_MemEntry * entry    = NULL ;
+    Char8              name [LDRV_SHM_NAMELEN] ;
+    Char8              path [LDRV_HUGE_PATHLEN] ;
+    LDRV_DspConfig *   cfg ;
+    Uint32             offset ;
+    Uint8 *            map ;
+    int                fd ;
+    Uint32             i ;
+
+    *mirror = NULL ;
+
+    cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+    for (i = 0u ; (i < cfg->numMemEntries) && (entry == NULL) ; i++) {
+        if (    (physAddr >= cfg->memTable [i].physAddr)
+            &&  ((physAddr - cfg->memTable [i].physAddr)
+                 < cfg->memTable [i].size)) {
+            entry = &(cfg->memTable [i]) ;
+        }
+    }
+
+    if (entry != NULL) {
+        offset = physAddr - entry->physAddr ;
+        if (    (size != 0u)
+            &&  ((offset & (entry->pageSize - 1u)) == 0u)
+            &&  ((size & (entry->pageSize - 1u)) == 0u)
+            &&  (size <= (entry->size - offset))) {
+            status = DSP_SOK ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        /* The memory entry is mapped afresh from the object backing it. */
+        LDRV_shmName (name, dspId, entry->name) ;
+        if (entry->pageSize != basePage) {
+            fd = (LDRV_hugePath (path, entry->pageSize, name) == TRUE)
+               ? open (path, O_RDWR, 0600)
+               : -1 ;
+        }
+        else {
+            fd = shm_open (name, O_RDWR, 0600) ;
+        }
+
+        map = (Uint8 *) MAP_FAILED ;
+        if (fd >= 0) {
+            /* Reserve both halves at once so that they are adjacent. */
+            map = (Uint8 *) mmap (NULL, (size_t) size * 2u, PROT_NONE,
+                                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                                  -1, 0) ;
+        }
+        if (map != (Uint8 *) MAP_FAILED) {
+            if (    (mmap (map, size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_FIXED, fd, (off_t) offset)
+                     == MAP_FAILED)
+                ||  (mmap (map + size, size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_FIXED, fd, (off_t) offset)
+                     == MAP_FAILED)) {
+                munmap (map, (size_t) size * 2u) ;
+                map = (Uint8 *) MAP_FAILED ;
+            }
+        }
+        if (fd >= 0) {
+            close (fd) ;
+        }
+
+        if (map == (Uint8 *) MAP_FAILED) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            *mirror = map ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_unmapMirror
+ *
+ *  @desc   Unmaps a range mapped by LDRV_mapMirror.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_unmapMirror (IN Pvoid mirror, IN Uint32 size)
+{
+    if (mirror != NULL) {
+        munmap (mirror, (size_t) size * 2u) ;
+    }
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_phyToDsp
+ *
+ *  @desc   Translates a physical address to a DSP address.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_phyToDsp (IN ProcessorId dspId, IN Uint32 physAddr)
+{
+    Uint32             dspAddr = LDRV_INVALID_ADDR ;
+    LDRV_DspConfig *   cfg ;
+    LINKCFG_MemEntry * entry ;
+    Uint32             i ;
+
+    cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+    for (i = 0u ; i < cfg->numMemEntries ; i++) {
+        entry = &(cfg->memTable [i]) ;
+        if (    (physAddr >= entry->physAddr)
+            &&  ((physAddr - entry->physAddr) < entry->size)) {
+            dspAddr = entry->dspVirtAddr + (physAddr - entry->physAddr) ;
+            break ;
+        }
+    }
+
+    return dspAddr ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_dspToPhy
+ *
+ *  @desc   Translates a DSP address to a physical address.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_dspToPhy (IN ProcessorId dspId, IN Uint32 dspAddr)
+{
+    Uint32             physAddr = LDRV_INVALID_ADDR ;
+    LDRV_DspConfig *   cfg ;
+    LINKCFG_MemEntry * entry ;
+    Uint32             i ;
+
+    cfg = &(LDRV_Obj->dspConfig [dspId]) ;
+    for (i = 0u ; i < cfg->numMemEntries ; i++) {
+        entry = &(cfg->memTable [i]) ;
+        if (    (dspAddr >= entry->dspVirtAddr)
+            &&  ((dspAddr - entry->dspVirtAddr) < entry->size)) {
+            physAddr = entry->physAddr + (dspAddr - entry->dspVirtAddr) ;
+            break ;
+        }
+    }
+
+    return physAddr ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,743 @@
+/** ============================================================================
+ *  @file   ldrv.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the link driver core of the host loopback
+ *          backend. The link driver owns two kinds of shared memory:
+ *          - The driver segment holding the state that the kernel module keeps
+ *            on a real target (configuration, process table and the private
+ *            state of every LDRV component).
+ *          - One segment per LINKCFG_MemEntry of every DSP. These segments
+ *            emulate the memory shared with the DSP. Their configured
+ *            physical and DSP addresses are preserved, so that addresses can
+ *            be translated exactly as on the target.
+ *          All segments are POSIX shared memory objects, so several Linux
+ *          processes can attach to the same emulated processor.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LDRV_H)
+#define LDRV_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <procdefs.h>
+#include <linkcfgdefs.h>
+#include <_dsplink.h>
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  LDRV_MAX_PROCESSES
+ *
+ *  @desc   Maximum number of processes that can attach to the backend.
+ *  ============================================================================
+ */
+#define LDRV_MAX_PROCESSES      16u
+
+/** ============================================================================
+ *  @const  LDRV_MAX_MEMENTRIES
+ *
+ *  @desc   Maximum number of memory entries per DSP.
+ *  ============================================================================
+ */
+#define LDRV_MAX_MEMENTRIES     8u
+
+/** ============================================================================
+ *  @const  LDRV_MAX_IPSENTRIES
+ *
+ *  @desc   Maximum number of IPS entries per DSP.
+ *  ============================================================================
+ */
+#define LDRV_MAX_IPSENTRIES     4u
+
+/** ============================================================================
+ *  @const  LDRV_MAX_DATADRIVERS
+ *
+ *  @desc   Maximum number of data drivers per DSP.
+ *  ============================================================================
+ */
+#define LDRV_MAX_DATADRIVERS    2u
+
+/** ============================================================================
+ *  @const  LDRV_DRV_SEGSIZE
+ *
+ *  @desc   Size of the driver segment. Pages that are never touched are not
+ *          backed by memory.
+ *  ============================================================================
+ */
+#define LDRV_DRV_SEGSIZE        0x00400000u
+
+/** ============================================================================
+ *  @const  LDRV_SHM_PREFIX_ENV
+ *
+ *  @desc   Environment variable selecting the prefix of the shared memory
+ *          objects. Processes using different prefixes see independent
+ *          emulated processors.
+ *  ============================================================================
+ */
+#define LDRV_SHM_PREFIX_ENV     "DSPLINK_SHM_PREFIX"
+
+/** ============================================================================
+ *  @const  LDRV_SHM_PREFIX_DEFAULT
+ *
+ *  @desc   Default prefix of the shared memory objects.
+ *  ============================================================================
+ */
+#define LDRV_SHM_PREFIX_DEFAULT "dsplink"
+
+/** ============================================================================
+ *  @const  LDRV_HUGETLBFS_ENV
+ *
+ *  @desc   Environment variable naming the hugetlbfs mount backing memory
+ *          entries that request huge pages. By default the mounts listed in
+ *          /proc/mounts are searched for one of the requested page size.
+ *  ============================================================================
+ */
+#define LDRV_HUGETLBFS_ENV      "DSPLINK_HUGETLBFS"
+
+/** ============================================================================
+ *  @const  LDRV_MAP_BASE_ENV
+ *
+ *  @desc   Environment variable giving the address at which the process
+ *          creating the driver segment tries to map the memory entries.
+ *          Every other process maps them at the address the creator got,
+ *          so that a buffer has the same address in all of them. By default
+ *          the creator lets the kernel choose.
+ *  ============================================================================
+ */
+#define LDRV_MAP_BASE_ENV       "DSPLINK_MAP_BASE"
+
+/** ============================================================================
+ *  @const  LDRV_INVALID_ADDR
+ *
+ *  @desc   Returned by the address translation functions on failure.
+ *  ============================================================================
+ */
+#define LDRV_INVALID_ADDR       ((Uint32) 0xFFFFFFFFu)
+
+/** ============================================================================
+ *  @macro  LDRV_UINT32_TO_PTR
+ *
+ *  @desc   Carries a 32-bit value in a pointer argument, such as the payload
+ *          of an event passed to a FnNotifyCbck.
+ *  ============================================================================
+ */
+#define LDRV_UINT32_TO_PTR(val) ((Pvoid) (unsigned long) (Uint32) (val))
+
+/** ============================================================================
+ *  @macro  LDRV_PTR_TO_UINT32
+ *
+ *  @desc   Retrieves a 32-bit value carried in a pointer argument.
+ *  ============================================================================
+ */
+#define LDRV_PTR_TO_UINT32(ptr) ((Uint32) (unsigned long) (ptr))
+
+
+/** ============================================================================
+ *  @name   LDRV_Component
+ *
+ *  @desc   Identifiers of the link driver components owning private state in
+ *          the driver segment.
+ *  ============================================================================
+ */
+typedef enum {
+    LDRV_Comp_Proc   = 0u,
+    LDRV_Comp_Dsp    = 1u,
+    LDRV_Comp_Ips    = 2u,
+    LDRV_Comp_Pool   = 3u,
+    LDRV_Comp_Msgq   = 4u,
+    LDRV_Comp_Mqt    = 5u,
+    LDRV_Comp_Chnl   = 6u,
+    LDRV_Comp_Data   = 7u,
+    LDRV_Comp_Mpcs   = 8u,
+    LDRV_Comp_RingIo = 9u,
+    LDRV_Comp_MpList = 10u,
+    LDRV_Comp_Idm    = 11u,
+    LDRV_Comp_Max    = 16u
+} LDRV_Component ;
+
+/** ============================================================================
+ *  @name   LDRV_DspConfig
+ *
+ *  @desc   Copy of the configuration of one DSP, held in the driver segment so
+ *          that every attached process sees the configuration of the process
+ *          that performed the first setup.
+ *  ============================================================================
+ */
+typedef struct LDRV_DspConfig_tag {
+    LINKCFG_Dsp         dspObject ;
+    LINKCFG_LinkDrv     linkDrv ;
+    Uint32              numMemEntries ;
+    LINKCFG_MemEntry    memTable [LDRV_MAX_MEMENTRIES] ;
+    Uint32              numIpsEntries ;
+    LINKCFG_Ips         ipsTable [LDRV_MAX_IPSENTRIES] ;
+    Uint32              numPools ;
+    LINKCFG_Pool        poolTable [MAX_POOLENTRIES] ;
+    Uint32              numDataDrivers ;
+    LINKCFG_DataDrv     dataTable [LDRV_MAX_DATADRIVERS] ;
+    LINKCFG_Mqt         mqtObject ;
+    LINKCFG_RingIo      ringIoObject ;
+    LINKCFG_MpList      mplistObject ;
+    LINKCFG_Mpcs        mpcsObject ;
+} LDRV_DspConfig ;
+
+/** ============================================================================
+ *  @name   LDRV_Object
+ *
+ *  @desc   Header of the driver segment.
+ *
+ *  @field  signature
+ *              SIGN_DRV once the segment has been initialized.
+ *  @field  objSize
+ *              Size of this structure, to detect incompatible binaries.
+ *  @field  lock
+ *              Lock protecting the driver state.
+ *  @field  procPid
+ *              Process table. Zero denotes a free slot.
+ *  @field  procSetupCount
+ *              Number of PROC_setup calls made by every process slot.
+ *  @field  heapCur
+ *              Next free offset in the driver segment.
+ *  @field  compState
+ *              Offset of the private state of every component.
+ *  @field  smmCur
+ *              Next free physical address in the link driver memory entry of
+ *              every DSP.
+ *  @field  smmEnd
+ *              End of the link driver memory entry of every DSP.
+ *  @field  mapBase
+ *              Address of the range holding the memory entries in every
+ *              process.
+ *  @field  mapSize
+ *              Size of that range.
+ *  @field  mapOffset
+ *              Offset of every memory entry of every DSP in that range.
+ *  @field  gppObject
+ *              Copy of the GPP configuration.
+ *  @field  dspConfig
+ *              Copy of the configuration of every DSP.
+ *  ============================================================================
+ */
+typedef struct LDRV_Object_tag {
+    Uint32          signature ;
+    Uint32          objSize ;
+    SYNC_HostLock   lock ;
+    Uint32          procPid [LDRV_MAX_PROCESSES] ;
+    Uint32          procSetupCount [LDRV_MAX_PROCESSES] ;
+    Uint32          heapCur ;
+    Uint32          compState [LDRV_Comp_Max] ;
+    Uint32          smmCur [MAX_DSPS] ;
+    Uint32          smmEnd [MAX_DSPS] ;
+    Pvoid           mapBase ;
+    Uint32          mapSize ;
+    Uint32          mapOffset [MAX_DSPS][LDRV_MAX_MEMENTRIES] ;
+    LINKCFG_Gpp     gppObject ;
+    LDRV_DspConfig  dspConfig [MAX_DSPS] ;
+} LDRV_Object ;
+
+
+/** ============================================================================
+ *  @name   LDRV_Obj
+ *
+ *  @desc   Mapping of the driver segment in the calling process. NULL when the
+ *          process has not set up the backend.
+ *  ============================================================================
+ */
+extern LDRV_Object * LDRV_Obj ;
+
+
+/** ============================================================================
+ *  @func   LDRV_init
+ *
+ *  @desc   Maps the driver segment and the memory entries of every DSP into
+ *          the calling process. The first process to attach initializes the
+ *          segments from the specified configuration and creates the shared
+ *          state of every component.
+ *
+ *  @arg    linkCfg
+ *              Configuration to be used if the calling process is the first
+ *              one to set up the backend.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SALREADYSETUP
+ *              The calling process had already set up the backend.
+ *          DSP_ECONFIG
+ *              The configuration exceeds the backend limits.
+ *          DSP_EMEMORY
+ *              A shared memory segment could not be created or mapped.
+ *          DSP_ERESOURCE
+ *              The process table is full.
+ *
+ *  @enter  linkCfg must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_init (IN LINKCFG_Object * linkCfg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_exit
+ *
+ *  @desc   Unmaps the segments from the calling process. The last process to
+ *          detach finalizes the shared state and unlinks the segments.
+ *
+ *  @arg    None
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SDESTROYED
+ *              The shared state has been finalized.
+ *          DSP_ESETUP
+ *              The backend has not been set up by the calling process.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_exit (Void) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_isLastExit
+ *
+ *  @desc   Indicates whether the next LDRV_exit by the calling process would
+ *          finalize the shared state.
+ *
+ *  @arg    None
+ *
+ *  @ret    TRUE/FALSE
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_exit
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_isLastExit (Void) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_procSlot
+ *
+ *  @desc   Returns the index of the calling process in the process table.
+ *
+ *  @arg    None
+ *
+ *  @ret    Process slot.
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_procSlot (Void) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_isProcessAlive
+ *
+ *  @desc   Indicates whether the process in the specified slot is still
+ *          attached to the backend.
+ *
+ *  @arg    slot
+ *              Process slot.
+ *
+ *  @ret    TRUE/FALSE
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_isProcessAlive (IN Uint32 slot) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_drvAlloc
+ *
+ *  @desc   Allocates zero-initialized private component state in the driver
+ *          segment. Allocations are only made while the shared state is being
+ *          created and are released together with the segment.
+ *
+ *  @arg    size
+ *              Number of bytes to allocate.
+ *
+ *  @ret    Offset of the allocation, 0 on failure.
+ *
+ *  @enter  LDRV_init is creating the shared state.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_drvPtr
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_drvAlloc (IN Uint32 size) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_drvPtr
+ *
+ *  @desc   Converts an offset in the driver segment to a pointer.
+ *
+ *  @arg    offset
+ *              Offset in the driver segment.
+ *
+ *  @ret    Pointer in the calling process.
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_drvAlloc
+ *  ============================================================================
+ */
+NORMAL_API
+Pvoid
+LDRV_drvPtr (IN Uint32 offset) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_compState
+ *
+ *  @desc   Returns the private state of the specified component in the calling
+ *          process.
+ *
+ *  @arg    comp
+ *              Component identifier.
+ *
+ *  @ret    Pointer to the component state, NULL if not created.
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_drvAlloc
+ *  ============================================================================
+ */
+NORMAL_API
+Pvoid
+LDRV_compState (IN LDRV_Component comp) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_getDspConfig
+ *
+ *  @desc   Returns the configuration of the specified DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    Configuration held in the driver segment.
+ *
+ *  @enter  LDRV_init has been successful.
+ *          dspId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+LDRV_DspConfig *
+LDRV_getDspConfig (IN ProcessorId dspId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_SMM_alloc
+ *
+ *  @desc   Allocates zero-initialized memory shared with the DSP from the link
+ *          driver memory entry. Allocations are only made while the shared
+ *          state is being created.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    size
+ *              Number of bytes to allocate.
+ *  @arg    physAddr
+ *              Location to receive the physical address of the allocation.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The link driver memory entry is exhausted.
+ *
+ *  @enter  physAddr must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_phyToUsr
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_SMM_alloc (IN  ProcessorId dspId,
+                IN  Uint32      size,
+                OUT Uint32 *    physAddr) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_phyToUsr
+ *
+ *  @desc   Translates a physical address to an address in the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    physAddr
+ *              Physical address.
+ *
+ *  @ret    Address in the calling process, NULL if the address is not mapped.
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_usrToPhy
+ *  ============================================================================
+ */
+NORMAL_API
+Pvoid
+LDRV_phyToUsr (IN ProcessorId dspId, IN Uint32 physAddr) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_usrToPhy
+ *
+ *  @desc   Translates an address in the calling process to a physical address.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    usrAddr
+ *              Address in the calling process.
+ *
+ *  @ret    Physical address, LDRV_INVALID_ADDR if the address is not mapped.
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_phyToUsr
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_usrToPhy (IN ProcessorId dspId, IN Pvoid usrAddr) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_pageSize
+ *
+ *  @desc   Gets the size of the GPP pages backing a physical address, which
+ *          is larger than the default page size for memory entries backed by
+ *          huge pages.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    physAddr
+ *              Physical address.
+ *
+ *  @ret    Size of the pages, 0 if the address is not mapped.
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_phyToUsr
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_pageSize (IN ProcessorId dspId, IN Uint32 physAddr) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_mapMirror
+ *
+ *  @desc   Maps a range of a memory entry twice back-to-back in the calling
+ *          process, so that an access running past the end of the first
+ *          mapping continues at the start of the range.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    physAddr
+ *              Physical address of the range.
+ *  @arg    size
+ *              Size of the range.
+ *  @arg    mirror
+ *              Location to receive the address of the first mapping.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The range is not in a memory entry, or its address or size is
+ *              not a multiple of the size of the pages backing it.
+ *          DSP_EMEMORY
+ *              The range cannot be mapped.
+ *
+ *  @enter  LDRV_init has been successful.
+ *          mirror must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_unmapMirror, LDRV_pageSize
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_mapMirror (IN  ProcessorId dspId,
+                IN  Uint32      physAddr,
+                IN  Uint32      size,
+                OUT Pvoid *     mirror) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_unmapMirror
+ *
+ *  @desc   Unmaps a range mapped by LDRV_mapMirror.
+ *
+ *  @arg    mirror
+ *              Address of the first mapping.
+ *  @arg    size
+ *              Size of the range.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_mapMirror
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_unmapMirror (IN Pvoid mirror, IN Uint32 size) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_phyToDsp
+ *
+ *  @desc   Translates a physical address to a DSP address.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    physAddr
+ *              Physical address.
+ *
+ *  @ret    DSP address, LDRV_INVALID_ADDR if the address is not mapped.
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_dspToPhy
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_phyToDsp (IN ProcessorId dspId, IN Uint32 physAddr) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_dspToPhy
+ *
+ *  @desc   Translates a DSP address to a physical address.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspAddr
+ *              DSP address.
+ *
+ *  @ret    Physical address, LDRV_INVALID_ADDR if the address is not mapped.
+ *
+ *  @enter  LDRV_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_phyToDsp
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_dspToPhy (IN ProcessorId dspId, IN Uint32 dspAddr) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LDRV_H) */
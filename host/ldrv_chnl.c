@@ -0,0 +1,1564 @@
+/** ============================================================================
+ *  @file   ldrv_chnl.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the CHNL manager of the host backend.
+ *          The I/O requests of every channel are kept in a control block in
+ *          the memory shared with the DSP: a ring of pending requests,
+ *          which the DSP side of the data driver consumes, and a ring of
+ *          completed requests, which the GPP reclaims.
+ *          The DSP copies blocks of LOOPDMA_MINSIZE bytes or more with its
+ *          DMA engine: the requests stay pending until their copy and the
+ *          copies of the requests before them are complete, so that they
+ *          still complete in order.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <chnldefs.h>
+#include <pooldefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+#include <ldrv.h>
+#include <ldrv_proc.h>
+#include <ldrv_ips.h>
+#include <ldrv_pool.h>
+#include <ldrv_chnl.h>
+#include <loopdma.h>
+#include <zcpydata.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_CHNL, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @const  LDRV_CHNL_DATADRV
+ *
+ *  @desc   Index of the data driver serving the channels in the
+ *          configuration.
+ *  ============================================================================
+ */
+#define LDRV_CHNL_DATADRV       0u
+
+/*  ============================================================================
+ *  @macro  LDRV_CHNL_SLOT
+ *
+ *  @desc   Position of a request counter in a ring of requests.
+ *  ============================================================================
+ */
+#define LDRV_CHNL_SLOT(count)   ((count) % LDRV_CHNL_MAXQUEUE)
+
+/*  ============================================================================
+ *  @macro  LDRV_CHNL_PEER
+ *
+ *  @desc   Channel a channel is looped back to by the DSP.
+ *  ============================================================================
+ */
+#define LDRV_CHNL_PEER(chnlId)  ((chnlId) ^ 1u)
+
+
+/*  ============================================================================
+ *  @name   LDRV_CHNL_Irp
+ *
+ *  @desc   I/O request of a channel.
+ *
+ *  @field  bufPhys
+ *              Physical address of the buffer.
+ *  @field  size
+ *              Size of the buffer; for a completed input request, number of
+ *              bytes received.
+ *  @field  arg
+ *              Argument of the request.
+ *  @field  status
+ *              Completion status of the request.
+ *  ============================================================================
+ */
+typedef struct LDRV_CHNL_Irp_tag {
+    Uint32      bufPhys ;
+    Uint32      size    ;
+    Uint32      arg     ;
+    DSP_STATUS  status  ;
+} LDRV_CHNL_Irp ;
+
+/*  ============================================================================
+ *  @name   LDRV_CHNL_Ctrl
+ *
+ *  @desc   Control block of a channel in the memory shared with the DSP.
+ *
+ *  @field  lock
+ *              Lock protecting the control block.
+ *  @field  cond
+ *              Signalled when requests complete or the channel is deleted.
+ *  @field  created
+ *              TRUE while the channel exists.
+ *  @field  ownerSlot
+ *              Process slot of the creator of the channel.
+ *  @field  mode
+ *              Mode of the channel.
+ *  @field  maxQueue
+ *              Highest number of outstanding requests.
+ *  @field  pendHead
+ *              Number of pending requests completed by the DSP.
+ *  @field  xferHead
+ *              Number of pending requests whose transfer the DSP started.
+ *  @field  pendTail
+ *              Number of requests issued.
+ *  @field  doneHead
+ *              Number of completed requests reclaimed.
+ *  @field  doneTail
+ *              Number of requests completed.
+ *  @field  transferred
+ *              Number of bytes transferred on the channel.
+ *  @field  polled
+ *              TRUE once the owner has asked for a pollable descriptor.
+ *  @field  pollFd
+ *              Pollable descriptor, valid in the owner process only.
+ *  @field  pollRaised
+ *              TRUE while the pollable descriptor is raised or being raised.
+ *  @field  pend
+ *              Ring of pending requests.
+ *  @field  done
+ *              Ring of completed requests.
+ *  ============================================================================
+ */
+typedef struct LDRV_CHNL_Ctrl_tag {
+    SYNC_HostLock  lock        ;
+    SYNC_HostCond  cond        ;
+    Uint32         created     ;
+    Uint32         ownerSlot   ;
+    Uint32         mode        ;
+    Uint32         maxQueue    ;
+    Uint32         pendHead    ;
+    Uint32         xferHead    ;
+    Uint32         pendTail    ;
+    Uint32         doneHead    ;
+    Uint32         doneTail    ;
+    Uint32         transferred ;
+    Uint32         polled      ;
+    Int32          pollFd      ;
+    Uint32         pollRaised  ;
+    LDRV_CHNL_Irp  pend [LDRV_CHNL_MAXQUEUE] ;
+    LDRV_CHNL_Irp  done [LDRV_CHNL_MAXQUEUE] ;
+} LDRV_CHNL_Ctrl ;
+
+/*  ============================================================================
+ *  @name   LDRV_CHNL_Copy
+ *
+ *  @desc   Copy of a transfer between a loopback pair of channels, in the
+ *          process running the DSP.
+ *
+ *  @field  request
+ *              Copy queued to the DMA engine.
+ *  @field  dspId
+ *              DSP identifier.
+ *  @field  chnlId
+ *              Identifier of the first channel of the pair.
+ *  @field  ready
+ *              TRUE once the data is copied. Protected by the locks of the
+ *              pair.
+ *  ============================================================================
+ */
+typedef struct LDRV_CHNL_Copy_tag {
+    LOOPDMA_Request  request ;
+    ProcessorId      dspId   ;
+    ChannelId        chnlId  ;
+    Uint32           ready   ;
+} LDRV_CHNL_Copy ;
+
+/*  ============================================================================
+ *  @name   LDRV_CHNL_Object
+ *
+ *  @desc   Private state of the CHNL manager in the driver segment.
+ *
+ *  @field  ctrlPhys
+ *              Physical address of the control blocks of the channels of
+ *              each DSP, 0 if the DSP has no data driver.
+ *  ============================================================================
+ */
+typedef struct LDRV_CHNL_Object_tag {
+    Uint32  ctrlPhys [MAX_DSPS] ;
+} LDRV_CHNL_Object ;
+
+
+/*  ============================================================================
+ *  @name   LDRV_CHNL_ctrls
+ *
+ *  @desc   Control blocks of the channels of each DSP in the calling process.
+ *  ============================================================================
+ */
+STATIC LDRV_CHNL_Ctrl * LDRV_CHNL_ctrls [MAX_DSPS] ;
+
+/*  ============================================================================
+ *  @name   LDRV_CHNL_copies
+ *
+ *  @desc   Copies of the transfers started by the DSP run by the calling
+ *          process, for every loopback pair, indexed by the slot of the
+ *          output request.
+ *  ============================================================================
+ */
+STATIC LDRV_CHNL_Copy LDRV_CHNL_copies [MAX_DSPS]
+                                       [MAX_CHANNELS / 2u]
+                                       [LDRV_CHNL_MAXQUEUE] ;
+
+#if defined (DDSP_PROFILE)
+/*  ============================================================================
+ *  @name   LDRV_CHNL_shared
+ *
+ *  @desc   Information shared by the channels, reported by the
+ *          instrumentation.
+ *  ============================================================================
+ */
+STATIC CHNL_Shared LDRV_CHNL_shared = { ZCPYDATA_NAME } ;
+#endif /* if defined (DDSP_PROFILE) */
+
+
+/*  ============================================================================
+ *  @func   LDRV_CHNL_getCtrl
+ *
+ *  @desc   Gets the control block of a channel served by the data driver.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *
+ *  @ret    Control block of the channel, NULL if the channel is not served
+ *          by the data driver.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+LDRV_CHNL_Ctrl *
+LDRV_CHNL_getCtrl (IN ProcessorId dspId, IN ChannelId chnlId)
+{
+    LDRV_CHNL_Ctrl *  ctrl = NULL ;
+    LINKCFG_DataDrv * dataDrv ;
+
+    if (IS_VALID_CHNLID (dspId, chnlId) && (LDRV_CHNL_ctrls [dspId] != NULL)) {
+        dataDrv = &(LDRV_getDspConfig (dspId)->dataTable [LDRV_CHNL_DATADRV]) ;
+        if (    (chnlId >= dataDrv->baseChnlId)
+            &&  (chnlId <  (dataDrv->baseChnlId + dataDrv->numChannels))) {
+            ctrl = &(LDRV_CHNL_ctrls [dspId][chnlId]) ;
+        }
+    }
+
+    return ctrl ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_CHNL_settle
+ *
+ *  @desc   Waits for the transfers of a channel started by the DSP to
+ *          complete.
+ *
+ *  @arg    ctrl
+ *              Control block of the channel.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the channel is held.
+ *
+ *  @leave  No transfer of the channel is in progress.
+ *
+ *  @see    LDRV_CHNL_retire
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_CHNL_settle (IN LDRV_CHNL_Ctrl * ctrl)
+{
+    while (ctrl->pendHead != ctrl->xferHead) {
+        SYNC_HOST_waitUntil (&ctrl->cond, &ctrl->lock, NULL) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_CHNL_cancel
+ *
+ *  @desc   Completes the pending requests of a channel as cancelled.
+ *
+ *  @arg    ctrl
+ *              Control block of the channel.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the channel is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_CHNL_cancel (IN LDRV_CHNL_Ctrl * ctrl)
+{
+    LDRV_CHNL_Irp * irp ;
+
+    /* The requests being transferred complete normally. */
+    LDRV_CHNL_settle (ctrl) ;
+    while (ctrl->pendHead != ctrl->pendTail) {
+        irp = &(ctrl->done [LDRV_CHNL_SLOT (ctrl->doneTail)]) ;
+        *irp = ctrl->pend [LDRV_CHNL_SLOT (ctrl->pendHead)] ;
+        irp->status = CHNL_E_CANCELLED ;
+        if (ctrl->mode == ChannelMode_Input) {
+            irp->size = 0u ;
+        }
+        ctrl->pendHead++ ;
+        ctrl->doneTail++ ;
+    }
+    ctrl->xferHead = ctrl->pendHead ;
+
+    SYNC_HOST_broadcast (&ctrl->cond) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_CHNL_outstanding
+ *
+ *  @desc   Gets the number of outstanding requests of a channel.
+ *
+ *  @arg    ctrl
+ *              Control block of the channel.
+ *
+ *  @ret    Number of pending and completed requests not reclaimed yet.
+ *
+ *  @enter  The lock of the channel is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_CHNL_outstanding (IN LDRV_CHNL_Ctrl * ctrl)
+{
+    return (  (ctrl->pendTail - ctrl->pendHead)
+            + (ctrl->doneTail - ctrl->doneHead)) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_CHNL_pollRaise
+ *
+ *  @desc   Marks the pollable descriptor of a channel as raised if the
+ *          channel has completed requests and the descriptor is not raised
+ *          yet. The caller raises it once the lock has been released.
+ *
+ *  @arg    ctrl
+ *              Control block of the channel.
+ *  @arg    slot
+ *              Location to receive the process slot of the owner.
+ *  @arg    fd
+ *              Location to receive the pollable descriptor.
+ *
+ *  @ret    TRUE if the descriptor must be raised.
+ *
+ *  @enter  The lock of the channel is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_userSignal
+ *  ============================================================================
+ */
+STATIC
+Bool
+LDRV_CHNL_pollRaise (IN  LDRV_CHNL_Ctrl * ctrl,
+                     OUT Uint32 *         slot,
+                     OUT Int32 *          fd)
+{
+    Bool wake = FALSE ;
+
+    if (    (ctrl->polled == TRUE)
+        &&  (ctrl->pollRaised == FALSE)
+        &&  (ctrl->doneHead != ctrl->doneTail)) {
+        ctrl->pollRaised = TRUE ;
+        *slot            = ctrl->ownerSlot ;
+        *fd              = ctrl->pollFd ;
+        wake             = TRUE ;
+    }
+
+    return wake ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_CHNL_pollRelease
+ *
+ *  @desc   Closes the pollable descriptor of a channel being deleted, if it
+ *          belongs to the calling process.
+ *
+ *  @arg    ctrl
+ *              Control block of the channel.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the channel is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_getPollFd
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_CHNL_pollRelease (IN LDRV_CHNL_Ctrl * ctrl)
+{
+    if (    (ctrl->polled == TRUE)
+        &&  (ctrl->ownerSlot == LDRV_procSlot ())) {
+        SYNC_HOST_deletePollFd (ctrl->pollFd) ;
+    }
+    ctrl->polled     = FALSE ;
+    ctrl->pollRaised = FALSE ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_CHNL_retire
+ *
+ *  @desc   Completes the transfers of a loopback pair whose copies are done,
+ *          in the order they were started.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    output
+ *              Control block of the output channel of the pair.
+ *  @arg    input
+ *              Control block of the input channel of the pair.
+ *  @arg    copies
+ *              Copies of the pair.
+ *
+ *  @ret    TRUE if requests were completed.
+ *
+ *  @enter  The locks of both channels are held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_dspTransfer, LDRV_CHNL_copyDone
+ *  ============================================================================
+ */
+STATIC
+Bool
+LDRV_CHNL_retire (IN ProcessorId      dspId,
+                  IN LDRV_CHNL_Ctrl * output,
+                  IN LDRV_CHNL_Ctrl * input,
+                  IN LDRV_CHNL_Copy * copies)
+{
+    Bool            completed = FALSE ;
+    LDRV_CHNL_Irp * outIrp ;
+    LDRV_CHNL_Irp * inIrp ;
+
+    (Void) dspId ;
+
+    while (    (output->pendHead != output->xferHead)
+           &&  (copies [LDRV_CHNL_SLOT (output->pendHead)].ready == TRUE)) {
+        outIrp = &(output->pend [LDRV_CHNL_SLOT (output->pendHead)]) ;
+        inIrp  = &(input->pend [LDRV_CHNL_SLOT (input->pendHead)]) ;
+
+        output->done [LDRV_CHNL_SLOT (output->doneTail)] = *outIrp ;
+        input->done [LDRV_CHNL_SLOT (input->doneTail)]   = *inIrp ;
+        output->pendHead++ ;
+        output->doneTail++ ;
+        input->pendHead++ ;
+        input->doneTail++ ;
+        output->transferred += outIrp->size ;
+        input->transferred  += inIrp->size ;
+
+#if defined (DDSP_PROFILE)
+        LDRV_PROC_getStats (dspId)->dataGppToDsp += outIrp->size ;
+        LDRV_PROC_getStats (dspId)->dataDspToGpp += inIrp->size ;
+#endif /* if defined (DDSP_PROFILE) */
+
+        completed = TRUE ;
+    }
+
+    if (completed == TRUE) {
+        /* Also wakes up the threads settling the pair, which must not depend
+         * on the GPP side of the driver still being registered.
+         */
+        SYNC_HOST_broadcast (&output->cond) ;
+        SYNC_HOST_broadcast (&input->cond) ;
+    }
+
+    return completed ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_CHNL_copyDone
+ *
+ *  @desc   Completion of a copy by the DMA engine of the DSP: completes the
+ *          transfers of the pair it unblocks and signals them to the GPP.
+ *
+ *  @arg    arg
+ *              Copy.
+ *  @arg    status
+ *              Completion status of the copy.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_dspTransfer
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_CHNL_copyDone (IN Pvoid arg, IN DSP_STATUS status)
+{
+    LDRV_CHNL_Copy * copy      = (LDRV_CHNL_Copy *) arg ;
+    Bool             completed = FALSE ;
+    LDRV_CHNL_Ctrl * first ;
+    LDRV_CHNL_Ctrl * second ;
+
+    (Void) status ;
+
+    first  = LDRV_CHNL_getCtrl (copy->dspId, copy->chnlId) ;
+    second = LDRV_CHNL_getCtrl (copy->dspId, LDRV_CHNL_PEER (copy->chnlId)) ;
+    if ((first != NULL) && (second != NULL)) {
+        SYNC_HOST_enter (&first->lock) ;
+        SYNC_HOST_enter (&second->lock) ;
+        copy->ready = TRUE ;
+        completed   = LDRV_CHNL_retire (
+                    copy->dspId,
+                    (first->mode == ChannelMode_Output) ? first  : second,
+                    (first->mode == ChannelMode_Output) ? second : first,
+                    LDRV_CHNL_copies [copy->dspId][copy->chnlId >> 1u]) ;
+        SYNC_HOST_leave (&second->lock) ;
+        SYNC_HOST_leave (&first->lock) ;
+    }
+
+    if (completed == TRUE) {
+        ZCPYDATA_complete (copy->dspId, LDRV_CHNL_DATADRV, copy->chnlId) ;
+    }
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_init
+ *
+ *  @desc   Initializes the CHNL manager and the data drivers in the calling
+ *          process.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_init (IN Bool create)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    LDRV_CHNL_Object * chnlState = NULL ;
+    LDRV_DspConfig *   cfg ;
+    LDRV_CHNL_Ctrl *   ctrl ;
+    ProcessorId        dspId ;
+    Uint32             i ;
+
+    TRC_1ENTER ("LDRV_CHNL_init", create) ;
+
+    memset (LDRV_CHNL_ctrls, 0, sizeof (LDRV_CHNL_ctrls)) ;
+
+    if (create == TRUE) {
+        LDRV_Obj->compState [LDRV_Comp_Chnl] =
+                                  LDRV_drvAlloc (sizeof (LDRV_CHNL_Object)) ;
+        if (LDRV_Obj->compState [LDRV_Comp_Chnl] == 0u) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        chnlState = (LDRV_CHNL_Object *) LDRV_compState (LDRV_Comp_Chnl) ;
+    }
+
+    for (dspId = 0u ; (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ; dspId++) {
+        cfg = LDRV_getDspConfig (dspId) ;
+        if (cfg->numDataDrivers == 0u) {
+            continue ;
+        }
+
+        if (    (strncmp (cfg->dataTable [LDRV_CHNL_DATADRV].name,
+                          ZCPYDATA_NAME,
+                          DSP_MAX_STRLEN) != 0)
+            ||  (  cfg->dataTable [LDRV_CHNL_DATADRV].baseChnlId
+                 + cfg->dataTable [LDRV_CHNL_DATADRV].numChannels
+                 > MAX_CHANNELS)) {
+            status = DSP_ECONFIG ;
+            SET_FAILURE_REASON ;
+        }
+        else if (create == TRUE) {
+            status = LDRV_SMM_alloc (dspId,
+                                     MAX_CHANNELS * sizeof (LDRV_CHNL_Ctrl),
+                                     &chnlState->ctrlPhys [dspId]) ;
+            if (DSP_SUCCEEDED (status)) {
+                ctrl = (LDRV_CHNL_Ctrl *) LDRV_phyToUsr (
+                                                dspId,
+                                                chnlState->ctrlPhys [dspId]) ;
+                memset (ctrl, 0, MAX_CHANNELS * sizeof (LDRV_CHNL_Ctrl)) ;
+                for (i = 0u ; (i < MAX_CHANNELS) && DSP_SUCCEEDED (status) ;
+                     i++) {
+                    status = SYNC_HOST_createLock (&ctrl [i].lock) ;
+                    if (DSP_SUCCEEDED (status)) {
+                        status = SYNC_HOST_createCond (&ctrl [i].cond) ;
+                    }
+                }
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            LDRV_CHNL_ctrls [dspId] = (LDRV_CHNL_Ctrl *)
+                          LDRV_phyToUsr (dspId, chnlState->ctrlPhys [dspId]) ;
+            status = ZCPYDATA_init (dspId, LDRV_CHNL_DATADRV) ;
+            if (DSP_FAILED (status)) {
+                LDRV_CHNL_ctrls [dspId] = NULL ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_exit
+ *
+ *  @desc   Finalizes the CHNL manager in the calling process.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_exit (IN Bool destroy)
+{
+    LDRV_CHNL_Ctrl * ctrl ;
+    ProcessorId      dspId ;
+    Uint32           slot ;
+    Uint32           i ;
+
+    TRC_1ENTER ("LDRV_CHNL_exit", destroy) ;
+
+    slot = LDRV_procSlot () ;
+    for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+        if (LDRV_CHNL_ctrls [dspId] == NULL) {
+            continue ;
+        }
+
+        ZCPYDATA_exit (dspId, LDRV_CHNL_DATADRV) ;
+
+        /* Delete the channels left behind by the calling process. */
+        for (i = 0u ; i < MAX_CHANNELS ; i++) {
+            ctrl = &(LDRV_CHNL_ctrls [dspId][i]) ;
+            SYNC_HOST_enter (&ctrl->lock) ;
+            if (    (ctrl->created == TRUE)
+                &&  ((ctrl->ownerSlot == slot) || (destroy == TRUE))) {
+                LDRV_CHNL_settle (ctrl) ;
+                ctrl->created  = FALSE ;
+                ctrl->pendHead = ctrl->pendTail ;
+                ctrl->xferHead = ctrl->pendTail ;
+                ctrl->doneHead = ctrl->doneTail ;
+                LDRV_CHNL_pollRelease (ctrl) ;
+                SYNC_HOST_broadcast (&ctrl->cond) ;
+            }
+            SYNC_HOST_leave (&ctrl->lock) ;
+
+            if (destroy == TRUE) {
+                SYNC_HOST_deleteCond (&ctrl->cond) ;
+                SYNC_HOST_deleteLock (&ctrl->lock) ;
+            }
+        }
+
+        LDRV_CHNL_ctrls [dspId] = NULL ;
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_create
+ *
+ *  @desc   Creates a channel owned by the calling process.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_create (IN ProcessorId    dspId,
+                  IN ChannelId      chnlId,
+                  IN ChannelAttrs * attrs)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_CHNL_Ctrl *  ctrl ;
+    LINKCFG_DataDrv * dataDrv ;
+    Uint32            maxQueue ;
+
+    TRC_3ENTER ("LDRV_CHNL_create", dspId, chnlId, attrs) ;
+
+    DBC_Require (attrs != NULL) ;
+
+    ctrl = LDRV_CHNL_getCtrl (dspId, chnlId) ;
+    if (ctrl == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else if (   (attrs->mode != ChannelMode_Input)
+             && (attrs->mode != ChannelMode_Output)) {
+        status = CHNL_E_BADMODE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        dataDrv  = &(LDRV_getDspConfig (dspId)->dataTable [LDRV_CHNL_DATADRV]) ;
+        maxQueue = dataDrv->queuePerChnl ;
+        if ((maxQueue == 0u) || (maxQueue > LDRV_CHNL_MAXQUEUE)) {
+            maxQueue = LDRV_CHNL_MAXQUEUE ;
+        }
+        if (    (LDRV_Obj->gppObject.maxChnlQueue != 0u)
+            &&  (maxQueue > LDRV_Obj->gppObject.maxChnlQueue)) {
+            maxQueue = LDRV_Obj->gppObject.maxChnlQueue ;
+        }
+
+        SYNC_HOST_enter (&ctrl->lock) ;
+        if (ctrl->created == TRUE) {
+            status = CHNL_E_CHANBUSY ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            ctrl->ownerSlot   = LDRV_procSlot () ;
+            ctrl->mode        = attrs->mode ;
+            ctrl->maxQueue    = maxQueue ;
+            ctrl->pendHead    = 0u ;
+            ctrl->xferHead    = 0u ;
+            ctrl->pendTail    = 0u ;
+            ctrl->doneHead    = 0u ;
+            ctrl->doneTail    = 0u ;
+            ctrl->transferred = 0u ;
+            ctrl->polled      = FALSE ;
+            ctrl->pollRaised  = FALSE ;
+            ctrl->created     = TRUE ;
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_create", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_delete
+ *
+ *  @desc   Deletes a channel. The outstanding requests are dropped.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_delete (IN ProcessorId dspId, IN ChannelId chnlId)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_CHNL_Ctrl * ctrl ;
+
+    TRC_2ENTER ("LDRV_CHNL_delete", dspId, chnlId) ;
+
+    ctrl = LDRV_CHNL_getCtrl (dspId, chnlId) ;
+    if (ctrl == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        if (ctrl->created == FALSE) {
+            status = CHNL_E_WRONGSTATE ;
+            SET_FAILURE_REASON ;
+        }
+        else if (ctrl->ownerSlot != LDRV_procSlot ()) {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            LDRV_CHNL_settle (ctrl) ;
+            ctrl->created  = FALSE ;
+            ctrl->pendHead = ctrl->pendTail ;
+            ctrl->xferHead = ctrl->pendTail ;
+            ctrl->doneHead = ctrl->doneTail ;
+            LDRV_CHNL_pollRelease (ctrl) ;
+            SYNC_HOST_broadcast (&ctrl->cond) ;
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_delete", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_allocateBuffer
+ *
+ *  @desc   Allocates buffers for a channel from the pool of the data driver.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_allocateBuffer (IN  ProcessorId dspId,
+                          IN  ChannelId   chnlId,
+                          OUT Char8 **    bufArray,
+                          IN  Uint32      size,
+                          IN  Uint32      numBufs)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LINKCFG_DataDrv * dataDrv ;
+    PoolId            poolId ;
+    Uint32            i ;
+
+    TRC_5ENTER ("LDRV_CHNL_allocateBuffer",
+                dspId,
+                chnlId,
+                bufArray,
+                size,
+                numBufs) ;
+
+    DBC_Require (bufArray != NULL) ;
+
+    if (LDRV_CHNL_getCtrl (dspId, chnlId) == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else if ((size == 0u) || (numBufs == 0u) || (numBufs > MAX_ALLOC_BUFFERS)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        dataDrv = &(LDRV_getDspConfig (dspId)->dataTable [LDRV_CHNL_DATADRV]) ;
+        poolId  = POOL_makePoolId (dspId, dataDrv->poolId) ;
+        for (i = 0u ; (i < numBufs) && DSP_SUCCEEDED (status) ; i++) {
+            status = LDRV_POOL_alloc (poolId, (Pvoid *) &bufArray [i], size) ;
+        }
+
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+            /* Release the buffers allocated before the failure. */
+            for (i = i - 1u ; i > 0u ; i--) {
+                LDRV_POOL_free (poolId, bufArray [i - 1u], size) ;
+                bufArray [i - 1u] = NULL ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_allocateBuffer", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_freeBuffer
+ *
+ *  @desc   Frees buffers allocated for a channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_freeBuffer (IN ProcessorId dspId,
+                      IN ChannelId   chnlId,
+                      IN Char8 **    bufArray,
+                      IN Uint32      numBufs)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    DSP_STATUS        tmpStatus ;
+    LINKCFG_DataDrv * dataDrv ;
+    PoolId            poolId ;
+    Uint32            i ;
+
+    TRC_4ENTER ("LDRV_CHNL_freeBuffer", dspId, chnlId, bufArray, numBufs) ;
+
+    DBC_Require (bufArray != NULL) ;
+
+    if (LDRV_CHNL_getCtrl (dspId, chnlId) == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else if ((numBufs == 0u) || (numBufs > MAX_ALLOC_BUFFERS)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        dataDrv = &(LDRV_getDspConfig (dspId)->dataTable [LDRV_CHNL_DATADRV]) ;
+        poolId  = POOL_makePoolId (dspId, dataDrv->poolId) ;
+        for (i = 0u ; i < numBufs ; i++) {
+            tmpStatus = LDRV_POOL_free (poolId, bufArray [i], 0u) ;
+            if (DSP_FAILED (tmpStatus) && DSP_SUCCEEDED (status)) {
+                status = tmpStatus ;
+                SET_FAILURE_REASON ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_freeBuffer", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_issue
+ *
+ *  @desc   Issues an I/O request on a channel. Requests issued before the
+ *          DSP runs are transferred with the next request of the loopback
+ *          pair.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_issue (IN ProcessorId     dspId,
+                 IN ChannelId       chnlId,
+                 IN ChannelIOInfo * ioReq)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_CHNL_Ctrl *  ctrl ;
+    LINKCFG_DataDrv * dataDrv ;
+    LDRV_CHNL_Irp *   irp ;
+    Uint32            physAddr ;
+
+    TRC_3ENTER ("LDRV_CHNL_issue", dspId, chnlId, ioReq) ;
+
+    DBC_Require (ioReq != NULL) ;
+
+    ctrl = LDRV_CHNL_getCtrl (dspId, chnlId) ;
+    if (ctrl == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        dataDrv  = &(LDRV_getDspConfig (dspId)->dataTable [LDRV_CHNL_DATADRV]) ;
+        physAddr = LDRV_usrToPhy (dspId, ioReq->buffer) ;
+        if (    (ioReq->size == 0u)
+            ||  (   (dataDrv->maxBufSize != 0u)
+                 && (ioReq->size > dataDrv->maxBufSize))) {
+            status = CHNL_E_BUFSIZE ;
+            SET_FAILURE_REASON ;
+        }
+        else if (   (physAddr == LDRV_INVALID_ADDR)
+                 || (   LDRV_usrToPhy (dspId, ioReq->buffer + ioReq->size - 1u)
+                     != (physAddr + ioReq->size - 1u))) {
+            status = DSP_EPOINTER ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        if (ctrl->created == FALSE) {
+            status = CHNL_E_WRONGSTATE ;
+            SET_FAILURE_REASON ;
+        }
+        else if (LDRV_CHNL_outstanding (ctrl) >= ctrl->maxQueue) {
+            status = CHNL_E_NOIORPS ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            irp = &(ctrl->pend [LDRV_CHNL_SLOT (ctrl->pendTail)]) ;
+            irp->bufPhys = physAddr ;
+            irp->size    = ioReq->size ;
+            irp->arg     = ioReq->arg ;
+            irp->status  = DSP_SOK ;
+            ctrl->pendTail++ ;
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+
+        if (DSP_SUCCEEDED (status)) {
+            /* A DSP that is not running picks the request up later. */
+            ZCPYDATA_request (dspId, LDRV_CHNL_DATADRV, chnlId) ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_issue", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_reclaim
+ *
+ *  @desc   Reclaims the oldest completed request of a channel.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_reclaim (IN     ProcessorId     dspId,
+                   IN     ChannelId       chnlId,
+                   IN     Uint32          timeout,
+                   IN OUT ChannelIOInfo * ioReq)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    struct timespec * until  = NULL ;
+    struct timespec   deadline ;
+    LDRV_CHNL_Ctrl *  ctrl ;
+    LDRV_CHNL_Irp *   irp ;
+
+    TRC_4ENTER ("LDRV_CHNL_reclaim", dspId, chnlId, timeout, ioReq) ;
+
+    DBC_Require (ioReq != NULL) ;
+
+    ctrl = LDRV_CHNL_getCtrl (dspId, chnlId) ;
+    if (ctrl == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        if ((timeout != WAIT_FOREVER) && (timeout != WAIT_NONE)) {
+            SYNC_HOST_deadline (timeout, &deadline) ;
+            until = &deadline ;
+        }
+
+        SYNC_HOST_enter (&ctrl->lock) ;
+        if (ctrl->created == FALSE) {
+            status = CHNL_E_WRONGSTATE ;
+            SET_FAILURE_REASON ;
+        }
+        else if (LDRV_CHNL_outstanding (ctrl) == 0u) {
+            status = CHNL_E_NOIOC ;
+            SET_FAILURE_REASON ;
+        }
+
+        while (DSP_SUCCEEDED (status) && (ctrl->doneHead == ctrl->doneTail)) {
+            if (timeout == WAIT_NONE) {
+                status = CHNL_E_NOIOC ;
+            }
+            else {
+                status = SYNC_HOST_waitUntil (&ctrl->cond, &ctrl->lock, until) ;
+                if (ctrl->created == FALSE) {
+                    status = CHNL_E_WRONGSTATE ;
+                }
+            }
+
+            if (DSP_FAILED (status)) {
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            irp = &(ctrl->done [LDRV_CHNL_SLOT (ctrl->doneHead)]) ;
+            ioReq->buffer = (Char8 *) LDRV_phyToUsr (dspId, irp->bufPhys) ;
+            ioReq->size   = irp->size ;
+            ioReq->arg    = irp->arg ;
+            status        = irp->status ;
+            ctrl->doneHead++ ;
+        }
+
+        /* Clearing on every reclaim that empties the ring also absorbs a
+         * raise from another process that arrived after it was emptied.
+         */
+        if (    (ctrl->polled == TRUE)
+            &&  (ctrl->ownerSlot == LDRV_procSlot ())
+            &&  (ctrl->doneHead == ctrl->doneTail)) {
+            SYNC_HOST_clearPollFd (ctrl->pollFd) ;
+            ctrl->pollRaised = FALSE ;
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_reclaim", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_getPollFd
+ *
+ *  @desc   Gets the pollable descriptor of a channel, creating it on the
+ *          first call.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_getPollFd (IN  ProcessorId dspId,
+                     IN  ChannelId   chnlId,
+                     OUT Int32 *     fd)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_CHNL_Ctrl * ctrl ;
+
+    TRC_3ENTER ("LDRV_CHNL_getPollFd", dspId, chnlId, fd) ;
+
+    DBC_Require (fd != NULL) ;
+
+    ctrl = LDRV_CHNL_getCtrl (dspId, chnlId) ;
+    if (ctrl == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        if (ctrl->created == FALSE) {
+            status = CHNL_E_WRONGSTATE ;
+            SET_FAILURE_REASON ;
+        }
+        else if (ctrl->ownerSlot != LDRV_procSlot ()) {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+        else if (ctrl->polled == FALSE) {
+            status = SYNC_HOST_createPollFd (&ctrl->pollFd) ;
+            if (DSP_SUCCEEDED (status)) {
+                ctrl->polled     = TRUE ;
+                ctrl->pollRaised = (ctrl->doneHead != ctrl->doneTail) ;
+                if (ctrl->pollRaised == TRUE) {
+                    SYNC_HOST_raisePollFd (ctrl->pollFd) ;
+                }
+            }
+            else {
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            *fd = ctrl->pollFd ;
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_getPollFd", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_idle
+ *
+ *  @desc   Idles a channel: an output channel waits for its pending requests
+ *          to be transferred, an input channel cancels them.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_idle (IN ProcessorId dspId, IN ChannelId chnlId)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    Bool             wake   = FALSE ;
+    LDRV_CHNL_Ctrl * ctrl ;
+    Uint32           slot ;
+    Int32            fd ;
+
+    TRC_2ENTER ("LDRV_CHNL_idle", dspId, chnlId) ;
+
+    ctrl = LDRV_CHNL_getCtrl (dspId, chnlId) ;
+    if (ctrl == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        if (ctrl->created == FALSE) {
+            status = CHNL_E_WRONGSTATE ;
+            SET_FAILURE_REASON ;
+        }
+        else if (ctrl->mode == ChannelMode_Input) {
+            LDRV_CHNL_cancel (ctrl) ;
+            wake = LDRV_CHNL_pollRaise (ctrl, &slot, &fd) ;
+        }
+        else {
+            while (    (ctrl->created == TRUE)
+                   &&  (ctrl->pendHead != ctrl->pendTail)) {
+                SYNC_HOST_waitUntil (&ctrl->cond, &ctrl->lock, NULL) ;
+            }
+
+            if (ctrl->created == FALSE) {
+                status = CHNL_E_WRONGSTATE ;
+                SET_FAILURE_REASON ;
+            }
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+
+        if (wake == TRUE) {
+            LDRV_IPS_userSignal (slot, fd) ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_idle", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_flush
+ *
+ *  @desc   Cancels the pending requests of a channel. They are reclaimed
+ *          with the status CHNL_E_CANCELLED.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_flush (IN ProcessorId dspId, IN ChannelId chnlId)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    Bool             wake   = FALSE ;
+    LDRV_CHNL_Ctrl * ctrl ;
+    Uint32           slot ;
+    Int32            fd ;
+
+    TRC_2ENTER ("LDRV_CHNL_flush", dspId, chnlId) ;
+
+    ctrl = LDRV_CHNL_getCtrl (dspId, chnlId) ;
+    if (ctrl == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        if (ctrl->created == FALSE) {
+            status = CHNL_E_WRONGSTATE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            LDRV_CHNL_cancel (ctrl) ;
+            wake = LDRV_CHNL_pollRaise (ctrl, &slot, &fd) ;
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+
+        if (wake == TRUE) {
+            LDRV_IPS_userSignal (slot, fd) ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_flush", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_control
+ *
+ *  @desc   Channel specific commands; none is supported by the host backend.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_control (IN ProcessorId dspId,
+                   IN ChannelId   chnlId,
+                   IN Int32       cmd,
+                   IN OPT Pvoid   arg)
+{
+    DSP_STATUS status = DSP_ENOTIMPL ;
+
+    TRC_4ENTER ("LDRV_CHNL_control", dspId, chnlId, cmd, arg) ;
+
+    (Void) cmd ;
+    (Void) arg ;
+
+    if (LDRV_CHNL_getCtrl (dspId, chnlId) == NULL) {
+        status = CHNL_E_BADCHANID ;
+    }
+    SET_FAILURE_REASON ;
+
+    TRC_1LEAVE ("LDRV_CHNL_control", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_dspTransfer
+ *
+ *  @desc   DSP side of the data driver: copies the pending output requests
+ *          of the loopback pair of a channel into its pending input
+ *          requests, and completes both once copied.
+ *
+ *  @modif  LDRV_CHNL_ctrls
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_CHNL_dspTransfer (IN ProcessorId dspId, IN ChannelId chnlId)
+{
+    Bool             completed = FALSE ;
+    LDRV_CHNL_Ctrl * first ;
+    LDRV_CHNL_Ctrl * second ;
+    LDRV_CHNL_Ctrl * output ;
+    LDRV_CHNL_Ctrl * input ;
+    LDRV_CHNL_Copy * copies ;
+    LDRV_CHNL_Copy * copy ;
+    LDRV_CHNL_Irp *  outIrp ;
+    LDRV_CHNL_Irp *  inIrp ;
+    DSP_STATUS       status ;
+    Uint32           bytes ;
+
+    first  = LDRV_CHNL_getCtrl (dspId, chnlId & ~1u) ;
+    second = LDRV_CHNL_getCtrl (dspId, LDRV_CHNL_PEER (chnlId & ~1u)) ;
+    if ((first != NULL) && (second != NULL)) {
+        /* Locks are always taken in the order of the channel identifiers. */
+        SYNC_HOST_enter (&first->lock) ;
+        SYNC_HOST_enter (&second->lock) ;
+        if (    (first->created == TRUE)
+            &&  (second->created == TRUE)
+            &&  (first->mode != second->mode)) {
+            output = (first->mode == ChannelMode_Output) ? first  : second ;
+            input  = (first->mode == ChannelMode_Output) ? second : first ;
+            copies = LDRV_CHNL_copies [dspId][chnlId >> 1u] ;
+            while (    (output->xferHead != output->pendTail)
+                   &&  (input->xferHead  != input->pendTail)) {
+                outIrp = &(output->pend [LDRV_CHNL_SLOT (output->xferHead)]) ;
+                inIrp  = &(input->pend [LDRV_CHNL_SLOT (input->xferHead)]) ;
+                copy   = &(copies [LDRV_CHNL_SLOT (output->xferHead)]) ;
+                bytes  = (outIrp->size < inIrp->size) ? outIrp->size
+                                                      : inIrp->size ;
+                inIrp->size = bytes ;
+
+                copy->request.dst    = LDRV_phyToUsr (dspId, inIrp->bufPhys) ;
+                copy->request.src    = LDRV_phyToUsr (dspId, outIrp->bufPhys) ;
+                copy->request.size   = bytes ;
+                copy->request.fnDone = LDRV_CHNL_copyDone ;
+                copy->request.arg    = copy ;
+                copy->dspId          = dspId ;
+                copy->chnlId         = chnlId & ~1u ;
+                copy->ready          = FALSE ;
+
+                /* Small blocks, or all of them if the engine cannot run,
+                 * are copied in place.
+                 */
+                status = DSP_EFAIL ;
+                if (bytes >= LOOPDMA_MINSIZE) {
+                    status = LOOPDMA_submit (dspId, &copy->request) ;
+                }
+                if (DSP_FAILED (status)) {
+                    memcpy (copy->request.dst, copy->request.src, bytes) ;
+                    copy->ready = TRUE ;
+                }
+
+                output->xferHead++ ;
+                input->xferHead++ ;
+            }
+
+            completed = LDRV_CHNL_retire (dspId, output, input, copies) ;
+        }
+        SYNC_HOST_leave (&second->lock) ;
+        SYNC_HOST_leave (&first->lock) ;
+    }
+
+    return completed ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_complete
+ *
+ *  @desc   GPP side of the data driver: wakes up the reclaimers of the
+ *          loopback pair of a channel and raises their pollable descriptors.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_CHNL_complete (IN ProcessorId dspId, IN ChannelId chnlId)
+{
+    LDRV_CHNL_Ctrl * ctrl ;
+    Bool             wake ;
+    Uint32           slot ;
+    Int32            fd ;
+    Uint32           i ;
+
+    for (i = 0u ; i < 2u ; i++) {
+        ctrl = LDRV_CHNL_getCtrl (dspId, (chnlId & ~1u) + i) ;
+        if (ctrl != NULL) {
+            SYNC_HOST_enter (&ctrl->lock) ;
+            SYNC_HOST_broadcast (&ctrl->cond) ;
+            wake = LDRV_CHNL_pollRaise (ctrl, &slot, &fd) ;
+            SYNC_HOST_leave (&ctrl->lock) ;
+
+            if (wake == TRUE) {
+                LDRV_IPS_userSignal (slot, fd) ;
+            }
+        }
+    }
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_CHNL_instrument
+ *
+ *  @desc   Gets the instrumentation information of a channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_instrument (IN  ProcessorId       dspId,
+                      IN  ChannelId         chnlId,
+                      OUT CHNL_Instrument * retVal)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_CHNL_Ctrl * ctrl ;
+
+    TRC_3ENTER ("LDRV_CHNL_instrument", dspId, chnlId, retVal) ;
+
+    DBC_Require (retVal != NULL) ;
+
+    ctrl = LDRV_CHNL_getCtrl (dspId, chnlId) ;
+    if (ctrl == NULL) {
+        status = CHNL_E_BADCHANID ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        retVal->procId        = dspId ;
+        retVal->chnlId        = chnlId ;
+        retVal->active        = (Bool) ctrl->created ;
+        retVal->mode          = (ChannelMode) ctrl->mode ;
+        retVal->chnlShared    = &LDRV_CHNL_shared ;
+        retVal->transferred   = ctrl->transferred ;
+        retVal->numBufsQueued = ctrl->pendTail - ctrl->pendHead ;
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_instrument", status) ;
+
+    return status ;
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (DDSP_DEBUG)
+/** ============================================================================
+ *  @func   LDRV_CHNL_debug
+ *
+ *  @desc   Prints the state of a channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_CHNL_debug (IN ProcessorId dspId, IN ChannelId chnlId)
+{
+    LDRV_CHNL_Ctrl * ctrl ;
+
+    ctrl = LDRV_CHNL_getCtrl (dspId, chnlId) ;
+    if (ctrl != NULL) {
+        TRC_2PRINT (TRC_LEVEL4, "CHNL [%d] of DSP [%d]\n", chnlId, dspId) ;
+        TRC_1PRINT (TRC_LEVEL4, "    created     [%d]\n", ctrl->created) ;
+        TRC_1PRINT (TRC_LEVEL4, "    mode        [%d]\n", ctrl->mode) ;
+        TRC_1PRINT (TRC_LEVEL4, "    ownerSlot   [%d]\n", ctrl->ownerSlot) ;
+        TRC_1PRINT (TRC_LEVEL4, "    pending     [%d]\n",
+                    ctrl->pendTail - ctrl->pendHead) ;
+        TRC_1PRINT (TRC_LEVEL4, "    completed   [%d]\n",
+                    ctrl->doneTail - ctrl->doneHead) ;
+        TRC_1PRINT (TRC_LEVEL4, "    transferred [%d]\n", ctrl->transferred) ;
+    }
+}
+#endif /* if defined (DDSP_DEBUG) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
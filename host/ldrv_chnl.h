@@ -0,0 +1,593 @@
+/** ============================================================================
+ *  @file   ldrv_chnl.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the CHNL manager of the host backend.
+ *          The control block of every channel sits in the link driver memory
+ *          shared with the DSP. It holds the I/O requests issued on the
+ *          channel and not yet transferred, and the completed requests not
+ *          yet reclaimed.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LDRV_CHNL_H)
+#define LDRV_CHNL_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <chnldefs.h>
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  LDRV_CHNL_MAXQUEUE
+ *
+ *  @desc   Highest number of outstanding I/O requests per channel.
+ *  ============================================================================
+ */
+#define LDRV_CHNL_MAXQUEUE      16u
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_init
+ *
+ *  @desc   Initializes the CHNL manager and the data drivers in the calling
+ *          process.
+ *
+ *  @arg    create
+ *              TRUE if the shared state is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The link driver memory is exhausted.
+ *          DSP_ECONFIG
+ *              Invalid data driver configuration.
+ *
+ *  @enter  LDRV_IPS_init and LDRV_POOL_init have been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_init (IN Bool create) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_exit
+ *
+ *  @desc   Finalizes the CHNL manager in the calling process. The channels
+ *          still created by the calling process are deleted.
+ *
+ *  @arg    destroy
+ *              TRUE if the shared state is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_exit (IN Bool destroy) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_create
+ *
+ *  @desc   Creates a channel owned by the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *  @arg    attrs
+ *              Attributes of the channel.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          CHNL_E_BADCHANID
+ *              The channel is not configured.
+ *          CHNL_E_CHANBUSY
+ *              The channel is already created.
+ *          CHNL_E_BADMODE
+ *              Invalid mode.
+ *
+ *  @enter  attrs is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_delete
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_create (IN ProcessorId    dspId,
+                  IN ChannelId      chnlId,
+                  IN ChannelAttrs * attrs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_delete
+ *
+ *  @desc   Deletes a channel. Outstanding I/O requests are dropped.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          CHNL_E_WRONGSTATE
+ *              The channel is not created.
+ *          DSP_EACCESSDENIED
+ *              The channel is owned by another process.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_create
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_delete (IN ProcessorId dspId, IN ChannelId chnlId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_allocateBuffer
+ *
+ *  @desc   Allocates buffers for a channel from the pool of its data driver.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *  @arg    bufArray
+ *              Location to receive the buffers.
+ *  @arg    size
+ *              Size of each buffer.
+ *  @arg    numBufs
+ *              Number of buffers.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              Not enough buffers. None is allocated.
+ *          CHNL_E_BUFSIZE
+ *              The size is larger than the buffers of the data driver.
+ *
+ *  @enter  bufArray is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_freeBuffer
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_allocateBuffer (IN  ProcessorId dspId,
+                          IN  ChannelId   chnlId,
+                          OUT Char8 **    bufArray,
+                          IN  Uint32      size,
+                          IN  Uint32      numBufs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_freeBuffer
+ *
+ *  @desc   Frees buffers allocated for a channel.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *  @arg    bufArray
+ *              Buffers.
+ *  @arg    numBufs
+ *              Number of buffers.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              A buffer does not belong to the pool.
+ *
+ *  @enter  bufArray is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_allocateBuffer
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_freeBuffer (IN ProcessorId dspId,
+                      IN ChannelId   chnlId,
+                      IN Char8 **    bufArray,
+                      IN Uint32      numBufs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_issue
+ *
+ *  @desc   Issues an I/O request on a channel.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *  @arg    ioReq
+ *              I/O request. For an input channel, size is the size of the
+ *              buffer.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          CHNL_E_NOIORPS
+ *              Too many outstanding I/O requests.
+ *          CHNL_E_BUFSIZE
+ *              The buffer is larger than the buffers of the data driver.
+ *          DSP_EPOINTER
+ *              The buffer is not shared with the DSP.
+ *          CHNL_E_WRONGSTATE
+ *              The channel is not created.
+ *
+ *  @enter  ioReq is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_reclaim
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_issue (IN ProcessorId     dspId,
+                 IN ChannelId       chnlId,
+                 IN ChannelIOInfo * ioReq) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_reclaim
+ *
+ *  @desc   Reclaims the oldest completed I/O request of a channel.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *  @arg    timeout
+ *              Time to wait for a completion.
+ *  @arg    ioReq
+ *              Location to receive the I/O request. For an input channel,
+ *              size is the number of bytes received.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          CHNL_E_NOIOC
+ *              No completed request, and timeout is WAIT_NONE or nothing is
+ *              outstanding.
+ *          DSP_ETIMEOUT
+ *              No request completed in time.
+ *          CHNL_E_CANCELLED
+ *              The request was cancelled by a flush or an idle.
+ *          CHNL_E_WRONGSTATE
+ *              The channel is not created.
+ *
+ *  @enter  ioReq is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_issue
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_reclaim (IN     ProcessorId     dspId,
+                   IN     ChannelId       chnlId,
+                   IN     Uint32          timeout,
+                   IN OUT ChannelIOInfo * ioReq) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_getPollFd
+ *
+ *  @desc   Gets the pollable descriptor of a channel, creating it on the
+ *          first call. The descriptor is readable while completed requests
+ *          wait to be reclaimed.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *  @arg    fd
+ *              Location to receive the descriptor.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          CHNL_E_BADCHANID
+ *              Invalid channel identifier.
+ *          CHNL_E_WRONGSTATE
+ *              The channel is not created.
+ *          DSP_EACCESSDENIED
+ *              The channel is owned by another process.
+ *          DSP_ERESOURCE
+ *              The descriptor cannot be created.
+ *
+ *  @enter  fd is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_reclaim
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_getPollFd (IN  ProcessorId dspId,
+                     IN  ChannelId   chnlId,
+                     OUT Int32 *     fd) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_idle
+ *
+ *  @desc   Idles a channel. An output channel waits for its requests to be
+ *          transferred; an input channel cancels its requests.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          CHNL_E_WRONGSTATE
+ *              The channel is not created, or deleted while waiting.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_flush
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_idle (IN ProcessorId dspId, IN ChannelId chnlId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_flush
+ *
+ *  @desc   Cancels the requests of a channel not yet transferred. They are
+ *          reclaimed with CHNL_E_CANCELLED.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          CHNL_E_WRONGSTATE
+ *              The channel is not created.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_idle
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_flush (IN ProcessorId dspId, IN ChannelId chnlId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_control
+ *
+ *  @desc   Device specific control of a channel. Not supported.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *  @arg    cmd
+ *              Command.
+ *  @arg    arg
+ *              Argument of the command.
+ *
+ *  @ret    DSP_ENOTIMPL
+ *              Not supported.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_control (IN ProcessorId dspId,
+                   IN ChannelId   chnlId,
+                   IN Int32       cmd,
+                   IN OPT Pvoid   arg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_dspTransfer
+ *
+ *  @desc   DSP side of the data transfer: moves the data of the pending
+ *          output requests of a loopback pair of channels into the pending
+ *          input requests of the pair. Blocks of LOOPDMA_MINSIZE bytes or
+ *          more are copied by the DMA engine of the DSP; their requests
+ *          complete later, and are signalled to the GPP by the engine.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Either channel of the pair.
+ *
+ *  @ret    TRUE if at least one request completed before returning.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_complete
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_CHNL_dspTransfer (IN ProcessorId dspId, IN ChannelId chnlId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_complete
+ *
+ *  @desc   GPP side of a completion: wakes up the reclaimers of a loopback
+ *          pair of channels.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Either channel of the pair.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_CHNL_dspTransfer
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_CHNL_complete (IN ProcessorId dspId, IN ChannelId chnlId) ;
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_CHNL_instrument
+ *
+ *  @desc   Gets the instrumentation information of a channel.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *  @arg    retVal
+ *              Location to receive the information.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          CHNL_E_BADCHANID
+ *              The channel is not configured.
+ *
+ *  @enter  retVal is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_instrument (IN  ProcessorId       dspId,
+                      IN  ChannelId         chnlId,
+                      OUT CHNL_Instrument * retVal) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (DDSP_DEBUG)
+/** ============================================================================
+ *  @func   LDRV_CHNL_debug
+ *
+ *  @desc   Prints the state of a channel.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_CHNL_debug (IN ProcessorId dspId, IN ChannelId chnlId) ;
+#endif /* if defined (DDSP_DEBUG) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LDRV_CHNL_H) */
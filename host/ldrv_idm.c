@@ -0,0 +1,460 @@
+/** ============================================================================
+ *  @file   ldrv_idm.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the ID Manager (IDM) of the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+#include <ldrv.h>
+#include <ldrv_idm.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_GEN_IDM, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @name   LDRV_IDM_Id
+ *
+ *  @desc   State of an identifier.
+ *
+ *  @field  refCount
+ *              Number of acquires not released yet, 0 if the identifier is
+ *              free.
+ *  @field  idKey
+ *              Key string the identifier is acquired for.
+ *  ============================================================================
+ */
+typedef struct LDRV_IDM_Id_tag {
+    Uint32   refCount ;
+    Char8    idKey [DSP_MAX_STRLEN] ;
+} LDRV_IDM_Id ;
+
+/*  ============================================================================
+ *  @name   LDRV_IDM_Entry
+ *
+ *  @desc   State of an IDM object.
+ *
+ *  @field  inUse
+ *              TRUE while the object exists.
+ *  @field  key
+ *              Key of the object.
+ *  @field  baseId
+ *              First identifier managed by the object.
+ *  @field  numIds
+ *              Number of identifiers managed by the object.
+ *  @field  ids
+ *              State of the identifiers.
+ *  ============================================================================
+ */
+typedef struct LDRV_IDM_Entry_tag {
+    Uint32       inUse  ;
+    Uint32       key    ;
+    Uint32       baseId ;
+    Uint32       numIds ;
+    LDRV_IDM_Id  ids [LDRV_IDM_MAXIDS] ;
+} LDRV_IDM_Entry ;
+
+/*  ============================================================================
+ *  @name   LDRV_IDM_Object
+ *
+ *  @desc   Private state of the IDM in the driver segment.
+ *
+ *  @field  lock
+ *              Lock protecting the IDM objects.
+ *  @field  entries
+ *              IDM objects.
+ *  ============================================================================
+ */
+typedef struct LDRV_IDM_Object_tag {
+    SYNC_HostLock   lock ;
+    LDRV_IDM_Entry  entries [LDRV_IDM_MAXOBJECTS] ;
+} LDRV_IDM_Object ;
+
+
+/*  ============================================================================
+ *  @name   LDRV_IDM_state
+ *
+ *  @desc   Private state of the IDM in the driver segment.
+ *  ============================================================================
+ */
+STATIC LDRV_IDM_Object * LDRV_IDM_state = NULL ;
+
+
+/*  ============================================================================
+ *  @func   LDRV_IDM_find
+ *
+ *  @desc   Finds an IDM object by key.
+ *
+ *  @arg    key
+ *              Key of the IDM object.
+ *
+ *  @ret    IDM object, NULL if not found.
+ *
+ *  @enter  The lock of the IDM is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+LDRV_IDM_Entry *
+LDRV_IDM_find (IN Uint32 key)
+{
+    LDRV_IDM_Entry * entry = NULL ;
+    Uint32           i ;
+
+    for (i = 0u ; (i < LDRV_IDM_MAXOBJECTS) && (entry == NULL) ; i++) {
+        if (    (LDRV_IDM_state->entries [i].inUse == TRUE)
+            &&  (LDRV_IDM_state->entries [i].key == key)) {
+            entry = &(LDRV_IDM_state->entries [i]) ;
+        }
+    }
+
+    return entry ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_init
+ *
+ *  @desc   Initializes the IDM in the calling process.
+ *
+ *  @modif  LDRV_IDM_state
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_init (IN Bool create)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_IDM_Object * idmState ;
+
+    TRC_1ENTER ("LDRV_IDM_init", create) ;
+
+    if (create == TRUE) {
+        LDRV_Obj->compState [LDRV_Comp_Idm] =
+                                   LDRV_drvAlloc (sizeof (LDRV_IDM_Object)) ;
+        idmState = (LDRV_IDM_Object *) LDRV_compState (LDRV_Comp_Idm) ;
+        if (idmState == NULL) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            status = SYNC_HOST_createLock (&idmState->lock) ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        LDRV_IDM_state = (LDRV_IDM_Object *) LDRV_compState (LDRV_Comp_Idm) ;
+    }
+
+    TRC_1LEAVE ("LDRV_IDM_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_exit
+ *
+ *  @desc   Finalizes the IDM in the calling process.
+ *
+ *  @modif  LDRV_IDM_state
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_exit (IN Bool destroy)
+{
+    TRC_1ENTER ("LDRV_IDM_exit", destroy) ;
+
+    if ((LDRV_IDM_state != NULL) && (destroy == TRUE)) {
+        SYNC_HOST_deleteLock (&LDRV_IDM_state->lock) ;
+    }
+
+    LDRV_IDM_state = NULL ;
+
+    TRC_1LEAVE ("LDRV_IDM_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_create
+ *
+ *  @desc   Creates an IDM object.
+ *
+ *  @modif  LDRV_IDM_state->entries
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_create (IN Uint32 key, IN IDM_Attrs * attrs)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_IDM_Entry * entry  = NULL ;
+    Uint32           i ;
+
+    TRC_2ENTER ("LDRV_IDM_create", key, attrs) ;
+
+    DBC_Require (attrs != NULL) ;
+
+    if (    (attrs->endId < attrs->baseId)
+        ||  ((attrs->endId - attrs->baseId) >= LDRV_IDM_MAXIDS)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&LDRV_IDM_state->lock) ;
+        if (LDRV_IDM_find (key) != NULL) {
+            status = DSP_EALREADYEXISTS ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            for (i = 0u ; (i < LDRV_IDM_MAXOBJECTS) && (entry == NULL) ; i++) {
+                if (LDRV_IDM_state->entries [i].inUse == FALSE) {
+                    entry = &(LDRV_IDM_state->entries [i]) ;
+                }
+            }
+
+            if (entry == NULL) {
+                status = DSP_ERESOURCE ;
+                SET_FAILURE_REASON ;
+            }
+            else {
+                memset (entry, 0, sizeof (LDRV_IDM_Entry)) ;
+                entry->key    = key ;
+                entry->baseId = attrs->baseId ;
+                entry->numIds = attrs->endId - attrs->baseId + 1u ;
+                entry->inUse  = TRUE ;
+            }
+        }
+        SYNC_HOST_leave (&LDRV_IDM_state->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_IDM_create", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_delete
+ *
+ *  @desc   Deletes an IDM object.
+ *
+ *  @modif  LDRV_IDM_state->entries
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_delete (IN Uint32 key)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_IDM_Entry * entry ;
+
+    TRC_1ENTER ("LDRV_IDM_delete", key) ;
+
+    SYNC_HOST_enter (&LDRV_IDM_state->lock) ;
+    entry = LDRV_IDM_find (key) ;
+    if (entry == NULL) {
+        status = DSP_ENOTFOUND ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        entry->inUse = FALSE ;
+    }
+    SYNC_HOST_leave (&LDRV_IDM_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_IDM_delete", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_acquireId
+ *
+ *  @desc   Acquires the identifier of a key string.
+ *
+ *  @modif  LDRV_IDM_state->entries
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_acquireId (IN Uint32 key, IN Pstr idKey, OUT Uint32 * id)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_IDM_Id *    free   = NULL ;
+    LDRV_IDM_Id *    found  = NULL ;
+    LDRV_IDM_Entry * entry ;
+    Uint32           i ;
+
+    TRC_3ENTER ("LDRV_IDM_acquireId", key, idKey, id) ;
+
+    DBC_Require (idKey != NULL) ;
+    DBC_Require (id != NULL) ;
+
+    SYNC_HOST_enter (&LDRV_IDM_state->lock) ;
+    entry = LDRV_IDM_find (key) ;
+    if (entry == NULL) {
+        status = DSP_ENOTFOUND ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        for (i = 0u ; (i < entry->numIds) && (found == NULL) ; i++) {
+            if (entry->ids [i].refCount == 0u) {
+                if (free == NULL) {
+                    free = &(entry->ids [i]) ;
+                }
+            }
+            else if (strncmp (entry->ids [i].idKey,
+                              idKey,
+                              DSP_MAX_STRLEN) == 0) {
+                found = &(entry->ids [i]) ;
+            }
+        }
+
+        if (found == NULL) {
+            found = free ;
+            if (found != NULL) {
+                strncpy (found->idKey, idKey, DSP_MAX_STRLEN - 1u) ;
+                found->idKey [DSP_MAX_STRLEN - 1u] = '\0' ;
+            }
+        }
+
+        if (found == NULL) {
+            status = DSP_ERESOURCE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            found->refCount++ ;
+            *id = entry->baseId + (Uint32) (found - entry->ids) ;
+        }
+    }
+    SYNC_HOST_leave (&LDRV_IDM_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_IDM_acquireId", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_releaseId
+ *
+ *  @desc   Releases an identifier.
+ *
+ *  @modif  LDRV_IDM_state->entries
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_releaseId (IN Uint32 key, IN Uint32 id)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_IDM_Entry * entry ;
+
+    TRC_2ENTER ("LDRV_IDM_releaseId", key, id) ;
+
+    SYNC_HOST_enter (&LDRV_IDM_state->lock) ;
+    entry = LDRV_IDM_find (key) ;
+    if (entry == NULL) {
+        status = DSP_ENOTFOUND ;
+        SET_FAILURE_REASON ;
+    }
+    else if (    (id < entry->baseId)
+             ||  ((id - entry->baseId) >= entry->numIds)
+             ||  (entry->ids [id - entry->baseId].refCount == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        entry->ids [id - entry->baseId].refCount-- ;
+    }
+    SYNC_HOST_leave (&LDRV_IDM_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_IDM_releaseId", status) ;
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
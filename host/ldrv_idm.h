@@ -0,0 +1,252 @@
+/** ============================================================================
+ *  @file   ldrv_idm.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the ID Manager (IDM) of the host backend.
+ *          The IDM objects live in the driver segment and are shared by all
+ *          the processes.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LDRV_IDM_H)
+#define LDRV_IDM_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_idm_usr.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  LDRV_IDM_MAXOBJECTS
+ *
+ *  @desc   Highest number of IDM objects.
+ *  ============================================================================
+ */
+#define LDRV_IDM_MAXOBJECTS     16u
+
+/** ============================================================================
+ *  @const  LDRV_IDM_MAXIDS
+ *
+ *  @desc   Highest number of identifiers of an IDM object.
+ *  ============================================================================
+ */
+#define LDRV_IDM_MAXIDS         64u
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_init
+ *
+ *  @desc   Initializes the IDM in the calling process.
+ *
+ *  @arg    create
+ *              TRUE if the shared state is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The driver segment is exhausted.
+ *
+ *  @enter  The segments of the link driver are mapped.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IDM_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_init (IN Bool create) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_exit
+ *
+ *  @desc   Finalizes the IDM in the calling process.
+ *
+ *  @arg    destroy
+ *              TRUE if the shared state is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IDM_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_exit (IN Bool destroy) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_create
+ *
+ *  @desc   Creates an IDM object.
+ *
+ *  @arg    key
+ *              Key of the IDM object.
+ *  @arg    attrs
+ *              Attributes of the IDM object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EALREADYEXISTS
+ *              An IDM object with this key already exists.
+ *          DSP_ERESOURCE
+ *              No free IDM object is available.
+ *          DSP_EINVALIDARG
+ *              Invalid range of identifiers.
+ *
+ *  @enter  attrs must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IDM_delete
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_create (IN Uint32 key, IN IDM_Attrs * attrs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_delete
+ *
+ *  @desc   Deletes an IDM object.
+ *
+ *  @arg    key
+ *              Key of the IDM object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              No IDM object with this key exists.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IDM_create
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_delete (IN Uint32 key) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_acquireId
+ *
+ *  @desc   Acquires the identifier of a key string.
+ *
+ *  @arg    key
+ *              Key of the IDM object.
+ *  @arg    idKey
+ *              Key string of the identifier.
+ *  @arg    id
+ *              Location to receive the identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              No IDM object with this key exists.
+ *          DSP_ERESOURCE
+ *              All the identifiers are in use.
+ *
+ *  @enter  idKey and id must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IDM_releaseId
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_acquireId (IN Uint32 key, IN Pstr idKey, OUT Uint32 * id) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IDM_releaseId
+ *
+ *  @desc   Releases an identifier.
+ *
+ *  @arg    key
+ *              Key of the IDM object.
+ *  @arg    id
+ *              Identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              No IDM object with this key exists.
+ *          DSP_EINVALIDARG
+ *              The identifier is not acquired.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IDM_acquireId
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IDM_releaseId (IN Uint32 key, IN Uint32 id) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LDRV_IDM_H) */
@@ -0,0 +1,1165 @@
+/** ============================================================================
+ *  @file   ldrv_ips.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the Inter Processor Signaling (IPS) component of
+ *          the host loopback backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_ips.h>
+#include <ldrv_proc.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_IPS, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @name   LDRV_IPS_UserReg
+ *
+ *  @desc   Registration of a NOTIFY callback.
+ *
+ *  @field  used
+ *              TRUE if the entry is in use.
+ *  @field  procSlot
+ *              Process owning the callback.
+ *  @field  dspId
+ *              DSP identifier.
+ *  @field  ipsId
+ *              IPS identifier.
+ *  @field  eventNo
+ *              Event number.
+ *  @field  fnNotifyCbck
+ *              Callback, valid in the owning process only.
+ *  @field  cbckArg
+ *              Argument of the callback.
+ *  ============================================================================
+ */
+typedef struct LDRV_IPS_UserReg_tag {
+    Uint32        used         ;
+    Uint32        procSlot     ;
+    ProcessorId   dspId        ;
+    Uint32        ipsId        ;
+    Uint32        eventNo      ;
+    FnNotifyCbck  fnNotifyCbck ;
+    Pvoid         cbckArg      ;
+} LDRV_IPS_UserReg ;
+
+/*  ============================================================================
+ *  @name   LDRV_IPS_UserQueue
+ *
+ *  @desc   Queue of events pending delivery to the NOTIFY clients of one
+ *          process.
+ *
+ *  @field  lock
+ *              Lock protecting the queue.
+ *  @field  cond
+ *              Condition signalled when the queue changes.
+ *  @field  active
+ *              TRUE while the process dispatches events.
+ *  @field  pollCbck
+ *              Callback raising a pollable descriptor of the process, valid
+ *              in the process only.
+ *  @field  head
+ *              Number of events taken from the queue.
+ *  @field  tail
+ *              Number of events put into the queue.
+ *  @field  queue
+ *              Event queue.
+ *  ============================================================================
+ */
+typedef struct LDRV_IPS_UserQueue_tag {
+    SYNC_HostLock       lock   ;
+    SYNC_HostCond       cond   ;
+    Uint32              active   ;
+    FnNotifyCbck        pollCbck ;
+    Uint32              head     ;
+    Uint32              tail     ;
+    LDRV_IPS_UserEvent  queue [LDRV_IPS_USERQUEUELEN] ;
+} LDRV_IPS_UserQueue ;
+
+/*  ============================================================================
+ *  @name   LDRV_IPS_Object
+ *
+ *  @desc   Private state of the IPS component in the driver segment.
+ *
+ *  @field  ctrlPhys
+ *              Physical address of the control structure of every DSP.
+ *  @field  regLock
+ *              Lock protecting the registration table.
+ *  @field  regs
+ *              Registration table of the NOTIFY callbacks.
+ *  @field  userQueue
+ *              Event queue of every process.
+ *  @field  stats
+ *              Instrumentation information of every IPS.
+ *  ============================================================================
+ */
+typedef struct LDRV_IPS_Object_tag {
+    Uint32              ctrlPhys [MAX_DSPS] ;
+    SYNC_HostLock       regLock ;
+    LDRV_IPS_UserReg    regs [LDRV_IPS_MAXREGS] ;
+    LDRV_IPS_UserQueue  userQueue [LDRV_MAX_PROCESSES] ;
+#if defined (DDSP_PROFILE)
+    IPS_Instrument      stats [MAX_DSPS][LDRV_MAX_IPSENTRIES] ;
+#endif /* if defined (DDSP_PROFILE) */
+} LDRV_IPS_Object ;
+
+/*  ============================================================================
+ *  @name   LDRV_IPS_Handler
+ *
+ *  @desc   Process-local event handler.
+ *
+ *  @field  fnNotifyCbck
+ *              Handler function.
+ *  @field  cbckArg
+ *              Argument of the handler.
+ *  ============================================================================
+ */
+typedef struct LDRV_IPS_Handler_tag {
+    FnNotifyCbck  fnNotifyCbck ;
+    Pvoid         cbckArg      ;
+} LDRV_IPS_Handler ;
+
+
+/*  ============================================================================
+ *  @name   LDRV_IPS_state
+ *
+ *  @desc   Private state of the IPS component in the driver segment.
+ *  ============================================================================
+ */
+STATIC LDRV_IPS_Object * LDRV_IPS_state = NULL ;
+
+/*  ============================================================================
+ *  @name   LDRV_IPS_ctrl
+ *
+ *  @desc   Control structure of every DSP in the calling process.
+ *  ============================================================================
+ */
+STATIC LDRV_IPS_Ctrl * LDRV_IPS_ctrl [MAX_DSPS] ;
+
+/*  ============================================================================
+ *  @name   LDRV_IPS_gppHandlers
+ *
+ *  @desc   GPP-side handlers of the link driver components in the calling
+ *          process.
+ *  ============================================================================
+ */
+STATIC LDRV_IPS_Handler
+    LDRV_IPS_gppHandlers [MAX_DSPS][LDRV_MAX_IPSENTRIES][LDRV_IPS_MAXEVENTS] ;
+
+/*  ============================================================================
+ *  @name   LDRV_IPS_dspHandlers
+ *
+ *  @desc   DSP-side handlers in the calling process.
+ *  ============================================================================
+ */
+STATIC LDRV_IPS_Handler
+    LDRV_IPS_dspHandlers [MAX_DSPS][LDRV_MAX_IPSENTRIES][LDRV_IPS_MAXEVENTS] ;
+
+/*  ============================================================================
+ *  @name   LDRV_IPS_dspDefault
+ *
+ *  @desc   Default DSP-side handler of every IPS in the calling process.
+ *  ============================================================================
+ */
+STATIC LDRV_IPS_Handler LDRV_IPS_dspDefault [MAX_DSPS][LDRV_MAX_IPSENTRIES] ;
+
+
+/*  ============================================================================
+ *  @func   LDRV_IPS_userPost
+ *
+ *  @desc   Queues an event for delivery to a NOTIFY client of a process,
+ *          waiting for room in the event queue of the process. The event is
+ *          dropped if the process does not dispatch events.
+ *
+ *  @arg    userQueue
+ *              Event queue of the process.
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    payload
+ *              Payload of the event.
+ *  @arg    fnNotifyCbck
+ *              Callback of the client, valid in the process only.
+ *  @arg    cbckArg
+ *              Argument of the callback.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the event queue is not held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_userWait
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_IPS_userPost (IN LDRV_IPS_UserQueue * userQueue,
+                   IN Uint32               eventNo,
+                   IN Uint32               payload,
+                   IN FnNotifyCbck         fnNotifyCbck,
+                   IN Pvoid                cbckArg)
+{
+    LDRV_IPS_UserEvent * event ;
+
+    SYNC_HOST_enter (&userQueue->lock) ;
+    while (    (userQueue->active == TRUE)
+           &&  (   (userQueue->tail - userQueue->head)
+                == LDRV_IPS_USERQUEUELEN)) {
+        SYNC_HOST_waitUntil (&userQueue->cond, &userQueue->lock, NULL) ;
+    }
+    if (userQueue->active == TRUE) {
+        event = &(userQueue->queue [userQueue->tail % LDRV_IPS_USERQUEUELEN]) ;
+        event->eventNo      = eventNo ;
+        event->payload      = payload ;
+        event->fnNotifyCbck = fnNotifyCbck ;
+        event->cbckArg      = cbckArg ;
+        userQueue->tail++ ;
+        SYNC_HOST_broadcast (&userQueue->cond) ;
+    }
+    SYNC_HOST_leave (&userQueue->lock) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_IPS_pollCbck
+ *
+ *  @desc   Raises the pollable descriptor of the calling process carried by
+ *          an event queued by LDRV_IPS_userSignal.
+ *
+ *  @arg    eventNo
+ *              Not used.
+ *  @arg    arg
+ *              Not used.
+ *  @arg    info
+ *              File descriptor.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_userSignal
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_IPS_pollCbck (IN Uint32 eventNo, IN OPT Pvoid arg, IN OPT Pvoid info)
+{
+    (Void) eventNo ;
+    (Void) arg ;
+
+    SYNC_HOST_raisePollFd ((Int32) LDRV_PTR_TO_UINT32 (info)) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_IPS_isValidEvent
+ *
+ *  @desc   Checks whether an event exists in the configuration.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ipsId
+ *              IPS identifier.
+ *  @arg    eventNo
+ *              Event number.
+ *
+ *  @ret    TRUE/FALSE
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Bool
+LDRV_IPS_isValidEvent (IN ProcessorId dspId,
+                       IN Uint32      ipsId,
+                       IN Uint32      eventNo)
+{
+    Bool             valid = FALSE ;
+    LDRV_DspConfig * cfg ;
+
+    if (IS_VALID_PROCID (dspId) && (LDRV_IPS_ctrl [dspId] != NULL)) {
+        cfg = LDRV_getDspConfig (dspId) ;
+        if (    (ipsId < cfg->numIpsEntries)
+            &&  (eventNo < cfg->ipsTable [ipsId].numIpsEvents)) {
+            valid = TRUE ;
+        }
+    }
+
+    return valid ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_init
+ *
+ *  @desc   Initializes the IPS component in the calling process.
+ *
+ *  @modif  LDRV_IPS_state, LDRV_IPS_ctrl
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_init (IN Bool create)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_DspConfig * cfg ;
+    LDRV_IPS_Ctrl *  ctrl ;
+    ProcessorId      dspId ;
+    Uint32           physAddr ;
+    Uint32           i ;
+
+    TRC_1ENTER ("LDRV_IPS_init", create) ;
+
+    memset (LDRV_IPS_gppHandlers, 0, sizeof (LDRV_IPS_gppHandlers)) ;
+    memset (LDRV_IPS_dspHandlers, 0, sizeof (LDRV_IPS_dspHandlers)) ;
+    memset (LDRV_IPS_dspDefault,  0, sizeof (LDRV_IPS_dspDefault)) ;
+
+    if (create == TRUE) {
+        LDRV_Obj->compState [LDRV_Comp_Ips] =
+                                 LDRV_drvAlloc (sizeof (LDRV_IPS_Object)) ;
+        if (LDRV_Obj->compState [LDRV_Comp_Ips] == 0u) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        LDRV_IPS_state = (LDRV_IPS_Object *) LDRV_compState (LDRV_Comp_Ips) ;
+        if (create == TRUE) {
+            status = SYNC_HOST_createLock (&LDRV_IPS_state->regLock) ;
+            for (i = 0u ;
+                 (i < LDRV_MAX_PROCESSES) && DSP_SUCCEEDED (status) ;
+                 i++) {
+                status = SYNC_HOST_createLock (
+                                       &LDRV_IPS_state->userQueue [i].lock) ;
+                if (DSP_SUCCEEDED (status)) {
+                    status = SYNC_HOST_createCond (
+                                       &LDRV_IPS_state->userQueue [i].cond) ;
+                }
+            }
+        }
+    }
+
+    for (dspId = 0u ; (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ; dspId++) {
+        LDRV_IPS_ctrl [dspId] = NULL ;
+        cfg = LDRV_getDspConfig (dspId) ;
+        for (i = 0u ; i < cfg->numIpsEntries ; i++) {
+            if (cfg->ipsTable [i].numIpsEvents > LDRV_IPS_MAXEVENTS) {
+                status = DSP_ECONFIG ;
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status) && (cfg->numIpsEntries != 0u)) {
+            if (create == TRUE) {
+                status = LDRV_SMM_alloc (dspId,
+                                         sizeof (LDRV_IPS_Ctrl),
+                                         &physAddr) ;
+                if (DSP_SUCCEEDED (status)) {
+                    LDRV_IPS_state->ctrlPhys [dspId] = physAddr ;
+                    ctrl = (LDRV_IPS_Ctrl *) LDRV_phyToUsr (dspId, physAddr) ;
+                    status = SYNC_HOST_createLock (&ctrl->lock) ;
+                    if (DSP_SUCCEEDED (status)) {
+                        status = SYNC_HOST_createCond (&ctrl->dspCond) ;
+                    }
+                    if (DSP_SUCCEEDED (status)) {
+                        status = SYNC_HOST_createCond (&ctrl->gppCond) ;
+                    }
+                }
+            }
+
+            if (DSP_SUCCEEDED (status)) {
+                LDRV_IPS_ctrl [dspId] = (LDRV_IPS_Ctrl *)
+                       LDRV_phyToUsr (dspId, LDRV_IPS_state->ctrlPhys [dspId]) ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_IPS_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_exit
+ *
+ *  @desc   Finalizes the IPS component in the calling process.
+ *
+ *  @modif  LDRV_IPS_state, LDRV_IPS_ctrl
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_exit (IN Bool destroy)
+{
+    DSP_STATUS   status = DSP_SOK ;
+    ProcessorId  dspId ;
+    Uint32       i ;
+
+    TRC_1ENTER ("LDRV_IPS_exit", destroy) ;
+
+    if (LDRV_IPS_state != NULL) {
+        /* Drop the registrations left behind by the calling process. */
+        SYNC_HOST_enter (&LDRV_IPS_state->regLock) ;
+        for (i = 0u ; i < LDRV_IPS_MAXREGS ; i++) {
+            if (LDRV_IPS_state->regs [i].procSlot == LDRV_procSlot ()) {
+                LDRV_IPS_state->regs [i].used = FALSE ;
+            }
+        }
+        SYNC_HOST_leave (&LDRV_IPS_state->regLock) ;
+
+        if (destroy == TRUE) {
+            for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+                if (LDRV_IPS_ctrl [dspId] != NULL) {
+                    SYNC_HOST_deleteCond (&LDRV_IPS_ctrl [dspId]->gppCond) ;
+                    SYNC_HOST_deleteCond (&LDRV_IPS_ctrl [dspId]->dspCond) ;
+                    SYNC_HOST_deleteLock (&LDRV_IPS_ctrl [dspId]->lock) ;
+                }
+            }
+            for (i = 0u ; i < LDRV_MAX_PROCESSES ; i++) {
+                SYNC_HOST_deleteCond (&LDRV_IPS_state->userQueue [i].cond) ;
+                SYNC_HOST_deleteLock (&LDRV_IPS_state->userQueue [i].lock) ;
+            }
+            SYNC_HOST_deleteLock (&LDRV_IPS_state->regLock) ;
+        }
+    }
+
+    for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+        LDRV_IPS_ctrl [dspId] = NULL ;
+    }
+    LDRV_IPS_state = NULL ;
+
+    TRC_1LEAVE ("LDRV_IPS_exit", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_register
+ *
+ *  @desc   Registers the GPP-side handler of a link driver component for an
+ *          event.
+ *
+ *  @modif  LDRV_IPS_gppHandlers
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_register (IN     ProcessorId  dspId,
+                   IN     Uint32       ipsId,
+                   IN     Uint32       eventNo,
+                   IN     FnNotifyCbck fnNotifyCbck,
+                   IN OPT Pvoid        cbckArg)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    LDRV_IPS_Handler * handler ;
+
+    TRC_4ENTER ("LDRV_IPS_register", dspId, ipsId, eventNo, fnNotifyCbck) ;
+
+    DBC_Require (fnNotifyCbck != NULL) ;
+
+    if (LDRV_IPS_isValidEvent (dspId, ipsId, eventNo) == FALSE) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        handler = &(LDRV_IPS_gppHandlers [dspId][ipsId][eventNo]) ;
+        if (handler->fnNotifyCbck != NULL) {
+            status = DSP_ERESOURCE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            handler->cbckArg      = cbckArg ;
+            handler->fnNotifyCbck = fnNotifyCbck ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_IPS_register", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_unregister
+ *
+ *  @desc   Unregisters the GPP-side handler of a link driver component.
+ *
+ *  @modif  LDRV_IPS_gppHandlers
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_unregister (IN ProcessorId dspId,
+                     IN Uint32      ipsId,
+                     IN Uint32      eventNo)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_3ENTER ("LDRV_IPS_unregister", dspId, ipsId, eventNo) ;
+
+    if (LDRV_IPS_isValidEvent (dspId, ipsId, eventNo) == FALSE) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        LDRV_IPS_gppHandlers [dspId][ipsId][eventNo].fnNotifyCbck = NULL ;
+        LDRV_IPS_gppHandlers [dspId][ipsId][eventNo].cbckArg      = NULL ;
+    }
+
+    TRC_1LEAVE ("LDRV_IPS_unregister", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_notify
+ *
+ *  @desc   Sends an event to the DSP.
+ *
+ *  @modif  LDRV_IPS_ctrl [dspId]
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_notify (IN ProcessorId dspId,
+                 IN Uint32      ipsId,
+                 IN Uint32      eventNo,
+                 IN Uint32      payload)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_IPS_Ctrl *  ctrl ;
+    LDRV_IPS_Event * event ;
+
+    TRC_4ENTER ("LDRV_IPS_notify", dspId, ipsId, eventNo, payload) ;
+
+    if (LDRV_IPS_isValidEvent (dspId, ipsId, eventNo) == FALSE) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        ctrl = LDRV_IPS_ctrl [dspId] ;
+        SYNC_HOST_enter (&ctrl->lock) ;
+        while (    (ctrl->dspActive == TRUE)
+               &&  ((ctrl->tail - ctrl->head) == LDRV_IPS_QUEUELEN)) {
+            SYNC_HOST_waitUntil (&ctrl->gppCond, &ctrl->lock, NULL) ;
+        }
+
+        if (ctrl->dspActive != TRUE) {
+            status = DSP_EWRONGSTATE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            event = &(ctrl->queue [ctrl->tail % LDRV_IPS_QUEUELEN]) ;
+            event->ipsId   = ipsId ;
+            event->eventNo = eventNo ;
+            event->payload = payload ;
+            ctrl->tail++ ;
+            SYNC_HOST_signal (&ctrl->dspCond) ;
+#if defined (DDSP_PROFILE)
+            LDRV_IPS_state->stats [dspId][ipsId].eventSentCount++ ;
+            LDRV_PROC_getStats (dspId)->intsGppToDsp++ ;
+#endif /* if defined (DDSP_PROFILE) */
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_IPS_notify", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_raise
+ *
+ *  @desc   Raises an event from the DSP to the GPP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_raise (IN ProcessorId dspId,
+                IN Uint32      ipsId,
+                IN Uint32      eventNo,
+                IN Uint32      payload)
+{
+    DSP_STATUS           status = DSP_SOK ;
+    LDRV_IPS_Handler *   handler ;
+    LDRV_IPS_UserReg *   reg ;
+    Uint32               i ;
+
+    TRC_4ENTER ("LDRV_IPS_raise", dspId, ipsId, eventNo, payload) ;
+
+    if (LDRV_IPS_isValidEvent (dspId, ipsId, eventNo) == FALSE) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+#if defined (DDSP_PROFILE)
+        LDRV_IPS_state->stats [dspId][ipsId].eventOccurredCount++ ;
+        LDRV_PROC_getStats (dspId)->intsDspToGpp++ ;
+#endif /* if defined (DDSP_PROFILE) */
+
+        handler = &(LDRV_IPS_gppHandlers [dspId][ipsId][eventNo]) ;
+        if (handler->fnNotifyCbck != NULL) {
+            handler->fnNotifyCbck (eventNo,
+                                   handler->cbckArg,
+                                   LDRV_UINT32_TO_PTR (payload)) ;
+        }
+        else {
+            SYNC_HOST_enter (&LDRV_IPS_state->regLock) ;
+            for (i = 0u ; i < LDRV_IPS_MAXREGS ; i++) {
+                reg = &(LDRV_IPS_state->regs [i]) ;
+                if (    (reg->used    == TRUE)
+                    &&  (reg->dspId   == dspId)
+                    &&  (reg->ipsId   == ipsId)
+                    &&  (reg->eventNo == eventNo)) {
+                    LDRV_IPS_userPost (
+                                &(LDRV_IPS_state->userQueue [reg->procSlot]),
+                                eventNo,
+                                payload,
+                                reg->fnNotifyCbck,
+                                reg->cbckArg) ;
+                }
+            }
+            SYNC_HOST_leave (&LDRV_IPS_state->regLock) ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_IPS_raise", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_dspRegister
+ *
+ *  @desc   Registers the DSP-side handler for an event.
+ *
+ *  @modif  LDRV_IPS_dspHandlers
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_dspRegister (IN     ProcessorId  dspId,
+                      IN     Uint32       ipsId,
+                      IN     Uint32       eventNo,
+                      IN OPT FnNotifyCbck fnNotifyCbck,
+                      IN OPT Pvoid        cbckArg)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_4ENTER ("LDRV_IPS_dspRegister", dspId, ipsId, eventNo, fnNotifyCbck) ;
+
+    if (eventNo == LDRV_IPS_ALLEVENTS) {
+        if (LDRV_IPS_isValidEvent (dspId, ipsId, 0u) == FALSE) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            LDRV_IPS_dspDefault [dspId][ipsId].cbckArg      = cbckArg ;
+            LDRV_IPS_dspDefault [dspId][ipsId].fnNotifyCbck = fnNotifyCbck ;
+        }
+    }
+    else if (LDRV_IPS_isValidEvent (dspId, ipsId, eventNo) == FALSE) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        LDRV_IPS_dspHandlers [dspId][ipsId][eventNo].cbckArg      = cbckArg ;
+        LDRV_IPS_dspHandlers [dspId][ipsId][eventNo].fnNotifyCbck =
+                                                                 fnNotifyCbck ;
+    }
+
+    TRC_1LEAVE ("LDRV_IPS_dspRegister", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_dspStart
+ *
+ *  @desc   Marks the DSP as running.
+ *
+ *  @modif  LDRV_IPS_ctrl [dspId]
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_dspStart (IN ProcessorId dspId)
+{
+    LDRV_IPS_Ctrl * ctrl ;
+
+    TRC_1ENTER ("LDRV_IPS_dspStart", dspId) ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    ctrl = LDRV_IPS_ctrl [dspId] ;
+    if (ctrl != NULL) {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        ctrl->head      = 0u ;
+        ctrl->tail      = 0u ;
+        ctrl->dspActive = TRUE ;
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    TRC_0LEAVE ("LDRV_IPS_dspStart") ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_dspStop
+ *
+ *  @desc   Marks the DSP as stopped and wakes up the DSP thread.
+ *
+ *  @modif  LDRV_IPS_ctrl [dspId]
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_dspStop (IN ProcessorId dspId)
+{
+    LDRV_IPS_Ctrl * ctrl ;
+
+    TRC_1ENTER ("LDRV_IPS_dspStop", dspId) ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    ctrl = LDRV_IPS_ctrl [dspId] ;
+    if (ctrl != NULL) {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        ctrl->dspActive = FALSE ;
+        ctrl->head      = ctrl->tail ;
+        SYNC_HOST_broadcast (&ctrl->dspCond) ;
+        SYNC_HOST_broadcast (&ctrl->gppCond) ;
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    TRC_0LEAVE ("LDRV_IPS_dspStop") ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_dspDispatch
+ *
+ *  @desc   Waits for events sent to the DSP and calls their DSP-side handlers.
+ *
+ *  @modif  LDRV_IPS_ctrl [dspId]
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_dspDispatch (IN ProcessorId dspId)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    LDRV_IPS_Ctrl *    ctrl ;
+    LDRV_IPS_Event     event ;
+    LDRV_IPS_Handler * handler ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    ctrl = LDRV_IPS_ctrl [dspId] ;
+    SYNC_HOST_enter (&ctrl->lock) ;
+    while ((ctrl->dspActive == TRUE) && (ctrl->head == ctrl->tail)) {
+        SYNC_HOST_waitUntil (&ctrl->dspCond, &ctrl->lock, NULL) ;
+    }
+
+    while ((ctrl->dspActive == TRUE) && (ctrl->head != ctrl->tail)) {
+        event = ctrl->queue [ctrl->head % LDRV_IPS_QUEUELEN] ;
+        ctrl->head++ ;
+        SYNC_HOST_signal (&ctrl->gppCond) ;
+        SYNC_HOST_leave (&ctrl->lock) ;
+
+        handler = &(LDRV_IPS_dspHandlers [dspId][event.ipsId][event.eventNo]) ;
+        if (handler->fnNotifyCbck == NULL) {
+            handler = &(LDRV_IPS_dspDefault [dspId][event.ipsId]) ;
+        }
+        if (handler->fnNotifyCbck != NULL) {
+            handler->fnNotifyCbck (event.eventNo,
+                                   handler->cbckArg,
+                                   LDRV_UINT32_TO_PTR (event.payload)) ;
+        }
+
+        SYNC_HOST_enter (&ctrl->lock) ;
+    }
+
+    if (ctrl->dspActive != TRUE) {
+        status = DSP_EWRONGSTATE ;
+    }
+    SYNC_HOST_leave (&ctrl->lock) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userRegister
+ *
+ *  @desc   Registers a NOTIFY callback of the calling process for an event.
+ *
+ *  @modif  LDRV_IPS_state->regs
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_userRegister (IN     ProcessorId  dspId,
+                       IN     Uint32       ipsId,
+                       IN     Uint32       eventNo,
+                       IN     FnNotifyCbck fnNotifyCbck,
+                       IN OPT Pvoid        cbckArg)
+{
+    DSP_STATUS         status = DSP_EMEMORY ;
+    LDRV_IPS_UserReg * reg ;
+    Uint32             i ;
+
+    TRC_5ENTER ("LDRV_IPS_userRegister",
+                dspId, ipsId, eventNo, fnNotifyCbck, cbckArg) ;
+
+    DBC_Require (fnNotifyCbck != NULL) ;
+
+    if (LDRV_IPS_isValidEvent (dspId, ipsId, eventNo) == FALSE) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (   LDRV_IPS_gppHandlers [dspId][ipsId][eventNo].fnNotifyCbck
+             != NULL) {
+        status = DSP_ERESOURCE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&LDRV_IPS_state->regLock) ;
+        for (i = 0u ; i < LDRV_IPS_MAXREGS ; i++) {
+            reg = &(LDRV_IPS_state->regs [i]) ;
+            if (reg->used == FALSE) {
+                reg->procSlot     = LDRV_procSlot () ;
+                reg->dspId        = dspId ;
+                reg->ipsId        = ipsId ;
+                reg->eventNo      = eventNo ;
+                reg->fnNotifyCbck = fnNotifyCbck ;
+                reg->cbckArg      = cbckArg ;
+                reg->used         = TRUE ;
+#if defined (DDSP_PROFILE)
+                LDRV_IPS_state->stats [dspId][ipsId].registerCount++ ;
+#endif /* if defined (DDSP_PROFILE) */
+                status = DSP_SOK ;
+                break ;
+            }
+        }
+        SYNC_HOST_leave (&LDRV_IPS_state->regLock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_IPS_userRegister", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userUnregister
+ *
+ *  @desc   Unregisters a NOTIFY callback of the calling process.
+ *
+ *  @modif  LDRV_IPS_state->regs
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_userUnregister (IN     ProcessorId  dspId,
+                         IN     Uint32       ipsId,
+                         IN     Uint32       eventNo,
+                         IN     FnNotifyCbck fnNotifyCbck,
+                         IN OPT Pvoid        cbckArg)
+{
+    DSP_STATUS         status = DSP_ENOTFOUND ;
+    LDRV_IPS_UserReg * reg ;
+    Uint32             i ;
+
+    TRC_5ENTER ("LDRV_IPS_userUnregister",
+                dspId, ipsId, eventNo, fnNotifyCbck, cbckArg) ;
+
+    if (LDRV_IPS_isValidEvent (dspId, ipsId, eventNo) == FALSE) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&LDRV_IPS_state->regLock) ;
+        for (i = 0u ; i < LDRV_IPS_MAXREGS ; i++) {
+            reg = &(LDRV_IPS_state->regs [i]) ;
+            if (    (reg->used         == TRUE)
+                &&  (reg->procSlot     == LDRV_procSlot ())
+                &&  (reg->dspId        == dspId)
+                &&  (reg->ipsId        == ipsId)
+                &&  (reg->eventNo      == eventNo)
+                &&  (reg->fnNotifyCbck == fnNotifyCbck)
+                &&  (reg->cbckArg      == cbckArg)) {
+                reg->used = FALSE ;
+#if defined (DDSP_PROFILE)
+                LDRV_IPS_state->stats [dspId][ipsId].unregisterCount++ ;
+#endif /* if defined (DDSP_PROFILE) */
+                status = DSP_SOK ;
+                break ;
+            }
+        }
+        SYNC_HOST_leave (&LDRV_IPS_state->regLock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_IPS_userUnregister", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userOpen
+ *
+ *  @desc   Activates the event queue of the calling process.
+ *
+ *  @modif  LDRV_IPS_state->userQueue
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_userOpen (Void)
+{
+    LDRV_IPS_UserQueue * userQueue ;
+
+    TRC_0ENTER ("LDRV_IPS_userOpen") ;
+
+    userQueue = &(LDRV_IPS_state->userQueue [LDRV_procSlot ()]) ;
+    SYNC_HOST_enter (&userQueue->lock) ;
+    userQueue->head     = 0u ;
+    userQueue->tail     = 0u ;
+    userQueue->pollCbck = LDRV_IPS_pollCbck ;
+    userQueue->active   = TRUE ;
+    SYNC_HOST_leave (&userQueue->lock) ;
+
+    TRC_0LEAVE ("LDRV_IPS_userOpen") ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userClose
+ *
+ *  @desc   Deactivates the event queue of the calling process.
+ *
+ *  @modif  LDRV_IPS_state->userQueue
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_userClose (Void)
+{
+    LDRV_IPS_UserQueue * userQueue ;
+
+    TRC_0ENTER ("LDRV_IPS_userClose") ;
+
+    userQueue = &(LDRV_IPS_state->userQueue [LDRV_procSlot ()]) ;
+    SYNC_HOST_enter (&userQueue->lock) ;
+    userQueue->active = FALSE ;
+    SYNC_HOST_broadcast (&userQueue->cond) ;
+    SYNC_HOST_leave (&userQueue->lock) ;
+
+    TRC_0LEAVE ("LDRV_IPS_userClose") ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userSignal
+ *
+ *  @desc   Raises a pollable descriptor of a process, directly if it is the
+ *          calling process and through its event queue otherwise.
+ *
+ *  @modif  LDRV_IPS_state->userQueue
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_userSignal (IN Uint32 procSlot, IN Int32 fd)
+{
+    LDRV_IPS_UserQueue * userQueue ;
+
+    TRC_2ENTER ("LDRV_IPS_userSignal", procSlot, fd) ;
+
+    DBC_Require (procSlot < LDRV_MAX_PROCESSES) ;
+
+    if (procSlot == LDRV_procSlot ()) {
+        SYNC_HOST_raisePollFd (fd) ;
+    }
+    else {
+        userQueue = &(LDRV_IPS_state->userQueue [procSlot]) ;
+        LDRV_IPS_userPost (userQueue,
+                           0u,
+                           (Uint32) fd,
+                           userQueue->pollCbck,
+                           NULL) ;
+    }
+
+    TRC_0LEAVE ("LDRV_IPS_userSignal") ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userWait
+ *
+ *  @desc   Waits for the next event pending delivery to the NOTIFY clients of
+ *          the calling process.
+ *
+ *  @modif  LDRV_IPS_state->userQueue
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_userWait (OUT LDRV_IPS_UserEvent * event)
+{
+    DSP_STATUS           status = DSP_SOK ;
+    LDRV_IPS_UserQueue * userQueue ;
+
+    DBC_Require (event != NULL) ;
+
+    userQueue = &(LDRV_IPS_state->userQueue [LDRV_procSlot ()]) ;
+    SYNC_HOST_enter (&userQueue->lock) ;
+    while (    (userQueue->active == TRUE)
+           &&  (userQueue->head == userQueue->tail)) {
+        SYNC_HOST_waitUntil (&userQueue->cond, &userQueue->lock, NULL) ;
+    }
+
+    if (userQueue->active != TRUE) {
+        status = DSP_EWRONGSTATE ;
+    }
+    else {
+        *event = userQueue->queue [userQueue->head % LDRV_IPS_USERQUEUELEN] ;
+        userQueue->head++ ;
+        SYNC_HOST_broadcast (&userQueue->cond) ;
+    }
+    SYNC_HOST_leave (&userQueue->lock) ;
+
+    return status ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_IPS_instrument
+ *
+ *  @desc   Gets the instrumentation information of an IPS.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_instrument (IN  ProcessorId      dspId,
+                     IN  Uint32           ipsId,
+                     OUT IPS_Instrument * retVal)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_3ENTER ("LDRV_IPS_instrument", dspId, ipsId, retVal) ;
+
+    DBC_Require (retVal != NULL) ;
+
+    if (LDRV_IPS_isValidEvent (dspId, ipsId, 0u) == FALSE) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *retVal = LDRV_IPS_state->stats [dspId][ipsId] ;
+    }
+
+    TRC_1LEAVE ("LDRV_IPS_instrument", status) ;
+
+    return status ;
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
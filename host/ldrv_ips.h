@@ -0,0 +1,709 @@
+/** ============================================================================
+ *  @file   ldrv_ips.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the Inter Processor Signaling (IPS)
+ *          component of the host loopback backend.
+ *          Events sent from the GPP to the emulated DSP are queued in the
+ *          memory shared with the DSP and picked up by the DSP thread.
+ *          Events raised by the DSP are delivered to the handlers of the link
+ *          driver components in the context of the DSP thread, and to the
+ *          NOTIFY clients through one event queue per attached process.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LDRV_IPS_H)
+#define LDRV_IPS_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <notify.h>
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* if defined (DDSP_PROFILE) */
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+#include <ldrv.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  LDRV_IPS_MAXEVENTS
+ *
+ *  @desc   Maximum number of events supported by one IPS.
+ *  ============================================================================
+ */
+#define LDRV_IPS_MAXEVENTS      32u
+
+/** ============================================================================
+ *  @const  LDRV_IPS_ALLEVENTS
+ *
+ *  @desc   Event number used to register the DSP-side handler of all events
+ *          that have no handler of their own.
+ *  ============================================================================
+ */
+#define LDRV_IPS_ALLEVENTS      0xFFFFFFFFu
+
+/** ============================================================================
+ *  @const  LDRV_IPS_QUEUELEN
+ *
+ *  @desc   Length of the queue of events sent from the GPP to the DSP.
+ *  ============================================================================
+ */
+#define LDRV_IPS_QUEUELEN       1024u
+
+/** ============================================================================
+ *  @const  LDRV_IPS_MAXREGS
+ *
+ *  @desc   Maximum number of NOTIFY registrations across all processes.
+ *  ============================================================================
+ */
+#define LDRV_IPS_MAXREGS        256u
+
+/** ============================================================================
+ *  @const  LDRV_IPS_USERQUEUELEN
+ *
+ *  @desc   Length of the queue of events pending delivery to the NOTIFY
+ *          clients of one process.
+ *  ============================================================================
+ */
+#define LDRV_IPS_USERQUEUELEN   1024u
+
+
+/** ============================================================================
+ *  @name   LDRV_IPS_Event
+ *
+ *  @desc   Event sent from the GPP to the DSP.
+ *
+ *  @field  ipsId
+ *              IPS identifier.
+ *  @field  eventNo
+ *              Event number.
+ *  @field  payload
+ *              Payload sent with the event.
+ *  ============================================================================
+ */
+typedef struct LDRV_IPS_Event_tag {
+    Uint32     ipsId   ;
+    Uint32     eventNo ;
+    Uint32     payload ;
+} LDRV_IPS_Event ;
+
+/** ============================================================================
+ *  @name   LDRV_IPS_Ctrl
+ *
+ *  @desc   Control structure shared with the DSP, holding the queue of events
+ *          sent from the GPP to the DSP.
+ *
+ *  @field  lock
+ *              Lock protecting the queue.
+ *  @field  dspCond
+ *              Condition on which the DSP waits for events.
+ *  @field  gppCond
+ *              Condition on which senders wait for free space in the queue.
+ *  @field  dspActive
+ *              TRUE while the DSP is running.
+ *  @field  head
+ *              Number of events taken from the queue by the DSP.
+ *  @field  tail
+ *              Number of events put into the queue by the GPP.
+ *  @field  queue
+ *              Event queue.
+ *  ============================================================================
+ */
+typedef struct LDRV_IPS_Ctrl_tag {
+    SYNC_HostLock   lock      ;
+    SYNC_HostCond   dspCond   ;
+    SYNC_HostCond   gppCond   ;
+    Uint32          dspActive ;
+    Uint32          head      ;
+    Uint32          tail      ;
+    LDRV_IPS_Event  queue [LDRV_IPS_QUEUELEN] ;
+} LDRV_IPS_Ctrl ;
+
+/** ============================================================================
+ *  @name   LDRV_IPS_UserEvent
+ *
+ *  @desc   Event pending delivery to a NOTIFY client.
+ *
+ *  @field  eventNo
+ *              Event number.
+ *  @field  payload
+ *              Payload received with the event.
+ *  @field  fnNotifyCbck
+ *              Callback of the client, valid in the client process only.
+ *  @field  cbckArg
+ *              Argument of the callback.
+ *  ============================================================================
+ */
+typedef struct LDRV_IPS_UserEvent_tag {
+    Uint32        eventNo      ;
+    Uint32        payload      ;
+    FnNotifyCbck  fnNotifyCbck ;
+    Pvoid         cbckArg      ;
+} LDRV_IPS_UserEvent ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_init
+ *
+ *  @desc   Initializes the IPS component in the calling process.
+ *
+ *  @arg    create
+ *              TRUE if the shared state is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              Shared memory is exhausted.
+ *          DSP_ECONFIG
+ *              An IPS is configured with too many events.
+ *
+ *  @enter  The segments of the link driver are mapped.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_init (IN Bool create) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_exit
+ *
+ *  @desc   Finalizes the IPS component in the calling process.
+ *
+ *  @arg    destroy
+ *              TRUE if the shared state is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_exit (IN Bool destroy) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_register
+ *
+ *  @desc   Registers the GPP-side handler of a link driver component for an
+ *          event. The handler is called in the context of the DSP thread and
+ *          must only access shared state. Events registered this way are
+ *          reserved and cannot be used by NOTIFY clients.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ipsId
+ *              IPS identifier.
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    fnNotifyCbck
+ *              Handler to be called.
+ *  @arg    cbckArg
+ *              Argument of the handler.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid IPS or event.
+ *          DSP_ERESOURCE
+ *              A handler is already registered for the event.
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_unregister
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_register (IN     ProcessorId  dspId,
+                   IN     Uint32       ipsId,
+                   IN     Uint32       eventNo,
+                   IN     FnNotifyCbck fnNotifyCbck,
+                   IN OPT Pvoid        cbckArg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_unregister
+ *
+ *  @desc   Unregisters the GPP-side handler of a link driver component.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ipsId
+ *              IPS identifier.
+ *  @arg    eventNo
+ *              Event number.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid IPS or event.
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_register
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_unregister (IN ProcessorId dspId,
+                     IN Uint32      ipsId,
+                     IN Uint32      eventNo) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_notify
+ *
+ *  @desc   Sends an event to the DSP. Blocks while the event queue is full.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ipsId
+ *              IPS identifier.
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    payload
+ *              Payload to be sent with the event.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid IPS or event.
+ *          DSP_EWRONGSTATE
+ *              The DSP is not running.
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_dspDispatch
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_notify (IN ProcessorId dspId,
+                 IN Uint32      ipsId,
+                 IN Uint32      eventNo,
+                 IN Uint32      payload) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_raise
+ *
+ *  @desc   Raises an event from the DSP to the GPP. Called in the context of
+ *          the DSP thread.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ipsId
+ *              IPS identifier.
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    payload
+ *              Payload to be sent with the event.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid IPS or event.
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_register, LDRV_IPS_userRegister
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_raise (IN ProcessorId dspId,
+                IN Uint32      ipsId,
+                IN Uint32      eventNo,
+                IN Uint32      payload) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_dspRegister
+ *
+ *  @desc   Registers the DSP-side handler for an event. The handler is called
+ *          by LDRV_IPS_dspDispatch in the context of the DSP thread.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ipsId
+ *              IPS identifier.
+ *  @arg    eventNo
+ *              Event number, or LDRV_IPS_ALLEVENTS for the default
+ *              handler of the IPS.
+ *  @arg    fnNotifyCbck
+ *              Handler to be called, NULL to unregister.
+ *  @arg    cbckArg
+ *              Argument of the handler.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid IPS or event.
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_dspDispatch
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_dspRegister (IN     ProcessorId  dspId,
+                      IN     Uint32       ipsId,
+                      IN     Uint32       eventNo,
+                      IN OPT FnNotifyCbck fnNotifyCbck,
+                      IN OPT Pvoid        cbckArg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_dspStart
+ *
+ *  @desc   Marks the DSP as running, so that events are accepted.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    None
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_dspStop
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_dspStart (IN ProcessorId dspId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_dspStop
+ *
+ *  @desc   Marks the DSP as stopped, discards the pending events and wakes up
+ *          the DSP thread.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    None
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_dspStart
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_dspStop (IN ProcessorId dspId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_dspDispatch
+ *
+ *  @desc   Waits for events sent to the DSP and calls their DSP-side handlers.
+ *          Returns once at least one event has been dispatched.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Events have been dispatched.
+ *          DSP_EWRONGSTATE
+ *              The DSP has been stopped.
+ *
+ *  @enter  LDRV_IPS_dspStart has been called.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_notify
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_dspDispatch (IN ProcessorId dspId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userRegister
+ *
+ *  @desc   Registers a NOTIFY callback of the calling process for an event.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ipsId
+ *              IPS identifier.
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    fnNotifyCbck
+ *              Callback to be called.
+ *  @arg    cbckArg
+ *              Argument of the callback.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid IPS or event.
+ *          DSP_ERESOURCE
+ *              The event is reserved by a link driver component.
+ *          DSP_EMEMORY
+ *              The registration table is full.
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_userUnregister
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_userRegister (IN     ProcessorId  dspId,
+                       IN     Uint32       ipsId,
+                       IN     Uint32       eventNo,
+                       IN     FnNotifyCbck fnNotifyCbck,
+                       IN OPT Pvoid        cbckArg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userUnregister
+ *
+ *  @desc   Unregisters a NOTIFY callback of the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ipsId
+ *              IPS identifier.
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    fnNotifyCbck
+ *              Callback to be unregistered.
+ *  @arg    cbckArg
+ *              Argument of the callback.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The callback is not registered.
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_userRegister
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_userUnregister (IN     ProcessorId  dspId,
+                         IN     Uint32       ipsId,
+                         IN     Uint32       eventNo,
+                         IN     FnNotifyCbck fnNotifyCbck,
+                         IN OPT Pvoid        cbckArg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userOpen
+ *
+ *  @desc   Activates the event queue of the calling process.
+ *
+ *  @arg    None
+ *
+ *  @ret    None
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_userClose
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_userOpen (Void) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userClose
+ *
+ *  @desc   Deactivates the event queue of the calling process and wakes up
+ *          the thread waiting on it.
+ *
+ *  @arg    None
+ *
+ *  @ret    None
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_userOpen
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_userClose (Void) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userSignal
+ *
+ *  @desc   Raises a pollable descriptor of a process. A descriptor of another
+ *          process is raised by its NOTIFY dispatch thread.
+ *
+ *  @arg    procSlot
+ *              Process slot of the owner of the descriptor.
+ *  @arg    fd
+ *              File descriptor, valid in the owner process.
+ *
+ *  @ret    None
+ *
+ *  @enter  procSlot must be valid.
+ *          The caller does not hold a lock taken by the NOTIFY callbacks.
+ *
+ *  @leave  None
+ *
+ *  @see    SYNC_HOST_raisePollFd
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_IPS_userSignal (IN Uint32 procSlot, IN Int32 fd) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_IPS_userWait
+ *
+ *  @desc   Waits for the next event pending delivery to the NOTIFY clients of
+ *          the calling process.
+ *
+ *  @arg    event
+ *              Location to receive the event.
+ *
+ *  @ret    DSP_SOK
+ *              An event has been received.
+ *          DSP_EWRONGSTATE
+ *              The event queue has been deactivated.
+ *
+ *  @enter  LDRV_IPS_userOpen has been called.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_IPS_userClose
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_userWait (OUT LDRV_IPS_UserEvent * event) ;
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_IPS_instrument
+ *
+ *  @desc   Gets the instrumentation information of an IPS.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ipsId
+ *              IPS identifier.
+ *  @arg    retVal
+ *              Location to receive the instrumentation information.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid IPS.
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_IPS_instrument (IN  ProcessorId      dspId,
+                     IN  Uint32           ipsId,
+                     OUT IPS_Instrument * retVal) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LDRV_IPS_H) */
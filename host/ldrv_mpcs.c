@@ -0,0 +1,296 @@
+/** ============================================================================
+ *  @file   ldrv_mpcs.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the MPCS manager of the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <mpcsdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_mpcs.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_MPCS, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @name   LDRV_MPCS_Object
+ *
+ *  @desc   Private state of the MPCS manager in the driver segment.
+ *
+ *  @field  regionPhys
+ *              Physical address of the control region of each DSP, 0 if
+ *              none is configured.
+ *  @field  regionSize
+ *              Size of the control region of each DSP.
+ *  ============================================================================
+ */
+typedef struct LDRV_MPCS_Object_tag {
+    Uint32  regionPhys [MAX_DSPS] ;
+    Uint32  regionSize [MAX_DSPS] ;
+} LDRV_MPCS_Object ;
+
+
+/*  ============================================================================
+ *  @name   LDRV_MPCS_state
+ *
+ *  @desc   Private state of the MPCS manager in the driver segment.
+ *  ============================================================================
+ */
+STATIC LDRV_MPCS_Object * LDRV_MPCS_state = NULL ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MPCS_init
+ *
+ *  @desc   Initializes the MPCS manager in the calling process.
+ *
+ *  @modif  LDRV_MPCS_state
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MPCS_init (IN Bool create)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    LDRV_MPCS_Object * mpcsState ;
+    LINKCFG_Mpcs *     mpcsObject ;
+    MPCS_Ctrl *        ctrl ;
+    ProcessorId        dspId ;
+    Uint32             size ;
+
+    TRC_1ENTER ("LDRV_MPCS_init", create) ;
+
+    if (create == TRUE) {
+        LDRV_Obj->compState [LDRV_Comp_Mpcs] =
+                                  LDRV_drvAlloc (sizeof (LDRV_MPCS_Object)) ;
+        mpcsState = (LDRV_MPCS_Object *) LDRV_compState (LDRV_Comp_Mpcs) ;
+        if (mpcsState == NULL) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+
+        for (dspId = 0u ;
+             (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ;
+             dspId++) {
+            mpcsObject = &(LDRV_getDspConfig (dspId)->mpcsObject) ;
+            if (mpcsObject->maxEntries == 0u) {
+                continue ;
+            }
+
+            size   =  sizeof (MPCS_Ctrl)
+                    + (mpcsObject->maxEntries * sizeof (MPCS_Entry)) ;
+            status = LDRV_SMM_alloc (dspId,
+                                     size,
+                                     &mpcsState->regionPhys [dspId]) ;
+            if (DSP_SUCCEEDED (status)) {
+                mpcsState->regionSize [dspId] = size ;
+                ctrl = (MPCS_Ctrl *) LDRV_phyToUsr (
+                                               dspId,
+                                               mpcsState->regionPhys [dspId]) ;
+                memset (ctrl, 0, size) ;
+                ctrl->dspId        = dspId ;
+                ctrl->maxEntries   = mpcsObject->maxEntries ;
+                ctrl->ipsId        = mpcsObject->ipsId ;
+                ctrl->ipsEventNo   = mpcsObject->ipsEventNo ;
+                ctrl->dspAddrEntry = (MPCS_Entry *) LDRV_UINT32_TO_PTR (
+                              LDRV_phyToDsp (dspId,
+                                               mpcsState->regionPhys [dspId]
+                                             + sizeof (MPCS_Ctrl))) ;
+                ctrl->isInitialized = TRUE ;
+            }
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        LDRV_MPCS_state = (LDRV_MPCS_Object *) LDRV_compState (LDRV_Comp_Mpcs) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MPCS_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MPCS_exit
+ *
+ *  @desc   Finalizes the MPCS manager in the calling process.
+ *
+ *  @modif  LDRV_MPCS_state
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MPCS_exit (IN Bool destroy)
+{
+    MPCS_Ctrl * ctrl ;
+    ProcessorId dspId ;
+
+    TRC_1ENTER ("LDRV_MPCS_exit", destroy) ;
+
+    if ((LDRV_MPCS_state != NULL) && (destroy == TRUE)) {
+        for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+            if (LDRV_MPCS_state->regionPhys [dspId] != 0u) {
+                ctrl = (MPCS_Ctrl *) LDRV_phyToUsr (
+                                         dspId,
+                                         LDRV_MPCS_state->regionPhys [dspId]) ;
+                ctrl->isInitialized = FALSE ;
+            }
+        }
+    }
+
+    LDRV_MPCS_state = NULL ;
+
+    TRC_1LEAVE ("LDRV_MPCS_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MPCS_mapRegion
+ *
+ *  @desc   Gets the MPCS control region of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MPCS_mapRegion (IN OUT MPCS_MemInfo * mpcsRegionArgs)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_1ENTER ("LDRV_MPCS_mapRegion", mpcsRegionArgs) ;
+
+    DBC_Require (mpcsRegionArgs != NULL) ;
+
+    if (!IS_VALID_PROCID (mpcsRegionArgs->procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (LDRV_MPCS_state->regionPhys [mpcsRegionArgs->procId] == 0u) {
+        status = DSP_ECONFIG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        mpcsRegionArgs->physAddr =
+                         LDRV_MPCS_state->regionPhys [mpcsRegionArgs->procId] ;
+        mpcsRegionArgs->size     =
+                         LDRV_MPCS_state->regionSize [mpcsRegionArgs->procId] ;
+        mpcsRegionArgs->kernAddr = 0u ;
+        mpcsRegionArgs->userAddr = 0u ;
+    }
+
+    TRC_1LEAVE ("LDRV_MPCS_mapRegion", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MPCS_unmapRegion
+ *
+ *  @desc   Releases the MPCS control region of a DSP. The region stays mapped
+ *          as long as the driver is.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MPCS_unmapRegion (IN MPCS_MemInfo * mpcsRegionArgs)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_1ENTER ("LDRV_MPCS_unmapRegion", mpcsRegionArgs) ;
+
+    DBC_Require (mpcsRegionArgs != NULL) ;
+
+    if (!IS_VALID_PROCID (mpcsRegionArgs->procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("LDRV_MPCS_unmapRegion", status) ;
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,296 @@
+/** ============================================================================
+ *  @file   ldrv_mplist.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the MPLIST manager of the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <mplistdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_mplist.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_MPLIST, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @name   LDRV_MPLIST_Object
+ *
+ *  @desc   Private state of the MPLIST manager in the driver segment.
+ *
+ *  @field  regionPhys
+ *              Physical address of the control region of each DSP, 0 if
+ *              none is configured.
+ *  @field  regionSize
+ *              Size of the control region of each DSP.
+ *  ============================================================================
+ */
+typedef struct LDRV_MPLIST_Object_tag {
+    Uint32  regionPhys [MAX_DSPS] ;
+    Uint32  regionSize [MAX_DSPS] ;
+} LDRV_MPLIST_Object ;
+
+
+/*  ============================================================================
+ *  @name   LDRV_MPLIST_state
+ *
+ *  @desc   Private state of the MPLIST manager in the driver segment.
+ *  ============================================================================
+ */
+STATIC LDRV_MPLIST_Object * LDRV_MPLIST_state = NULL ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MPLIST_init
+ *
+ *  @desc   Initializes the MPLIST manager in the calling process.
+ *
+ *  @modif  LDRV_MPLIST_state
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MPLIST_init (IN Bool create)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    LDRV_MPLIST_Object * mplistState ;
+    LINKCFG_MpList *     mplistObject ;
+    MPLIST_Ctrl *        ctrl ;
+    ProcessorId        dspId ;
+    Uint32             size ;
+
+    TRC_1ENTER ("LDRV_MPLIST_init", create) ;
+
+    if (create == TRUE) {
+        LDRV_Obj->compState [LDRV_Comp_MpList] =
+                                  LDRV_drvAlloc (sizeof (LDRV_MPLIST_Object)) ;
+        mplistState = (LDRV_MPLIST_Object *) LDRV_compState (LDRV_Comp_MpList) ;
+        if (mplistState == NULL) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+
+        for (dspId = 0u ;
+             (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ;
+             dspId++) {
+            mplistObject = &(LDRV_getDspConfig (dspId)->mplistObject) ;
+            if (mplistObject->maxEntries == 0u) {
+                continue ;
+            }
+
+            size   =  sizeof (MPLIST_Ctrl)
+                    + (mplistObject->maxEntries * sizeof (MPLIST_Entry)) ;
+            status = LDRV_SMM_alloc (dspId,
+                                     size,
+                                     &mplistState->regionPhys [dspId]) ;
+            if (DSP_SUCCEEDED (status)) {
+                mplistState->regionSize [dspId] = size ;
+                ctrl = (MPLIST_Ctrl *) LDRV_phyToUsr (
+                                               dspId,
+                                               mplistState->regionPhys [dspId]) ;
+                memset (ctrl, 0, size) ;
+                ctrl->dspId        = dspId ;
+                ctrl->maxEntries   = mplistObject->maxEntries ;
+                ctrl->ipsId        = mplistObject->ipsId ;
+                ctrl->ipsEventNo   = mplistObject->ipsEventNo ;
+                ctrl->dspAddrEntry = (MPLIST_Entry *) LDRV_UINT32_TO_PTR (
+                              LDRV_phyToDsp (dspId,
+                                               mplistState->regionPhys [dspId]
+                                             + sizeof (MPLIST_Ctrl))) ;
+                ctrl->isInitialized = TRUE ;
+            }
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        LDRV_MPLIST_state = (LDRV_MPLIST_Object *) LDRV_compState (LDRV_Comp_MpList) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MPLIST_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MPLIST_exit
+ *
+ *  @desc   Finalizes the MPLIST manager in the calling process.
+ *
+ *  @modif  LDRV_MPLIST_state
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MPLIST_exit (IN Bool destroy)
+{
+    MPLIST_Ctrl * ctrl ;
+    ProcessorId dspId ;
+
+    TRC_1ENTER ("LDRV_MPLIST_exit", destroy) ;
+
+    if ((LDRV_MPLIST_state != NULL) && (destroy == TRUE)) {
+        for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+            if (LDRV_MPLIST_state->regionPhys [dspId] != 0u) {
+                ctrl = (MPLIST_Ctrl *) LDRV_phyToUsr (
+                                         dspId,
+                                         LDRV_MPLIST_state->regionPhys [dspId]) ;
+                ctrl->isInitialized = FALSE ;
+            }
+        }
+    }
+
+    LDRV_MPLIST_state = NULL ;
+
+    TRC_1LEAVE ("LDRV_MPLIST_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MPLIST_mapRegion
+ *
+ *  @desc   Gets the MPLIST control region of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MPLIST_mapRegion (IN OUT MPLIST_MemInfo * mplistRegionArgs)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_1ENTER ("LDRV_MPLIST_mapRegion", mplistRegionArgs) ;
+
+    DBC_Require (mplistRegionArgs != NULL) ;
+
+    if (!IS_VALID_PROCID (mplistRegionArgs->procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (LDRV_MPLIST_state->regionPhys [mplistRegionArgs->procId] == 0u) {
+        status = DSP_ECONFIG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        mplistRegionArgs->physAddr =
+                         LDRV_MPLIST_state->regionPhys [mplistRegionArgs->procId] ;
+        mplistRegionArgs->size     =
+                         LDRV_MPLIST_state->regionSize [mplistRegionArgs->procId] ;
+        mplistRegionArgs->kernAddr = 0u ;
+        mplistRegionArgs->userAddr = 0u ;
+    }
+
+    TRC_1LEAVE ("LDRV_MPLIST_mapRegion", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MPLIST_unmapRegion
+ *
+ *  @desc   Releases the MPLIST control region of a DSP. The region stays mapped
+ *          as long as the driver is.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MPLIST_unmapRegion (IN MPLIST_MemInfo * mplistRegionArgs)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_1ENTER ("LDRV_MPLIST_unmapRegion", mplistRegionArgs) ;
+
+    DBC_Require (mplistRegionArgs != NULL) ;
+
+    if (!IS_VALID_PROCID (mplistRegionArgs->procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("LDRV_MPLIST_unmapRegion", status) ;
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
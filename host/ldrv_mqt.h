@@ -0,0 +1,313 @@
+/** ============================================================================
+ *  @file   ldrv_mqt.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface between the MSGQ manager of the host backend
+ *          and the Message Queue Transports (MQT) that move messages to and
+ *          from a DSP.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LDRV_MQT_H)
+#define LDRV_MQT_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <msgqdefs.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @name   FnMqtInit
+ *
+ *  @desc   Signature of the function that initializes an MQT in the calling
+ *          process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    create
+ *              TRUE if the shared state of the MQT is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              Out of memory.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    FnMqtExit
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnMqtInit) (IN ProcessorId dspId, IN Bool create) ;
+
+/** ============================================================================
+ *  @name   FnMqtExit
+ *
+ *  @desc   Signature of the function that finalizes an MQT in the calling
+ *          process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    destroy
+ *              TRUE if the shared state of the MQT is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    FnMqtInit
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnMqtExit) (IN ProcessorId dspId, IN Bool destroy) ;
+
+/** ============================================================================
+ *  @name   FnMqtOpen
+ *
+ *  @desc   Signature of the function that opens an MQT.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    attrs
+ *              Attributes of the MQT.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid attributes.
+ *
+ *  @enter  The MQT is not open.
+ *
+ *  @leave  None
+ *
+ *  @see    FnMqtClose
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnMqtOpen) (IN ProcessorId dspId, IN Pvoid attrs) ;
+
+/** ============================================================================
+ *  @name   FnMqtClose
+ *
+ *  @desc   Signature of the function that closes an MQT.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  The MQT is open.
+ *
+ *  @leave  None
+ *
+ *  @see    FnMqtOpen
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnMqtClose) (IN ProcessorId dspId) ;
+
+/** ============================================================================
+ *  @name   FnMqtLocate
+ *
+ *  @desc   Signature of the function that locates a message queue on the
+ *          DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    queueName
+ *              Name of the message queue.
+ *  @arg    msgqQueue
+ *              Location to receive the message queue.
+ *  @arg    timeout
+ *              Time to wait for the answer of the DSP.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The message queue does not exist on the DSP.
+ *          DSP_ETIMEOUT
+ *              The DSP did not answer in time.
+ *
+ *  @enter  The MQT is open.
+ *
+ *  @leave  None
+ *
+ *  @see    FnMqtRelease
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnMqtLocate) (IN  ProcessorId  dspId,
+                                   IN  Pstr         queueName,
+                                   OUT MSGQ_Queue * msgqQueue,
+                                   IN  Uint32       timeout) ;
+
+/** ============================================================================
+ *  @name   FnMqtRelease
+ *
+ *  @desc   Signature of the function that releases a located message queue.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    msgqQueue
+ *              Message queue.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  The MQT is open.
+ *
+ *  @leave  None
+ *
+ *  @see    FnMqtLocate
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnMqtRelease) (IN ProcessorId dspId,
+                                    IN MSGQ_Queue  msgqQueue) ;
+
+/** ============================================================================
+ *  @name   FnMqtPut
+ *
+ *  @desc   Signature of the function that sends a message to the DSP. The
+ *          destination is in the header of the message.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    msg
+ *              Message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The message is not in a pool shared with the DSP.
+ *
+ *  @enter  The MQT is open.
+ *
+ *  @leave  On success, the message belongs to the DSP.
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnMqtPut) (IN ProcessorId dspId, IN MSGQ_Msg msg) ;
+
+/** ============================================================================
+ *  @name   FnMqtPutv
+ *
+ *  @desc   Signature of the function that sends an array of messages to the
+ *          DSP, notifying the DSP once for the whole array.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    msgArray
+ *              Messages.
+ *  @arg    numMsgs
+ *              Number of messages.
+ *  @arg    numPut
+ *              Location to receive the number of messages sent.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              A message is not in a pool shared with the DSP.
+ *
+ *  @enter  The MQT is open.
+ *
+ *  @leave  The first *numPut messages belong to the DSP.
+ *
+ *  @see    FnMqtPut
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnMqtPutv) (IN  ProcessorId dspId,
+                                 IN  MSGQ_Msg *  msgArray,
+                                 IN  Uint32      numMsgs,
+                                 OUT Uint32 *    numPut) ;
+
+
+/** ============================================================================
+ *  @name   MQT_Interface
+ *
+ *  @desc   Interface of a Message Queue Transport.
+ *
+ *  @field  init
+ *              Initializes the MQT in the calling process.
+ *  @field  exit
+ *              Finalizes the MQT in the calling process.
+ *  @field  open
+ *              Opens the MQT.
+ *  @field  close
+ *              Closes the MQT.
+ *  @field  locate
+ *              Locates a message queue on the DSP.
+ *  @field  release
+ *              Releases a located message queue.
+ *  @field  put
+ *              Sends a message to the DSP.
+ *  @field  putv
+ *              Sends an array of messages to the DSP.
+ *  ============================================================================
+ */
+struct MQT_Interface_tag {
+    FnMqtInit     init    ;
+    FnMqtExit     exit    ;
+    FnMqtOpen     open    ;
+    FnMqtClose    close   ;
+    FnMqtLocate   locate  ;
+    FnMqtRelease  release ;
+    FnMqtPut      put     ;
+    FnMqtPutv     putv    ;
+} ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LDRV_MQT_H) */
@@ -0,0 +1,3860 @@
+/** ============================================================================
+ *  @file   ldrv_msgq.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the MSGQ manager of the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <pooldefs.h>
+#include <msgqdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+#include <ldrv.h>
+#include <ldrv_proc.h>
+#include <ldrv_ips.h>
+#include <ldrv_pool.h>
+#include <ldrv_mqt.h>
+#include <ldrv_msgq.h>
+#include <zcpymqt.h>
+#include <ringmqt.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_MSGQ, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_MAXQUEUES
+ *
+ *  @desc   Highest number of local message queues that can be configured.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_MAXQUEUES     256u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_BUCKETS
+ *
+ *  @desc   Number of buckets of the name directory of the local message
+ *          queues. Must be a power of two.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_BUCKETS       256u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_CACHESIZE
+ *
+ *  @desc   Number of entries of the locate cache of a process. Must be a
+ *          power of two.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_CACHESIZE     64u
+
+/*  ============================================================================
+ *  @macro  LDRV_MSGQ_NEXT
+ *
+ *  @desc   Physical address of the next message in a queue, kept in the
+ *          reserved field of the header.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_NEXT(msg)     ((msg)->reserved [0])
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_SPINBUDGET
+ *
+ *  @desc   Default spin budget in microseconds of the adaptive wait policy.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_SPINBUDGET    50u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_SPINCHECK
+ *
+ *  @desc   Number of polls of a queue between two readings of the clock while
+ *          spinning.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_SPINCHECK     64u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_MAGAZINES
+ *
+ *  @desc   Number of message magazines of a thread, each caching the messages
+ *          of one pool and size.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_MAGAZINES     4u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_MAGSIZE
+ *
+ *  @desc   Capacity of a message magazine. A thread never holds more than
+ *          LDRV_MSGQ_MAGAZINES * LDRV_MSGQ_MAGSIZE free messages.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_MAGSIZE       16u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_MAGBATCH
+ *
+ *  @desc   Number of messages moved between a magazine and its pool at once.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_MAGBATCH      8u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_MAGSHARE
+ *
+ *  @desc   A magazine holds at most one LDRV_MSGQ_MAGSHARE-th of the buffers
+ *          of the class its messages come from, and classes of fewer than
+ *          2 * LDRV_MSGQ_MAGSHARE buffers are not cached at all.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_MAGSHARE      8u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_ASSEMBLIES
+ *
+ *  @desc   Number of large messages from the DSPs that a message queue can
+ *          reassemble at the same time.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_ASSEMBLIES    4u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_FRAGBATCH
+ *
+ *  @desc   Number of fragments of a large message handed to an MQT at once.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_FRAGBATCH     16u
+
+#if defined (DDSP_PROFILE)
+/*  ============================================================================
+ *  @macro  LDRV_MSGQ_STAMP
+ *
+ *  @desc   Time in ticks between the queuing of a message and of the one
+ *          before it on the same lane, coded by LDRV_MSGQ_gapCode.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_STAMP(msg)    ((msg)->reserved [1])
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_GAPSHIFT
+ *
+ *  @desc   Gaps between two messages of 2^31 ticks (about 34 seconds) or more
+ *          are coded in units of 2^LDRV_MSGQ_GAPSHIFT ticks.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_GAPSHIFT      16u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_LATSUBBITS
+ *
+ *  @desc   Number of bits below the most significant one that select the
+ *          bucket of a latency within its power of two.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_LATSUBBITS    2u
+
+/*  ============================================================================
+ *  @const  LDRV_MSGQ_LATBUCKETS
+ *
+ *  @desc   Number of buckets of the latency histogram of a queue, enough for
+ *          any 32-bit latency.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_LATBUCKETS    ((33u - LDRV_MSGQ_LATSUBBITS)                \
+                                 << LDRV_MSGQ_LATSUBBITS)
+
+/*  ============================================================================
+ *  @macro  LDRV_MSGQ_TICKSTONS
+ *
+ *  @desc   Converts a latency in ticks to nanoseconds, saturating at
+ *          0xFFFFFFFF.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_TICKSTONS(ticks)                                            \
+            (((ticks) > (0xFFFFFFFFu / SYNC_HOST_TICKNS)) ?                   \
+             0xFFFFFFFFu : ((ticks) * SYNC_HOST_TICKNS))
+#endif /* if defined (DDSP_PROFILE) */
+
+/*  ============================================================================
+ *  @macro  LDRV_MSGQ_FRAG
+ *
+ *  @desc   Fragment header of a message with the ID MSGQ_FRAGMSGID.
+ *  ============================================================================
+ */
+#define LDRV_MSGQ_FRAG(msg)     ((MSGQ_FragMsg *) ((Pvoid) (msg)))
+
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_Assembly
+ *
+ *  @desc   Large message from a DSP being reassembled on a local message
+ *          queue. Its fragments are chained in order through their link.
+ *
+ *  @field  srcProcId
+ *              Processor of the sender of the large message.
+ *  @field  xferId
+ *              Identifier of the large message given by the sender.
+ *  @field  headPhys
+ *              Physical address of the first fragment received, 0 if the
+ *              entry is free.
+ *  @field  tailPhys
+ *              Physical address of the last fragment of the chain.
+ *  @field  received
+ *              Number of fragments received.
+ *  ============================================================================
+ */
+typedef struct LDRV_MSGQ_Assembly_tag {
+    Uint32         srcProcId ;
+    Uint32         xferId    ;
+    Uint32         headPhys  ;
+    Uint32         tailPhys  ;
+    Uint32         received  ;
+} LDRV_MSGQ_Assembly ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_Queue
+ *
+ *  @desc   Shared state of a local message queue.
+ *
+ *  @field  name
+ *              Name of the message queue.
+ *  @field  hash
+ *              Hash of the name of the message queue.
+ *  @field  hashNext
+ *              Identifier plus one of the next message queue in the same
+ *              bucket of the name directory, 0 if none.
+ *  @field  inUse
+ *              TRUE while the message queue is open.
+ *  @field  ownerSlot
+ *              Process slot of the owner of the message queue.
+ *  @field  headPhys
+ *              Physical address of the first queued message of each lane, 0
+ *              if none.
+ *  @field  tailPhys
+ *              Physical address of the last queued message of each lane.
+ *  @field  laneCount
+ *              Number of queued messages of each lane.
+ *  @field  count
+ *              Number of queued messages of all lanes.
+ *  @field  numLanes
+ *              Number of priority lanes of the message queue.
+ *  @field  lanePolicy
+ *              Order of the dequeues from the lanes (MSGQ_LanePolicy).
+ *  @field  laneMsgIdStart
+ *              Lowest message ID of each lane but the last one.
+ *  @field  laneWeight
+ *              Weight of each lane for the weighted order.
+ *  @field  wrrLane
+ *              Lane currently visited by the weighted order.
+ *  @field  wrrCredit
+ *              Messages still to be taken from wrrLane before the weighted
+ *              order moves to the next lane.
+ *  @field  transferred
+ *              Number of messages delivered to the message queue.
+ *  @field  waitPolicy
+ *              Wait policy of the message queue (MSGQ_WaitPolicy).
+ *  @field  spinBudget
+ *              Longest spin in microseconds of the adaptive wait policy.
+ *  @field  lastArrival
+ *              Time in microseconds of the last arrival of messages, kept
+ *              for the adaptive wait policy only.
+ *  @field  avgGap
+ *              Running average of the time in microseconds between two
+ *              arrivals of messages, kept for the adaptive wait policy only.
+ *  @field  spinHits
+ *              Number of gets satisfied while spinning.
+ *  @field  latCount
+ *              Number of latencies recorded in latHist.
+ *  @field  latMax
+ *              Highest latency in ticks.
+ *  @field  latHist
+ *              Histogram of the latencies in ticks from the queuing of the
+ *              messages to their get, in logarithmic buckets.
+ *  @field  headPut
+ *              Time in ticks of the queuing of the first message of each
+ *              lane.
+ *  @field  tailPut
+ *              Time in ticks of the queuing of the last message of each lane.
+ *  @field  lastPut
+ *              Time in ticks of the queuing of the message last dequeued.
+ *  @field  polled
+ *              TRUE once the owner has asked for a pollable descriptor.
+ *  @field  pollFd
+ *              Pollable descriptor, valid in the owner process only.
+ *  @field  pollRaised
+ *              TRUE while the pollable descriptor is raised or being raised.
+ *  @field  assembly
+ *              Large messages from the DSPs being reassembled.
+ *  @field  lock
+ *              Lock protecting the message queue.
+ *  @field  cond
+ *              Signalled when a message is queued or the queue is closed.
+ *  ============================================================================
+ */
+typedef struct LDRV_MSGQ_Queue_tag {
+    Char8          name [DSP_MAX_STRLEN] ;
+    Uint32         hash        ;
+    Uint32         hashNext    ;
+    Uint32         inUse       ;
+    Uint32         ownerSlot   ;
+    Uint32         headPhys    [MSGQ_MAXLANES] ;
+    Uint32         tailPhys    [MSGQ_MAXLANES] ;
+    Uint32         laneCount   [MSGQ_MAXLANES] ;
+    Uint32         count       ;
+    Uint32         numLanes    ;
+    Uint32         lanePolicy  ;
+    Uint16         laneMsgIdStart [MSGQ_MAXLANES] ;
+    Uint32         laneWeight  [MSGQ_MAXLANES] ;
+    Uint32         wrrLane     ;
+    Uint32         wrrCredit   ;
+    Uint32         transferred ;
+    Uint32         waitPolicy  ;
+    Uint32         spinBudget  ;
+    Uint32         lastArrival ;
+    Uint32         avgGap      ;
+    Uint32         spinHits    ;
+#if defined (DDSP_PROFILE)
+    Uint32         latCount    ;
+    Uint32         latMax      ;
+    Uint32         latHist     [LDRV_MSGQ_LATBUCKETS] ;
+    SYNC_HostTicks headPut     [MSGQ_MAXLANES] ;
+    SYNC_HostTicks tailPut     [MSGQ_MAXLANES] ;
+    SYNC_HostTicks lastPut     ;
+#endif /* if defined (DDSP_PROFILE) */
+    Uint32         polled      ;
+    Int32          pollFd      ;
+    Uint32         pollRaised  ;
+    LDRV_MSGQ_Assembly assembly [LDRV_MSGQ_ASSEMBLIES] ;
+    SYNC_HostLock  lock        ;
+    SYNC_HostCond  cond        ;
+} LDRV_MSGQ_Queue ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_Object
+ *
+ *  @desc   Private state of the MSGQ manager in the driver segment.
+ *
+ *  @field  lock
+ *              Lock protecting the names of the queues and the MQTs.
+ *  @field  maxMsgqs
+ *              Number of local message queues.
+ *  @field  queues
+ *              Offset of the local message queues in the driver segment.
+ *  @field  errorQueue
+ *              Queue receiving the asynchronous errors.
+ *  @field  errorPoolId
+ *              Pool of the asynchronous error messages.
+ *  @field  mqtOpenCount
+ *              Number of opens of the MQT to each DSP.
+ *  @field  generation
+ *              Incremented on the last close of the MQT to each DSP, which
+ *              invalidates the queues of the DSP in the locate caches.
+ *  @field  buckets
+ *              Name directory of the local message queues. Each bucket holds
+ *              the identifier plus one of its first message queue, 0 if none.
+ *  @field  xferId
+ *              Identifier of the last large message sent from the GPP.
+ *  ============================================================================
+ */
+typedef struct LDRV_MSGQ_Object_tag {
+    SYNC_HostLock  lock         ;
+    Uint32         maxMsgqs     ;
+    Uint32         queues       ;
+    MSGQ_Queue     errorQueue   ;
+    Uint32         errorPoolId  ;
+    Uint32         mqtOpenCount [MAX_DSPS] ;
+    Uint32         generation   [MAX_DSPS] ;
+    Uint32         buckets      [LDRV_MSGQ_BUCKETS] ;
+    Uint32         xferId       ;
+} LDRV_MSGQ_Object ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_CacheEntry
+ *
+ *  @desc   Entry of the locate cache of a process. Only the message queues
+ *          on the DSPs are cached; the local ones are found in the name
+ *          directory without involving another processor.
+ *
+ *  @field  name
+ *              Name of the located message queue.
+ *  @field  msgqQueue
+ *              Located message queue, MSGQ_INVALIDMSGQ if the entry is free.
+ *  @field  generation
+ *              Generation of the MQT to the DSP of the message queue when the
+ *              entry was filled.
+ *  ============================================================================
+ */
+typedef struct LDRV_MSGQ_CacheEntry_tag {
+    Char8          name [DSP_MAX_STRLEN] ;
+    MSGQ_Queue     msgqQueue  ;
+    Uint32         generation ;
+} LDRV_MSGQ_CacheEntry ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_Magazine
+ *
+ *  @desc   Free messages of one pool and size kept by a thread, so that most
+ *          allocations and frees do not take the lock of the pool.
+ *
+ *  @field  poolId
+ *              Pool of the messages.
+ *  @field  size
+ *              Size of the messages.
+ *  @field  epoch
+ *              Value of LDRV_MSGQ_epoch when the magazine was filled.
+ *  @field  generation
+ *              Generation of the pool when the magazine was filled.
+ *  @field  limit
+ *              Number of messages the magazine may hold, 0 if the messages
+ *              are not cached.
+ *  @field  batch
+ *              Number of messages moved between the magazine and the pool at
+ *              once.
+ *  @field  count
+ *              Number of messages in the magazine.
+ *  @field  bufs
+ *              Messages in the magazine.
+ *  ============================================================================
+ */
+typedef struct LDRV_MSGQ_Magazine_tag {
+    Uint32         poolId     ;
+    Uint32         size       ;
+    Uint32         epoch      ;
+    Uint32         generation ;
+    Uint32         limit      ;
+    Uint32         batch      ;
+    Uint32         count      ;
+    Pvoid          bufs [LDRV_MSGQ_MAGSIZE] ;
+} LDRV_MSGQ_Magazine ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_MagSet
+ *
+ *  @desc   Message magazines of a thread. They are listed in the process so
+ *          that a thread finding a pool exhausted can return the messages
+ *          the other threads keep.
+ *
+ *  @field  lock
+ *              Taken by the thread around the use of its magazines, and by
+ *              another thread emptying them.
+ *  @field  listed
+ *              TRUE once the set is in LDRV_MSGQ_magSets.
+ *  @field  next
+ *              Next set in LDRV_MSGQ_magSets.
+ *  @field  mags
+ *              Magazines of the thread.
+ *  ============================================================================
+ */
+typedef struct LDRV_MSGQ_MagSet_tag {
+    volatile Uint32                 lock   ;
+    Bool                            listed ;
+    struct LDRV_MSGQ_MagSet_tag *   next   ;
+    LDRV_MSGQ_Magazine              mags [LDRV_MSGQ_MAGAZINES] ;
+} LDRV_MSGQ_MagSet ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_Transport
+ *
+ *  @desc   Maps the name of an MQT in the configuration to its interface.
+ *
+ *  @field  name
+ *              Name of the MQT.
+ *  @field  interface
+ *              Interface of the MQT.
+ *  ============================================================================
+ */
+typedef struct LDRV_MSGQ_Transport_tag {
+    Char8 *         name      ;
+    MQT_Interface * interface ;
+} LDRV_MSGQ_Transport ;
+
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_transports
+ *
+ *  @desc   MQTs supported by the host backend.
+ *  ============================================================================
+ */
+STATIC LDRV_MSGQ_Transport LDRV_MSGQ_transports [] = {
+    { "ZCPYMQT", &ZCPYMQT_Interface },
+    { "RINGMQT", &RINGMQT_Interface }
+} ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_state
+ *
+ *  @desc   Private state of the MSGQ manager in the driver segment.
+ *  ============================================================================
+ */
+STATIC LDRV_MSGQ_Object * LDRV_MSGQ_state = NULL ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_queues
+ *
+ *  @desc   Local message queues in the driver segment.
+ *  ============================================================================
+ */
+STATIC LDRV_MSGQ_Queue * LDRV_MSGQ_queues = NULL ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_mqts
+ *
+ *  @desc   MQT of each DSP in the calling process.
+ *  ============================================================================
+ */
+STATIC MQT_Interface * LDRV_MSGQ_mqts [MAX_DSPS] ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_mqtOpens
+ *
+ *  @desc   Number of opens of the MQT to each DSP by the calling process.
+ *  ============================================================================
+ */
+STATIC Uint32 LDRV_MSGQ_mqtOpens [MAX_DSPS] ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_attrs
+ *
+ *  @desc   Pend and post functions of the queues owned by the calling
+ *          process. They can only be called from the owner, so they are used
+ *          for the messages put by the owner; the other messages wake the
+ *          getter through the condition of the queue.
+ *  ============================================================================
+ */
+STATIC MSGQ_Attrs LDRV_MSGQ_attrs [LDRV_MSGQ_MAXQUEUES] ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_cache
+ *
+ *  @desc   Locate cache of the calling process, indexed by the hash of the
+ *          names.
+ *  ============================================================================
+ */
+STATIC LDRV_MSGQ_CacheEntry LDRV_MSGQ_cache [LDRV_MSGQ_CACHESIZE] ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_cacheLock
+ *
+ *  @desc   Lock protecting the locate cache of the calling process.
+ *  ============================================================================
+ */
+STATIC SYNC_HostLock LDRV_MSGQ_cacheLock ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_magSet
+ *
+ *  @desc   Message magazines of the calling thread.
+ *  ============================================================================
+ */
+STATIC __thread LDRV_MSGQ_MagSet LDRV_MSGQ_magSet ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_magSets
+ *
+ *  @desc   Magazine sets of the threads of the process that used them,
+ *          protected by LDRV_MSGQ_magSetsLock. It is taken before the lock of
+ *          a set, never while holding one.
+ *  ============================================================================
+ */
+STATIC LDRV_MSGQ_MagSet * LDRV_MSGQ_magSets = NULL ;
+STATIC pthread_mutex_t LDRV_MSGQ_magSetsLock = PTHREAD_MUTEX_INITIALIZER ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_magVictim
+ *
+ *  @desc   Next magazine of the calling thread to be taken over by another
+ *          pool and size.
+ *  ============================================================================
+ */
+STATIC __thread Uint32 LDRV_MSGQ_magVictim = 0u ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_epoch
+ *
+ *  @desc   Incremented at every initialization and finalization of the MSGQ
+ *          manager in the calling process, which resets the magazines of all
+ *          its threads at their next use. Their messages have already been
+ *          returned by LDRV_MSGQ_exit.
+ *  ============================================================================
+ */
+STATIC volatile Uint32 LDRV_MSGQ_epoch = 0u ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_magKey
+ *
+ *  @desc   Key whose destructor returns the magazines of an exiting thread.
+ *  ============================================================================
+ */
+STATIC pthread_key_t LDRV_MSGQ_magKey ;
+
+/*  ============================================================================
+ *  @name   LDRV_MSGQ_magOnce
+ *
+ *  @desc   Creates LDRV_MSGQ_magKey once per process.
+ *  ============================================================================
+ */
+STATIC pthread_once_t LDRV_MSGQ_magOnce = PTHREAD_ONCE_INIT ;
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_toPhy
+ *
+ *  @desc   Gets the physical address of a message.
+ *
+ *  @arg    msg
+ *              Message.
+ *
+ *  @ret    Physical address of the message, LDRV_INVALID_ADDR if the message
+ *          is not in a configured pool.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_toUsr
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_MSGQ_toPhy (IN MSGQ_Msg msg)
+{
+    Uint32      physAddr = LDRV_INVALID_ADDR ;
+    ProcessorId dspId    = POOL_getProcId (msg->poolId) ;
+
+    if (IS_VALID_PROCID (dspId)) {
+        physAddr = LDRV_usrToPhy (dspId, msg) ;
+    }
+
+    return physAddr ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_toUsr
+ *
+ *  @desc   Gets a message from its physical address. Physical addresses are
+ *          unique across the DSPs.
+ *
+ *  @arg    physAddr
+ *              Physical address of the message.
+ *
+ *  @ret    Message, NULL if the address is not mapped.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_toPhy
+ *  ============================================================================
+ */
+STATIC
+MSGQ_Msg
+LDRV_MSGQ_toUsr (IN Uint32 physAddr)
+{
+    MSGQ_Msg    msg = NULL ;
+    ProcessorId dspId ;
+
+    for (dspId = 0u ; (dspId < MAX_DSPS) && (msg == NULL) ; dspId++) {
+        msg = (MSGQ_Msg) LDRV_phyToUsr (dspId, physAddr) ;
+    }
+
+    return msg ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_getQueue
+ *
+ *  @desc   Gets the shared state of a local message queue.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *
+ *  @ret    Shared state of the queue, NULL if the queue is not local.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+LDRV_MSGQ_Queue *
+LDRV_MSGQ_getQueue (IN MSGQ_Queue msgqQueue)
+{
+    LDRV_MSGQ_Queue * queue = NULL ;
+
+    if (    (LDRV_MSGQ_state != NULL)
+        &&  ((msgqQueue >> 16u) == ID_GPP)
+        &&  ((msgqQueue & 0xFFFFu) < LDRV_MSGQ_state->maxMsgqs)) {
+        queue = &(LDRV_MSGQ_queues [msgqQueue & 0xFFFFu]) ;
+    }
+
+    return queue ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_lane
+ *
+ *  @desc   Selects the priority lane of a message from its message ID.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *  @arg    msgId
+ *              Message ID of the message.
+ *
+ *  @ret    Lane of the message.
+ *
+ *  @enter  The lock of the queue is held.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_LaneAttrs
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_MSGQ_lane (IN LDRV_MSGQ_Queue * queue, IN Uint16 msgId)
+{
+    Uint32 lane = queue->numLanes - 1u ;
+    Uint32 i ;
+
+    if (msgId == MSGQ_INVALIDMSGID) {
+        lane = queue->numLanes - 1u ;
+    }
+    else if (msgId >= MSGQ_INTERNALIDSSTART) {
+        lane = 0u ;
+    }
+    else {
+        for (i = 0u ; i < (queue->numLanes - 1u) ; i++) {
+            if (msgId >= queue->laneMsgIdStart [i]) {
+                lane = i ;
+                break ;
+            }
+        }
+    }
+
+    return lane ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_gapCode
+ *
+ *  @desc   Codes the time between the queuing of two messages in 32 bits,
+ *          exactly below 2^31 ticks and in units of 2^LDRV_MSGQ_GAPSHIFT
+ *          ticks above.
+ *
+ *  @arg    gap
+ *              Time in ticks.
+ *
+ *  @ret    Coded time.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_gapDecode
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_MSGQ_gapCode (IN SYNC_HostTicks gap)
+{
+    Uint32 code = (Uint32) gap ;
+
+    if (gap >= 0x80000000u) {
+        gap >>= LDRV_MSGQ_GAPSHIFT ;
+        code  = (gap >= 0x7FFFFFFFu) ? 0xFFFFFFFFu
+                                     : (0x80000000u | (Uint32) gap) ;
+    }
+
+    return code ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_gapDecode
+ *
+ *  @desc   Decodes a time coded by LDRV_MSGQ_gapCode.
+ *
+ *  @arg    code
+ *              Coded time.
+ *
+ *  @ret    Time in ticks, rounded down.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_gapCode
+ *  ============================================================================
+ */
+STATIC
+SYNC_HostTicks
+LDRV_MSGQ_gapDecode (IN Uint32 code)
+{
+    SYNC_HostTicks gap = code ;
+
+    if (code >= 0x80000000u) {
+        gap = (SYNC_HostTicks) (code & 0x7FFFFFFFu) << LDRV_MSGQ_GAPSHIFT ;
+    }
+
+    return gap ;
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_dequeue
+ *
+ *  @desc   Removes the next message of a queue, following the lane policy of
+ *          the queue.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *
+ *  @ret    Message, NULL if the queue is empty.
+ *
+ *  @enter  The lock of the queue is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+MSGQ_Msg
+LDRV_MSGQ_dequeue (IN LDRV_MSGQ_Queue * queue)
+{
+    MSGQ_Msg msg  = NULL ;
+    Uint32   lane = 0u ;
+    Uint32   i ;
+#if defined (DDSP_PROFILE)
+    MSGQ_Msg next ;
+#endif /* if defined (DDSP_PROFILE) */
+
+    if (queue->count != 0u) {
+        if (queue->lanePolicy == MSGQ_LanePolicy_Weighted) {
+            lane = queue->wrrLane ;
+            if (    (queue->laneCount [lane] == 0u)
+                ||  (queue->wrrCredit == 0u)) {
+                for (i = 0u ; i < queue->numLanes ; i++) {
+                    lane = (lane + 1u) % queue->numLanes ;
+                    if (queue->laneCount [lane] != 0u) {
+                        break ;
+                    }
+                }
+                queue->wrrLane   = lane ;
+                queue->wrrCredit = queue->laneWeight [lane] ;
+            }
+            queue->wrrCredit-- ;
+        }
+        else {
+            while (queue->laneCount [lane] == 0u) {
+                lane++ ;
+            }
+        }
+
+        msg                     = LDRV_MSGQ_toUsr (queue->headPhys [lane]) ;
+        queue->headPhys [lane]  = LDRV_MSGQ_NEXT (msg) ;
+        queue->laneCount [lane]-- ;
+        queue->count-- ;
+        if (queue->laneCount [lane] == 0u) {
+            queue->tailPhys [lane] = 0u ;
+        }
+#if defined (DDSP_PROFILE)
+        queue->lastPut = queue->headPut [lane] ;
+        if (queue->laneCount [lane] != 0u) {
+            next = LDRV_MSGQ_toUsr (queue->headPhys [lane]) ;
+            queue->headPut [lane] +=
+                            LDRV_MSGQ_gapDecode (LDRV_MSGQ_STAMP (next)) ;
+        }
+#endif /* if defined (DDSP_PROFILE) */
+    }
+
+    return msg ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_hash
+ *
+ *  @desc   Hashes the name of a message queue (FNV-1a).
+ *
+ *  @arg    queueName
+ *              Name of the queue.
+ *
+ *  @ret    Hash of the name.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_findLocal
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_MSGQ_hash (IN Pstr queueName)
+{
+    Uint32 hash = 2166136261u ;
+    Uint32 i ;
+
+    for (i = 0u ; (i < DSP_MAX_STRLEN) && (queueName [i] != '\0') ; i++) {
+        hash = (hash ^ (Uint8) queueName [i]) * 16777619u ;
+    }
+
+    return hash ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_findLocal
+ *
+ *  @desc   Finds an open local queue by name in the name directory.
+ *
+ *  @arg    queueName
+ *              Name of the queue.
+ *  @arg    hash
+ *              Hash of the name.
+ *
+ *  @ret    Identifier of the queue, MSGQ_INVALIDMSGQ if not found.
+ *
+ *  @enter  The global lock is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_hash
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_MSGQ_findLocal (IN Pstr queueName, IN Uint32 hash)
+{
+    Uint32            id = MSGQ_INVALIDMSGQ ;
+    LDRV_MSGQ_Queue * queue ;
+    Uint32            next ;
+
+    next = LDRV_MSGQ_state->buckets [hash & (LDRV_MSGQ_BUCKETS - 1u)] ;
+    while ((next != 0u) && (id == MSGQ_INVALIDMSGQ)) {
+        queue = &(LDRV_MSGQ_queues [next - 1u]) ;
+        if (    (queue->hash == hash)
+            &&  (strncmp (queue->name, queueName, DSP_MAX_STRLEN) == 0)) {
+            id = next - 1u ;
+        }
+        next = queue->hashNext ;
+    }
+
+    return id ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_unlink
+ *
+ *  @desc   Removes a queue from the name directory.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *  @arg    id
+ *              Identifier of the queue.
+ *
+ *  @ret    None
+ *
+ *  @enter  The global lock is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_findLocal
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_unlink (IN LDRV_MSGQ_Queue * queue, IN Uint32 id)
+{
+    Uint32 * link ;
+
+    link = &(LDRV_MSGQ_state->buckets [queue->hash & (LDRV_MSGQ_BUCKETS - 1u)]);
+    while ((*link != 0u) && (*link != (id + 1u))) {
+        link = &(LDRV_MSGQ_queues [*link - 1u].hashNext) ;
+    }
+
+    if (*link != 0u) {
+        *link = queue->hashNext ;
+    }
+    queue->hashNext = 0u ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_setLanes
+ *
+ *  @desc   Copies the priority lanes requested at the open of a queue to its
+ *          shared state.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *  @arg    laneAttrs
+ *              Requested lanes, already validated.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the queue is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_open
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_setLanes (IN LDRV_MSGQ_Queue * queue,
+                    IN MSGQ_LaneAttrs *  laneAttrs)
+{
+    Uint32 lane ;
+
+    queue->numLanes   = laneAttrs->numLanes ;
+    queue->lanePolicy = laneAttrs->policy ;
+    for (lane = 0u ; lane < queue->numLanes ; lane++) {
+        queue->laneMsgIdStart [lane] = laneAttrs->msgIdStart [lane] ;
+        if (laneAttrs->weight [lane] != 0u) {
+            queue->laneWeight [lane] = laneAttrs->weight [lane] ;
+        }
+    }
+    queue->wrrCredit = queue->laneWeight [0] ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_freeChain
+ *
+ *  @desc   Frees a message and, if it is a fragment of a large message, the
+ *          fragments chained after it.
+ *
+ *  @arg    msg
+ *              First message to free.
+ *  @arg    cached
+ *              TRUE to free through the magazine of the calling thread.
+ *
+ *  @ret    None
+ *
+ *  @enter  The chain is owned by the caller.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_assemble
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_freeChain (IN MSGQ_Msg msg, IN Bool cached)
+{
+    Uint32 physAddr ;
+
+    while (msg != NULL) {
+        physAddr = 0u ;
+        if (msg->msgId == MSGQ_FRAGMSGID) {
+            physAddr = LDRV_MSGQ_FRAG (msg)->link ;
+        }
+
+        if (cached == TRUE) {
+            LDRV_MSGQ_free (msg) ;
+        }
+        else {
+            LDRV_POOL_free (msg->poolId, msg, msg->size) ;
+        }
+
+        msg = NULL ;
+        if (physAddr != 0u) {
+            msg = LDRV_MSGQ_toUsr (physAddr) ;
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_freeOthers
+ *
+ *  @desc   Frees the fragments of a large message but one, which is left
+ *          unlinked.
+ *
+ *  @arg    msg
+ *              First fragment of the large message.
+ *  @arg    keep
+ *              Fragment not to free.
+ *
+ *  @ret    None
+ *
+ *  @enter  The chain is owned by the caller.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_freeChain
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_freeOthers (IN MSGQ_Msg msg, IN MSGQ_Msg keep)
+{
+    Uint32 physAddr ;
+
+    while (msg != NULL) {
+        physAddr = LDRV_MSGQ_FRAG (msg)->link ;
+        if (msg == keep) {
+            LDRV_MSGQ_FRAG (msg)->link = 0u ;
+        }
+        else {
+            LDRV_MSGQ_free (msg) ;
+        }
+
+        msg = NULL ;
+        if (physAddr != 0u) {
+            msg = LDRV_MSGQ_toUsr (physAddr) ;
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_assemble
+ *
+ *  @desc   Adds a fragment received from a DSP to the large message it
+ *          belongs to. When the large message is complete, its first
+ *          fragment is returned, chained to the others in order, to be
+ *          queued as a single message.
+ *
+ *  @arg    msg
+ *              On entry, the fragment. On exit, the first fragment of the
+ *              completed large message, NULL if it is not complete yet.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The destination queue is not open.
+ *          DSP_ERESOURCE
+ *              The destination queue is reassembling too many large messages.
+ *
+ *  @enter  The fragment has the message ID MSGQ_FRAGMSGID.
+ *
+ *  @leave  On failure, the fragment still belongs to the caller.
+ *
+ *  @see    LDRV_MSGQ_put, LDRV_MSGQ_deliver
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LDRV_MSGQ_assemble (IN OUT MSGQ_Msg * msg)
+{
+    DSP_STATUS           status = DSP_SOK ;
+    MSGQ_FragMsg *       frag   = LDRV_MSGQ_FRAG (*msg) ;
+    LDRV_MSGQ_Assembly * entry  = NULL ;
+    LDRV_MSGQ_Queue *    queue ;
+    MSGQ_FragMsg *       prev ;
+    Uint32               physAddr ;
+    Uint32               i ;
+
+    physAddr   = LDRV_MSGQ_toPhy (*msg) ;
+    frag->link = 0u ;
+    queue = LDRV_MSGQ_getQueue (((Uint32) ID_GPP << 16u) | (*msg)->dstId) ;
+    if ((queue == NULL) || (physAddr == LDRV_INVALID_ADDR)) {
+        status = DSP_ENOTFOUND ;
+    }
+    else if (frag->numFrags <= 1u) {
+        /* A large message of one fragment needs no reassembly. */
+    }
+    else {
+        SYNC_HOST_enter (&queue->lock) ;
+        for (i = 0u ; (i < LDRV_MSGQ_ASSEMBLIES) && (entry == NULL) ; i++) {
+            if (    (queue->assembly [i].headPhys != 0u)
+                &&  (queue->assembly [i].xferId == frag->xferId)
+                &&  (  queue->assembly [i].srcProcId
+                     == (*msg)->srcProcId)) {
+                entry = &(queue->assembly [i]) ;
+            }
+        }
+        for (i = 0u ; (i < LDRV_MSGQ_ASSEMBLIES) && (entry == NULL) ; i++) {
+            if (queue->assembly [i].headPhys == 0u) {
+                entry            = &(queue->assembly [i]) ;
+                entry->srcProcId = (*msg)->srcProcId ;
+                entry->xferId    = frag->xferId ;
+                entry->received  = 0u ;
+            }
+        }
+
+        if (queue->inUse == FALSE) {
+            status = DSP_ENOTFOUND ;
+        }
+        else if (entry == NULL) {
+            status = DSP_ERESOURCE ;
+        }
+        else if (entry->headPhys == 0u) {
+            entry->headPhys = physAddr ;
+            entry->tailPhys = physAddr ;
+        }
+        else {
+            prev = LDRV_MSGQ_FRAG (LDRV_MSGQ_toUsr (entry->tailPhys)) ;
+            if (prev->index < frag->index) {
+                /* The fragments of one sender normally arrive in order. */
+                prev->link      = physAddr ;
+                entry->tailPhys = physAddr ;
+            }
+            else {
+                prev = LDRV_MSGQ_FRAG (LDRV_MSGQ_toUsr (entry->headPhys)) ;
+                if (prev->index > frag->index) {
+                    frag->link      = entry->headPhys ;
+                    entry->headPhys = physAddr ;
+                }
+                else {
+                    while (    (prev->link != 0u)
+                           &&  (LDRV_MSGQ_FRAG (LDRV_MSGQ_toUsr (prev->link))
+                                                 ->index < frag->index)) {
+                        prev = LDRV_MSGQ_FRAG (LDRV_MSGQ_toUsr (prev->link)) ;
+                    }
+                    frag->link = prev->link ;
+                    prev->link = physAddr ;
+                }
+            }
+        }
+
+        *msg = NULL ;
+        if (DSP_SUCCEEDED (status)) {
+            entry->received++ ;
+            if (entry->received == frag->numFrags) {
+                *msg            = LDRV_MSGQ_toUsr (entry->headPhys) ;
+                entry->headPhys = 0u ;
+            }
+        }
+        else {
+            *msg = &(frag->header) ;
+        }
+        SYNC_HOST_leave (&queue->lock) ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_drain
+ *
+ *  @desc   Closes a queue, removes it from the name directory and frees its
+ *          messages.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *  @arg    id
+ *              Identifier of the queue.
+ *
+ *  @ret    None
+ *
+ *  @enter  The global lock is held, the lock of the queue is not.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_drain (IN LDRV_MSGQ_Queue * queue, IN Uint32 id)
+{
+    Uint32   physAddr [MSGQ_MAXLANES] ;
+    Uint32   partial [LDRV_MSGQ_ASSEMBLIES] ;
+    MSGQ_Msg msg ;
+    Uint32   lane ;
+    Uint32   i ;
+
+    SYNC_HOST_enter (&queue->lock) ;
+    if (    (queue->polled == TRUE)
+        &&  (queue->ownerSlot == LDRV_procSlot ())) {
+        SYNC_HOST_deletePollFd (queue->pollFd) ;
+    }
+    queue->polled     = FALSE ;
+    queue->pollRaised = FALSE ;
+    for (i = 0u ; i < LDRV_MSGQ_ASSEMBLIES ; i++) {
+        partial [i]                  = queue->assembly [i].headPhys ;
+        queue->assembly [i].headPhys = 0u ;
+    }
+    for (lane = 0u ; lane < MSGQ_MAXLANES ; lane++) {
+        physAddr [lane]         = queue->headPhys [lane] ;
+        queue->headPhys [lane]  = 0u ;
+        queue->tailPhys [lane]  = 0u ;
+        queue->laneCount [lane] = 0u ;
+    }
+    queue->inUse    = FALSE ;
+    queue->count    = 0u ;
+    queue->name [0] = '\0' ;
+    SYNC_HOST_broadcast (&queue->cond) ;
+    SYNC_HOST_leave (&queue->lock) ;
+
+    LDRV_MSGQ_unlink (queue, id) ;
+    memset (&(LDRV_MSGQ_attrs [id]), 0, sizeof (MSGQ_Attrs)) ;
+
+    for (lane = 0u ; lane < MSGQ_MAXLANES ; lane++) {
+        while (physAddr [lane] != 0u) {
+            msg             = LDRV_MSGQ_toUsr (physAddr [lane]) ;
+            physAddr [lane] = LDRV_MSGQ_NEXT (msg) ;
+            LDRV_MSGQ_freeChain (msg, FALSE) ;
+        }
+    }
+
+    for (i = 0u ; i < LDRV_MSGQ_ASSEMBLIES ; i++) {
+        if (partial [i] != 0u) {
+            LDRV_MSGQ_freeChain (LDRV_MSGQ_toUsr (partial [i]), FALSE) ;
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_arrival
+ *
+ *  @desc   Records an arrival of messages on a queue with the adaptive wait
+ *          policy, updating the running average of the time between two
+ *          arrivals.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the queue is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_spinLimit
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_arrival (IN LDRV_MSGQ_Queue * queue)
+{
+    Uint32 now ;
+    Uint32 gap ;
+
+    now = SYNC_HOST_usecs () ;
+    if (queue->lastArrival != 0u) {
+        gap = now - queue->lastArrival ;
+        /* Gaps far beyond the budget only need to keep the average above
+         * it, and are clipped so that the average recovers quickly.
+         */
+        if (gap > (queue->spinBudget * 8u)) {
+            gap = queue->spinBudget * 8u ;
+        }
+        queue->avgGap = queue->avgGap - (queue->avgGap / 8u) + (gap / 8u) ;
+    }
+    queue->lastArrival = (now == 0u) ? 1u : now ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_latRecord
+ *
+ *  @desc   Records the latency of a message in the histogram of its queue.
+ *          Latencies below 2^LDRV_MSGQ_LATSUBBITS ticks have a bucket each;
+ *          above, each power of two is split in 2^LDRV_MSGQ_LATSUBBITS
+ *          buckets, and latencies of 2^32 ticks or more go to the last one.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *  @arg    latency
+ *              Latency of the message in ticks.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the queue is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_latPercentile
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_latRecord (IN LDRV_MSGQ_Queue * queue, IN SYNC_HostTicks latency)
+{
+    Uint32 ticks  = (latency > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (Uint32) latency ;
+    Uint32 bucket = ticks ;
+    Uint32 msb ;
+
+    if (ticks >= (1u << LDRV_MSGQ_LATSUBBITS)) {
+        msb    = 31u - (Uint32) __builtin_clz (ticks) ;
+        bucket =   ((msb - LDRV_MSGQ_LATSUBBITS + 1u) << LDRV_MSGQ_LATSUBBITS)
+                 + (  (ticks >> (msb - LDRV_MSGQ_LATSUBBITS))
+                    & ((1u << LDRV_MSGQ_LATSUBBITS) - 1u)) ;
+    }
+
+    queue->latHist [bucket]++ ;
+    queue->latCount++ ;
+    if (ticks > queue->latMax) {
+        queue->latMax = ticks ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_latPercentile
+ *
+ *  @desc   Finds a percentile of the latencies recorded on a queue.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *  @arg    above
+ *              Number of recorded latencies allowed above the percentile,
+ *              e.g. latCount / 100 for the 99th percentile.
+ *
+ *  @ret    Upper bound in ticks of the bucket of the percentile, not above
+ *          the highest latency, 0 if no latency is recorded.
+ *
+ *  @enter  The lock of the queue is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_latRecord
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_MSGQ_latPercentile (IN LDRV_MSGQ_Queue * queue, IN Uint32 above)
+{
+    Uint32 ticks  = 0u ;
+    Uint32 target = queue->latCount - above ;
+    Uint32 seen   = 0u ;
+    Uint32 shift ;
+    Uint32 i ;
+
+    for (i = 0u ; (i < LDRV_MSGQ_LATBUCKETS) && (seen < target) ; i++) {
+        seen += queue->latHist [i] ;
+        if (seen >= target) {
+            ticks = i ;
+            if (i >= (1u << LDRV_MSGQ_LATSUBBITS)) {
+                shift = (i >> LDRV_MSGQ_LATSUBBITS) - 1u ;
+                ticks =   (  ((i & ((1u << LDRV_MSGQ_LATSUBBITS) - 1u)) + 1u)
+                           + (1u << LDRV_MSGQ_LATSUBBITS))
+                        << shift ;
+                ticks -= 1u ;
+            }
+        }
+    }
+
+    if (ticks > queue->latMax) {
+        ticks = queue->latMax ;
+    }
+
+    return ticks ;
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_spinLimit
+ *
+ *  @desc   Computes how long a get may spin on an empty queue before
+ *          blocking, according to the wait policy of the queue.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *  @arg    timeout
+ *              Timeout of the get in milliseconds, not WAIT_NONE.
+ *
+ *  @ret    Spin limit in microseconds, WAIT_FOREVER to spin until a message
+ *          arrives, 0 to block at once.
+ *
+ *  @enter  The lock of the queue is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_spin
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_MSGQ_spinLimit (IN LDRV_MSGQ_Queue * queue, IN Uint32 timeout)
+{
+    Uint32 limit = 0u ;
+
+    if (queue->waitPolicy == MSGQ_WaitPolicy_Poll) {
+        limit = WAIT_FOREVER ;
+    }
+    else if (queue->waitPolicy == MSGQ_WaitPolicy_Adaptive) {
+        /* Spin only when the next message is expected within the budget,
+         * and then for about twice the average gap between arrivals.
+         */
+        if (queue->avgGap <= queue->spinBudget) {
+            limit = queue->avgGap * 2u ;
+            if ((limit == 0u) || (limit > queue->spinBudget)) {
+                limit = queue->spinBudget ;
+            }
+        }
+    }
+
+    /* The spin never outlasts the timeout of the get, nor the budget of
+     * the policy: a timeout too long to count in microseconds only makes
+     * an endless poll finite.
+     */
+    if ((limit != 0u) && (timeout != WAIT_FOREVER)) {
+        if (timeout < (WAIT_FOREVER / 1000u)) {
+            if (limit > (timeout * 1000u)) {
+                limit = timeout * 1000u ;
+            }
+        }
+        else if (limit == WAIT_FOREVER) {
+            limit = WAIT_FOREVER - 1u ;
+        }
+    }
+
+    return limit ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_spin
+ *
+ *  @desc   Polls an empty queue without holding its lock until a message
+ *          arrives, the queue is closed or the spin limit expires.
+ *
+ *  @arg    queue
+ *              Shared state of the queue.
+ *  @arg    limit
+ *              Spin limit in microseconds, WAIT_FOREVER for no limit.
+ *
+ *  @ret    TRUE
+ *              A message arrived while spinning.
+ *          FALSE
+ *              The spin limit expired or the queue was closed.
+ *
+ *  @enter  The lock of the queue is not held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_spinLimit
+ *  ============================================================================
+ */
+STATIC
+Bool
+LDRV_MSGQ_spin (IN LDRV_MSGQ_Queue * queue, IN Uint32 limit)
+{
+    volatile Uint32 * count = &(queue->count) ;
+    volatile Uint32 * inUse = &(queue->inUse) ;
+    Bool              found = FALSE ;
+    Bool              done  = FALSE ;
+    Uint32            start ;
+    Uint32            i ;
+
+    start = SYNC_HOST_usecs () ;
+    while (done == FALSE) {
+        for (i = 0u ; (i < LDRV_MSGQ_SPINCHECK) && (done == FALSE) ; i++) {
+            if (*count != 0u) {
+                found = TRUE ;
+                done  = TRUE ;
+            }
+            else if (*inUse == FALSE) {
+                done = TRUE ;
+            }
+        }
+
+        if (    (done == FALSE)
+            &&  (limit != WAIT_FOREVER)
+            &&  ((SYNC_HOST_usecs () - start) >= limit)) {
+            done = TRUE ;
+        }
+        else if (done == FALSE) {
+            /* The producer may share the processor with the spinner. */
+            sched_yield () ;
+        }
+    }
+
+    return found ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_generation
+ *
+ *  @desc   Reads the generation of the MQT to a DSP.
+ *
+ *  @arg    dspId
+ *              Processor identifier of the DSP.
+ *
+ *  @ret    Current generation.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_cacheFind
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_MSGQ_generation (IN ProcessorId dspId)
+{
+    __sync_synchronize () ;
+
+    return *((volatile Uint32 *) &(LDRV_MSGQ_state->generation [dspId])) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_cacheFind
+ *
+ *  @desc   Looks up a name in the locate cache of the calling process. An
+ *          entry is valid while the MQT to its DSP stays open.
+ *
+ *  @arg    queueName
+ *              Name of the queue.
+ *  @arg    hash
+ *              Hash of the name.
+ *  @arg    msgqQueue
+ *              Location to receive the cached message queue.
+ *
+ *  @ret    TRUE
+ *              The name is cached and the entry is still valid.
+ *          FALSE
+ *              The name must be located.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_cacheFill, LDRV_MSGQ_cacheForget
+ *  ============================================================================
+ */
+STATIC
+Bool
+LDRV_MSGQ_cacheFind (IN  Pstr         queueName,
+                     IN  Uint32       hash,
+                     OUT MSGQ_Queue * msgqQueue)
+{
+    Bool                   found = FALSE ;
+    LDRV_MSGQ_CacheEntry * entry ;
+    ProcessorId            dspId ;
+
+    entry = &(LDRV_MSGQ_cache [hash & (LDRV_MSGQ_CACHESIZE - 1u)]) ;
+    SYNC_HOST_enter (&LDRV_MSGQ_cacheLock) ;
+    if (    (entry->msgqQueue != MSGQ_INVALIDMSGQ)
+        &&  (strncmp (entry->name, queueName, DSP_MAX_STRLEN) == 0)) {
+        dspId = (ProcessorId) (entry->msgqQueue >> 16u) ;
+        if (    (LDRV_MSGQ_state->mqtOpenCount [dspId] != 0u)
+            &&  (entry->generation == LDRV_MSGQ_generation (dspId))) {
+            *msgqQueue = entry->msgqQueue ;
+            found      = TRUE ;
+        }
+        else {
+            entry->msgqQueue = MSGQ_INVALIDMSGQ ;
+        }
+    }
+    SYNC_HOST_leave (&LDRV_MSGQ_cacheLock) ;
+
+    return found ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_cacheFill
+ *
+ *  @desc   Records a message queue located on a DSP in the locate cache of
+ *          the calling process.
+ *
+ *  @arg    queueName
+ *              Name of the queue.
+ *  @arg    hash
+ *              Hash of the name.
+ *  @arg    generation
+ *              Generation of the MQT to the DSP of the message queue, read
+ *              before the locate.
+ *  @arg    msgqQueue
+ *              Message queue located on the DSP.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_cacheFind
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_cacheFill (IN Pstr       queueName,
+                     IN Uint32     hash,
+                     IN Uint32     generation,
+                     IN MSGQ_Queue msgqQueue)
+{
+    LDRV_MSGQ_CacheEntry * entry ;
+
+    entry = &(LDRV_MSGQ_cache [hash & (LDRV_MSGQ_CACHESIZE - 1u)]) ;
+    SYNC_HOST_enter (&LDRV_MSGQ_cacheLock) ;
+    strncpy (entry->name, queueName, DSP_MAX_STRLEN - 1u) ;
+    entry->name [DSP_MAX_STRLEN - 1u] = '\0' ;
+    entry->msgqQueue  = msgqQueue ;
+    entry->generation = generation ;
+    SYNC_HOST_leave (&LDRV_MSGQ_cacheLock) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_cacheForget
+ *
+ *  @desc   Removes a message queue from the locate cache of the calling
+ *          process.
+ *
+ *  @arg    msgqQueue
+ *              Message queue to remove.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_cacheFill
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_cacheForget (IN MSGQ_Queue msgqQueue)
+{
+    Uint32 i ;
+
+    SYNC_HOST_enter (&LDRV_MSGQ_cacheLock) ;
+    for (i = 0u ; i < LDRV_MSGQ_CACHESIZE ; i++) {
+        if (LDRV_MSGQ_cache [i].msgqQueue == msgqQueue) {
+            LDRV_MSGQ_cache [i].msgqQueue = MSGQ_INVALIDMSGQ ;
+        }
+    }
+    SYNC_HOST_leave (&LDRV_MSGQ_cacheLock) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_magFlush
+ *
+ *  @desc   Returns messages of a magazine to their pool. The messages of a
+ *          pool destroyed since the magazine was filled are dropped.
+ *
+ *  @arg    mag
+ *              Magazine, in a set locked by the caller.
+ *  @arg    numBufs
+ *              Number of messages to return.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_magazine
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_magFlush (IN LDRV_MSGQ_Magazine * mag, IN Uint32 numBufs)
+{
+    if (numBufs > mag->count) {
+        numBufs = mag->count ;
+    }
+
+    if (    (numBufs != 0u)
+        &&  (mag->epoch == LDRV_MSGQ_epoch)
+        &&  (mag->generation == LDRV_POOL_generation ((PoolId) mag->poolId))) {
+        LDRV_POOL_freev ((PoolId) mag->poolId,
+                         &(mag->bufs [mag->count - numBufs]),
+                         mag->size,
+                         numBufs) ;
+    }
+    mag->count -= numBufs ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_magEnter
+ *
+ *  @desc   Locks the magazines of the calling thread, listing them in the
+ *          process at their first use.
+ *
+ *  @arg    None
+ *
+ *  @ret    Magazine set of the calling thread.
+ *
+ *  @enter  LDRV_MSGQ_magSetsLock is not held.
+ *
+ *  @leave  The set is locked.
+ *
+ *  @see    LDRV_MSGQ_magLeave
+ *  ============================================================================
+ */
+STATIC
+LDRV_MSGQ_MagSet *
+LDRV_MSGQ_magEnter (Void)
+{
+    LDRV_MSGQ_MagSet * set = &LDRV_MSGQ_magSet ;
+
+    if (set->listed == FALSE) {
+        pthread_mutex_lock (&LDRV_MSGQ_magSetsLock) ;
+        set->next         = LDRV_MSGQ_magSets ;
+        LDRV_MSGQ_magSets = set ;
+        set->listed       = TRUE ;
+        pthread_mutex_unlock (&LDRV_MSGQ_magSetsLock) ;
+        pthread_setspecific (LDRV_MSGQ_magKey, set) ;
+    }
+
+    /* Only taken by another thread while it empties the magazines. */
+    while (__sync_lock_test_and_set (&(set->lock), 1u) != 0u) {
+        sched_yield () ;
+    }
+
+    return set ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_magLeave
+ *
+ *  @desc   Unlocks a magazine set.
+ *
+ *  @arg    set
+ *              Magazine set.
+ *
+ *  @ret    None
+ *
+ *  @enter  The set is locked by the caller.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_magEnter
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_magLeave (IN LDRV_MSGQ_MagSet * set)
+{
+    __sync_lock_release (&(set->lock)) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_magDrain
+ *
+ *  @desc   Returns the messages of the magazines of a set to their pools, or
+ *          only those of one pool.
+ *
+ *  @arg    set
+ *              Magazine set.
+ *  @arg    poolId
+ *              Pool whose messages are returned, POOL_INVALIDID for all.
+ *
+ *  @ret    None
+ *
+ *  @enter  The set is not locked by the caller.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_magReclaim, LDRV_MSGQ_magExit
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_magDrain (IN LDRV_MSGQ_MagSet * set, IN PoolId poolId)
+{
+    Uint32 i ;
+
+    while (__sync_lock_test_and_set (&(set->lock), 1u) != 0u) {
+        sched_yield () ;
+    }
+    for (i = 0u ; i < LDRV_MSGQ_MAGAZINES ; i++) {
+        if (    (poolId == POOL_INVALIDID)
+            ||  (set->mags [i].poolId == (Uint32) poolId)) {
+            LDRV_MSGQ_magFlush (&(set->mags [i]), set->mags [i].count) ;
+        }
+    }
+    LDRV_MSGQ_magLeave (set) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_magReclaim
+ *
+ *  @desc   Returns the messages of a pool kept in the magazines of all the
+ *          threads of the process to the pool, or those of all the pools.
+ *
+ *  @arg    poolId
+ *              Pool found exhausted, POOL_INVALIDID for all.
+ *
+ *  @ret    None
+ *
+ *  @enter  The magazines of the calling thread are not locked.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_alloc, LDRV_MSGQ_exit
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_magReclaim (IN PoolId poolId)
+{
+    LDRV_MSGQ_MagSet * set ;
+
+    pthread_mutex_lock (&LDRV_MSGQ_magSetsLock) ;
+    for (set = LDRV_MSGQ_magSets ; set != NULL ; set = set->next) {
+        LDRV_MSGQ_magDrain (set, poolId) ;
+    }
+    pthread_mutex_unlock (&LDRV_MSGQ_magSetsLock) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_magExit
+ *
+ *  @desc   Returns the magazines of an exiting thread to their pools and
+ *          removes them from the list of the process.
+ *
+ *  @arg    arg
+ *              Magazine set of the thread.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_magKeyCreate
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_magExit (IN Pvoid arg)
+{
+    LDRV_MSGQ_MagSet *  set = (LDRV_MSGQ_MagSet *) arg ;
+    LDRV_MSGQ_MagSet ** link ;
+
+    pthread_mutex_lock (&LDRV_MSGQ_magSetsLock) ;
+    for (link = &LDRV_MSGQ_magSets ; *link != NULL ; link = &((*link)->next)) {
+        if (*link == set) {
+            *link = set->next ;
+            break ;
+        }
+    }
+    set->listed = FALSE ;
+    pthread_mutex_unlock (&LDRV_MSGQ_magSetsLock) ;
+
+    LDRV_MSGQ_magDrain (set, POOL_INVALIDID) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_magKeyCreate
+ *
+ *  @desc   Creates the key returning the magazines of the exiting threads.
+ *
+ *  @arg    None
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_magExit
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_MSGQ_magKeyCreate (Void)
+{
+    pthread_key_create (&LDRV_MSGQ_magKey, &LDRV_MSGQ_magExit) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_magazine
+ *
+ *  @desc   Gets the magazine of the calling thread for a pool and size,
+ *          taking over another magazine if needed.
+ *
+ *  @arg    set
+ *              Magazine set of the calling thread.
+ *  @arg    poolId
+ *              Pool of the messages.
+ *  @arg    size
+ *              Size of the messages.
+ *
+ *  @ret    Magazine, NULL if the pool is not open or the messages are not
+ *          cached.
+ *
+ *  @enter  The set is locked by the caller.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_magFlush
+ *  ============================================================================
+ */
+STATIC
+LDRV_MSGQ_Magazine *
+LDRV_MSGQ_magazine (IN LDRV_MSGQ_MagSet * set,
+                    IN PoolId             poolId,
+                    IN Uint32             size)
+{
+    LDRV_MSGQ_Magazine * mag   = NULL ;
+    LDRV_MSGQ_Magazine * empty = NULL ;
+    Uint32               generation ;
+    Uint32               i ;
+
+    generation = LDRV_POOL_generation (poolId) ;
+    if (generation != 0u) {
+        for (i = 0u ; (i < LDRV_MSGQ_MAGAZINES) && (mag == NULL) ; i++) {
+            if (    (set->mags [i].poolId == poolId)
+                &&  (set->mags [i].size == size)) {
+                mag = &(set->mags [i]) ;
+            }
+            else if ((empty == NULL) && (set->mags [i].count == 0u)) {
+                empty = &(set->mags [i]) ;
+            }
+        }
+
+        if (mag == NULL) {
+            mag = empty ;
+            if (mag == NULL) {
+                mag = &(set->mags [  LDRV_MSGQ_magVictim
+                                   % LDRV_MSGQ_MAGAZINES]) ;
+                LDRV_MSGQ_magVictim++ ;
+                LDRV_MSGQ_magFlush (mag, mag->count) ;
+            }
+            mag->poolId     = poolId ;
+            mag->size       = size ;
+            mag->generation = 0u ;
+        }
+
+        if (    (mag->epoch != LDRV_MSGQ_epoch)
+            ||  (mag->generation != generation)) {
+            /* The pool has been destroyed since: drop its old messages. */
+            mag->count      = 0u ;
+            mag->epoch      = LDRV_MSGQ_epoch ;
+            mag->generation = generation ;
+            mag->limit      =   LDRV_POOL_numBufs (poolId, size)
+                              / LDRV_MSGQ_MAGSHARE ;
+            if (mag->limit > LDRV_MSGQ_MAGSIZE) {
+                mag->limit = LDRV_MSGQ_MAGSIZE ;
+            }
+            else if (mag->limit < 2u) {
+                mag->limit = 0u ;
+            }
+            mag->batch = mag->limit / 2u ;
+            if (mag->batch > LDRV_MSGQ_MAGBATCH) {
+                mag->batch = LDRV_MSGQ_MAGBATCH ;
+            }
+        }
+
+        if (mag->limit == 0u) {
+            mag = NULL ;
+        }
+    }
+
+    return mag ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_init
+ *
+ *  @desc   Initializes the MSGQ manager and the MQTs in the calling process.
+ *
+ *  @modif  LDRV_MSGQ_state, LDRV_MSGQ_queues, LDRV_MSGQ_mqts
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_init (IN Bool create)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    LDRV_MSGQ_Object * msgqState ;
+    LDRV_DspConfig *   cfg ;
+    ProcessorId        dspId ;
+    Uint32             maxMsgqs ;
+    Uint32             i ;
+
+    TRC_1ENTER ("LDRV_MSGQ_init", create) ;
+
+    memset (LDRV_MSGQ_mqts, 0, sizeof (LDRV_MSGQ_mqts)) ;
+    memset (LDRV_MSGQ_mqtOpens, 0, sizeof (LDRV_MSGQ_mqtOpens)) ;
+    memset (LDRV_MSGQ_attrs, 0, sizeof (LDRV_MSGQ_attrs)) ;
+    for (i = 0u ; i < LDRV_MSGQ_CACHESIZE ; i++) {
+        LDRV_MSGQ_cache [i].msgqQueue = MSGQ_INVALIDMSGQ ;
+    }
+    pthread_once (&LDRV_MSGQ_magOnce, &LDRV_MSGQ_magKeyCreate) ;
+    LDRV_MSGQ_epoch++ ;
+    status = SYNC_HOST_createLock (&LDRV_MSGQ_cacheLock) ;
+
+    if (DSP_SUCCEEDED (status) && (create == TRUE)) {
+        maxMsgqs = LDRV_Obj->gppObject.maxMsgqs ;
+        if ((maxMsgqs == 0u) || (maxMsgqs > LDRV_MSGQ_MAXQUEUES)) {
+            status = DSP_ECONFIG ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            LDRV_Obj->compState [LDRV_Comp_Msgq] =
+                                  LDRV_drvAlloc (sizeof (LDRV_MSGQ_Object)) ;
+            msgqState = (LDRV_MSGQ_Object *) LDRV_compState (LDRV_Comp_Msgq) ;
+            if (msgqState == NULL) {
+                status = DSP_EMEMORY ;
+                SET_FAILURE_REASON ;
+            }
+            else {
+                msgqState->maxMsgqs    = maxMsgqs ;
+                msgqState->errorQueue  = MSGQ_INVALIDMSGQ ;
+                msgqState->errorPoolId = POOL_INVALIDID ;
+                msgqState->queues      = LDRV_drvAlloc (  maxMsgqs
+                                                        * sizeof (LDRV_MSGQ_Queue)) ;
+                if (msgqState->queues == 0u) {
+                    status = DSP_EMEMORY ;
+                    SET_FAILURE_REASON ;
+                }
+            }
+
+            if (DSP_SUCCEEDED (status)) {
+                status = SYNC_HOST_createLock (&msgqState->lock) ;
+                LDRV_MSGQ_queues = (LDRV_MSGQ_Queue *)
+                                            LDRV_drvPtr (msgqState->queues) ;
+                for (i = 0u ; (i < maxMsgqs) && DSP_SUCCEEDED (status) ; i++) {
+                    status = SYNC_HOST_createLock (&LDRV_MSGQ_queues [i].lock) ;
+                    if (DSP_SUCCEEDED (status)) {
+                        status = SYNC_HOST_createCond (
+                                                  &LDRV_MSGQ_queues [i].cond) ;
+                    }
+                }
+            }
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        LDRV_MSGQ_state  = (LDRV_MSGQ_Object *) LDRV_compState (LDRV_Comp_Msgq) ;
+        LDRV_MSGQ_queues = (LDRV_MSGQ_Queue *)
+                                        LDRV_drvPtr (LDRV_MSGQ_state->queues) ;
+    }
+
+    for (dspId = 0u ; (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ; dspId++) {
+        cfg = LDRV_getDspConfig (dspId) ;
+        for (i = 0u ;
+             i < (sizeof (LDRV_MSGQ_transports) /
+                  sizeof (LDRV_MSGQ_transports [0])) ;
+             i++) {
+            if (strncmp (cfg->mqtObject.name,
+                         LDRV_MSGQ_transports [i].name,
+                         DSP_MAX_STRLEN) == 0) {
+                LDRV_MSGQ_mqts [dspId] = LDRV_MSGQ_transports [i].interface ;
+            }
+        }
+
+        if (LDRV_MSGQ_mqts [dspId] == NULL) {
+            status = DSP_ECONFIG ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            status = LDRV_MSGQ_mqts [dspId]->init (dspId, create) ;
+            if (DSP_FAILED (status)) {
+                LDRV_MSGQ_mqts [dspId] = NULL ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_exit
+ *
+ *  @desc   Finalizes the MSGQ manager in the calling process.
+ *
+ *  @modif  LDRV_MSGQ_state, LDRV_MSGQ_queues, LDRV_MSGQ_mqts
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_exit (IN Bool destroy)
+{
+    ProcessorId dspId ;
+    Uint32      slot ;
+    Uint32      i ;
+
+    TRC_1ENTER ("LDRV_MSGQ_exit", destroy) ;
+
+    /* The messages kept by every thread go back before the pools close. */
+    LDRV_MSGQ_magReclaim (POOL_INVALIDID) ;
+    LDRV_MSGQ_epoch++ ;
+
+    if (LDRV_MSGQ_state != NULL) {
+        slot = LDRV_procSlot () ;
+        SYNC_HOST_enter (&LDRV_MSGQ_state->lock) ;
+        for (i = 0u ; i < LDRV_MSGQ_state->maxMsgqs ; i++) {
+            if (    (LDRV_MSGQ_queues [i].inUse == TRUE)
+                &&  (   (LDRV_MSGQ_queues [i].ownerSlot == slot)
+                     || (destroy == TRUE))) {
+                LDRV_MSGQ_drain (&(LDRV_MSGQ_queues [i]), i) ;
+            }
+        }
+
+        /* Undo the transport opens of the calling process. */
+        for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+            if (LDRV_MSGQ_mqts [dspId] != NULL) {
+                LDRV_MSGQ_state->mqtOpenCount [dspId] -=
+                                                   LDRV_MSGQ_mqtOpens [dspId] ;
+                if (    (LDRV_MSGQ_mqtOpens [dspId] != 0u)
+                    &&  (LDRV_MSGQ_state->mqtOpenCount [dspId] == 0u)) {
+                    LDRV_MSGQ_state->generation [dspId]++ ;
+                    LDRV_MSGQ_mqts [dspId]->close (dspId) ;
+                }
+                LDRV_MSGQ_mqtOpens [dspId] = 0u ;
+            }
+        }
+        SYNC_HOST_leave (&LDRV_MSGQ_state->lock) ;
+    }
+
+    for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+        if (LDRV_MSGQ_mqts [dspId] != NULL) {
+            LDRV_MSGQ_mqts [dspId]->exit (dspId, destroy) ;
+            LDRV_MSGQ_mqts [dspId] = NULL ;
+        }
+    }
+
+    if ((LDRV_MSGQ_state != NULL) && (destroy == TRUE)) {
+        for (i = 0u ; i < LDRV_MSGQ_state->maxMsgqs ; i++) {
+            SYNC_HOST_deleteCond (&LDRV_MSGQ_queues [i].cond) ;
+            SYNC_HOST_deleteLock (&LDRV_MSGQ_queues [i].lock) ;
+        }
+        SYNC_HOST_deleteLock (&LDRV_MSGQ_state->lock) ;
+    }
+
+    LDRV_MSGQ_state  = NULL ;
+    LDRV_MSGQ_queues = NULL ;
+    SYNC_HOST_deleteLock (&LDRV_MSGQ_cacheLock) ;
+
+    TRC_1LEAVE ("LDRV_MSGQ_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_transportOpen
+ *
+ *  @desc   Opens the MQT to a DSP.
+ *
+ *  @modif  LDRV_MSGQ_state->mqtOpenCount, LDRV_MSGQ_mqtOpens
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_transportOpen (IN ProcessorId dspId, IN Pvoid attrs)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_2ENTER ("LDRV_MSGQ_transportOpen", dspId, attrs) ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    if (LDRV_PROC_isStarted (dspId) == FALSE) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&LDRV_MSGQ_state->lock) ;
+        if (LDRV_MSGQ_state->mqtOpenCount [dspId] == 0u) {
+            status = LDRV_MSGQ_mqts [dspId]->open (dspId, attrs) ;
+        }
+        else {
+            status = DSP_SALREADYOPENED ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            LDRV_MSGQ_state->mqtOpenCount [dspId]++ ;
+            LDRV_MSGQ_mqtOpens [dspId]++ ;
+        }
+        SYNC_HOST_leave (&LDRV_MSGQ_state->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_transportOpen", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_transportClose
+ *
+ *  @desc   Closes the MQT to a DSP.
+ *
+ *  @modif  LDRV_MSGQ_state->mqtOpenCount, LDRV_MSGQ_mqtOpens
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_transportClose (IN ProcessorId dspId)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_1ENTER ("LDRV_MSGQ_transportClose", dspId) ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    SYNC_HOST_enter (&LDRV_MSGQ_state->lock) ;
+    if (LDRV_MSGQ_mqtOpens [dspId] == 0u) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        LDRV_MSGQ_mqtOpens [dspId]-- ;
+        LDRV_MSGQ_state->mqtOpenCount [dspId]-- ;
+        if (LDRV_MSGQ_state->mqtOpenCount [dspId] == 0u) {
+            LDRV_MSGQ_state->generation [dspId]++ ;
+            status = LDRV_MSGQ_mqts [dspId]->close (dspId) ;
+            if (DSP_SUCCEEDED (status)) {
+                status = DSP_SCLOSED ;
+            }
+        }
+    }
+    SYNC_HOST_leave (&LDRV_MSGQ_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_MSGQ_transportClose", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_open
+ *
+ *  @desc   Opens a local message queue owned by the calling process.
+ *
+ *  @modif  LDRV_MSGQ_queues, LDRV_MSGQ_attrs, LDRV_MSGQ_state->buckets
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_open (IN     Pstr         queueName,
+                OUT    MSGQ_Queue * msgqQueue,
+                IN OPT MSGQ_Attrs * attrs)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    MSGQ_Attrs        given  = MSGQ_ATTRS_INIT ;
+    LDRV_MSGQ_Queue * queue ;
+    Uint32            hash ;
+    Uint32            bucket ;
+    Uint32            lane ;
+    Uint32            i ;
+
+    TRC_3ENTER ("LDRV_MSGQ_open", queueName, msgqQueue, attrs) ;
+
+    DBC_Require (queueName != NULL) ;
+    DBC_Require (msgqQueue != NULL) ;
+
+    if (attrs != NULL) {
+        /* The fields after post are only read when the caller says so. */
+        given.notifyHandle = attrs->notifyHandle ;
+        given.pend         = attrs->pend ;
+        given.post         = attrs->post ;
+        if (attrs->version == MSGQ_ATTRS_VERSION) {
+            given.waitPolicy = attrs->waitPolicy ;
+            given.spinBudget = attrs->spinBudget ;
+            given.laneAttrs  = attrs->laneAttrs ;
+        }
+    }
+
+    hash   = LDRV_MSGQ_hash (queueName) ;
+    bucket = hash & (LDRV_MSGQ_BUCKETS - 1u) ;
+    SYNC_HOST_enter (&LDRV_MSGQ_state->lock) ;
+    if (given.waitPolicy > (Uint32) MSGQ_WaitPolicy_Adaptive) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (    (given.laneAttrs != NULL)
+             &&  (   (given.laneAttrs->numLanes > MSGQ_MAXLANES)
+                  || (  given.laneAttrs->policy
+                      > (Uint32) MSGQ_LanePolicy_Weighted))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (LDRV_MSGQ_findLocal (queueName, hash) != MSGQ_INVALIDMSGQ) {
+        status = DSP_EALREADYEXISTS ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        for (i = 0u ; i < LDRV_MSGQ_state->maxMsgqs ; i++) {
+            if (LDRV_MSGQ_queues [i].inUse == FALSE) {
+                break ;
+            }
+        }
+
+        if (i == LDRV_MSGQ_state->maxMsgqs) {
+            status = DSP_ERESOURCE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            queue = &(LDRV_MSGQ_queues [i]) ;
+            LDRV_MSGQ_attrs [i] = given ;
+            SYNC_HOST_enter (&queue->lock) ;
+            strncpy (queue->name, queueName, DSP_MAX_STRLEN - 1u) ;
+            queue->name [DSP_MAX_STRLEN - 1u] = '\0' ;
+            queue->ownerSlot   = LDRV_procSlot () ;
+            queue->count       = 0u ;
+            queue->numLanes    = 1u ;
+            queue->lanePolicy  = MSGQ_LanePolicy_Strict ;
+            queue->wrrLane     = 0u ;
+            queue->wrrCredit   = 0u ;
+            for (lane = 0u ; lane < MSGQ_MAXLANES ; lane++) {
+                queue->headPhys [lane]       = 0u ;
+                queue->tailPhys [lane]       = 0u ;
+                queue->laneCount [lane]      = 0u ;
+                queue->laneMsgIdStart [lane] = 0u ;
+                queue->laneWeight [lane]     = 1u ;
+            }
+            queue->transferred = 0u ;
+            queue->waitPolicy  = MSGQ_WaitPolicy_Block ;
+            queue->spinBudget  = LDRV_MSGQ_SPINBUDGET ;
+            queue->lastArrival = 0u ;
+            queue->avgGap      = 0u ;
+            queue->spinHits    = 0u ;
+#if defined (DDSP_PROFILE)
+            queue->latCount    = 0u ;
+            queue->latMax      = 0u ;
+            memset (queue->latHist, 0, sizeof (queue->latHist)) ;
+#endif /* if defined (DDSP_PROFILE) */
+            queue->polled      = FALSE ;
+            queue->pollRaised  = FALSE ;
+            memset (queue->assembly, 0, sizeof (queue->assembly)) ;
+            queue->waitPolicy = given.waitPolicy ;
+            if (given.spinBudget != 0u) {
+                queue->spinBudget = given.spinBudget ;
+            }
+            if (    (given.laneAttrs != NULL)
+                &&  (given.laneAttrs->numLanes > 1u)) {
+                LDRV_MSGQ_setLanes (queue, given.laneAttrs) ;
+            }
+            queue->inUse       = TRUE ;
+            SYNC_HOST_leave (&queue->lock) ;
+
+            queue->hash     = hash ;
+            queue->hashNext = LDRV_MSGQ_state->buckets [bucket] ;
+            LDRV_MSGQ_state->buckets [bucket] = i + 1u ;
+            *msgqQueue = ((Uint32) ID_GPP << 16u) | i ;
+        }
+    }
+    SYNC_HOST_leave (&LDRV_MSGQ_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_MSGQ_open", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_close
+ *
+ *  @desc   Closes a local message queue.
+ *
+ *  @modif  LDRV_MSGQ_queues, LDRV_MSGQ_attrs
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_close (IN MSGQ_Queue msgqQueue)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_MSGQ_Queue * queue ;
+
+    TRC_1ENTER ("LDRV_MSGQ_close", msgqQueue) ;
+
+    queue = LDRV_MSGQ_getQueue (msgqQueue) ;
+    if (queue == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&LDRV_MSGQ_state->lock) ;
+        if (queue->inUse == FALSE) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else if (queue->ownerSlot != LDRV_procSlot ()) {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            LDRV_MSGQ_drain (queue, msgqQueue & 0xFFFFu) ;
+        }
+        SYNC_HOST_leave (&LDRV_MSGQ_state->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_close", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_locate
+ *
+ *  @desc   Locates a message queue by name. Local message queues are found in
+ *          the name directory, and message queues on a DSP in the locate
+ *          cache of the calling process before asking the DSP.
+ *
+ *  @modif  LDRV_MSGQ_cache
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_locate (IN     Pstr               queueName,
+                  OUT    MSGQ_Queue *       msgqQueue,
+                  IN OPT MSGQ_LocateAttrs * attrs)
+{
+    DSP_STATUS  status  = DSP_ENOTFOUND ;
+    Uint32      timeout = WAIT_FOREVER ;
+    Uint32      generation = 0u ;
+    Uint32      hash ;
+    Uint32      id ;
+    ProcessorId dspId ;
+
+    TRC_3ENTER ("LDRV_MSGQ_locate", queueName, msgqQueue, attrs) ;
+
+    DBC_Require (queueName != NULL) ;
+    DBC_Require (msgqQueue != NULL) ;
+
+    if (attrs != NULL) {
+        timeout = attrs->timeout ;
+    }
+
+    hash = LDRV_MSGQ_hash (queueName) ;
+    SYNC_HOST_enter (&LDRV_MSGQ_state->lock) ;
+    id = LDRV_MSGQ_findLocal (queueName, hash) ;
+    SYNC_HOST_leave (&LDRV_MSGQ_state->lock) ;
+
+    if (id != MSGQ_INVALIDMSGQ) {
+        *msgqQueue = ((Uint32) ID_GPP << 16u) | id ;
+        status     = DSP_SOK ;
+    }
+    else if (LDRV_MSGQ_cacheFind (queueName, hash, msgqQueue) == TRUE) {
+        status = DSP_SOK ;
+    }
+    else {
+        for (dspId = 0u ;
+             (dspId < MAX_DSPS) && (status == DSP_ENOTFOUND) ;
+             dspId++) {
+            if (LDRV_MSGQ_state->mqtOpenCount [dspId] != 0u) {
+                /* Read first, so that an answer made stale by a close of the
+                 * MQT during the locate is never cached as valid.
+                 */
+                generation = LDRV_MSGQ_generation (dspId) ;
+                status = LDRV_MSGQ_mqts [dspId]->locate (dspId,
+                                                         queueName,
+                                                         msgqQueue,
+                                                         timeout) ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            LDRV_MSGQ_cacheFill (queueName, hash, generation, *msgqQueue) ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_locate", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_locateAsync
+ *
+ *  @desc   Locates a message queue by name and sends the answer to a reply
+ *          queue. A cached answer is sent without involving the DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_locateAsync (IN Pstr                    queueName,
+                       IN MSGQ_Queue              replyQueue,
+                       IN MSGQ_LocateAsyncAttrs * attrs)
+{
+    DSP_STATUS            status ;
+    MSGQ_Queue            msgqQueue ;
+    MSGQ_AsyncLocateMsg * locateMsg ;
+
+    TRC_3ENTER ("LDRV_MSGQ_locateAsync", queueName, replyQueue, attrs) ;
+
+    DBC_Require (queueName != NULL) ;
+    DBC_Require (attrs != NULL) ;
+
+    status = LDRV_MSGQ_locate (queueName, &msgqQueue, NULL) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_MSGQ_alloc (attrs->poolId,
+                                  sizeof (MSGQ_AsyncLocateMsg),
+                                  (MSGQ_Msg *) ((Pvoid) &locateMsg)) ;
+        if (DSP_SUCCEEDED (status)) {
+            locateMsg->header.msgId = MSGQ_ASYNCLOCATEMSGID ;
+            locateMsg->msgqQueue    = msgqQueue ;
+            locateMsg->arg          = attrs->arg ;
+            status = LDRV_MSGQ_put (replyQueue, &(locateMsg->header)) ;
+            if (DSP_FAILED (status)) {
+                LDRV_MSGQ_free (&(locateMsg->header)) ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_locateAsync", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_release
+ *
+ *  @desc   Releases a located message queue and drops it from the locate
+ *          cache of the calling process.
+ *
+ *  @modif  LDRV_MSGQ_cache
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_release (IN MSGQ_Queue msgqQueue)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    ProcessorId dspId  = (ProcessorId) (msgqQueue >> 16u) ;
+
+    TRC_1ENTER ("LDRV_MSGQ_release", msgqQueue) ;
+
+    LDRV_MSGQ_cacheForget (msgqQueue) ;
+
+    if (dspId == ID_GPP) {
+        if (LDRV_MSGQ_getQueue (msgqQueue) == NULL) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+    }
+    else if (!IS_VALID_PROCID (dspId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (LDRV_MSGQ_state->mqtOpenCount [dspId] == 0u) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = LDRV_MSGQ_mqts [dspId]->release (dspId, msgqQueue) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_release", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_alloc
+ *
+ *  @desc   Allocates a message from a pool, through the magazine of the
+ *          calling thread.
+ *
+ *  @modif  LDRV_MSGQ_magSet
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_alloc (IN PoolId poolId, IN Uint16 size, OUT MSGQ_Msg * msg)
+{
+    DSP_STATUS           status = DSP_SOK ;
+    LDRV_MSGQ_MagSet *   set ;
+    LDRV_MSGQ_Magazine * mag ;
+    Pvoid                buf ;
+
+    TRC_3ENTER ("LDRV_MSGQ_alloc", poolId, size, msg) ;
+
+    DBC_Require (msg != NULL) ;
+
+    if (size < sizeof (MSGQ_MsgHeader)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        set = LDRV_MSGQ_magEnter () ;
+        mag = LDRV_MSGQ_magazine (set, poolId, size) ;
+        if (mag == NULL) {
+            status = LDRV_POOL_alloc (poolId, &buf, size) ;
+        }
+        else {
+            if (mag->count == 0u) {
+                status = LDRV_POOL_allocv (poolId,
+                                           mag->bufs,
+                                           size,
+                                           mag->batch,
+                                           &(mag->count)) ;
+            }
+
+            if (mag->count != 0u) {
+                mag->count-- ;
+                buf = mag->bufs [mag->count] ;
+            }
+        }
+        LDRV_MSGQ_magLeave (set) ;
+
+        if (status == DSP_EMEMORY) {
+            /* The free messages may all sit in the magazines of others. */
+            LDRV_MSGQ_magReclaim (poolId) ;
+            status = LDRV_POOL_alloc (poolId, &buf, size) ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            *msg              = (MSGQ_Msg) buf ;
+            (*msg)->size      = size ;
+            (*msg)->poolId    = poolId ;
+            (*msg)->msgId     = MSGQ_INVALIDMSGID ;
+            (*msg)->dstId     = MSGQ_INVALIDMSGQ ;
+            (*msg)->srcId     = MSGQ_INVALIDMSGQ ;
+            (*msg)->srcProcId = MSGQ_INVALIDPROCID ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_alloc", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_free
+ *
+ *  @desc   Returns a message to its pool, through the magazine of the calling
+ *          thread.
+ *
+ *  @modif  LDRV_MSGQ_magSet
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_free (IN MSGQ_Msg msg)
+{
+    DSP_STATUS           status = DSP_SOK ;
+    LDRV_MSGQ_MagSet *   set    = NULL ;
+    LDRV_MSGQ_Magazine * mag    = NULL ;
+
+    TRC_1ENTER ("LDRV_MSGQ_free", msg) ;
+
+    DBC_Require (msg != NULL) ;
+
+    if (LDRV_MSGQ_toPhy (msg) != LDRV_INVALID_ADDR) {
+        set = LDRV_MSGQ_magEnter () ;
+        mag = LDRV_MSGQ_magazine (set, msg->poolId, msg->size) ;
+    }
+
+    if (mag == NULL) {
+        status = LDRV_POOL_free (msg->poolId, msg, msg->size) ;
+    }
+    else {
+        if (mag->count >= mag->limit) {
+            LDRV_MSGQ_magFlush (mag, mag->batch) ;
+        }
+        mag->bufs [mag->count] = msg ;
+        mag->count++ ;
+    }
+
+    if (set != NULL) {
+        LDRV_MSGQ_magLeave (set) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_free", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_MSGQ_enqueue
+ *
+ *  @desc   Queues messages on a local queue, waking its reader once.
+ *
+ *  @arg    msgArray
+ *              Messages, with the same destination in their header.
+ *  @arg    numMsgs
+ *              Number of messages.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The destination is not open. No message has been queued.
+ *
+ *  @enter  numMsgs is not 0.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LDRV_MSGQ_enqueue (IN MSGQ_Msg * msgArray, IN Uint32 numMsgs)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_MSGQ_Queue * queue ;
+    MSGQ_Attrs *      attrs  = NULL ;
+    Bool              wake   = FALSE ;
+    Uint32            pollSlot ;
+    Int32             pollFd ;
+    MSGQ_Msg          tail ;
+    Uint32            physAddr ;
+    Uint32            lane ;
+    Uint16            msgId ;
+    Uint32            i ;
+#if defined (DDSP_PROFILE)
+    SYNC_HostTicks    now ;
+#endif /* if defined (DDSP_PROFILE) */
+
+    queue = LDRV_MSGQ_getQueue (  ((Uint32) ID_GPP << 16u)
+                                | msgArray [0]->dstId) ;
+    for (i = 0u ; (i < numMsgs) && (queue != NULL) ; i++) {
+        if (LDRV_MSGQ_toPhy (msgArray [i]) == LDRV_INVALID_ADDR) {
+            queue = NULL ;
+        }
+    }
+
+    if (queue == NULL) {
+        status = DSP_ENOTFOUND ;
+    }
+    else {
+        SYNC_HOST_enter (&queue->lock) ;
+#if defined (DDSP_PROFILE)
+        /* Read under the lock so that the times of a lane never decrease. */
+        now = SYNC_HOST_ticks () ;
+#endif /* if defined (DDSP_PROFILE) */
+        if (queue->inUse == FALSE) {
+            status = DSP_ENOTFOUND ;
+        }
+        else {
+            for (i = 0u ; i < numMsgs ; i++) {
+                physAddr = LDRV_MSGQ_toPhy (msgArray [i]) ;
+                msgId    = msgArray [i]->msgId ;
+                if (msgId == MSGQ_FRAGMSGID) {
+                    /* A large message takes the lane of its own ID. */
+                    msgId = LDRV_MSGQ_FRAG (msgArray [i])->msgId ;
+                }
+                lane = LDRV_MSGQ_lane (queue, msgId) ;
+                LDRV_MSGQ_NEXT (msgArray [i]) = 0u ;
+#if defined (DDSP_PROFILE)
+                LDRV_MSGQ_STAMP (msgArray [i]) =
+                            LDRV_MSGQ_gapCode (now - queue->tailPut [lane]) ;
+                queue->tailPut [lane] = now ;
+                if (queue->laneCount [lane] == 0u) {
+                    queue->headPut [lane] = now ;
+                }
+#endif /* if defined (DDSP_PROFILE) */
+                if (queue->laneCount [lane] == 0u) {
+                    queue->headPhys [lane] = physAddr ;
+                }
+                else {
+                    tail = LDRV_MSGQ_toUsr (queue->tailPhys [lane]) ;
+                    LDRV_MSGQ_NEXT (tail) = physAddr ;
+                }
+                queue->tailPhys [lane] = physAddr ;
+                queue->laneCount [lane]++ ;
+                queue->count++ ;
+                queue->transferred++ ;
+            }
+
+            if (queue->waitPolicy == MSGQ_WaitPolicy_Adaptive) {
+                LDRV_MSGQ_arrival (queue) ;
+            }
+
+            if (    (queue->polled == TRUE)
+                &&  (queue->pollRaised == FALSE)) {
+                queue->pollRaised = TRUE ;
+                pollSlot          = queue->ownerSlot ;
+                pollFd            = queue->pollFd ;
+                wake              = TRUE ;
+            }
+
+            if (    (queue->ownerSlot == LDRV_procSlot ())
+                &&  (LDRV_MSGQ_attrs [msgArray [0]->dstId].post != NULL)) {
+                attrs = &(LDRV_MSGQ_attrs [msgArray [0]->dstId]) ;
+            }
+            else {
+                SYNC_HOST_broadcast (&queue->cond) ;
+            }
+        }
+        SYNC_HOST_leave (&queue->lock) ;
+
+        if (attrs != NULL) {
+            attrs->post (attrs->notifyHandle) ;
+        }
+
+        if (wake == TRUE) {
+            LDRV_IPS_userSignal (pollSlot, pollFd) ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_put
+ *
+ *  @desc   Sends a message to a local or a remote message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_put (IN MSGQ_Queue msgqQueue, IN MSGQ_Msg msg)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    ProcessorId dspId  = (ProcessorId) (msgqQueue >> 16u) ;
+    MSGQ_Msg    head   = msg ;
+
+    TRC_2ENTER ("LDRV_MSGQ_put", msgqQueue, msg) ;
+
+    DBC_Require (msg != NULL) ;
+
+    msg->dstId = (MSGQ_Id) (msgqQueue & 0xFFFFu) ;
+    if (dspId == ID_GPP) {
+        if (LDRV_MSGQ_getQueue (msgqQueue) == NULL) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            /*  The message stays with the caller on a local failure, unlike
+             *  in LDRV_MSGQ_deliver, which owns the messages of the DSPs.
+             */
+            if (msg->msgId == MSGQ_FRAGMSGID) {
+                status = LDRV_MSGQ_assemble (&head) ;
+            }
+            if (DSP_SUCCEEDED (status) && (head != NULL)) {
+                status = LDRV_MSGQ_enqueue (&head, 1u) ;
+                if (DSP_FAILED (status) && (head != msg)) {
+                    /* The queue closed as the fragment completed it. */
+                    LDRV_MSGQ_freeOthers (head, msg) ;
+                }
+            }
+            if (DSP_FAILED (status)) {
+                SET_FAILURE_REASON ;
+            }
+        }
+    }
+    else if (!IS_VALID_PROCID (dspId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (LDRV_MSGQ_state->mqtOpenCount [dspId] == 0u) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = LDRV_MSGQ_mqts [dspId]->put (dspId, msg) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_put", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_deliver
+ *
+ *  @desc   Queues a message received from a DSP on its local destination.
+ *          The fragments of a large message are held back until the large
+ *          message is complete. A message that cannot be queued is freed.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_deliver (IN MSGQ_Msg msg)
+{
+    DSP_STATUS           status ;
+    DSP_STATUS           tmpStatus ;
+    MSGQ_AsyncErrorMsg * errorMsg ;
+    MSGQ_Msg             errorHeader ;
+    MSGQ_Queue           dstQueue ;
+
+    TRC_1ENTER ("LDRV_MSGQ_deliver", msg) ;
+
+    DBC_Require (msg != NULL) ;
+
+    dstQueue = ((Uint32) ID_GPP << 16u) | msg->dstId ;
+    status   = DSP_SOK ;
+    if (msg->msgId == MSGQ_FRAGMSGID) {
+        status = LDRV_MSGQ_assemble (&msg) ;
+    }
+
+    if (DSP_SUCCEEDED (status) && (msg != NULL)) {
+        status = LDRV_MSGQ_enqueue (&msg, 1u) ;
+    }
+
+    if (DSP_FAILED (status)) {
+        SET_FAILURE_REASON ;
+        LDRV_MSGQ_freeChain (msg, TRUE) ;
+
+        if (    (LDRV_MSGQ_state->errorQueue != MSGQ_INVALIDMSGQ)
+            &&  (LDRV_MSGQ_state->errorQueue != dstQueue)) {
+            tmpStatus = LDRV_MSGQ_alloc (
+                             (PoolId) LDRV_MSGQ_state->errorPoolId,
+                             sizeof (MSGQ_AsyncErrorMsg),
+                             (MSGQ_Msg *) ((Pvoid) &errorMsg)) ;
+            if (DSP_SUCCEEDED (tmpStatus)) {
+                errorMsg->header.msgId = MSGQ_ASYNCERRORMSGID ;
+                errorMsg->header.dstId = (MSGQ_Id)
+                                   (LDRV_MSGQ_state->errorQueue & 0xFFFFu) ;
+                errorMsg->errorType    = MSGQ_MQTFAILEDPUT ;
+                errorMsg->arg1         = LDRV_UINT32_TO_PTR (dstQueue) ;
+                errorMsg->arg2         = NULL ;
+                errorHeader = &(errorMsg->header) ;
+                tmpStatus   = LDRV_MSGQ_enqueue (&errorHeader, 1u) ;
+                if (DSP_FAILED (tmpStatus)) {
+                    LDRV_MSGQ_free (&(errorMsg->header)) ;
+                }
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_deliver", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_putv
+ *
+ *  @desc   Sends an array of messages to a local or a remote message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_putv (IN  MSGQ_Queue msgqQueue,
+                IN  MSGQ_Msg * msgArray,
+                IN  Uint32     numMsgs,
+                OUT Uint32 *   numPut)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    ProcessorId dspId  = (ProcessorId) (msgqQueue >> 16u) ;
+    Uint32      i ;
+
+    TRC_4ENTER ("LDRV_MSGQ_putv", msgqQueue, msgArray, numMsgs, numPut) ;
+
+    DBC_Require (msgArray != NULL) ;
+    DBC_Require (numPut != NULL) ;
+
+    *numPut = 0u ;
+    for (i = 0u ; i < numMsgs ; i++) {
+        msgArray [i]->dstId = (MSGQ_Id) (msgqQueue & 0xFFFFu) ;
+    }
+
+    if (numMsgs == 0u) {
+        status = DSP_SOK ;
+    }
+    else if (dspId == ID_GPP) {
+        if (LDRV_MSGQ_getQueue (msgqQueue) == NULL) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            status = LDRV_MSGQ_enqueue (msgArray, numMsgs) ;
+            if (DSP_SUCCEEDED (status)) {
+                *numPut = numMsgs ;
+            }
+            else {
+                /* The messages stay with the caller on a local failure. */
+                SET_FAILURE_REASON ;
+            }
+        }
+    }
+    else if (!IS_VALID_PROCID (dspId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (LDRV_MSGQ_state->mqtOpenCount [dspId] == 0u) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = LDRV_MSGQ_mqts [dspId]->putv (dspId,
+                                               msgArray,
+                                               numMsgs,
+                                               numPut) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_putv", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_get
+ *
+ *  @desc   Receives a message from a local message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_get (IN  MSGQ_Queue msgqQueue,
+               IN  Uint32     timeout,
+               OUT MSGQ_Msg * msg)
+{
+    DSP_STATUS status ;
+    Uint32     numMsgs ;
+
+    TRC_3ENTER ("LDRV_MSGQ_get", msgqQueue, timeout, msg) ;
+
+    DBC_Require (msg != NULL) ;
+
+    status = LDRV_MSGQ_getv (msgqQueue, timeout, msg, 1u, &numMsgs) ;
+
+    TRC_1LEAVE ("LDRV_MSGQ_get", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_getv
+ *
+ *  @desc   Receives up to maxMsgs messages from a local message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_getv (IN  MSGQ_Queue msgqQueue,
+                IN  Uint32     timeout,
+                OUT MSGQ_Msg * msgArray,
+                IN  Uint32     maxMsgs,
+                OUT Uint32 *   numMsgs)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    struct timespec   deadline ;
+    struct timespec * until  = NULL ;
+    Bool              spun   = FALSE ;
+    LDRV_MSGQ_Queue * queue ;
+    MSGQ_Attrs *      attrs ;
+    Uint32            limit ;
+#if defined (DDSP_PROFILE)
+    SYNC_HostTicks    now ;
+#endif /* if defined (DDSP_PROFILE) */
+
+    TRC_5ENTER ("LDRV_MSGQ_getv",
+                msgqQueue,
+                timeout,
+                msgArray,
+                maxMsgs,
+                numMsgs) ;
+
+    DBC_Require (msgArray != NULL) ;
+    DBC_Require (maxMsgs != 0u) ;
+    DBC_Require (numMsgs != NULL) ;
+
+    *numMsgs = 0u ;
+    queue = LDRV_MSGQ_getQueue (msgqQueue) ;
+    if (queue == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        attrs = &(LDRV_MSGQ_attrs [msgqQueue & 0xFFFFu]) ;
+        if ((timeout != WAIT_FOREVER) && (timeout != WAIT_NONE)) {
+            SYNC_HOST_deadline (timeout, &deadline) ;
+            until = &deadline ;
+        }
+
+        SYNC_HOST_enter (&queue->lock) ;
+        if (queue->inUse == FALSE) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else if (queue->ownerSlot != LDRV_procSlot ()) {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+
+        if (    DSP_SUCCEEDED (status)
+            &&  (queue->count == 0u)
+            &&  (timeout != WAIT_NONE)) {
+            limit = LDRV_MSGQ_spinLimit (queue, timeout) ;
+            if (limit != 0u) {
+                SYNC_HOST_leave (&queue->lock) ;
+                spun = LDRV_MSGQ_spin (queue, limit) ;
+                SYNC_HOST_enter (&queue->lock) ;
+            }
+        }
+
+        while (    DSP_SUCCEEDED (status)
+               &&  (queue->count == 0u)) {
+            spun = FALSE ;
+            if (timeout == WAIT_NONE) {
+                status = DSP_ENOTCOMPLETE ;
+            }
+            else if (attrs->pend != NULL) {
+                SYNC_HOST_leave (&queue->lock) ;
+                status = attrs->pend (attrs->notifyHandle, timeout) ;
+                SYNC_HOST_enter (&queue->lock) ;
+            }
+            else {
+                status = SYNC_HOST_waitUntil (&queue->cond,
+                                              &queue->lock,
+                                              until) ;
+            }
+
+            if (queue->inUse == FALSE) {
+                status = DSP_EINVALIDARG ;
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (    (queue->inUse == TRUE)
+            &&  (queue->ownerSlot == LDRV_procSlot ())
+            &&  (queue->count != 0u)) {
+            /* A message that raced with the timeout is still taken. */
+#if defined (DDSP_PROFILE)
+            now = SYNC_HOST_ticks () ;
+#endif /* if defined (DDSP_PROFILE) */
+            while ((*numMsgs < maxMsgs) && (queue->count != 0u)) {
+                msgArray [*numMsgs] = LDRV_MSGQ_dequeue (queue) ;
+#if defined (DDSP_PROFILE)
+                LDRV_MSGQ_latRecord (queue, now - queue->lastPut) ;
+#endif /* if defined (DDSP_PROFILE) */
+                (*numMsgs)++ ;
+            }
+            if (spun == TRUE) {
+                queue->spinHits++ ;
+            }
+            status = DSP_SOK ;
+        }
+
+        /* Clearing on every get of an empty queue also absorbs a raise from
+         * another process that arrived after the queue had been emptied.
+         */
+        if (    (queue->polled == TRUE)
+            &&  (queue->ownerSlot == LDRV_procSlot ())
+            &&  (queue->count == 0u)) {
+            SYNC_HOST_clearPollFd (queue->pollFd) ;
+            queue->pollRaised = FALSE ;
+        }
+        SYNC_HOST_leave (&queue->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_getv", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_allocLarge
+ *
+ *  @desc   Allocates the fragments of a large message and fills its scatter
+ *          list.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_allocLarge (IN     PoolId          poolId,
+                      IN     Uint32          size,
+                      IN     Uint16          fragSize,
+                      IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    DSP_STATUS     status   = DSP_SOK ;
+    Uint32         numFrags = 0u ;
+    MSGQ_FragMsg * frag ;
+    MSGQ_Msg       msg ;
+    Uint32         capacity ;
+    Uint32         i ;
+
+    TRC_4ENTER ("LDRV_MSGQ_allocLarge", poolId, size, fragSize, largeMsg) ;
+
+    DBC_Require (largeMsg != NULL) ;
+
+    largeMsg->numFrags = 0u ;
+    if ((size == 0u) || (fragSize <= sizeof (MSGQ_FragMsg))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        capacity = fragSize - sizeof (MSGQ_FragMsg) ;
+        numFrags = (size + capacity - 1u) / capacity ;
+        if ((numFrags > largeMsg->maxFrags) || (numFrags > 0xFFFFu)) {
+            status = DSP_ESIZE ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    for (i = 0u ; (i < numFrags) && DSP_SUCCEEDED (status) ; i++) {
+        status = LDRV_MSGQ_alloc (poolId, fragSize, &msg) ;
+        if (DSP_SUCCEEDED (status)) {
+            msg->msgId      = MSGQ_FRAGMSGID ;
+            frag            = LDRV_MSGQ_FRAG (msg) ;
+            frag->xferId    = 0u ;
+            frag->totalSize = size ;
+            frag->link      = 0u ;
+            frag->msgId     = MSGQ_INVALIDMSGID ;
+            frag->index     = (Uint16) i ;
+            frag->numFrags  = (Uint16) numFrags ;
+            frag->length    = (Uint16) capacity ;
+            if (i == (numFrags - 1u)) {
+                frag->length = (Uint16) (size - (i * capacity)) ;
+            }
+            if (i != 0u) {
+                LDRV_MSGQ_FRAG (largeMsg->frags [i - 1u].msg)->link =
+                                                      LDRV_MSGQ_toPhy (msg) ;
+            }
+            largeMsg->frags [i].msg  = msg ;
+            largeMsg->frags [i].data = (Pvoid) (frag + 1) ;
+            largeMsg->frags [i].size = frag->length ;
+            largeMsg->numFrags       = i + 1u ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        largeMsg->msgId = MSGQ_INVALIDMSGID ;
+        largeMsg->size  = size ;
+    }
+    else if (largeMsg->numFrags != 0u) {
+        LDRV_MSGQ_freeChain (largeMsg->frags [0].msg, TRUE) ;
+        largeMsg->numFrags = 0u ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_allocLarge", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_freeLarge
+ *
+ *  @desc   Frees all the fragments of a large message.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_freeLarge (IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    TRC_1ENTER ("LDRV_MSGQ_freeLarge", largeMsg) ;
+
+    DBC_Require (largeMsg != NULL) ;
+
+    if (largeMsg->numFrags != 0u) {
+        LDRV_MSGQ_freeChain (largeMsg->frags [0].msg, TRUE) ;
+        largeMsg->numFrags = 0u ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_freeLarge", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_putLarge
+ *
+ *  @desc   Sends a large message to a local or a remote message queue.
+ *
+ *  @modif  LDRV_MSGQ_state->xferId
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_putLarge (IN MSGQ_Queue msgqQueue, IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    DSP_STATUS     status = DSP_SOK ;
+    Uint32         size   = 0u ;
+    Uint32         sent   = 0u ;
+    MSGQ_Msg       batch [LDRV_MSGQ_FRAGBATCH] ;
+    MSGQ_FragMsg * frag ;
+    MSGQ_Msg       head ;
+    Uint32         xferId ;
+    Uint32         numPut ;
+    Uint32         n ;
+    Uint32         i ;
+
+    TRC_2ENTER ("LDRV_MSGQ_putLarge", msgqQueue, largeMsg) ;
+
+    DBC_Require (largeMsg != NULL) ;
+
+    if (    (largeMsg->numFrags == 0u)
+        ||  (largeMsg->frags [0].msg->msgId != MSGQ_FRAGMSGID)
+        ||  (  LDRV_MSGQ_FRAG (largeMsg->frags [0].msg)->numFrags
+             != largeMsg->numFrags)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    for (i = 0u ; (i < largeMsg->numFrags) && DSP_SUCCEEDED (status) ; i++) {
+        if (  largeMsg->frags [i].size
+            > (largeMsg->frags [i].msg->size - sizeof (MSGQ_FragMsg))) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        size += largeMsg->frags [i].size ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        /* Every fragment carries the source of the first one, so that the
+         * replies of a remote receiver find their way back.
+         */
+        head   = largeMsg->frags [0].msg ;
+        xferId = __sync_add_and_fetch (&(LDRV_MSGQ_state->xferId), 1u) ;
+        for (i = 0u ; i < largeMsg->numFrags ; i++) {
+            frag                   = LDRV_MSGQ_FRAG (largeMsg->frags [i].msg) ;
+            frag->header.srcId     = head->srcId ;
+            frag->header.srcProcId = head->srcProcId ;
+            frag->xferId           = xferId ;
+            frag->totalSize        = size ;
+            frag->msgId            = largeMsg->msgId ;
+            frag->length           = (Uint16) largeMsg->frags [i].size ;
+        }
+        largeMsg->size = size ;
+
+        if ((msgqQueue >> 16u) == ID_GPP) {
+            /* Already chained: the whole large message is one queue entry. */
+            status = LDRV_MSGQ_putv (msgqQueue, &head, 1u, &numPut) ;
+            sent   = numPut * largeMsg->numFrags ;
+        }
+        else {
+            while ((sent < largeMsg->numFrags) && DSP_SUCCEEDED (status)) {
+                n = largeMsg->numFrags - sent ;
+                if (n > LDRV_MSGQ_FRAGBATCH) {
+                    n = LDRV_MSGQ_FRAGBATCH ;
+                }
+                for (i = 0u ; i < n ; i++) {
+                    batch [i] = largeMsg->frags [sent + i].msg ;
+                }
+                status = LDRV_MSGQ_putv (msgqQueue, batch, n, &numPut) ;
+                sent  += numPut ;
+            }
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        largeMsg->numFrags = 0u ;
+    }
+    else if (sent != 0u) {
+        /* The large message is broken: drop the fragments not sent. */
+        SET_FAILURE_REASON ;
+        LDRV_MSGQ_freeChain (largeMsg->frags [sent].msg, TRUE) ;
+        largeMsg->numFrags = 0u ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_putLarge", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_getLarge
+ *
+ *  @desc   Receives a large message from a local message queue as a scatter
+ *          list of its fragments. Any other message is received as a large
+ *          message of a single fragment.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_getLarge (IN     MSGQ_Queue      msgqQueue,
+                    IN     Uint32          timeout,
+                    IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    DSP_STATUS     status ;
+    MSGQ_FragMsg * frag ;
+    MSGQ_Msg       msg ;
+    Uint32         numMsgs ;
+    Uint32         i ;
+
+    TRC_3ENTER ("LDRV_MSGQ_getLarge", msgqQueue, timeout, largeMsg) ;
+
+    DBC_Require (largeMsg != NULL) ;
+    DBC_Require (largeMsg->maxFrags != 0u) ;
+
+    largeMsg->numFrags = 0u ;
+    status = LDRV_MSGQ_getv (msgqQueue, timeout, &msg, 1u, &numMsgs) ;
+    if (DSP_SUCCEEDED (status) && (msg->msgId != MSGQ_FRAGMSGID)) {
+        largeMsg->msgId          = msg->msgId ;
+        largeMsg->size           = msg->size - sizeof (MSGQ_MsgHeader) ;
+        largeMsg->numFrags       = 1u ;
+        largeMsg->frags [0].msg  = msg ;
+        largeMsg->frags [0].data = (Pvoid) (msg + 1) ;
+        largeMsg->frags [0].size = largeMsg->size ;
+    }
+    else if (DSP_SUCCEEDED (status)) {
+        frag               = LDRV_MSGQ_FRAG (msg) ;
+        largeMsg->msgId    = frag->msgId ;
+        largeMsg->size     = frag->totalSize ;
+        largeMsg->numFrags = frag->numFrags ;
+        for (i = 0u ; (msg != NULL) && (i < largeMsg->maxFrags) ; i++) {
+            frag                     = LDRV_MSGQ_FRAG (msg) ;
+            largeMsg->frags [i].msg  = msg ;
+            largeMsg->frags [i].data = (Pvoid) (frag + 1) ;
+            largeMsg->frags [i].size = frag->length ;
+            msg = NULL ;
+            if (frag->link != 0u) {
+                msg = LDRV_MSGQ_toUsr (frag->link) ;
+            }
+        }
+
+        if (largeMsg->numFrags > largeMsg->maxFrags) {
+            /* The caller still owns the large message and must free it. */
+            status = DSP_ETRUNCATED ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_getLarge", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_getPollFd
+ *
+ *  @desc   Gets the pollable descriptor of a local message queue, creating it
+ *          on the first call.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_getPollFd (IN MSGQ_Queue msgqQueue, OUT Int32 * fd)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_MSGQ_Queue * queue ;
+
+    TRC_2ENTER ("LDRV_MSGQ_getPollFd", msgqQueue, fd) ;
+
+    DBC_Require (fd != NULL) ;
+
+    queue = LDRV_MSGQ_getQueue (msgqQueue) ;
+    if (queue == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&queue->lock) ;
+        if (queue->inUse == FALSE) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else if (queue->ownerSlot != LDRV_procSlot ()) {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+        else if (queue->polled == FALSE) {
+            status = SYNC_HOST_createPollFd (&queue->pollFd) ;
+            if (DSP_SUCCEEDED (status)) {
+                queue->polled     = TRUE ;
+                queue->pollRaised = (queue->count != 0u) ;
+                if (queue->pollRaised == TRUE) {
+                    SYNC_HOST_raisePollFd (queue->pollFd) ;
+                }
+            }
+            else {
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            *fd = queue->pollFd ;
+        }
+        SYNC_HOST_leave (&queue->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_getPollFd", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_count
+ *
+ *  @desc   Gets the number of messages queued on a local message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_count (IN MSGQ_Queue msgqQueue, OUT Uint16 * count)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_MSGQ_Queue * queue ;
+
+    TRC_2ENTER ("LDRV_MSGQ_count", msgqQueue, count) ;
+
+    DBC_Require (count != NULL) ;
+
+    queue = LDRV_MSGQ_getQueue (msgqQueue) ;
+    if ((queue == NULL) || (queue->inUse == FALSE)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *count = (Uint16) queue->count ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_count", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_countLane
+ *
+ *  @desc   Gets the number of messages queued on a priority lane of a local
+ *          message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_countLane (IN  MSGQ_Queue msgqQueue,
+                     IN  Uint32     lane,
+                     OUT Uint16 *   count)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_MSGQ_Queue * queue ;
+
+    TRC_3ENTER ("LDRV_MSGQ_countLane", msgqQueue, lane, count) ;
+
+    DBC_Require (count != NULL) ;
+
+    queue = LDRV_MSGQ_getQueue (msgqQueue) ;
+    if (    (queue == NULL)
+        ||  (queue->inUse == FALSE)
+        ||  (lane >= queue->numLanes)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *count = (Uint16) queue->laneCount [lane] ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_countLane", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_setErrorHandler
+ *
+ *  @desc   Sets the queue that receives the asynchronous errors.
+ *
+ *  @modif  LDRV_MSGQ_state->errorQueue, LDRV_MSGQ_state->errorPoolId
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_setErrorHandler (IN MSGQ_Queue errorQueue, IN PoolId poolId)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_2ENTER ("LDRV_MSGQ_setErrorHandler", errorQueue, poolId) ;
+
+    if (    (errorQueue != MSGQ_INVALIDMSGQ)
+        &&  (LDRV_MSGQ_getQueue (errorQueue) == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&LDRV_MSGQ_state->lock) ;
+        LDRV_MSGQ_state->errorQueue  = errorQueue ;
+        LDRV_MSGQ_state->errorPoolId = poolId ;
+        SYNC_HOST_leave (&LDRV_MSGQ_state->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_setErrorHandler", status) ;
+
+    return status ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_MSGQ_instrument
+ *
+ *  @desc   Gets the instrumentation information of a local message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_instrument (IN MSGQ_Queue msgqQueue, OUT MSGQ_Instrument * retVal)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_MSGQ_Queue * queue ;
+
+    TRC_2ENTER ("LDRV_MSGQ_instrument", msgqQueue, retVal) ;
+
+    DBC_Require (retVal != NULL) ;
+
+    queue = LDRV_MSGQ_getQueue (msgqQueue) ;
+    if ((queue == NULL) || (queue->inUse == FALSE)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_HOST_enter (&queue->lock) ;
+        retVal->transferred = queue->transferred ;
+        retVal->queued      = queue->count ;
+        retVal->spinHits    = queue->spinHits ;
+        retVal->latencyCount = queue->latCount ;
+        retVal->latencyP50   = LDRV_MSGQ_TICKSTONS (
+               LDRV_MSGQ_latPercentile (queue, queue->latCount / 2u)) ;
+        retVal->latencyP99   = LDRV_MSGQ_TICKSTONS (
+               LDRV_MSGQ_latPercentile (queue, queue->latCount / 100u)) ;
+        retVal->latencyP999  = LDRV_MSGQ_TICKSTONS (
+               LDRV_MSGQ_latPercentile (queue, queue->latCount / 1000u)) ;
+        retVal->latencyMax   = LDRV_MSGQ_TICKSTONS (queue->latMax) ;
+        SYNC_HOST_leave (&queue->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_instrument", status) ;
+
+    return status ;
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (DDSP_DEBUG)
+/** ============================================================================
+ *  @func   LDRV_MSGQ_debug
+ *
+ *  @desc   Prints the state of a local message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_MSGQ_debug (IN MSGQ_Queue msgqQueue)
+{
+    LDRV_MSGQ_Queue * queue ;
+
+    queue = LDRV_MSGQ_getQueue (msgqQueue) ;
+    if (queue != NULL) {
+        TRC_1PRINT (TRC_LEVEL4, "MSGQ [0x%x]\n", msgqQueue) ;
+        TRC_1PRINT (TRC_LEVEL4, "    inUse       [%d]\n", queue->inUse) ;
+        TRC_1PRINT (TRC_LEVEL4, "    ownerSlot   [%d]\n", queue->ownerSlot) ;
+        TRC_1PRINT (TRC_LEVEL4, "    count       [%d]\n", queue->count) ;
+        TRC_1PRINT (TRC_LEVEL4, "    transferred [%d]\n", queue->transferred) ;
+    }
+}
+#endif /* if defined (DDSP_DEBUG) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
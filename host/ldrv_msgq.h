@@ -0,0 +1,882 @@
+/** ============================================================================
+ *  @file   ldrv_msgq.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the MSGQ manager of the host backend.
+ *          Local message queues live in the driver segment and are shared
+ *          by every process of the link. Messages to a DSP go through the
+ *          MQT configured for it.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LDRV_MSGQ_H)
+#define LDRV_MSGQ_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <msgqdefs.h>
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_init
+ *
+ *  @desc   Initializes the MSGQ manager and the MQTs in the calling process.
+ *
+ *  @arg    create
+ *              TRUE if the shared state is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The driver segment is exhausted.
+ *          DSP_ECONFIG
+ *              A DSP uses an unknown MQT.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_init (IN Bool create) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_exit
+ *
+ *  @desc   Finalizes the MSGQ manager in the calling process. The queues
+ *          still open in the calling process are closed.
+ *
+ *  @arg    destroy
+ *              TRUE if the shared state is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_exit (IN Bool destroy) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_transportOpen
+ *
+ *  @desc   Opens the MQT to a DSP. Later opens only count.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    attrs
+ *              Attributes of the MQT.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SALREADYOPENED
+ *              The MQT was already open.
+ *          DSP_EWRONGSTATE
+ *              The DSP is not started.
+ *
+ *  @enter  dspId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_transportClose
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_transportOpen (IN ProcessorId dspId, IN Pvoid attrs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_transportClose
+ *
+ *  @desc   Closes the MQT to a DSP. The last close closes the MQT.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SCLOSED
+ *              The last close has been done.
+ *          DSP_EWRONGSTATE
+ *              The MQT is not open.
+ *
+ *  @enter  dspId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_transportOpen
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_transportClose (IN ProcessorId dspId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_open
+ *
+ *  @desc   Opens a local message queue owned by the calling process.
+ *
+ *  @arg    queueName
+ *              Name of the message queue.
+ *  @arg    msgqQueue
+ *              Location to receive the message queue.
+ *  @arg    attrs
+ *              Optional pend and post functions used by MSGQ_get to wait,
+ *              and the wait policy and lanes if its version is
+ *              MSGQ_ATTRS_VERSION.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EALREADYEXISTS
+ *              A message queue with the same name is open.
+ *          DSP_ERESOURCE
+ *              All the message queues are in use.
+ *
+ *  @enter  queueName and msgqQueue are valid pointers.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_close
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_open (IN     Pstr         queueName,
+                OUT    MSGQ_Queue * msgqQueue,
+                IN OPT MSGQ_Attrs * attrs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_close
+ *
+ *  @desc   Closes a local message queue. Queued messages are freed.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The message queue is not open.
+ *          DSP_EACCESSDENIED
+ *              The message queue is owned by another process.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_open
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_close (IN MSGQ_Queue msgqQueue) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_locate
+ *
+ *  @desc   Locates a message queue by name, first among the local queues and
+ *          then on every DSP with an open MQT.
+ *
+ *  @arg    queueName
+ *              Name of the message queue.
+ *  @arg    msgqQueue
+ *              Location to receive the message queue.
+ *  @arg    attrs
+ *              Optional attributes of the locate.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The message queue does not exist.
+ *
+ *  @enter  queueName and msgqQueue are valid pointers.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_release
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_locate (IN     Pstr               queueName,
+                  OUT    MSGQ_Queue *       msgqQueue,
+                  IN OPT MSGQ_LocateAttrs * attrs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_locateAsync
+ *
+ *  @desc   Locates a message queue by name and sends the answer as an
+ *          MSGQ_AsyncLocateMsg to a reply queue.
+ *
+ *  @arg    queueName
+ *              Name of the message queue.
+ *  @arg    replyQueue
+ *              Queue that receives the answer.
+ *  @arg    attrs
+ *              Pool of the answer and argument returned in it.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The message queue does not exist.
+ *          DSP_EMEMORY
+ *              The answer could not be allocated.
+ *
+ *  @enter  queueName and attrs are valid pointers.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_locate
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_locateAsync (IN Pstr                    queueName,
+                       IN MSGQ_Queue              replyQueue,
+                       IN MSGQ_LocateAsyncAttrs * attrs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_release
+ *
+ *  @desc   Releases a located message queue.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid message queue.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_locate
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_release (IN MSGQ_Queue msgqQueue) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_alloc
+ *
+ *  @desc   Allocates a message from a pool and initializes its header.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    size
+ *              Size of the message, including the header.
+ *  @arg    msg
+ *              Location to receive the message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              No buffer is available.
+ *          DSP_EINVALIDARG
+ *              The size is smaller than the header.
+ *
+ *  @enter  msg is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_free
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_alloc (IN PoolId poolId, IN Uint16 size, OUT MSGQ_Msg * msg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_free
+ *
+ *  @desc   Returns a message to its pool.
+ *
+ *  @arg    msg
+ *              Message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The message does not belong to its pool.
+ *
+ *  @enter  msg is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_alloc
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_free (IN MSGQ_Msg msg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_put
+ *
+ *  @desc   Sends a message to a local or a remote message queue.
+ *
+ *  @arg    msgqQueue
+ *              Destination message queue.
+ *  @arg    msg
+ *              Message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The local destination is not open.
+ *          DSP_EWRONGSTATE
+ *              The MQT to the destination is not open.
+ *          DSP_EINVALIDARG
+ *              Invalid destination.
+ *
+ *  @enter  msg is a valid pointer.
+ *
+ *  @leave  On success, the message belongs to the destination. On failure,
+ *          it still belongs to the caller.
+ *
+ *  @see    LDRV_MSGQ_get
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_put (IN MSGQ_Queue msgqQueue, IN MSGQ_Msg msg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_putv
+ *
+ *  @desc   Sends an array of messages to a local or a remote message queue.
+ *          A local destination is woken once, and the MQT to a remote one is
+ *          given the whole array.
+ *
+ *  @arg    msgqQueue
+ *              Destination message queue.
+ *  @arg    msgArray
+ *              Messages.
+ *  @arg    numMsgs
+ *              Number of messages.
+ *  @arg    numPut
+ *              Location to receive the number of messages sent.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The local destination is not open.
+ *          DSP_EWRONGSTATE
+ *              The MQT to the destination is not open.
+ *          DSP_EINVALIDARG
+ *              Invalid destination.
+ *
+ *  @enter  msgArray holds numMsgs valid pointers.
+ *          numPut is a valid pointer.
+ *
+ *  @leave  The first *numPut messages belong to the destination.
+ *
+ *  @see    LDRV_MSGQ_put, LDRV_MSGQ_getv
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_putv (IN  MSGQ_Queue msgqQueue,
+                IN  MSGQ_Msg * msgArray,
+                IN  Uint32     numMsgs,
+                OUT Uint32 *   numPut) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_deliver
+ *
+ *  @desc   Queues a message on the local message queue in its header. Used by
+ *          the MQTs for the messages received from a DSP.
+ *
+ *  @arg    msg
+ *              Message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The destination is not open. The message has been freed and
+ *              the error handler, if any, has been told.
+ *
+ *  @enter  msg is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_put
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_deliver (IN MSGQ_Msg msg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_get
+ *
+ *  @desc   Receives a message from a local message queue owned by the calling
+ *          process.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *  @arg    timeout
+ *              Time to wait for a message.
+ *  @arg    msg
+ *              Location to receive the message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ETIMEOUT
+ *              No message arrived in time.
+ *          DSP_ENOTCOMPLETE
+ *              No message is queued and timeout is WAIT_NONE.
+ *          DSP_EINVALIDARG
+ *              The message queue is not open.
+ *          DSP_EACCESSDENIED
+ *              The message queue is owned by another process.
+ *
+ *  @enter  msg is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_put
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_get (IN  MSGQ_Queue msgqQueue,
+               IN  Uint32     timeout,
+               OUT MSGQ_Msg * msg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_getv
+ *
+ *  @desc   Receives up to maxMsgs messages from a local message queue owned by
+ *          the calling process. Only the first message is waited for.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *  @arg    timeout
+ *              Time to wait for the first message.
+ *  @arg    msgArray
+ *              Array to receive the messages.
+ *  @arg    maxMsgs
+ *              Number of entries of the array.
+ *  @arg    numMsgs
+ *              Location to receive the number of messages received.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ETIMEOUT
+ *              No message arrived in time.
+ *          DSP_ENOTCOMPLETE
+ *              No message is queued and timeout is WAIT_NONE.
+ *          DSP_EINVALIDARG
+ *              The message queue is not open.
+ *          DSP_EACCESSDENIED
+ *              The message queue is owned by another process.
+ *
+ *  @enter  msgArray has maxMsgs entries, maxMsgs is not 0.
+ *          numMsgs is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_get, LDRV_MSGQ_putv
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_getv (IN  MSGQ_Queue msgqQueue,
+                IN  Uint32     timeout,
+                OUT MSGQ_Msg * msgArray,
+                IN  Uint32     maxMsgs,
+                OUT Uint32 *   numMsgs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_allocLarge
+ *
+ *  @desc   Allocates the fragments of a large message of size bytes, each in
+ *          a message of fragSize bytes, and fills the scatter list of the
+ *          large message.
+ *
+ *  @arg    poolId
+ *              Pool of the fragments.
+ *  @arg    size
+ *              Size in bytes of the data of the large message.
+ *  @arg    fragSize
+ *              Size in bytes of the message holding each fragment.
+ *  @arg    largeMsg
+ *              Large message, with the scatter list set by the caller.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              size is 0 or fragSize does not leave room for data.
+ *          DSP_ESIZE
+ *              The scatter list is too short for the fragments.
+ *          DSP_EMEMORY
+ *              The pool is out of messages of fragSize bytes.
+ *
+ *  @enter  largeMsg is a valid pointer.
+ *
+ *  @leave  On failure, no fragment is allocated.
+ *
+ *  @see    LDRV_MSGQ_putLarge, LDRV_MSGQ_freeLarge
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_allocLarge (IN     PoolId          poolId,
+                      IN     Uint32          size,
+                      IN     Uint16          fragSize,
+                      IN OUT MSGQ_LargeMsg * largeMsg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_freeLarge
+ *
+ *  @desc   Frees all the fragments of a large message.
+ *
+ *  @arg    largeMsg
+ *              Large message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  largeMsg is a valid pointer.
+ *
+ *  @leave  The large message has no fragment.
+ *
+ *  @see    LDRV_MSGQ_allocLarge, LDRV_MSGQ_getLarge
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_freeLarge (IN OUT MSGQ_LargeMsg * largeMsg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_putLarge
+ *
+ *  @desc   Sends a large message allocated with LDRV_MSGQ_allocLarge. A local
+ *          destination receives it as a single queue entry. A remote one
+ *          receives its fragments in order, handed to the MQT in batches.
+ *
+ *  @arg    msgqQueue
+ *              Destination message queue.
+ *  @arg    largeMsg
+ *              Large message. The size of each entry of its scatter list may
+ *              have been reduced by the caller.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid large message or destination.
+ *
+ *  @enter  largeMsg is a valid pointer.
+ *
+ *  @leave  On success, the large message is consumed. On failure, it stays
+ *          with the caller unless some of its fragments were sent, in which
+ *          case the others are freed.
+ *
+ *  @see    LDRV_MSGQ_getLarge
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_putLarge (IN MSGQ_Queue msgqQueue, IN OUT MSGQ_LargeMsg * largeMsg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_getLarge
+ *
+ *  @desc   Receives a large message from a local message queue as a scatter
+ *          list pointing into its fragments, without copying them. Any other
+ *          message is received as a large message of a single fragment.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *  @arg    timeout
+ *              Timeout of the wait for a message.
+ *  @arg    largeMsg
+ *              Large message, with the scatter list set by the caller.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ETRUNCATED
+ *              The scatter list holds only the first fragments. The large
+ *              message is received all the same and must be freed.
+ *          DSP_ENOTCOMPLETE
+ *              No message with WAIT_NONE.
+ *          DSP_ETIMEOUT
+ *              Timeout waiting for a message.
+ *          DSP_EINVALIDARG
+ *              The message queue is not open.
+ *          DSP_EACCESSDENIED
+ *              The message queue is owned by another process.
+ *
+ *  @enter  largeMsg is a valid pointer with a non-empty scatter list.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_getv, LDRV_MSGQ_freeLarge
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_getLarge (IN     MSGQ_Queue      msgqQueue,
+                    IN     Uint32          timeout,
+                    IN OUT MSGQ_LargeMsg * largeMsg) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_getPollFd
+ *
+ *  @desc   Gets the pollable descriptor of a local message queue, creating it
+ *          on the first call. The descriptor is readable while messages are
+ *          queued.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *  @arg    fd
+ *              Location to receive the descriptor.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The message queue is not open.
+ *          DSP_EACCESSDENIED
+ *              The message queue is owned by another process.
+ *          DSP_ERESOURCE
+ *              The descriptor cannot be created.
+ *
+ *  @enter  fd is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_getv
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_getPollFd (IN MSGQ_Queue msgqQueue, OUT Int32 * fd) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_count
+ *
+ *  @desc   Gets the number of messages queued on a local message queue.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *  @arg    count
+ *              Location to receive the count.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The message queue is not open.
+ *
+ *  @enter  count is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_count (IN MSGQ_Queue msgqQueue, OUT Uint16 * count) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_countLane
+ *
+ *  @desc   Gets the number of messages queued on a priority lane of a local
+ *          message queue.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *  @arg    lane
+ *              Priority lane of the message queue.
+ *  @arg    count
+ *              Location to receive the count.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The message queue is not open or has no such lane.
+ *
+ *  @enter  count is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_count
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_countLane (IN  MSGQ_Queue msgqQueue,
+                     IN  Uint32     lane,
+                     OUT Uint16 *   count) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_setErrorHandler
+ *
+ *  @desc   Sets the queue that receives the asynchronous errors, or removes
+ *          it if errorQueue is MSGQ_INVALIDMSGQ.
+ *
+ *  @arg    errorQueue
+ *              Error queue.
+ *  @arg    poolId
+ *              Pool of the error messages.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_setErrorHandler (IN MSGQ_Queue errorQueue, IN PoolId poolId) ;
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_MSGQ_instrument
+ *
+ *  @desc   Gets the instrumentation information of a local message queue.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *  @arg    retVal
+ *              Location to receive the information.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The message queue is not open.
+ *
+ *  @enter  retVal is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_MSGQ_instrument (IN MSGQ_Queue msgqQueue, OUT MSGQ_Instrument * retVal) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (DDSP_DEBUG)
+/** ============================================================================
+ *  @func   LDRV_MSGQ_debug
+ *
+ *  @desc   Prints the state of a local message queue.
+ *
+ *  @arg    msgqQueue
+ *              Message queue.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_MSGQ_debug (IN MSGQ_Queue msgqQueue) ;
+#endif /* if defined (DDSP_DEBUG) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LDRV_MSGQ_H) */
@@ -0,0 +1,2014 @@
+/** ============================================================================
+ *  @file   ldrv_pool.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the POOL manager of the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <execinfo.h>
+#include <sys/syscall.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_pool.h>
+#include <smapool.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_POOL, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @const  LDRV_POOL_TRACEBUFS
+ *
+ *  @desc   Number of trace records buffered in the calling process before
+ *          they are written to its trace file.
+ *  ============================================================================
+ */
+#define LDRV_POOL_TRACEBUFS     1024u
+
+/*  ============================================================================
+ *  @const  LDRV_POOL_TRACENAMELEN
+ *
+ *  @desc   Maximum length of the name of a trace file.
+ *  ============================================================================
+ */
+#define LDRV_POOL_TRACENAMELEN  256u
+
+/*  ============================================================================
+ *  @const  LDRV_POOL_OWNERBITS, LDRV_POOL_OWNERSETS, LDRV_POOL_OWNERWAYS
+ *
+ *  @desc   Number of sets of the owner table, as a power of 2 and as a
+ *          number, and of owners in a set. A
+ *          buffer is tracked in the set its physical address hashes to, so
+ *          that a free only looks at the few owners of that set.
+ *  ============================================================================
+ */
+#define LDRV_POOL_OWNERBITS     9u
+#define LDRV_POOL_OWNERSETS     (1u << LDRV_POOL_OWNERBITS)
+#define LDRV_POOL_OWNERWAYS     4u
+
+/*  ============================================================================
+ *  @const  LDRV_POOL_OWNERBUSY
+ *
+ *  @desc   Key of an owner being recorded, never the address of a buffer.
+ *  ============================================================================
+ */
+#define LDRV_POOL_OWNERBUSY     1u
+
+/*  ============================================================================
+ *  @const  LDRV_POOL_DUMPUSECS
+ *
+ *  @desc   Minimum time between two dumps of the owners by a process.
+ *  ============================================================================
+ */
+#define LDRV_POOL_DUMPUSECS     1000000u
+
+/*  ============================================================================
+ *  @const  LDRV_POOL_DUMPLINELEN
+ *
+ *  @desc   Maximum length of a line of a dump of the owners.
+ *  ============================================================================
+ */
+#define LDRV_POOL_DUMPLINELEN   512u
+
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_Allocator
+ *
+ *  @desc   Maps the name of a pool in the configuration to its allocator.
+ *
+ *  @field  name
+ *              Name of the allocator.
+ *  @field  init
+ *              Initialization function of the allocator.
+ *  @field  exit
+ *              Finalization function of the allocator.
+ *  @field  interface
+ *              Interface of the allocator.
+ *  @field  instrument
+ *              Instrumentation function of the allocator, NULL if it has
+ *              none.
+ *  ============================================================================
+ */
+typedef struct LDRV_POOL_Allocator_tag {
+    Char8 *           name      ;
+    FnPoolInit        init      ;
+    FnPoolExit        exit      ;
+    POOL_Interface *  interface ;
+#if defined (DDSP_PROFILE)
+    DSP_STATUS        (*instrument) (Void * object, SMAPOOL_Stats * retVal) ;
+#endif /* if defined (DDSP_PROFILE) */
+} LDRV_POOL_Allocator ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_Entry
+ *
+ *  @desc   Shared state of one pool.
+ *
+ *  @field  openCount
+ *              Number of opens not yet closed.
+ *  @field  physAddr
+ *              Physical address of the region of the pool.
+ *  @field  size
+ *              Size of the region of the pool.
+ *  @field  generation
+ *              Incremented every time the pool is created by its first open.
+ *  ============================================================================
+ */
+typedef struct LDRV_POOL_Entry_tag {
+    Uint32  openCount  ;
+    Uint32  physAddr   ;
+    Uint32  size       ;
+    Uint32  generation ;
+} LDRV_POOL_Entry ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_Object
+ *
+ *  @desc   Private state of the POOL manager in the driver segment.
+ *
+ *  @field  lock
+ *              Lock protecting the open counts.
+ *  @field  owners
+ *              Offset of the owner table in the driver segment, 0 if the
+ *              owner tracking is not enabled.
+ *  @field  pools
+ *              State of every pool.
+ *  ============================================================================
+ */
+typedef struct LDRV_POOL_Object_tag {
+    SYNC_HostLock    lock   ;
+    Uint32           owners ;
+    LDRV_POOL_Entry  pools [MAX_DSPS][MAX_POOLENTRIES] ;
+} LDRV_POOL_Object ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_Local
+ *
+ *  @desc   State of one pool in the calling process.
+ *
+ *  @field  allocator
+ *              Allocator of the pool.
+ *  @field  object
+ *              Allocator object of the pool.
+ *  ============================================================================
+ */
+typedef struct LDRV_POOL_Local_tag {
+    LDRV_POOL_Allocator * allocator ;
+    Pvoid                 object    ;
+} LDRV_POOL_Local ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_Trace
+ *
+ *  @desc   Allocation trace of the calling process.
+ *
+ *  @field  fd
+ *              Trace file, -1 if the trace is not enabled.
+ *  @field  count
+ *              Number of records buffered.
+ *  @field  lock
+ *              Lock protecting the buffered records.
+ *  @field  records
+ *              Records not yet written to the trace file.
+ *  ============================================================================
+ */
+typedef struct LDRV_POOL_Trace_tag {
+    Int32                  fd      ;
+    Uint32                 count   ;
+    SYNC_HostLock          lock    ;
+    LDRV_POOL_TraceRecord  records [LDRV_POOL_TRACEBUFS] ;
+} LDRV_POOL_Trace ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_OwnerSet
+ *
+ *  @desc   Set of the owner table.
+ *
+ *  @field  keys
+ *              Physical address of the buffer of every owner, 0 if the owner
+ *              is free and LDRV_POOL_OWNERBUSY while it is being recorded.
+ *              The keys are kept apart so that a free reads them together.
+ *  @field  infos
+ *              Owners.
+ *  ============================================================================
+ */
+typedef struct LDRV_POOL_OwnerSet_tag {
+    volatile Uint32  keys  [LDRV_POOL_OWNERWAYS] ;
+    POOL_OwnerInfo   infos [LDRV_POOL_OWNERWAYS] ;
+} LDRV_POOL_OwnerSet ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_Owners
+ *
+ *  @desc   Owner table, in the driver segment so that a buffer allocated in
+ *          one process and freed in another stops being tracked.
+ *
+ *  @field  stats
+ *              Counters of every pool.
+ *  @field  sets
+ *              Sets of owners.
+ *  ============================================================================
+ */
+typedef struct LDRV_POOL_Owners_tag {
+    POOL_OwnerStats     stats [MAX_DSPS][MAX_POOLENTRIES] ;
+    LDRV_POOL_OwnerSet  sets  [LDRV_POOL_OWNERSETS] ;
+} LDRV_POOL_Owners ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_Dump
+ *
+ *  @desc   Dump of the owners of the calling process.
+ *
+ *  @field  fd
+ *              Dump file, -1 if the dump is not enabled.
+ *  @field  usecs
+ *              Time of the last dump.
+ *  @field  lock
+ *              Lock protecting the dump.
+ *  @field  infos
+ *              Owners being dumped.
+ *  ============================================================================
+ */
+typedef struct LDRV_POOL_Dump_tag {
+    Int32           fd    ;
+    Uint32          usecs ;
+    SYNC_HostLock   lock  ;
+    POOL_OwnerInfo  infos [LDRV_POOL_OWNERSETS * LDRV_POOL_OWNERWAYS] ;
+} LDRV_POOL_Dump ;
+
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_allocators
+ *
+ *  @desc   Allocators supported by the host backend.
+ *  ============================================================================
+ */
+STATIC LDRV_POOL_Allocator LDRV_POOL_allocators [] = {
+    {
+        "SMAPOOL", &SMAPOOL_init, &SMAPOOL_exit, &SMAPOOL_Interface
+#if defined (DDSP_PROFILE)
+        , &SMAPOOL_instrument
+#endif /* if defined (DDSP_PROFILE) */
+    }
+} ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_state
+ *
+ *  @desc   Private state of the POOL manager in the driver segment.
+ *  ============================================================================
+ */
+STATIC LDRV_POOL_Object * LDRV_POOL_state = NULL ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_local
+ *
+ *  @desc   State of the pools in the calling process.
+ *  ============================================================================
+ */
+STATIC LDRV_POOL_Local LDRV_POOL_local [MAX_DSPS][MAX_POOLENTRIES] ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_trace
+ *
+ *  @desc   Allocation trace of the calling process.
+ *  ============================================================================
+ */
+STATIC LDRV_POOL_Trace LDRV_POOL_trace = { -1 } ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_owners
+ *
+ *  @desc   Owner table, NULL if the owner tracking is not enabled.
+ *  ============================================================================
+ */
+STATIC LDRV_POOL_Owners * LDRV_POOL_owners = NULL ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_countdown
+ *
+ *  @desc   Number of allocations of the calling thread left until the next
+ *          one tracked. Kept per thread so that sampling shares nothing.
+ *  ============================================================================
+ */
+STATIC __thread Uint32 LDRV_POOL_countdown = 0u ;
+
+/*  ============================================================================
+ *  @name   LDRV_POOL_dump
+ *
+ *  @desc   Dump of the owners of the calling process.
+ *  ============================================================================
+ */
+STATIC LDRV_POOL_Dump LDRV_POOL_dump = { -1 } ;
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_getOpen
+ *
+ *  @desc   Gets the local state of an open pool.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *
+ *  @ret    Local state of the pool, NULL if the pool is not open.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+LDRV_POOL_Local *
+LDRV_POOL_getOpen (IN PoolId poolId)
+{
+    LDRV_POOL_Local * local  = NULL ;
+    ProcessorId       dspId  = POOL_getProcId (poolId) ;
+    Uint32            poolNo = POOL_getPoolNo (poolId) ;
+
+    if (    IS_VALID_PROCID (dspId)
+        &&  (poolNo < LDRV_getDspConfig (dspId)->numPools)
+        &&  (LDRV_POOL_state->pools [dspId][poolNo].openCount != 0u)) {
+        local = &(LDRV_POOL_local [dspId][poolNo]) ;
+    }
+
+    return local ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_toPhys
+ *
+ *  @desc   Gets the physical address of a buffer of a pool.
+ *
+ *  @arg    local
+ *              Local state of the pool.
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    buf
+ *              Address of the buffer in the calling process.
+ *
+ *  @ret    Physical address of the buffer, 0 if it is NULL or not in the
+ *          pool.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_POOL_toPhys (IN LDRV_POOL_Local * local, IN PoolId poolId, IN Pvoid buf)
+{
+    Pvoid physAddr = NULL ;
+
+    if (buf != NULL) {
+        local->allocator->interface->xltBuf (
+                          POOL_getProcId (poolId),
+                          POOL_getPoolNo (poolId),
+                          local->object,
+                          buf,
+                          &physAddr,
+                          (POOL_AddrXltFlag) (    AddrType_Usr
+                                              | (AddrType_Phy << 8u))) ;
+    }
+
+    return LDRV_PTR_TO_UINT32 (physAddr) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_traceOpen
+ *
+ *  @desc   Opens the trace file of the calling process if the allocation
+ *          trace is enabled.
+ *
+ *  @arg    None
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_traceClose
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_POOL_traceOpen (Void)
+{
+    const char * prefix = getenv (LDRV_POOL_TRACE_ENV) ;
+    DSP_STATUS   status = DSP_EFAIL ;
+    Char8        name [LDRV_POOL_TRACENAMELEN] ;
+
+    if (    (LDRV_POOL_trace.fd < 0)
+        &&  (prefix != NULL)
+        &&  (prefix [0] != '\0')) {
+        status = SYNC_HOST_createLock (&LDRV_POOL_trace.lock) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        snprintf (name, sizeof (name), "%s.%d", prefix, (int) getpid ()) ;
+        LDRV_POOL_trace.count = 0u ;
+        LDRV_POOL_trace.fd    = open (name,
+                                      O_WRONLY | O_CREAT | O_APPEND,
+                                      0644) ;
+        if (LDRV_POOL_trace.fd < 0) {
+            SYNC_HOST_deleteLock (&LDRV_POOL_trace.lock) ;
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_traceFlush
+ *
+ *  @desc   Writes the buffered trace records to the trace file. Records that
+ *          cannot be written are dropped.
+ *
+ *  @arg    None
+ *
+ *  @ret    None
+ *
+ *  @enter  The trace is enabled and its lock is held.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_traceRecord
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_POOL_traceFlush (Void)
+{
+    ssize_t written ;
+
+    if (LDRV_POOL_trace.count != 0u) {
+        written = write (LDRV_POOL_trace.fd,
+                         LDRV_POOL_trace.records,
+                           LDRV_POOL_trace.count
+                         * sizeof (LDRV_POOL_TraceRecord)) ;
+        (Void) written ;
+        LDRV_POOL_trace.count = 0u ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_traceClose
+ *
+ *  @desc   Writes the remaining trace records and closes the trace file of
+ *          the calling process.
+ *
+ *  @arg    None
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_traceOpen
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_POOL_traceClose (Void)
+{
+    Int32 fd = LDRV_POOL_trace.fd ;
+
+    if (fd >= 0) {
+        SYNC_HOST_enter (&LDRV_POOL_trace.lock) ;
+        LDRV_POOL_traceFlush () ;
+        LDRV_POOL_trace.fd = -1 ;
+        SYNC_HOST_leave (&LDRV_POOL_trace.lock) ;
+        SYNC_HOST_deleteLock (&LDRV_POOL_trace.lock) ;
+        close (fd) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_traceRecord
+ *
+ *  @desc   Records an allocation, a free or a failed allocation in the trace.
+ *
+ *  @arg    local
+ *              Local state of the pool.
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    op
+ *              LDRV_POOL_TRACEALLOC, LDRV_POOL_TRACEFREE or
+ *              LDRV_POOL_TRACEFAIL.
+ *  @arg    buf
+ *              Address of the buffer in the calling process, NULL for
+ *              LDRV_POOL_TRACEFAIL.
+ *  @arg    size
+ *              Size passed to the call.
+ *
+ *  @ret    None
+ *
+ *  @enter  The trace is enabled.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_traceFlush
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_POOL_traceRecord (IN LDRV_POOL_Local * local,
+                       IN PoolId            poolId,
+                       IN Uint32            op,
+                       IN Pvoid             buf,
+                       IN Uint32            size)
+{
+    Uint32                  physAddr = LDRV_POOL_toPhys (local, poolId, buf) ;
+    LDRV_POOL_TraceRecord * record ;
+
+    SYNC_HOST_enter (&LDRV_POOL_trace.lock) ;
+    if (LDRV_POOL_trace.fd >= 0) {
+        record           = &(LDRV_POOL_trace.records [LDRV_POOL_trace.count]) ;
+        record->usecs    = SYNC_HOST_usecs () ;
+        record->physAddr = physAddr ;
+        record->size     = size ;
+        record->poolId   = poolId ;
+        record->op       = (Uint16) op ;
+        LDRV_POOL_trace.count++ ;
+        if (LDRV_POOL_trace.count == LDRV_POOL_TRACEBUFS) {
+            LDRV_POOL_traceFlush () ;
+        }
+    }
+    SYNC_HOST_leave (&LDRV_POOL_trace.lock) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_ownersOpen
+ *
+ *  @desc   Creates the owner table if the owner tracking is enabled in the
+ *          environment of the process setting up the link, finds it in the
+ *          other processes, and opens the dump file of the calling process.
+ *
+ *  @arg    create
+ *              TRUE in the process setting up the link.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              No room left in the driver segment for the owner table.
+ *
+ *  @enter  LDRV_POOL_state is set.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_ownersClose
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LDRV_POOL_ownersOpen (IN Bool create)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    const char *       period = getenv (LDRV_POOL_OWNERS_ENV) ;
+    const char *       prefix = getenv (LDRV_POOL_OWNERSDUMP_ENV) ;
+    Uint32             value  = 0u ;
+    DSP_STATUS         lockStatus ;
+    LDRV_POOL_Owners * owners ;
+    Char8              name [LDRV_POOL_TRACENAMELEN] ;
+    ProcessorId        dspId ;
+    Uint32             i ;
+
+    if ((create == TRUE) && (period != NULL)) {
+        value = (Uint32) strtoul (period, NULL, 0) ;
+    }
+
+    if (value != 0u) {
+        LDRV_POOL_state->owners = LDRV_drvAlloc (sizeof (LDRV_POOL_Owners)) ;
+        if (LDRV_POOL_state->owners == 0u) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            owners = (LDRV_POOL_Owners *)
+                                     LDRV_drvPtr (LDRV_POOL_state->owners) ;
+            for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+                for (i = 0u ; i < MAX_POOLENTRIES ; i++) {
+                    owners->stats [dspId][i].period = value ;
+                }
+            }
+        }
+    }
+
+    if (DSP_SUCCEEDED (status) && (LDRV_POOL_state->owners != 0u)) {
+        LDRV_POOL_owners =
+                (LDRV_POOL_Owners *) LDRV_drvPtr (LDRV_POOL_state->owners) ;
+        if (    (LDRV_POOL_dump.fd < 0)
+            &&  (prefix != NULL)
+            &&  (prefix [0] != '\0')) {
+            lockStatus = SYNC_HOST_createLock (&LDRV_POOL_dump.lock) ;
+            if (DSP_SUCCEEDED (lockStatus)) {
+                snprintf (name,
+                          sizeof (name),
+                          "%s.%d",
+                          prefix,
+                          (int) getpid ()) ;
+                LDRV_POOL_dump.usecs =   SYNC_HOST_usecs ()
+                                       - LDRV_POOL_DUMPUSECS ;
+                LDRV_POOL_dump.fd    = open (name,
+                                             O_WRONLY | O_CREAT | O_APPEND,
+                                             0644) ;
+                if (LDRV_POOL_dump.fd < 0) {
+                    SYNC_HOST_deleteLock (&LDRV_POOL_dump.lock) ;
+                }
+            }
+        }
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_ownersClose
+ *
+ *  @desc   Closes the dump file of the calling process and forgets the owner
+ *          table.
+ *
+ *  @arg    None
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_ownersOpen
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_POOL_ownersClose (Void)
+{
+    Int32 fd = LDRV_POOL_dump.fd ;
+
+    if (fd >= 0) {
+        SYNC_HOST_enter (&LDRV_POOL_dump.lock) ;
+        LDRV_POOL_dump.fd = -1 ;
+        SYNC_HOST_leave (&LDRV_POOL_dump.lock) ;
+        SYNC_HOST_deleteLock (&LDRV_POOL_dump.lock) ;
+        close (fd) ;
+    }
+
+    LDRV_POOL_owners = NULL ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_ownerSet
+ *
+ *  @desc   Gets the set of the owner table tracking a buffer.
+ *
+ *  @arg    physAddr
+ *              Physical address of the buffer.
+ *
+ *  @ret    Set of the owner table.
+ *
+ *  @enter  The owner tracking is enabled.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+LDRV_POOL_OwnerSet *
+LDRV_POOL_ownerSet (IN Uint32 physAddr)
+{
+    /* Buffers are at least DSPLINK_BUF_ALIGN bytes apart. The top bits of
+     * the product spread buffers of any stride over all the sets.
+     */
+    return &(LDRV_POOL_owners->sets [  ((physAddr / DSPLINK_BUF_ALIGN)
+                                         * 2654435761u)
+                                     >> (32u - LDRV_POOL_OWNERBITS)]) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_ownerTrack
+ *
+ *  @desc   Records the owner of a buffer just allocated, if the allocation
+ *          is one picked by the sampling of the calling thread.
+ *
+ *  @arg    local
+ *              Local state of the pool.
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    buf
+ *              Address of the buffer in the calling process.
+ *  @arg    size
+ *              Size passed to the allocation.
+ *
+ *  @ret    None
+ *
+ *  @enter  The owner tracking is enabled.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_ownerUntrack
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_POOL_ownerTrack (IN LDRV_POOL_Local * local,
+                      IN PoolId            poolId,
+                      IN Pvoid             buf,
+                      IN Uint32            size)
+{
+    POOL_OwnerStats *    stats = &(LDRV_POOL_owners->stats
+                                        [POOL_getProcId (poolId)]
+                                        [POOL_getPoolNo (poolId)]) ;
+    Uint32               i     = 0u ;
+    LDRV_POOL_OwnerSet * set ;
+    POOL_OwnerInfo *     info ;
+    Pvoid                frames [POOL_OWNERCALLERS + 1u] ;
+    Int32                numFrames ;
+    Uint32               physAddr ;
+    Uint32               tracked ;
+    Uint32               max ;
+
+    if (LDRV_POOL_countdown > 1u) {
+        LDRV_POOL_countdown-- ;
+    }
+    else {
+        LDRV_POOL_countdown = stats->period ;
+        physAddr = LDRV_POOL_toPhys (local, poolId, buf) ;
+        set      = LDRV_POOL_ownerSet (physAddr) ;
+        while (    (i < LDRV_POOL_OWNERWAYS)
+               &&  (__sync_bool_compare_and_swap (&set->keys [i],
+                                                  0u,
+                                                  LDRV_POOL_OWNERBUSY)
+                    == FALSE)) {
+            i++ ;
+        }
+
+        if (i == LDRV_POOL_OWNERWAYS) {
+            __sync_add_and_fetch (&stats->numDropped, 1u) ;
+        }
+        else {
+            /* The first frame is the one of the allocation in LDRV_POOL. */
+            numFrames = backtrace (frames, (int) (POOL_OWNERCALLERS + 1u)) ;
+            info      = &(set->infos [i]) ;
+            memset (info->callers, 0, sizeof (info->callers)) ;
+            if (numFrames > 1) {
+                memcpy (info->callers,
+                        &(frames [1]),
+                        (Uint32) (numFrames - 1) * sizeof (Pvoid)) ;
+            }
+            info->physAddr  = physAddr ;
+            info->size      = size ;
+            info->usecs     = SYNC_HOST_usecs () ;
+            info->processId = (Uint32) getpid () ;
+            info->threadId  = (Uint32) syscall (SYS_gettid) ;
+            info->poolId    = poolId ;
+
+            tracked = __sync_add_and_fetch (&stats->numTracked, 1u) ;
+            max     = stats->maxTracked ;
+            while (    (tracked > max)
+                   &&  (__sync_bool_compare_and_swap (&stats->maxTracked,
+                                                      max,
+                                                      tracked)
+                        == FALSE)) {
+                max = stats->maxTracked ;
+            }
+
+            __sync_synchronize () ;
+            set->keys [i] = physAddr ;
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_ownerUntrack
+ *
+ *  @desc   Forgets the owner of a buffer about to be freed, if it is tracked.
+ *
+ *  @arg    local
+ *              Local state of the pool.
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    buf
+ *              Address of the buffer in the calling process.
+ *
+ *  @ret    None
+ *
+ *  @enter  The owner tracking is enabled.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_ownerTrack
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_POOL_ownerUntrack (IN LDRV_POOL_Local * local,
+                        IN PoolId            poolId,
+                        IN Pvoid             buf)
+{
+    Uint32               physAddr = LDRV_POOL_toPhys (local, poolId, buf) ;
+    LDRV_POOL_OwnerSet * set      = LDRV_POOL_ownerSet (physAddr) ;
+    Uint32               i ;
+
+    for (i = 0u ; i < LDRV_POOL_OWNERWAYS ; i++) {
+        if (    (physAddr > LDRV_POOL_OWNERBUSY)
+            &&  (set->keys [i] == physAddr)
+            &&  __sync_bool_compare_and_swap (&set->keys [i], physAddr, 0u)) {
+            __sync_sub_and_fetch (&(LDRV_POOL_owners->stats
+                                        [POOL_getProcId (poolId)]
+                                        [POOL_getPoolNo (poolId)].numTracked),
+                                  1u) ;
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_ownerCollect
+ *
+ *  @desc   Copies the owners of the tracked buffers of a pool, oldest first.
+ *          When there are more than the location holds, the oldest ones are
+ *          kept.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    infos
+ *              Location to receive the owners.
+ *  @arg    maxInfos
+ *              Number of owners the location can hold.
+ *
+ *  @ret    Number of owners copied.
+ *
+ *  @enter  The owner tracking is enabled.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_getOwners, LDRV_POOL_ownerDump
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LDRV_POOL_ownerCollect (IN  PoolId           poolId,
+                        OUT POOL_OwnerInfo * infos,
+                        IN  Uint32           maxInfos)
+{
+    Uint32               now   = SYNC_HOST_usecs () ;
+    Uint32               count = 0u ;
+    LDRV_POOL_OwnerSet * set ;
+    POOL_OwnerInfo       info ;
+    Uint32               key ;
+    Uint32               i ;
+    Uint32               j ;
+    Uint32               k ;
+
+    for (i = 0u ; i < LDRV_POOL_OWNERSETS ; i++) {
+        set = &(LDRV_POOL_owners->sets [i]) ;
+        for (j = 0u ; j < LDRV_POOL_OWNERWAYS ; j++) {
+            key = set->keys [j] ;
+            if (key > LDRV_POOL_OWNERBUSY) {
+                __sync_synchronize () ;
+                info = set->infos [j] ;
+                __sync_synchronize () ;
+                /* Skipped if the buffer was freed while it was copied. */
+                if ((set->keys [j] == key) && (info.poolId == poolId)) {
+                    for (k = count ;
+                         (k > 0u) && (   (now - infos [k - 1u].usecs)
+                                      <  (now - info.usecs)) ;
+                         k--) {
+                        if (k < maxInfos) {
+                            infos [k] = infos [k - 1u] ;
+                        }
+                    }
+                    if (k < maxInfos) {
+                        infos [k] = info ;
+                    }
+                    if (count < maxInfos) {
+                        count++ ;
+                    }
+                }
+            }
+        }
+    }
+
+    return count ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_POOL_ownerDump
+ *
+ *  @desc   Appends the owners of a pool to the dump file of the calling
+ *          process, unless it did so less than LDRV_POOL_DUMPUSECS ago.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *
+ *  @ret    None
+ *
+ *  @enter  The owner tracking is enabled.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_ownerCollect
+ *  ============================================================================
+ */
+STATIC
+Void
+LDRV_POOL_ownerDump (IN PoolId poolId)
+{
+    POOL_OwnerStats * stats = &(LDRV_POOL_owners->stats
+                                        [POOL_getProcId (poolId)]
+                                        [POOL_getPoolNo (poolId)]) ;
+    Uint32            now   = SYNC_HOST_usecs () ;
+    POOL_OwnerInfo *  info ;
+    Char8             line [LDRV_POOL_DUMPLINELEN] ;
+    Uint32            count ;
+    Int32             len ;
+    ssize_t           written ;
+    Uint32            i ;
+    Uint32            j ;
+
+    SYNC_HOST_enter (&LDRV_POOL_dump.lock) ;
+    if (    (LDRV_POOL_dump.fd >= 0)
+        &&  ((now - LDRV_POOL_dump.usecs) >= LDRV_POOL_DUMPUSECS)) {
+        LDRV_POOL_dump.usecs = now ;
+        count = LDRV_POOL_ownerCollect (poolId,
+                                        LDRV_POOL_dump.infos,
+                                          LDRV_POOL_OWNERSETS
+                                        * LDRV_POOL_OWNERWAYS) ;
+        len = snprintf (line,
+                        sizeof (line),
+                        "pool 0x%x: %u tracked, %u at most, %u dropped,"
+                        " 1 allocation in %u\n",
+                        (unsigned) poolId,
+                        (unsigned) stats->numTracked,
+                        (unsigned) stats->maxTracked,
+                        (unsigned) stats->numDropped,
+                        (unsigned) stats->period) ;
+        written = write (LDRV_POOL_dump.fd, line, (size_t) len) ;
+
+        for (i = 0u ; i < count ; i++) {
+            info = &(LDRV_POOL_dump.infos [i]) ;
+            len  = snprintf (line,
+                             sizeof (line),
+                             "  buf 0x%08x size %u age %u us pid %u tid %u"
+                             " callers",
+                             (unsigned) info->physAddr,
+                             (unsigned) info->size,
+                             (unsigned) (now - info->usecs),
+                             (unsigned) info->processId,
+                             (unsigned) info->threadId) ;
+            for (j = 0u ;
+                 (j < POOL_OWNERCALLERS) && (info->callers [j] != NULL) ;
+                 j++) {
+                len += snprintf (line + len,
+                                 sizeof (line) - (size_t) len,
+                                 " %p",
+                                 info->callers [j]) ;
+            }
+            len += snprintf (line + len, sizeof (line) - (size_t) len, "\n") ;
+            written = write (LDRV_POOL_dump.fd, line, (size_t) len) ;
+        }
+        (Void) written ;
+    }
+    SYNC_HOST_leave (&LDRV_POOL_dump.lock) ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_init
+ *
+ *  @desc   Initializes the POOL manager in the calling process.
+ *
+ *  @modif  LDRV_POOL_state, LDRV_POOL_local
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_init (IN Bool create)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    LDRV_DspConfig *   cfg ;
+    LINKCFG_MemEntry * memEntry ;
+    LDRV_POOL_Entry *  entry ;
+    LDRV_POOL_Local *  local ;
+    Uint32             offset [LDRV_MAX_MEMENTRIES] ;
+    Uint32             shDspAddr ;
+    ProcessorId        dspId ;
+    Uint32             i ;
+    Uint32             j ;
+
+    TRC_1ENTER ("LDRV_POOL_init", create) ;
+
+    memset (LDRV_POOL_local, 0, sizeof (LDRV_POOL_local)) ;
+    LDRV_POOL_traceOpen () ;
+
+    if (create == TRUE) {
+        LDRV_Obj->compState [LDRV_Comp_Pool] =
+                                 LDRV_drvAlloc (sizeof (LDRV_POOL_Object)) ;
+        if (LDRV_Obj->compState [LDRV_Comp_Pool] == 0u) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        LDRV_POOL_state = (LDRV_POOL_Object *) LDRV_compState (LDRV_Comp_Pool) ;
+        if (create == TRUE) {
+            status = SYNC_HOST_createLock (&LDRV_POOL_state->lock) ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_POOL_ownersOpen (create) ;
+    }
+
+    for (dspId = 0u ; (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ; dspId++) {
+        cfg = LDRV_getDspConfig (dspId) ;
+        memset (offset, 0, sizeof (offset)) ;
+        for (i = 0u ; (i < cfg->numPools) && DSP_SUCCEEDED (status) ; i++) {
+            entry = &(LDRV_POOL_state->pools [dspId][i]) ;
+            local = &(LDRV_POOL_local [dspId][i]) ;
+            if (cfg->poolTable [i].poolMemEntry >= cfg->numMemEntries) {
+                status = DSP_ECONFIG ;
+                SET_FAILURE_REASON ;
+            }
+            else if (create == TRUE) {
+                /* Pools sharing a memory entry are laid out in order. */
+                memEntry = &(cfg->memTable [cfg->poolTable [i].poolMemEntry]) ;
+                if (  offset [cfg->poolTable [i].poolMemEntry]
+                    + cfg->poolTable [i].poolSize > memEntry->size) {
+                    status = DSP_ECONFIG ;
+                    SET_FAILURE_REASON ;
+                }
+                else {
+                    entry->physAddr =   memEntry->physAddr
+                                      + offset [cfg->poolTable [i].poolMemEntry] ;
+                    entry->size     = cfg->poolTable [i].poolSize ;
+                    offset [cfg->poolTable [i].poolMemEntry] += entry->size ;
+                }
+            }
+
+            if (DSP_SUCCEEDED (status)) {
+                for (j = 0u ;
+                     j < (sizeof (LDRV_POOL_allocators) /
+                          sizeof (LDRV_POOL_allocators [0])) ;
+                     j++) {
+                    if (strncmp (cfg->poolTable [i].name,
+                                 LDRV_POOL_allocators [j].name,
+                                 DSP_MAX_STRLEN) == 0) {
+                        local->allocator = &(LDRV_POOL_allocators [j]) ;
+                    }
+                }
+
+                if (local->allocator == NULL) {
+                    status = DSP_ECONFIG ;
+                    SET_FAILURE_REASON ;
+                }
+                else {
+                    status = local->allocator->init (dspId,
+                                                     i,
+                                                     &shDspAddr,
+                                                     &local->object) ;
+                }
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_POOL_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_exit
+ *
+ *  @desc   Finalizes the POOL manager in the calling process.
+ *
+ *  @modif  LDRV_POOL_state, LDRV_POOL_local
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_exit (IN Bool destroy)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_POOL_Local * local ;
+    ProcessorId       dspId ;
+    Uint32            i ;
+
+    TRC_1ENTER ("LDRV_POOL_exit", destroy) ;
+
+    if (LDRV_POOL_state != NULL) {
+        for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+            for (i = 0u ; i < MAX_POOLENTRIES ; i++) {
+                local = &(LDRV_POOL_local [dspId][i]) ;
+                if (local->allocator != NULL) {
+                    if (    (destroy == TRUE)
+                        &&  (LDRV_POOL_state->pools [dspId][i].openCount != 0u)) {
+                        local->allocator->interface->close (dspId,
+                                                            i,
+                                                            local->object) ;
+                        LDRV_POOL_state->pools [dspId][i].openCount = 0u ;
+                    }
+                    local->allocator->exit (dspId, i, local->object) ;
+                    local->allocator = NULL ;
+                }
+            }
+        }
+
+        if (destroy == TRUE) {
+            SYNC_HOST_deleteLock (&LDRV_POOL_state->lock) ;
+        }
+    }
+
+    LDRV_POOL_state = NULL ;
+    LDRV_POOL_ownersClose () ;
+    LDRV_POOL_traceClose () ;
+
+    TRC_1LEAVE ("LDRV_POOL_exit", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_getRegion
+ *
+ *  @desc   Gets the memory region assigned to a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_getRegion (IN  ProcessorId dspId,
+                     IN  Uint32      poolNo,
+                     OUT Uint32 *    physAddr,
+                     OUT Uint32 *    size)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    DBC_Require (physAddr != NULL) ;
+    DBC_Require (size != NULL) ;
+
+    if (    (!IS_VALID_PROCID (dspId))
+        ||  (poolNo >= LDRV_getDspConfig (dspId)->numPools)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *physAddr = LDRV_POOL_state->pools [dspId][poolNo].physAddr ;
+        *size     = LDRV_POOL_state->pools [dspId][poolNo].size ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_open
+ *
+ *  @desc   Opens a pool.
+ *
+ *  @modif  LDRV_POOL_state->pools
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_open (IN PoolId poolId, IN OUT POOL_OpenParams * poolOpenParams)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    ProcessorId       dspId  = POOL_getProcId (poolId) ;
+    Uint32            poolNo = POOL_getPoolNo (poolId) ;
+    LDRV_POOL_Entry * entry ;
+    LDRV_POOL_Local * local ;
+
+    TRC_2ENTER ("LDRV_POOL_open", poolId, poolOpenParams) ;
+
+    DBC_Require (poolOpenParams != NULL) ;
+
+    if (    (!IS_VALID_PROCID (dspId))
+        ||  (poolNo >= LDRV_getDspConfig (dspId)->numPools)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        entry = &(LDRV_POOL_state->pools [dspId][poolNo]) ;
+        local = &(LDRV_POOL_local [dspId][poolNo]) ;
+
+        poolOpenParams->physAddr = entry->physAddr ;
+        poolOpenParams->virtAddr = 0u ;
+        poolOpenParams->dspAddr  = LDRV_phyToDsp (dspId, entry->physAddr) ;
+        poolOpenParams->size     = entry->size ;
+
+        SYNC_HOST_enter (&LDRV_POOL_state->lock) ;
+        if (entry->openCount != 0u) {
+            entry->openCount++ ;
+            status = DSP_SALREADYOPENED ;
+        }
+        else {
+            status = local->allocator->interface->open (dspId,
+                                                        poolNo,
+                                                        local->object,
+                                                        poolOpenParams) ;
+            if (DSP_SUCCEEDED (status)) {
+                entry->openCount = 1u ;
+                entry->generation++ ;
+                if (entry->generation == 0u) {
+                    entry->generation = 1u ;
+                }
+            }
+            else {
+                SET_FAILURE_REASON ;
+            }
+        }
+        SYNC_HOST_leave (&LDRV_POOL_state->lock) ;
+    }
+
+    TRC_1LEAVE ("LDRV_POOL_open", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_close
+ *
+ *  @desc   Closes a pool.
+ *
+ *  @modif  LDRV_POOL_state->pools
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_close (IN PoolId poolId)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    ProcessorId       dspId  = POOL_getProcId (poolId) ;
+    Uint32            poolNo = POOL_getPoolNo (poolId) ;
+    LDRV_POOL_Entry * entry ;
+    LDRV_POOL_Local * local ;
+
+    TRC_1ENTER ("LDRV_POOL_close", poolId) ;
+
+    SYNC_HOST_enter (&LDRV_POOL_state->lock) ;
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        entry = &(LDRV_POOL_state->pools [dspId][poolNo]) ;
+        entry->openCount-- ;
+        if (entry->openCount == 0u) {
+            status = local->allocator->interface->close (dspId,
+                                                         poolNo,
+                                                         local->object) ;
+            if (DSP_SUCCEEDED (status)) {
+                status = DSP_SCLOSED ;
+            }
+        }
+    }
+    SYNC_HOST_leave (&LDRV_POOL_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_POOL_close", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_alloc
+ *
+ *  @desc   Allocates a buffer from a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_alloc (IN PoolId poolId, OUT Pvoid * bufPtr, IN Uint32 size)
+{
+    DSP_STATUS        status ;
+    LDRV_POOL_Local * local ;
+
+    TRC_3ENTER ("LDRV_POOL_alloc", poolId, bufPtr, size) ;
+
+    DBC_Require (bufPtr != NULL) ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = local->allocator->interface->alloc (POOL_getProcId (poolId),
+                                                     POOL_getPoolNo (poolId),
+                                                     local->object,
+                                                     bufPtr,
+                                                     size) ;
+        if (LDRV_POOL_trace.fd >= 0) {
+            if (DSP_SUCCEEDED (status)) {
+                LDRV_POOL_traceRecord (local, poolId, LDRV_POOL_TRACEALLOC,
+                                       *bufPtr, size) ;
+            }
+            else {
+                LDRV_POOL_traceRecord (local, poolId, LDRV_POOL_TRACEFAIL,
+                                       NULL, size) ;
+            }
+        }
+        if (LDRV_POOL_owners != NULL) {
+            if (DSP_SUCCEEDED (status)) {
+                LDRV_POOL_ownerTrack (local, poolId, *bufPtr, size) ;
+            }
+            else if (LDRV_POOL_dump.fd >= 0) {
+                LDRV_POOL_ownerDump (poolId) ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_POOL_alloc", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_free
+ *
+ *  @desc   Frees a buffer to a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_free (IN PoolId poolId, IN Pvoid buf, IN Uint32 size)
+{
+    DSP_STATUS        status ;
+    LDRV_POOL_Local * local ;
+
+    TRC_3ENTER ("LDRV_POOL_free", poolId, buf, size) ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        /* Recorded first: once freed, the buffer may be allocated and traced
+         * again by another thread before this call returns.
+         */
+        if (LDRV_POOL_trace.fd >= 0) {
+            LDRV_POOL_traceRecord (local, poolId, LDRV_POOL_TRACEFREE,
+                                   buf, size) ;
+        }
+        if (LDRV_POOL_owners != NULL) {
+            LDRV_POOL_ownerUntrack (local, poolId, buf) ;
+        }
+        status = local->allocator->interface->free (POOL_getProcId (poolId),
+                                                    POOL_getPoolNo (poolId),
+                                                    local->object,
+                                                    buf,
+                                                    size) ;
+    }
+
+    TRC_1LEAVE ("LDRV_POOL_free", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_allocv
+ *
+ *  @desc   Allocates several buffers of the same size from a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_allocv (IN  PoolId   poolId,
+                  OUT Pvoid *  bufArray,
+                  IN  Uint32   size,
+                  IN  Uint32   numBufs,
+                  OUT Uint32 * numAlloc)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_POOL_Local * local ;
+    POOL_Interface *  interface ;
+    Uint32            i ;
+
+    TRC_5ENTER ("LDRV_POOL_allocv", poolId, bufArray, size, numBufs, numAlloc) ;
+
+    DBC_Require (bufArray != NULL) ;
+    DBC_Require (numAlloc != NULL) ;
+
+    *numAlloc = 0u ;
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        interface = local->allocator->interface ;
+        if (interface->allocv != NULL) {
+            status = interface->allocv (POOL_getProcId (poolId),
+                                        POOL_getPoolNo (poolId),
+                                        local->object,
+                                        bufArray,
+                                        size,
+                                        numBufs,
+                                        numAlloc) ;
+        }
+        else {
+            while (DSP_SUCCEEDED (status) && (*numAlloc < numBufs)) {
+                status = interface->alloc (POOL_getProcId (poolId),
+                                           POOL_getPoolNo (poolId),
+                                           local->object,
+                                           &(bufArray [*numAlloc]),
+                                           size) ;
+                if (DSP_SUCCEEDED (status)) {
+                    (*numAlloc)++ ;
+                }
+            }
+
+            if (*numAlloc != 0u) {
+                status = DSP_SOK ;
+            }
+        }
+
+        if (LDRV_POOL_trace.fd >= 0) {
+            for (i = 0u ; i < *numAlloc ; i++) {
+                LDRV_POOL_traceRecord (local, poolId, LDRV_POOL_TRACEALLOC,
+                                       bufArray [i], size) ;
+            }
+            if (*numAlloc == 0u) {
+                LDRV_POOL_traceRecord (local, poolId, LDRV_POOL_TRACEFAIL,
+                                       NULL, size) ;
+            }
+        }
+        if (LDRV_POOL_owners != NULL) {
+            for (i = 0u ; i < *numAlloc ; i++) {
+                LDRV_POOL_ownerTrack (local, poolId, bufArray [i], size) ;
+            }
+            if ((*numAlloc < numBufs) && (LDRV_POOL_dump.fd >= 0)) {
+                LDRV_POOL_ownerDump (poolId) ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_POOL_allocv", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_freev
+ *
+ *  @desc   Frees several buffers of the same size to a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_freev (IN PoolId   poolId,
+                 IN Pvoid *  bufArray,
+                 IN Uint32   size,
+                 IN Uint32   numBufs)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_POOL_Local * local ;
+    POOL_Interface *  interface ;
+    DSP_STATUS        tmpStatus ;
+    Uint32            i ;
+
+    TRC_4ENTER ("LDRV_POOL_freev", poolId, bufArray, size, numBufs) ;
+
+    DBC_Require (bufArray != NULL) ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        /* Recorded first, as in LDRV_POOL_free. */
+        if (LDRV_POOL_trace.fd >= 0) {
+            for (i = 0u ; i < numBufs ; i++) {
+                LDRV_POOL_traceRecord (local, poolId, LDRV_POOL_TRACEFREE,
+                                       bufArray [i], size) ;
+            }
+        }
+        if (LDRV_POOL_owners != NULL) {
+            for (i = 0u ; i < numBufs ; i++) {
+                LDRV_POOL_ownerUntrack (local, poolId, bufArray [i]) ;
+            }
+        }
+
+        interface = local->allocator->interface ;
+        if (interface->freev != NULL) {
+            status = interface->freev (POOL_getProcId (poolId),
+                                       POOL_getPoolNo (poolId),
+                                       local->object,
+                                       bufArray,
+                                       size,
+                                       numBufs) ;
+        }
+        else {
+            for (i = 0u ; i < numBufs ; i++) {
+                tmpStatus = interface->free (POOL_getProcId (poolId),
+                                             POOL_getPoolNo (poolId),
+                                             local->object,
+                                             bufArray [i],
+                                             size) ;
+                if (DSP_FAILED (tmpStatus)) {
+                    status = tmpStatus ;
+                }
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_POOL_freev", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_generation
+ *
+ *  @desc   Gets the generation of a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_POOL_generation (IN PoolId poolId)
+{
+    Uint32            generation = 0u ;
+    LDRV_POOL_Entry * entry ;
+
+    if (    (LDRV_POOL_state != NULL)
+        &&  (LDRV_POOL_getOpen (poolId) != NULL)) {
+        entry = &(LDRV_POOL_state->pools [POOL_getProcId (poolId)]
+                                         [POOL_getPoolNo (poolId)]) ;
+        generation = entry->generation ;
+    }
+
+    return generation ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_numBufs
+ *
+ *  @desc   Gets the number of buffers of the classes of a pool serving a
+ *          size.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_POOL_numBufs (IN PoolId poolId, IN Uint32 size)
+{
+    Uint32            numBufs = 0u ;
+    LDRV_POOL_Local * local ;
+    POOL_Interface *  interface ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local != NULL) {
+        interface = local->allocator->interface ;
+        if (interface->numBufs != NULL) {
+            numBufs = interface->numBufs (POOL_getProcId (poolId),
+                                          POOL_getPoolNo (poolId),
+                                          local->object,
+                                          size) ;
+        }
+    }
+
+    return numBufs ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_translateAddr
+ *
+ *  @desc   Translates the address of a buffer of a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_translateAddr (IN  PoolId   poolId,
+                         OUT Pvoid *  dstAddr,
+                         IN  AddrType dstAddrType,
+                         IN  Pvoid    srcAddr,
+                         IN  AddrType srcAddrType)
+{
+    DSP_STATUS        status ;
+    LDRV_POOL_Local * local ;
+
+    TRC_5ENTER ("LDRV_POOL_translateAddr",
+                poolId, dstAddr, dstAddrType, srcAddr, srcAddrType) ;
+
+    DBC_Require (dstAddr != NULL) ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = local->allocator->interface->xltBuf (
+                            POOL_getProcId (poolId),
+                            POOL_getPoolNo (poolId),
+                            local->object,
+                            srcAddr,
+                            dstAddr,
+                            (POOL_AddrXltFlag) (    srcAddrType
+                                                | (dstAddrType << 8u))) ;
+    }
+
+    TRC_1LEAVE ("LDRV_POOL_translateAddr", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_writeback
+ *
+ *  @desc   Writes back the content of a buffer of a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_writeback (IN PoolId poolId, IN Pvoid buf, IN Uint32 size)
+{
+    DSP_STATUS        status ;
+    LDRV_POOL_Local * local ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = local->allocator->interface->writeback (
+                                                    POOL_getProcId (poolId),
+                                                    POOL_getPoolNo (poolId),
+                                                    local->object,
+                                                    buf,
+                                                    size) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_invalidate
+ *
+ *  @desc   Invalidates the content of a buffer of a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_invalidate (IN PoolId poolId, IN Pvoid buf, IN Uint32 size)
+{
+    DSP_STATUS        status ;
+    LDRV_POOL_Local * local ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = local->allocator->interface->invalidate (
+                                                    POOL_getProcId (poolId),
+                                                    POOL_getPoolNo (poolId),
+                                                    local->object,
+                                                    buf,
+                                                    size) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_cachev
+ *
+ *  @desc   Writes back or invalidates several ranges of buffers of a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_cachev (IN PoolId            poolId,
+                  IN POOL_CacheOp      op,
+                  IN POOL_CacheRange * ranges,
+                  IN Uint32            numRanges)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_POOL_Local * local ;
+    FnPoolWriteback   fxn ;
+    DSP_STATUS        tmpStatus ;
+    Uint32            i ;
+
+    TRC_4ENTER ("LDRV_POOL_cachev", poolId, op, ranges, numRanges) ;
+
+    DBC_Require ((ranges != NULL) || (numRanges == 0u)) ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        if (op == POOL_CacheOp_Writeback) {
+            fxn = local->allocator->interface->writeback ;
+        }
+        else {
+            fxn = local->allocator->interface->invalidate ;
+        }
+
+        for (i = 0u ; i < numRanges ; i++) {
+            tmpStatus = fxn (POOL_getProcId (poolId),
+                             POOL_getPoolNo (poolId),
+                             local->object,
+                             ranges [i].buf,
+                             ranges [i].size) ;
+            if (DSP_FAILED (tmpStatus)) {
+                status = tmpStatus ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_POOL_cachev", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_reconfigure
+ *
+ *  @desc   Reconfigures an open pool. Reconfigurations are serialized with
+ *          each other and with opens and closes by the lock of the manager.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_reconfigure (IN PoolId poolId, IN Pvoid args)
+{
+    DSP_STATUS        status ;
+    LDRV_POOL_Local * local ;
+
+    TRC_2ENTER ("LDRV_POOL_reconfigure", poolId, args) ;
+
+    SYNC_HOST_enter (&LDRV_POOL_state->lock) ;
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = local->allocator->interface->reconfigure (
+                                                    POOL_getProcId (poolId),
+                                                    POOL_getPoolNo (poolId),
+                                                    local->object,
+                                                    args) ;
+    }
+    SYNC_HOST_leave (&LDRV_POOL_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_POOL_reconfigure", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_getOwners
+ *
+ *  @desc   Gets the owners of the tracked buffers of an open pool, oldest
+ *          first.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_getOwners (IN     PoolId            poolId,
+                     OUT    POOL_OwnerStats * stats,
+                     OUT    POOL_OwnerInfo *  owners,
+                     IN OUT Uint32 *          numOwners)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_POOL_Local * local ;
+
+    TRC_4ENTER ("LDRV_POOL_getOwners", poolId, stats, owners, numOwners) ;
+
+    DBC_Require (stats != NULL) ;
+    DBC_Require (owners != NULL) ;
+    DBC_Require (numOwners != NULL) ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else if (LDRV_POOL_owners == NULL) {
+        status = DSP_ENOTSUPPORTED ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *stats     = LDRV_POOL_owners->stats [POOL_getProcId (poolId)]
+                                             [POOL_getPoolNo (poolId)] ;
+        *numOwners = LDRV_POOL_ownerCollect (poolId, owners, *numOwners) ;
+    }
+
+    TRC_1LEAVE ("LDRV_POOL_getOwners", status) ;
+
+    return status ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_POOL_instrument
+ *
+ *  @desc   Gets the instrumentation information of an open pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_instrument (IN PoolId poolId, OUT SMAPOOL_Stats * retVal)
+{
+    DSP_STATUS        status ;
+    LDRV_POOL_Local * local ;
+
+    DBC_Require (retVal != NULL) ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else if (local->allocator->instrument == NULL) {
+        status = DSP_ENOTSUPPORTED ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = local->allocator->instrument (local->object, retVal) ;
+    }
+
+    return status ;
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_getObject
+ *
+ *  @desc   Gets the allocator object of an open pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_getObject (IN  PoolId            poolId,
+                     OUT POOL_Interface ** interface,
+                     OUT Pvoid *           object)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    LDRV_POOL_Local * local ;
+
+    DBC_Require (interface != NULL) ;
+    DBC_Require (object != NULL) ;
+
+    local = LDRV_POOL_getOpen (poolId) ;
+    if (local == NULL) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *interface = local->allocator->interface ;
+        *object    = local->object ;
+    }
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,769 @@
+/** ============================================================================
+ *  @file   ldrv_pool.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the POOL manager of the host backend.
+ *          Every configured pool is assigned a region of its POOL memory
+ *          entry, in configuration order, and is managed through the
+ *          POOL_Interface of its allocator.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LDRV_POOL_H)
+#define LDRV_POOL_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <pooldefs.h>
+#include <_pooldefs.h>
+
+/*  ----------------------------------- Profiling                   */
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* #if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  LDRV_POOL_TRACE_ENV
+ *
+ *  @desc   Environment variable enabling the allocation trace. When it is set,
+ *          every process appends the allocations and frees of all pools to
+ *          the file named by its value followed by "." and the process id.
+ *  ============================================================================
+ */
+#define LDRV_POOL_TRACE_ENV     "DSPLINK_POOL_TRACE"
+
+/** ============================================================================
+ *  @const  LDRV_POOL_OWNERS_ENV
+ *
+ *  @desc   Environment variable enabling the owner tracking. When it is set
+ *          to a period in the process setting up the link, one allocation
+ *          in period, in every process, records the owner of its buffer
+ *          until the buffer is freed.
+ *  ============================================================================
+ */
+#define LDRV_POOL_OWNERS_ENV    "DSPLINK_POOL_OWNERS"
+
+/** ============================================================================
+ *  @const  LDRV_POOL_OWNERSDUMP_ENV
+ *
+ *  @desc   Environment variable naming where the owners are dumped. When it
+ *          is set and the owner tracking is enabled, a process that fails
+ *          to allocate from a pool appends the owners of the pool to the
+ *          file named by its value followed by "." and the process id, at
+ *          most once a second.
+ *  ============================================================================
+ */
+#define LDRV_POOL_OWNERSDUMP_ENV "DSPLINK_POOL_OWNERS_DUMP"
+
+/** ============================================================================
+ *  @const  LDRV_POOL_TRACEALLOC
+ *
+ *  @desc   Trace record of a buffer allocated.
+ *  ============================================================================
+ */
+#define LDRV_POOL_TRACEALLOC    1u
+
+/** ============================================================================
+ *  @const  LDRV_POOL_TRACEFREE
+ *
+ *  @desc   Trace record of a buffer freed.
+ *  ============================================================================
+ */
+#define LDRV_POOL_TRACEFREE     2u
+
+/** ============================================================================
+ *  @const  LDRV_POOL_TRACEFAIL
+ *
+ *  @desc   Trace record of an allocation that found no buffer.
+ *  ============================================================================
+ */
+#define LDRV_POOL_TRACEFAIL     3u
+
+
+/** ============================================================================
+ *  @name   LDRV_POOL_TraceRecord
+ *
+ *  @desc   Record of the allocation trace.
+ *
+ *  @field  usecs
+ *              CLOCK_MONOTONIC time of the call in microseconds, modulo 2^32.
+ *  @field  physAddr
+ *              Physical address of the buffer, 0 for LDRV_POOL_TRACEFAIL.
+ *              Unlike the address in the calling process, it is the same in
+ *              every process, so a buffer freed by another process than the
+ *              one that allocated it can be matched.
+ *  @field  size
+ *              Size passed to the call.
+ *  @field  poolId
+ *              Pool identifier.
+ *  @field  op
+ *              LDRV_POOL_TRACEALLOC, LDRV_POOL_TRACEFREE or
+ *              LDRV_POOL_TRACEFAIL.
+ *  ============================================================================
+ */
+typedef struct LDRV_POOL_TraceRecord_tag {
+    Uint32  usecs    ;
+    Uint32  physAddr ;
+    Uint32  size     ;
+    Uint16  poolId   ;
+    Uint16  op       ;
+} LDRV_POOL_TraceRecord ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_init
+ *
+ *  @desc   Initializes the POOL manager in the calling process.
+ *
+ *  @arg    create
+ *              TRUE if the shared state is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The driver segment is exhausted.
+ *          DSP_ECONFIG
+ *              The pools do not fit in their memory entries, or a pool uses
+ *              an unknown allocator.
+ *
+ *  @enter  The segments of the link driver are mapped.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_init (IN Bool create) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_exit
+ *
+ *  @desc   Finalizes the POOL manager in the calling process.
+ *
+ *  @arg    destroy
+ *              TRUE if the shared state is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_exit (IN Bool destroy) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_getRegion
+ *
+ *  @desc   Gets the memory region assigned to a pool.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolNo
+ *              Pool number.
+ *  @arg    physAddr
+ *              Location to receive the physical address of the region.
+ *  @arg    size
+ *              Location to receive the size of the region.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The pool is not configured.
+ *
+ *  @enter  LDRV_POOL_init has been called.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_getRegion (IN  ProcessorId dspId,
+                     IN  Uint32      poolNo,
+                     OUT Uint32 *    physAddr,
+                     OUT Uint32 *    size) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_open
+ *
+ *  @desc   Opens a pool. The first open configures the pool with the
+ *          attributes in poolOpenParams->params; later opens only count.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    poolOpenParams
+ *              Attributes of the pool. The region of the pool is returned in
+ *              the other fields.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SALREADYOPENED
+ *              The pool was already open.
+ *          DSP_EINVALIDARG
+ *              The pool is not configured.
+ *          DSP_EMEMORY
+ *              The buffers do not fit in the region of the pool.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_close
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_open (IN PoolId poolId, IN OUT POOL_OpenParams * poolOpenParams) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_close
+ *
+ *  @desc   Closes a pool. The last close releases the pool.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SCLOSED
+ *              The last close has been done.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_open
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_close (IN PoolId poolId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_alloc
+ *
+ *  @desc   Allocates a buffer from a pool.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    bufPtr
+ *              Location to receive the address of the buffer in the calling
+ *              process.
+ *  @arg    size
+ *              Size of the buffer.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              No buffer is available.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_free
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_alloc (IN PoolId poolId, OUT Pvoid * bufPtr, IN Uint32 size) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_free
+ *
+ *  @desc   Frees a buffer to a pool.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    buf
+ *              Address of the buffer in the calling process.
+ *  @arg    size
+ *              Size of the buffer.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The buffer does not belong to the pool.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_alloc
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_free (IN PoolId poolId, IN Pvoid buf, IN Uint32 size) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_allocv
+ *
+ *  @desc   Allocates several buffers of the same size from a pool in one
+ *          call. Fewer buffers than requested may be returned.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    bufArray
+ *              Location to receive the addresses of the buffers in the
+ *              calling process.
+ *  @arg    size
+ *              Size of the buffers.
+ *  @arg    numBufs
+ *              Number of buffers requested.
+ *  @arg    numAlloc
+ *              Location to receive the number of buffers allocated.
+ *
+ *  @ret    DSP_SOK
+ *              At least one buffer has been allocated.
+ *          DSP_EMEMORY
+ *              No buffer is available.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *          bufArray and numAlloc are valid pointers.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_freev
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_allocv (IN  PoolId   poolId,
+                  OUT Pvoid *  bufArray,
+                  IN  Uint32   size,
+                  IN  Uint32   numBufs,
+                  OUT Uint32 * numAlloc) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_freev
+ *
+ *  @desc   Frees several buffers of the same size to a pool in one call.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    bufArray
+ *              Addresses of the buffers in the calling process.
+ *  @arg    size
+ *              Size of the buffers.
+ *  @arg    numBufs
+ *              Number of buffers.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              A buffer does not belong to the pool. The other buffers have
+ *              been freed.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *          bufArray is a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_allocv
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_freev (IN PoolId   poolId,
+                 IN Pvoid *  bufArray,
+                 IN Uint32   size,
+                 IN Uint32   numBufs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_generation
+ *
+ *  @desc   Gets the generation of a pool, which changes every time the pool
+ *          is created by its first open. Buffers kept aside by the caller
+ *          belong to the pool only as long as its generation is unchanged.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *
+ *  @ret    Generation of the pool, 0 if the pool is not open.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_open
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_POOL_generation (IN PoolId poolId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_numBufs
+ *
+ *  @desc   Gets the number of buffers, free or not, of the classes of a pool
+ *          serving a size.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    size
+ *              Size of the buffers.
+ *
+ *  @ret    Number of buffers, 0 if the pool is not open or does not tell.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_allocv
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+LDRV_POOL_numBufs (IN PoolId poolId, IN Uint32 size) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_translateAddr
+ *
+ *  @desc   Translates the address of a buffer of a pool.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    dstAddr
+ *              Location to receive the translated address.
+ *  @arg    dstAddrType
+ *              Type of the translated address.
+ *  @arg    srcAddr
+ *              Address to be translated.
+ *  @arg    srcAddrType
+ *              Type of the address to be translated.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ETRANSLATE
+ *              The address does not belong to the pool.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_translateAddr (IN  PoolId   poolId,
+                         OUT Pvoid *  dstAddr,
+                         IN  AddrType dstAddrType,
+                         IN  Pvoid    srcAddr,
+                         IN  AddrType srcAddrType) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_writeback
+ *
+ *  @desc   Writes back the content of a buffer of a pool.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    buf
+ *              Address of the buffer in the calling process.
+ *  @arg    size
+ *              Number of bytes to write back.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_invalidate
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_writeback (IN PoolId poolId, IN Pvoid buf, IN Uint32 size) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_invalidate
+ *
+ *  @desc   Invalidates the content of a buffer of a pool.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    buf
+ *              Address of the buffer in the calling process.
+ *  @arg    size
+ *              Number of bytes to invalidate.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_writeback
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_invalidate (IN PoolId poolId, IN Pvoid buf, IN Uint32 size) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_cachev
+ *
+ *  @desc   Writes back or invalidates several ranges of buffers of a pool,
+ *          one cache operation per range.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    op
+ *              Cache operation.
+ *  @arg    ranges
+ *              Ranges, with addresses in the calling process.
+ *  @arg    numRanges
+ *              Number of ranges.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *          DSP_ERANGE
+ *              A range is outside the pool. The other ranges have been
+ *              maintained.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_POOL_writeback, LDRV_POOL_invalidate
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_cachev (IN PoolId            poolId,
+                  IN POOL_CacheOp      op,
+                  IN POOL_CacheRange * ranges,
+                  IN Uint32            numRanges) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_reconfigure
+ *
+ *  @desc   Reconfigures an open pool, serialized with the other
+ *          reconfigurations, opens and closes of pools.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    args
+ *              Allocator-specific arguments.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTSUPPORTED
+ *              The allocator cannot be reconfigured.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_reconfigure (IN PoolId poolId, IN Pvoid args) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_getOwners
+ *
+ *  @desc   Gets the owners of the tracked buffers of an open pool, oldest
+ *          first.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    stats
+ *              Location to receive the counters of the tracking.
+ *  @arg    owners
+ *              Location to receive the owners.
+ *  @arg    numOwners
+ *              On entry, number of owners the location can hold. On exit,
+ *              number of owners retrieved.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTSUPPORTED
+ *              The owner tracking is not enabled.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_getOwners (IN     PoolId            poolId,
+                     OUT    POOL_OwnerStats * stats,
+                     OUT    POOL_OwnerInfo *  owners,
+                     IN OUT Uint32 *          numOwners) ;
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_POOL_instrument
+ *
+ *  @desc   Gets the instrumentation information of an open pool.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    retVal
+ *              Location to receive the instrumentation information.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTSUPPORTED
+ *              The allocator does not provide instrumentation information.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *          retVal must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_instrument (IN PoolId poolId, OUT SMAPOOL_Stats * retVal) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+
+/** ============================================================================
+ *  @func   LDRV_POOL_getObject
+ *
+ *  @desc   Gets the allocator object of an open pool.
+ *
+ *  @arg    poolId
+ *              Pool identifier.
+ *  @arg    interface
+ *              Location to receive the interface of the allocator.
+ *  @arg    object
+ *              Location to receive the allocator object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  LDRV_POOL_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_POOL_getObject (IN  PoolId            poolId,
+                     OUT POOL_Interface ** interface,
+                     OUT Pvoid *           object) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LDRV_POOL_H) */
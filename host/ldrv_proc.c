@@ -0,0 +1,887 @@
+/** ============================================================================
+ *  @file   ldrv_proc.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the processor manager of the host loopback
+ *          backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <_linkdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_proc.h>
+#include <ldrv_ips.h>
+#include <loopdsp.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_PROC, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @name   LDRV_PROC_DspState
+ *
+ *  @desc   Shared state of one DSP.
+ *
+ *  @field  state
+ *              Current state of the DSP.
+ *  @field  attachCount
+ *              Number of processes attached to the DSP.
+ *  @field  starterSlot
+ *              Slot of the process running the DSP.
+ *  @field  stats
+ *              Statistics updated by the link drivers.
+ *  ============================================================================
+ */
+typedef struct LDRV_PROC_DspState_tag {
+    PROC_State   state       ;
+    Uint32       attachCount ;
+    Uint32       starterSlot ;
+#if defined (DDSP_PROFILE)
+    DSP_Stats    stats       ;
+#endif /* if defined (DDSP_PROFILE) */
+} LDRV_PROC_DspState ;
+
+/*  ============================================================================
+ *  @name   LDRV_PROC_Object
+ *
+ *  @desc   Private state of the processor manager in the driver segment.
+ *
+ *  @field  lock
+ *              Lock protecting the state of the DSPs.
+ *  @field  dspState
+ *              State of every DSP.
+ *  ============================================================================
+ */
+typedef struct LDRV_PROC_Object_tag {
+    SYNC_HostLock       lock ;
+    LDRV_PROC_DspState  dspState [MAX_DSPS] ;
+} LDRV_PROC_Object ;
+
+/*  ============================================================================
+ *  @name   LDRV_PROC_DspInterface
+ *
+ *  @desc   Maps the name of a DSP in the configuration to its interface.
+ *
+ *  @field  name
+ *              Name of the DSP.
+ *  @field  interface
+ *              Interface of the DSP.
+ *  ============================================================================
+ */
+typedef struct LDRV_PROC_DspInterface_tag {
+    Char8 *          name      ;
+    DSP_Interface *  interface ;
+} LDRV_PROC_DspInterface ;
+
+
+/*  ============================================================================
+ *  @name   LDRV_PROC_dspInterfaces
+ *
+ *  @desc   DSPs supported by the host backend.
+ *  ============================================================================
+ */
+STATIC LDRV_PROC_DspInterface LDRV_PROC_dspInterfaces [] = {
+    { "LOOPDSP", &LOOPDSP_Interface }
+} ;
+
+/*  ============================================================================
+ *  @name   LDRV_PROC_state
+ *
+ *  @desc   Private state of the processor manager in the driver segment.
+ *  ============================================================================
+ */
+STATIC LDRV_PROC_Object * LDRV_PROC_state = NULL ;
+
+/*  ============================================================================
+ *  @name   LDRV_PROC_dspObjects
+ *
+ *  @desc   DSP objects in the calling process.
+ *  ============================================================================
+ */
+STATIC DSP_Object LDRV_PROC_dspObjects [MAX_DSPS] ;
+
+/*  ============================================================================
+ *  @name   LDRV_PROC_attached
+ *
+ *  @desc   Attach state of the calling process for every DSP.
+ *  ============================================================================
+ */
+STATIC Bool LDRV_PROC_attached [MAX_DSPS] ;
+
+
+/*  ============================================================================
+ *  @func   LDRV_PROC_isLoaded
+ *
+ *  @desc   Checks whether a DSP has an executable loaded.
+ *
+ *  @arg    state
+ *              State of the DSP.
+ *
+ *  @ret    TRUE/FALSE
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Bool
+LDRV_PROC_isLoaded (IN PROC_State state)
+{
+    return (    (state == ProcState_Loaded)
+            ||  (state == ProcState_Started)
+            ||  (state == ProcState_Stopped)
+            ||  (state == ProcState_Idle)) ? TRUE : FALSE ;
+}
+
+
+/*  ============================================================================
+ *  @func   LDRV_PROC_stopDsp
+ *
+ *  @desc   Stops the DSP. Called with the lock held.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LDRV_PROC_stopDsp (IN ProcessorId procId)
+{
+    DSP_Object * dspObj = &(LDRV_PROC_dspObjects [procId]) ;
+
+    LDRV_PROC_state->dspState [procId].state = ProcState_Stopped ;
+    return dspObj->interface->stop (procId, dspObj) ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_init
+ *
+ *  @desc   Initializes the processor manager in the calling process.
+ *
+ *  @modif  LDRV_PROC_state, LDRV_PROC_dspObjects
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_init (IN Bool create)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_DspConfig * cfg ;
+    ProcessorId      procId ;
+    Uint32           i ;
+
+    TRC_1ENTER ("LDRV_PROC_init", create) ;
+
+    if (create == TRUE) {
+        LDRV_Obj->compState [LDRV_Comp_Proc] =
+                                 LDRV_drvAlloc (sizeof (LDRV_PROC_Object)) ;
+        if (LDRV_Obj->compState [LDRV_Comp_Proc] == 0u) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        LDRV_PROC_state = (LDRV_PROC_Object *)
+                                         LDRV_compState (LDRV_Comp_Proc) ;
+        if (create == TRUE) {
+            status = SYNC_HOST_createLock (&LDRV_PROC_state->lock) ;
+            for (procId = 0u ; procId < MAX_DSPS ; procId++) {
+                LDRV_PROC_state->dspState [procId].state = ProcState_Setup ;
+            }
+        }
+    }
+
+    for (procId = 0u ; (procId < MAX_DSPS) && DSP_SUCCEEDED (status) ; procId++) {
+        cfg = LDRV_getDspConfig (procId) ;
+        LDRV_PROC_attached [procId] = FALSE ;
+        LDRV_PROC_dspObjects [procId].dspId     = procId ;
+        LDRV_PROC_dspObjects [procId].interface = NULL ;
+        for (i = 0u ;
+             i < (sizeof (LDRV_PROC_dspInterfaces) /
+                  sizeof (LDRV_PROC_dspInterfaces [0])) ;
+             i++) {
+            if (strncmp (cfg->dspObject.name,
+                         LDRV_PROC_dspInterfaces [i].name,
+                         DSP_MAX_STRLEN) == 0) {
+                LDRV_PROC_dspObjects [procId].interface =
+                                          LDRV_PROC_dspInterfaces [i].interface ;
+            }
+        }
+
+        if (LDRV_PROC_dspObjects [procId].interface == NULL) {
+            status = DSP_ECONFIG ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            status = LDRV_PROC_dspObjects [procId].interface->init (
+                                             procId,
+                                             &(LDRV_PROC_dspObjects [procId])) ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_PROC_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_exit
+ *
+ *  @desc   Finalizes the processor manager in the calling process.
+ *
+ *  @modif  LDRV_PROC_state, LDRV_PROC_dspObjects
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_exit (IN Bool destroy)
+{
+    DSP_STATUS           status = DSP_SOK ;
+    LDRV_PROC_DspState * dspState ;
+    DSP_Object *         dspObj ;
+    ProcessorId          procId ;
+
+    TRC_1ENTER ("LDRV_PROC_exit", destroy) ;
+
+    if (LDRV_PROC_state != NULL) {
+        LDRV_PROC_cleanup () ;
+
+        SYNC_HOST_enter (&LDRV_PROC_state->lock) ;
+        for (procId = 0u ; procId < MAX_DSPS ; procId++) {
+            dspState = &(LDRV_PROC_state->dspState [procId]) ;
+            dspObj   = &(LDRV_PROC_dspObjects [procId]) ;
+            if (LDRV_PROC_attached [procId] == TRUE) {
+                dspState->attachCount-- ;
+                LDRV_PROC_attached [procId] = FALSE ;
+            }
+
+            if (dspObj->interface != NULL) {
+                dspObj->interface->exit (procId, dspObj) ;
+                dspObj->interface = NULL ;
+            }
+        }
+        SYNC_HOST_leave (&LDRV_PROC_state->lock) ;
+
+        if (destroy == TRUE) {
+            SYNC_HOST_deleteLock (&LDRV_PROC_state->lock) ;
+        }
+    }
+
+    LDRV_PROC_state = NULL ;
+
+    TRC_1LEAVE ("LDRV_PROC_exit", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_cleanup
+ *
+ *  @desc   Stops the DSPs run by the calling process.
+ *
+ *  @modif  LDRV_PROC_state->dspState
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_PROC_cleanup (Void)
+{
+    LDRV_PROC_DspState * dspState ;
+    ProcessorId          procId ;
+
+    TRC_0ENTER ("LDRV_PROC_cleanup") ;
+
+    SYNC_HOST_enter (&LDRV_PROC_state->lock) ;
+    for (procId = 0u ; procId < MAX_DSPS ; procId++) {
+        dspState = &(LDRV_PROC_state->dspState [procId]) ;
+        if (    (dspState->state == ProcState_Started)
+            &&  (dspState->starterSlot == LDRV_procSlot ())) {
+            /* The DSP thread cannot outlive the process running it. */
+            LDRV_PROC_stopDsp (procId) ;
+        }
+    }
+    SYNC_HOST_leave (&LDRV_PROC_state->lock) ;
+
+    TRC_0LEAVE ("LDRV_PROC_cleanup") ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_attach
+ *
+ *  @desc   Attaches the calling process to a DSP.
+ *
+ *  @modif  LDRV_PROC_attached
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_attach (IN ProcessorId procId, IN OPT PROC_Attrs * attr)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_2ENTER ("LDRV_PROC_attach", procId, attr) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+
+    (Void) attr ;
+
+    SYNC_HOST_enter (&LDRV_PROC_state->lock) ;
+    if (LDRV_PROC_attached [procId] == TRUE) {
+        status = DSP_SALREADYATTACHED ;
+    }
+    else {
+        LDRV_PROC_attached [procId] = TRUE ;
+        LDRV_PROC_state->dspState [procId].attachCount++ ;
+    }
+    SYNC_HOST_leave (&LDRV_PROC_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_PROC_attach", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_detach
+ *
+ *  @desc   Detaches the calling process from a DSP.
+ *
+ *  @modif  LDRV_PROC_attached
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_detach (IN ProcessorId procId)
+{
+    DSP_STATUS           status = DSP_SOK ;
+    LDRV_PROC_DspState * dspState ;
+
+    TRC_1ENTER ("LDRV_PROC_detach", procId) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+
+    SYNC_HOST_enter (&LDRV_PROC_state->lock) ;
+    dspState = &(LDRV_PROC_state->dspState [procId]) ;
+    if (LDRV_PROC_attached [procId] != TRUE) {
+        status = DSP_EATTACHED ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        LDRV_PROC_attached [procId] = FALSE ;
+        dspState->attachCount-- ;
+        if (dspState->attachCount == 0u) {
+            if (dspState->state == ProcState_Started) {
+                LDRV_PROC_stopDsp (procId) ;
+            }
+            dspState->state = ProcState_Setup ;
+            status = DSP_SDETACHED ;
+        }
+    }
+    SYNC_HOST_leave (&LDRV_PROC_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_PROC_detach", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_isAttached
+ *
+ *  @desc   Checks whether the calling process is attached to a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_PROC_isAttached (IN ProcessorId procId)
+{
+    return (IS_VALID_PROCID (procId) && (LDRV_PROC_attached [procId] == TRUE)) ?
+           TRUE : FALSE ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_isLastDetach
+ *
+ *  @desc   Checks whether the calling process is the last one attached to a
+ *          DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_PROC_isLastDetach (IN ProcessorId procId)
+{
+    Bool lastDetach ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+
+    SYNC_HOST_enter (&LDRV_PROC_state->lock) ;
+    lastDetach = (    (LDRV_PROC_attached [procId] == TRUE)
+                  &&  (LDRV_PROC_state->dspState [procId].attachCount == 1u)) ?
+                 TRUE : FALSE ;
+    SYNC_HOST_leave (&LDRV_PROC_state->lock) ;
+
+    return lastDetach ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_load
+ *
+ *  @desc   Loads an executable on a DSP.
+ *
+ *  @modif  LDRV_PROC_state->dspState [procId]
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_load (IN     ProcessorId procId,
+                IN     Char8 *     imagePath,
+                IN     Uint32      argc,
+                IN OPT Char8 **    argv)
+{
+    DSP_STATUS           status = DSP_SOK ;
+    LDRV_PROC_DspState * dspState ;
+
+    TRC_4ENTER ("LDRV_PROC_load", procId, imagePath, argc, argv) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (imagePath != NULL) ;
+
+    SYNC_HOST_enter (&LDRV_PROC_state->lock) ;
+    dspState = &(LDRV_PROC_state->dspState [procId]) ;
+    if (LDRV_PROC_attached [procId] != TRUE) {
+        status = DSP_EACCESSDENIED ;
+        SET_FAILURE_REASON ;
+    }
+    else if (dspState->state == ProcState_Started) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        dspState->state = ProcState_Loaded ;
+    }
+    SYNC_HOST_leave (&LDRV_PROC_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_PROC_load", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_start
+ *
+ *  @desc   Starts a DSP.
+ *
+ *  @modif  LDRV_PROC_state->dspState [procId]
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_start (IN ProcessorId procId)
+{
+    DSP_STATUS           status = DSP_SOK ;
+    LDRV_PROC_DspState * dspState ;
+    DSP_Object *         dspObj ;
+
+    TRC_1ENTER ("LDRV_PROC_start", procId) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+
+    SYNC_HOST_enter (&LDRV_PROC_state->lock) ;
+    dspState = &(LDRV_PROC_state->dspState [procId]) ;
+    dspObj   = &(LDRV_PROC_dspObjects [procId]) ;
+    if (dspState->state == ProcState_Started) {
+        status = DSP_SALREADYSTARTED ;
+    }
+    else if (    (dspState->state != ProcState_Loaded)
+             &&  (dspState->state != ProcState_Stopped)) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = dspObj->interface->start (procId, dspObj, 0u) ;
+        if (DSP_SUCCEEDED (status)) {
+            dspState->starterSlot = LDRV_procSlot () ;
+            dspState->state       = ProcState_Started ;
+        }
+        else {
+            SET_FAILURE_REASON ;
+        }
+    }
+    SYNC_HOST_leave (&LDRV_PROC_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_PROC_start", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_stop
+ *
+ *  @desc   Stops a DSP.
+ *
+ *  @modif  LDRV_PROC_state->dspState [procId]
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_stop (IN ProcessorId procId)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_1ENTER ("LDRV_PROC_stop", procId) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+
+    SYNC_HOST_enter (&LDRV_PROC_state->lock) ;
+    if (LDRV_PROC_state->dspState [procId].state != ProcState_Started) {
+        status = DSP_SSTOPPED ;
+    }
+    else {
+        status = LDRV_PROC_stopDsp (procId) ;
+    }
+    SYNC_HOST_leave (&LDRV_PROC_state->lock) ;
+
+    TRC_1LEAVE ("LDRV_PROC_stop", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_getState
+ *
+ *  @desc   Gets the state of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_getState (IN ProcessorId procId, OUT PROC_State * procState)
+{
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (procState != NULL) ;
+
+    *procState = LDRV_PROC_state->dspState [procId].state ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_isStarted
+ *
+ *  @desc   Checks whether a DSP is running.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_PROC_isStarted (IN ProcessorId procId)
+{
+    return (    IS_VALID_PROCID (procId)
+            &&  (LDRV_PROC_state != NULL)
+            &&  (   LDRV_PROC_state->dspState [procId].state
+                 == ProcState_Started)) ? TRUE : FALSE ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_read
+ *
+ *  @desc   Reads from the memory of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_read (IN  ProcessorId procId,
+                IN  Uint32      dspAddr,
+                IN  Uint32      numBytes,
+                OUT Pvoid       buffer)
+{
+    DSP_STATUS   status = DSP_SOK ;
+    DSP_Object * dspObj ;
+
+    TRC_4ENTER ("LDRV_PROC_read", procId, dspAddr, numBytes, buffer) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (buffer != NULL) ;
+
+    if (LDRV_PROC_isLoaded (LDRV_PROC_state->dspState [procId].state) == FALSE) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        dspObj = &(LDRV_PROC_dspObjects [procId]) ;
+        status = dspObj->interface->read (procId,
+                                          dspObj,
+                                          dspAddr,
+                                          Endianism_Default,
+                                          numBytes,
+                                          (Uint8 *) buffer) ;
+    }
+
+    TRC_1LEAVE ("LDRV_PROC_read", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_write
+ *
+ *  @desc   Writes to the memory of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_write (IN ProcessorId procId,
+                 IN Uint32      dspAddr,
+                 IN Uint32      numBytes,
+                 IN Pvoid       buffer)
+{
+    DSP_STATUS   status = DSP_SOK ;
+    DSP_Object * dspObj ;
+
+    TRC_4ENTER ("LDRV_PROC_write", procId, dspAddr, numBytes, buffer) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (buffer != NULL) ;
+
+    if (LDRV_PROC_isLoaded (LDRV_PROC_state->dspState [procId].state) == FALSE) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        dspObj = &(LDRV_PROC_dspObjects [procId]) ;
+        status = dspObj->interface->write (procId,
+                                           dspObj,
+                                           dspAddr,
+                                           Endianism_Default,
+                                           numBytes,
+                                           (Uint8 *) buffer) ;
+    }
+
+    TRC_1LEAVE ("LDRV_PROC_write", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_getSymbolAddress
+ *
+ *  @desc   Gets the DSP address of a symbol of the loaded executable.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_getSymbolAddress (IN  ProcessorId procId,
+                            IN  Char8 *     symbolName,
+                            OUT Uint32 *    dspAddr)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_DspConfig * cfg ;
+
+    TRC_3ENTER ("LDRV_PROC_getSymbolAddress", procId, symbolName, dspAddr) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (symbolName != NULL) ;
+    DBC_Require (dspAddr != NULL) ;
+
+    cfg = LDRV_getDspConfig (procId) ;
+    if (LDRV_PROC_isLoaded (LDRV_PROC_state->dspState [procId].state) == FALSE) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else if (strcmp (symbolName, DRV_SHMBASESYMBOL) == 0) {
+        *dspAddr = cfg->memTable [cfg->linkDrv.memEntry].dspVirtAddr ;
+    }
+    else {
+        status = DSP_ENOTFOUND ;
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("LDRV_PROC_getSymbolAddress", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_control
+ *
+ *  @desc   Platform-specific control of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_control (IN ProcessorId procId, IN Int32 cmd, IN OPT Pvoid arg)
+{
+    DSP_Object * dspObj ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+
+    dspObj = &(LDRV_PROC_dspObjects [procId]) ;
+    return dspObj->interface->control (procId, dspObj, cmd, arg) ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_PROC_getStats
+ *
+ *  @desc   Gets the shared statistics of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_Stats *
+LDRV_PROC_getStats (IN ProcessorId procId)
+{
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+
+    return &(LDRV_PROC_state->dspState [procId].stats) ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_instrument
+ *
+ *  @desc   Gets the instrumentation information of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_instrument (IN ProcessorId procId, OUT PROC_Instrument * retVal)
+{
+    LDRV_PROC_DspState * dspState ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (retVal != NULL) ;
+
+    dspState = &(LDRV_PROC_state->dspState [procId]) ;
+    retVal->procId      = procId ;
+    retVal->active      = (dspState->state == ProcState_Started) ? TRUE : FALSE ;
+    retVal->dataToDsp   = dspState->stats.dataGppToDsp ;
+    retVal->dataFromDsp = dspState->stats.dataDspToGpp ;
+    retVal->intsToDsp   = dspState->stats.intsGppToDsp ;
+    retVal->intsFromDsp = dspState->stats.intsDspToGpp ;
+    retVal->activeLinks = dspState->attachCount ;
+
+    return DSP_SOK ;
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
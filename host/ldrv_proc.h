@@ -0,0 +1,568 @@
+/** ============================================================================
+ *  @file   ldrv_proc.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the processor manager of the host
+ *          loopback backend. The state of every DSP is kept in the driver
+ *          segment and shared by all the attached processes; the emulated DSP
+ *          runs as a thread of the process that started it.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LDRV_PROC_H)
+#define LDRV_PROC_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <procdefs.h>
+#include <_dspdefs.h>
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_init
+ *
+ *  @desc   Initializes the processor manager in the calling process.
+ *
+ *  @arg    create
+ *              TRUE if the shared state is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The driver segment is exhausted.
+ *          DSP_ECONFIG
+ *              The configured DSP is not supported.
+ *
+ *  @enter  The segments of the link driver are mapped.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_init (IN Bool create) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_exit
+ *
+ *  @desc   Finalizes the processor manager in the calling process. A DSP
+ *          started by the calling process is stopped.
+ *
+ *  @arg    destroy
+ *              TRUE if the shared state is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_exit (IN Bool destroy) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_cleanup
+ *
+ *  @desc   Stops the DSPs run by the calling process.
+ *
+ *  @arg    None
+ *
+ *  @ret    None
+ *
+ *  @enter  LDRV_PROC_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_exit
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_PROC_cleanup (Void) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_attach
+ *
+ *  @desc   Attaches the calling process to a DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    attr
+ *              Attributes of the DSP, ignored by the host backend.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SALREADYATTACHED
+ *              The calling process is already attached.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_detach
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_attach (IN ProcessorId procId, IN OPT PROC_Attrs * attr) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_detach
+ *
+ *  @desc   Detaches the calling process from a DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SDETACHED
+ *              The last process has detached.
+ *          DSP_EATTACHED
+ *              The calling process is not attached.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_attach
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_detach (IN ProcessorId procId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_isAttached
+ *
+ *  @desc   Checks whether the calling process is attached to a DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *
+ *  @ret    TRUE/FALSE
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_attach
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_PROC_isAttached (IN ProcessorId procId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_isLastDetach
+ *
+ *  @desc   Checks whether the calling process is the last one attached to a
+ *          DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *
+ *  @ret    TRUE/FALSE
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_detach
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_PROC_isLastDetach (IN ProcessorId procId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_load
+ *
+ *  @desc   Loads an executable on a DSP. The emulated DSP runs the same
+ *          loopback program whatever the executable, so only the state of
+ *          the DSP is changed.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    imagePath
+ *              Path of the executable.
+ *  @arg    argc
+ *              Number of arguments.
+ *  @arg    argv
+ *              Arguments.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EACCESSDENIED
+ *              The calling process is not attached.
+ *          DSP_EWRONGSTATE
+ *              The DSP is running.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_start
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_load (IN     ProcessorId procId,
+                IN     Char8 *     imagePath,
+                IN     Uint32      argc,
+                IN OPT Char8 **    argv) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_start
+ *
+ *  @desc   Starts a DSP. The emulated DSP runs in the calling process.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SALREADYSTARTED
+ *              The DSP is already running.
+ *          DSP_EWRONGSTATE
+ *              No executable is loaded.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_stop
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_start (IN ProcessorId procId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_stop
+ *
+ *  @desc   Stops a DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_SSTOPPED
+ *              The DSP is already stopped.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_start
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_stop (IN ProcessorId procId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_getState
+ *
+ *  @desc   Gets the state of a DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    procState
+ *              Location to receive the state.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_getState (IN ProcessorId procId, OUT PROC_State * procState) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_isStarted
+ *
+ *  @desc   Checks whether a DSP is running.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *
+ *  @ret    TRUE/FALSE
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_start
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_PROC_isStarted (IN ProcessorId procId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_read
+ *
+ *  @desc   Reads from the memory of a DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    dspAddr
+ *              DSP address to read from.
+ *  @arg    numBytes
+ *              Number of bytes to read.
+ *  @arg    buffer
+ *              Buffer to receive the data.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EWRONGSTATE
+ *              No executable is loaded.
+ *          DSP_ERANGE
+ *              The range is not mapped.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_write
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_read (IN  ProcessorId procId,
+                IN  Uint32      dspAddr,
+                IN  Uint32      numBytes,
+                OUT Pvoid       buffer) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_write
+ *
+ *  @desc   Writes to the memory of a DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    dspAddr
+ *              DSP address to write to.
+ *  @arg    numBytes
+ *              Number of bytes to write.
+ *  @arg    buffer
+ *              Data to be written.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EWRONGSTATE
+ *              No executable is loaded.
+ *          DSP_ERANGE
+ *              The range is not mapped.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_read
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_write (IN ProcessorId procId,
+                 IN Uint32      dspAddr,
+                 IN Uint32      numBytes,
+                 IN Pvoid       buffer) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_getSymbolAddress
+ *
+ *  @desc   Gets the DSP address of a symbol of the loaded executable. Only
+ *          the symbols known to the link driver are resolved.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    symbolName
+ *              Name of the symbol.
+ *  @arg    dspAddr
+ *              Location to receive the address.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The symbol is unknown.
+ *          DSP_EWRONGSTATE
+ *              No executable is loaded.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_getSymbolAddress (IN  ProcessorId procId,
+                            IN  Char8 *     symbolName,
+                            OUT Uint32 *    dspAddr) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_control
+ *
+ *  @desc   Platform-specific control of a DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    cmd
+ *              Command identifier.
+ *  @arg    arg
+ *              Argument of the command.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTSUPPORTED
+ *              The command is not supported.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_control (IN ProcessorId procId, IN Int32 cmd, IN OPT Pvoid arg) ;
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   LDRV_PROC_getStats
+ *
+ *  @desc   Gets the shared statistics of a DSP, updated by the link drivers.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *
+ *  @ret    Pointer to the statistics.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_instrument
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_Stats *
+LDRV_PROC_getStats (IN ProcessorId procId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_PROC_instrument
+ *
+ *  @desc   Gets the instrumentation information of a DSP.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    retVal
+ *              Location to receive the instrumentation information.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  procId is valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_PROC_getStats
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_PROC_instrument (IN ProcessorId procId, OUT PROC_Instrument * retVal) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LDRV_PROC_H) */
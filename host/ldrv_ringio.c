@@ -0,0 +1,297 @@
+/** ============================================================================
+ *  @file   ldrv_ringio.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the RingIO manager of the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <_ringiodefs.h>
+#include <ringiodefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_ringio.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_RINGIO, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @name   LDRV_RINGIO_Object
+ *
+ *  @desc   Private state of the RingIO manager in the driver segment.
+ *
+ *  @field  regionPhys
+ *              Physical address of the control region of each DSP, 0 if
+ *              none is configured.
+ *  @field  regionSize
+ *              Size of the control region of each DSP.
+ *  ============================================================================
+ */
+typedef struct LDRV_RINGIO_Object_tag {
+    Uint32  regionPhys [MAX_DSPS] ;
+    Uint32  regionSize [MAX_DSPS] ;
+} LDRV_RINGIO_Object ;
+
+
+/*  ============================================================================
+ *  @name   LDRV_RINGIO_state
+ *
+ *  @desc   Private state of the RingIO manager in the driver segment.
+ *  ============================================================================
+ */
+STATIC LDRV_RINGIO_Object * LDRV_RINGIO_state = NULL ;
+
+
+/** ============================================================================
+ *  @func   LDRV_RINGIO_init
+ *
+ *  @desc   Initializes the RingIO manager in the calling process.
+ *
+ *  @modif  LDRV_RINGIO_state
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_RINGIO_init (IN Bool create)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    LDRV_RINGIO_Object * ringIoState ;
+    LINKCFG_RingIo *     ringIoObject ;
+    RingIO_Ctrl *        ctrl ;
+    ProcessorId        dspId ;
+    Uint32             size ;
+
+    TRC_1ENTER ("LDRV_RINGIO_init", create) ;
+
+    if (create == TRUE) {
+        LDRV_Obj->compState [LDRV_Comp_RingIo] =
+                                  LDRV_drvAlloc (sizeof (LDRV_RINGIO_Object)) ;
+        ringIoState = (LDRV_RINGIO_Object *) LDRV_compState (LDRV_Comp_RingIo) ;
+        if (ringIoState == NULL) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+
+        for (dspId = 0u ;
+             (dspId < MAX_DSPS) && DSP_SUCCEEDED (status) ;
+             dspId++) {
+            ringIoObject = &(LDRV_getDspConfig (dspId)->ringIoObject) ;
+            if (ringIoObject->maxEntries == 0u) {
+                continue ;
+            }
+
+            size   =  sizeof (RingIO_Ctrl)
+                    + (ringIoObject->maxEntries * sizeof (RingIO_Entry)) ;
+            status = LDRV_SMM_alloc (dspId,
+                                     size,
+                                     &ringIoState->regionPhys [dspId]) ;
+            if (DSP_SUCCEEDED (status)) {
+                ringIoState->regionSize [dspId] = size ;
+                ctrl = (RingIO_Ctrl *) LDRV_phyToUsr (
+                                               dspId,
+                                               ringIoState->regionPhys [dspId]) ;
+                memset (ctrl, 0, size) ;
+                ctrl->dspId        = dspId ;
+                ctrl->maxEntries   = ringIoObject->maxEntries ;
+                ctrl->ipsId        = ringIoObject->ipsId ;
+                ctrl->ipsEventNo   = ringIoObject->ipsEventNo ;
+                ctrl->dspAddrEntry = (RingIO_Entry *) LDRV_UINT32_TO_PTR (
+                              LDRV_phyToDsp (dspId,
+                                               ringIoState->regionPhys [dspId]
+                                             + sizeof (RingIO_Ctrl))) ;
+                ctrl->isInitialized = TRUE ;
+            }
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        LDRV_RINGIO_state = (LDRV_RINGIO_Object *) LDRV_compState (LDRV_Comp_RingIo) ;
+    }
+
+    TRC_1LEAVE ("LDRV_RINGIO_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_RINGIO_exit
+ *
+ *  @desc   Finalizes the RingIO manager in the calling process.
+ *
+ *  @modif  LDRV_RINGIO_state
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_RINGIO_exit (IN Bool destroy)
+{
+    RingIO_Ctrl * ctrl ;
+    ProcessorId dspId ;
+
+    TRC_1ENTER ("LDRV_RINGIO_exit", destroy) ;
+
+    if ((LDRV_RINGIO_state != NULL) && (destroy == TRUE)) {
+        for (dspId = 0u ; dspId < MAX_DSPS ; dspId++) {
+            if (LDRV_RINGIO_state->regionPhys [dspId] != 0u) {
+                ctrl = (RingIO_Ctrl *) LDRV_phyToUsr (
+                                         dspId,
+                                         LDRV_RINGIO_state->regionPhys [dspId]) ;
+                ctrl->isInitialized = FALSE ;
+            }
+        }
+    }
+
+    LDRV_RINGIO_state = NULL ;
+
+    TRC_1LEAVE ("LDRV_RINGIO_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_RINGIO_mapRegion
+ *
+ *  @desc   Gets the RingIO control region of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_RINGIO_mapRegion (IN OUT RingIO_MemInfo * ringioRegionArgs)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_1ENTER ("LDRV_RINGIO_mapRegion", ringioRegionArgs) ;
+
+    DBC_Require (ringioRegionArgs != NULL) ;
+
+    if (!IS_VALID_PROCID (ringioRegionArgs->procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (LDRV_RINGIO_state->regionPhys [ringioRegionArgs->procId] == 0u) {
+        status = DSP_ECONFIG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        ringioRegionArgs->physAddr =
+                         LDRV_RINGIO_state->regionPhys [ringioRegionArgs->procId] ;
+        ringioRegionArgs->size     =
+                         LDRV_RINGIO_state->regionSize [ringioRegionArgs->procId] ;
+        ringioRegionArgs->kernAddr = 0u ;
+        ringioRegionArgs->userAddr = 0u ;
+    }
+
+    TRC_1LEAVE ("LDRV_RINGIO_mapRegion", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_RINGIO_unmapRegion
+ *
+ *  @desc   Releases the RingIO control region of a DSP. The region stays mapped
+ *          as long as the driver is.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_RINGIO_unmapRegion (IN RingIO_MemInfo * ringioRegionArgs)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_1ENTER ("LDRV_RINGIO_unmapRegion", ringioRegionArgs) ;
+
+    DBC_Require (ringioRegionArgs != NULL) ;
+
+    if (!IS_VALID_PROCID (ringioRegionArgs->procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("LDRV_RINGIO_unmapRegion", status) ;
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,176 @@
+/** ============================================================================
+ *  @file   ldrv_ringio.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the RingIO manager of the host backend.
+ *          The manager reserves the RingIO control region of every DSP in the
+ *          memory shared with the DSP. The RingIO instances themselves are
+ *          managed by the user side on the mapped region.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LDRV_RINGIO_H)
+#define LDRV_RINGIO_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_ringiodefs.h>
+#include <ringiodefs.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @func   LDRV_RINGIO_init
+ *
+ *  @desc   Initializes the RingIO manager in the calling process.
+ *
+ *  @arg    create
+ *              TRUE if the shared state is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The driver segment or the DSPLINKMEM entry is exhausted.
+ *
+ *  @enter  The segments of the link driver are mapped.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_RINGIO_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_RINGIO_init (IN Bool create) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_RINGIO_exit
+ *
+ *  @desc   Finalizes the RingIO manager in the calling process.
+ *
+ *  @arg    destroy
+ *              TRUE if the shared state is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_RINGIO_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_RINGIO_exit (IN Bool destroy) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_RINGIO_mapRegion
+ *
+ *  @desc   Gets the RingIO control region of a DSP. The host addresses do not
+ *          fit the 32-bit address fields, so only the physical address and
+ *          the size are returned; the user side translates the physical
+ *          address.
+ *
+ *  @arg    ringioRegionArgs
+ *              Identifier of the DSP on input, region on output.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid DSP identifier.
+ *          DSP_ECONFIG
+ *              No RingIO instances are configured for the DSP.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_RINGIO_unmapRegion
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_RINGIO_mapRegion (IN OUT RingIO_MemInfo * ringioRegionArgs) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_RINGIO_unmapRegion
+ *
+ *  @desc   Releases the RingIO control region of a DSP.
+ *
+ *  @arg    ringioRegionArgs
+ *              Region returned by LDRV_RINGIO_mapRegion.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid DSP identifier.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_RINGIO_mapRegion
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_RINGIO_unmapRegion (IN RingIO_MemInfo * ringioRegionArgs) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LDRV_RINGIO_H) */
@@ -0,0 +1,545 @@
+/** ============================================================================
+ *  @file   loopdma.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the DMA engine of the emulated loopback DSP.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#if defined (__SSE2__)
+#include <emmintrin.h>
+#endif /* if defined (__SSE2__) */
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+#include <ldrv.h>
+#include <loopdma.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_ARCH_HAL_DMA, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @name   LOOPDMA_Object
+ *
+ *  @desc   DMA engine of a DSP in the calling process.
+ *
+ *  @field  lock
+ *              Lock protecting the engine.
+ *  @field  workCond
+ *              Condition on which the copy threads wait for copies.
+ *  @field  doneCond
+ *              Condition on which LOOPDMA_wait waits for completions.
+ *  @field  initialized
+ *              TRUE between LOOPDMA_init and LOOPDMA_exit.
+ *  @field  stopping
+ *              TRUE while the copy threads are being joined.
+ *  @field  numThreads
+ *              Number of copy threads running.
+ *  @field  threads
+ *              Copy threads.
+ *  @field  head
+ *              First copy of the submission queue with chunks not taken yet.
+ *  @field  tail
+ *              Last copy of the submission queue.
+ *  ============================================================================
+ */
+typedef struct LOOPDMA_Object_tag {
+    SYNC_HostLock     lock        ;
+    SYNC_HostCond     workCond    ;
+    SYNC_HostCond     doneCond    ;
+    Bool              initialized ;
+    Bool              stopping    ;
+    Uint32            numThreads  ;
+    pthread_t         threads [LOOPDMA_MAXTHREADS] ;
+    LOOPDMA_Request * head        ;
+    LOOPDMA_Request * tail        ;
+} LOOPDMA_Object ;
+
+
+/*  ============================================================================
+ *  @name   LOOPDMA_objects
+ *
+ *  @desc   DMA engines of the DSPs in the calling process.
+ *  ============================================================================
+ */
+STATIC LOOPDMA_Object LOOPDMA_objects [MAX_DSPS] ;
+
+
+/*  ============================================================================
+ *  @func   LOOPDMA_copy
+ *
+ *  @desc   Copies a chunk, bypassing the caches for the destination where
+ *          the processor supports non-temporal stores.
+ *
+ *  @arg    dst
+ *              Destination of the chunk.
+ *  @arg    src
+ *              Source of the chunk.
+ *  @arg    size
+ *              Number of bytes to copy.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  The chunk is visible to the other processors.
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+LOOPDMA_copy (OUT Uint8 * dst, IN const Uint8 * src, IN Uint32 size)
+{
+#if defined (__SSE2__)
+    Uint32    head = (Uint32) ((16u - (LDRV_PTR_TO_UINT32 (dst) & 15u)) & 15u) ;
+    __m128i * out ;
+    __m128i   a ;
+    __m128i   b ;
+    __m128i   c ;
+    __m128i   d ;
+
+    if (head > size) {
+        head = size ;
+    }
+    memcpy (dst, src, head) ;
+    dst  += head ;
+    src  += head ;
+    size -= head ;
+
+    /* Streamed 64 bytes at a time, a full write-combining buffer. */
+    out = (__m128i *) dst ;
+    while (size >= 64u) {
+        a = _mm_loadu_si128 ((const __m128i *) src) ;
+        b = _mm_loadu_si128 ((const __m128i *) (src + 16u)) ;
+        c = _mm_loadu_si128 ((const __m128i *) (src + 32u)) ;
+        d = _mm_loadu_si128 ((const __m128i *) (src + 48u)) ;
+        _mm_stream_si128 (out, a) ;
+        _mm_stream_si128 (out + 1u, b) ;
+        _mm_stream_si128 (out + 2u, c) ;
+        _mm_stream_si128 (out + 3u, d) ;
+        out  += 4u ;
+        src  += 64u ;
+        size -= 64u ;
+    }
+    memcpy (out, src, size) ;
+
+    /* Streaming stores are weakly ordered: make them visible before the
+     * completion is.
+     */
+    _mm_sfence () ;
+#else
+    memcpy (dst, src, size) ;
+#endif /* if defined (__SSE2__) */
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDMA_complete
+ *
+ *  @desc   Completes a copy whose last chunk has been written.
+ *
+ *  @arg    dmaObj
+ *              DMA engine.
+ *  @arg    request
+ *              Copy to complete.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the engine is not held.
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDMA_wait
+ *  ============================================================================
+ */
+STATIC
+Void
+LOOPDMA_complete (IN LOOPDMA_Object * dmaObj, IN LOOPDMA_Request * request)
+{
+    if (request->fnDone != NULL) {
+        request->fnDone (request->arg, DSP_SOK) ;
+    }
+    else {
+        SYNC_HOST_enter (&dmaObj->lock) ;
+        request->done = TRUE ;
+        SYNC_HOST_broadcast (&dmaObj->doneCond) ;
+        SYNC_HOST_leave (&dmaObj->lock) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDMA_run
+ *
+ *  @desc   Body of a copy thread: writes the chunks of the submission queue
+ *          until the engine stops and the queue is empty.
+ *
+ *  @arg    arg
+ *              DMA engine.
+ *
+ *  @ret    NULL
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void *
+LOOPDMA_run (IN Void * arg)
+{
+    LOOPDMA_Object *  dmaObj = (LOOPDMA_Object *) arg ;
+    LOOPDMA_Request * request ;
+    Uint32            offset ;
+    Uint32            size ;
+
+    SYNC_HOST_enter (&dmaObj->lock) ;
+    while ((dmaObj->head != NULL) || (dmaObj->stopping == FALSE)) {
+        request = dmaObj->head ;
+        if (request == NULL) {
+            SYNC_HOST_wait (&dmaObj->workCond, &dmaObj->lock, WAIT_FOREVER) ;
+        }
+        else {
+            offset = request->offset ;
+            size   = request->size - offset ;
+            if (size > LOOPDMA_CHUNK) {
+                size = LOOPDMA_CHUNK ;
+            }
+            request->offset += size ;
+            if (request->offset == request->size) {
+                dmaObj->head = request->next ;
+                if (dmaObj->head == NULL) {
+                    dmaObj->tail = NULL ;
+                }
+            }
+            SYNC_HOST_leave (&dmaObj->lock) ;
+
+            LOOPDMA_copy ((Uint8 *) request->dst + offset,
+                          (const Uint8 *) request->src + offset,
+                          size) ;
+            if (__sync_sub_and_fetch (&request->pending, 1u) == 0u) {
+                LOOPDMA_complete (dmaObj, request) ;
+            }
+
+            SYNC_HOST_enter (&dmaObj->lock) ;
+        }
+    }
+    SYNC_HOST_leave (&dmaObj->lock) ;
+
+    return NULL ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDMA_start
+ *
+ *  @desc   Starts the copy threads of an engine.
+ *
+ *  @arg    dmaObj
+ *              DMA engine.
+ *
+ *  @ret    DSP_SOK
+ *              At least one copy thread runs.
+ *          DSP_EFAIL
+ *              No copy thread could be created.
+ *
+ *  @enter  The lock of the engine is held. No copy thread runs.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDMA_start (IN LOOPDMA_Object * dmaObj)
+{
+    DSP_STATUS   status     = DSP_SOK ;
+    Uint32       numThreads = LOOPDMA_THREADS ;
+    const char * value      = getenv (LOOPDMA_THREADS_ENV) ;
+
+    if (value != NULL) {
+        numThreads = (Uint32) strtoul (value, NULL, 0) ;
+    }
+    if (numThreads == 0u) {
+        numThreads = 1u ;
+    }
+    else if (numThreads > LOOPDMA_MAXTHREADS) {
+        numThreads = LOOPDMA_MAXTHREADS ;
+    }
+
+    while (    (dmaObj->numThreads < numThreads)
+           &&  (pthread_create (&(dmaObj->threads [dmaObj->numThreads]),
+                                NULL,
+                                LOOPDMA_run,
+                                dmaObj) == 0)) {
+        dmaObj->numThreads++ ;
+    }
+
+    if (dmaObj->numThreads == 0u) {
+        status = DSP_EFAIL ;
+        SET_FAILURE_REASON ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LOOPDMA_init
+ *
+ *  @desc   Initializes the DMA engine of a DSP in the calling process.
+ *
+ *  @modif  LOOPDMA_objects
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LOOPDMA_init (IN ProcessorId dspId)
+{
+    DSP_STATUS       status ;
+    LOOPDMA_Object * dmaObj ;
+
+    TRC_1ENTER ("LOOPDMA_init", dspId) ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    dmaObj = &(LOOPDMA_objects [dspId]) ;
+    memset (dmaObj, 0, sizeof (LOOPDMA_Object)) ;
+    status = SYNC_HOST_createLock (&dmaObj->lock) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = SYNC_HOST_createCond (&dmaObj->workCond) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = SYNC_HOST_createCond (&dmaObj->doneCond) ;
+            if (DSP_FAILED (status)) {
+                SYNC_HOST_deleteCond (&dmaObj->workCond) ;
+            }
+        }
+        if (DSP_FAILED (status)) {
+            SYNC_HOST_deleteLock (&dmaObj->lock) ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        dmaObj->initialized = TRUE ;
+    }
+    else {
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("LOOPDMA_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LOOPDMA_exit
+ *
+ *  @desc   Finalizes the DMA engine of a DSP in the calling process.
+ *
+ *  @modif  LOOPDMA_objects
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LOOPDMA_exit (IN ProcessorId dspId)
+{
+    LOOPDMA_Object * dmaObj ;
+    Uint32           i ;
+
+    TRC_1ENTER ("LOOPDMA_exit", dspId) ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    dmaObj = &(LOOPDMA_objects [dspId]) ;
+    if (dmaObj->initialized == TRUE) {
+        SYNC_HOST_enter (&dmaObj->lock) ;
+        dmaObj->stopping = TRUE ;
+        SYNC_HOST_broadcast (&dmaObj->workCond) ;
+        SYNC_HOST_leave (&dmaObj->lock) ;
+
+        for (i = 0u ; i < dmaObj->numThreads ; i++) {
+            pthread_join (dmaObj->threads [i], NULL) ;
+        }
+
+        dmaObj->initialized = FALSE ;
+        dmaObj->numThreads  = 0u ;
+        SYNC_HOST_deleteCond (&dmaObj->doneCond) ;
+        SYNC_HOST_deleteCond (&dmaObj->workCond) ;
+        SYNC_HOST_deleteLock (&dmaObj->lock) ;
+    }
+
+    TRC_1LEAVE ("LOOPDMA_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   LOOPDMA_submit
+ *
+ *  @desc   Queues a copy to the DMA engine of a DSP.
+ *
+ *  @modif  LOOPDMA_objects
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LOOPDMA_submit (IN ProcessorId dspId, IN LOOPDMA_Request * request)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LOOPDMA_Object * dmaObj ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+    DBC_Require (request != NULL) ;
+    DBC_Require (request->size != 0u) ;
+
+    dmaObj = &(LOOPDMA_objects [dspId]) ;
+    if (dmaObj->initialized == FALSE) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        request->next    = NULL ;
+        request->offset  = 0u ;
+        request->pending =   (request->size + LOOPDMA_CHUNK - 1u)
+                           / LOOPDMA_CHUNK ;
+        request->done    = FALSE ;
+
+        SYNC_HOST_enter (&dmaObj->lock) ;
+        if (dmaObj->numThreads == 0u) {
+            status = LOOPDMA_start (dmaObj) ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            if (dmaObj->tail == NULL) {
+                dmaObj->head = request ;
+            }
+            else {
+                dmaObj->tail->next = request ;
+            }
+            dmaObj->tail = request ;
+
+            /* One thread per chunk, up to all of them. */
+            if (request->pending == 1u) {
+                SYNC_HOST_signal (&dmaObj->workCond) ;
+            }
+            else {
+                SYNC_HOST_broadcast (&dmaObj->workCond) ;
+            }
+        }
+        SYNC_HOST_leave (&dmaObj->lock) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LOOPDMA_wait
+ *
+ *  @desc   Waits for the completion of a copy submitted without callback.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LOOPDMA_wait (IN ProcessorId dspId, IN LOOPDMA_Request * request)
+{
+    LOOPDMA_Object * dmaObj ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+    DBC_Require (request != NULL) ;
+    DBC_Require (request->fnDone == NULL) ;
+
+    dmaObj = &(LOOPDMA_objects [dspId]) ;
+    SYNC_HOST_enter (&dmaObj->lock) ;
+    while (request->done == FALSE) {
+        SYNC_HOST_wait (&dmaObj->doneCond, &dmaObj->lock, WAIT_FOREVER) ;
+    }
+    SYNC_HOST_leave (&dmaObj->lock) ;
+
+    return DSP_SOK ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,288 @@
+/** ============================================================================
+ *  @file   loopdma.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the DMA engine of the emulated loopback
+ *          DSP used by the host backend.
+ *          Every DSP has a submission queue in each process using it. The
+ *          copies queued are split in chunks taken by a pool of copy threads
+ *          of that process, started with the first copy, and written with
+ *          non-temporal stores where the processor has them, so that the
+ *          data does not evict the working set of the copy threads. A copy
+ *          completes with a callback in the context of the copy thread
+ *          writing its last chunk, or wakes up the thread waiting for it.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (LOOPDMA_H)
+#define LOOPDMA_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  LOOPDMA_THREADS_ENV
+ *
+ *  @desc   Environment variable giving the number of copy threads of each
+ *          DSP, LOOPDMA_THREADS by default.
+ *  ============================================================================
+ */
+#define LOOPDMA_THREADS_ENV     "DSPLINK_DMA_THREADS"
+
+/** ============================================================================
+ *  @const  LOOPDMA_THREADS
+ *
+ *  @desc   Default number of copy threads of each DSP.
+ *  ============================================================================
+ */
+#define LOOPDMA_THREADS         2u
+
+/** ============================================================================
+ *  @const  LOOPDMA_MAXTHREADS
+ *
+ *  @desc   Maximum number of copy threads of each DSP.
+ *  ============================================================================
+ */
+#define LOOPDMA_MAXTHREADS      8u
+
+/** ============================================================================
+ *  @const  LOOPDMA_CHUNK
+ *
+ *  @desc   Size of the chunks copies are split in. Chunks of the same copy
+ *          are written in parallel by different copy threads.
+ *  ============================================================================
+ */
+#define LOOPDMA_CHUNK           0x10000u
+
+/** ============================================================================
+ *  @const  LOOPDMA_MINSIZE
+ *
+ *  @desc   Size below which handing a copy over to a copy thread costs more
+ *          than doing it in place. Users are expected to copy smaller blocks
+ *          themselves.
+ *  ============================================================================
+ */
+#define LOOPDMA_MINSIZE         0x1000u
+
+
+/** ============================================================================
+ *  @name   FnLoopDmaDone
+ *
+ *  @desc   Signature of the callback completing a copy.
+ *
+ *  @arg    arg
+ *              Argument given with the copy.
+ *  @arg    status
+ *              Completion status of the copy.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+typedef Void (*FnLoopDmaDone) (IN Pvoid arg, IN DSP_STATUS status) ;
+
+/** ============================================================================
+ *  @name   LOOPDMA_Request
+ *
+ *  @desc   Copy queued to the DMA engine of a DSP. It belongs to the engine
+ *          from its submission to its completion.
+ *
+ *  @field  next
+ *              Next copy in the submission queue.
+ *  @field  dst
+ *              Destination of the copy in the calling process.
+ *  @field  src
+ *              Source of the copy in the calling process.
+ *  @field  size
+ *              Number of bytes to copy.
+ *  @field  fnDone
+ *              Callback completing the copy, NULL if the copy is waited for
+ *              with LOOPDMA_wait.
+ *  @field  arg
+ *              Argument of the callback.
+ *  @field  offset
+ *              Offset of the first chunk not taken by a copy thread yet.
+ *  @field  pending
+ *              Number of chunks not written yet.
+ *  @field  done
+ *              TRUE once a copy without callback is complete.
+ *  ============================================================================
+ */
+typedef struct LOOPDMA_Request_tag {
+    struct LOOPDMA_Request_tag * next    ;
+    Pvoid                        dst     ;
+    Pvoid                        src     ;
+    Uint32                       size    ;
+    FnLoopDmaDone                fnDone  ;
+    Pvoid                        arg     ;
+    Uint32                       offset  ;
+    volatile Uint32              pending ;
+    volatile Uint32              done    ;
+} LOOPDMA_Request ;
+
+
+/** ============================================================================
+ *  @func   LOOPDMA_init
+ *
+ *  @desc   Initializes the DMA engine of a DSP in the calling process. The
+ *          copy threads are started by the first copy.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              The synchronization objects could not be created.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDMA_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LOOPDMA_init (IN ProcessorId dspId) ;
+
+
+/** ============================================================================
+ *  @func   LOOPDMA_exit
+ *
+ *  @desc   Finalizes the DMA engine of a DSP in the calling process. The
+ *          copies queued are completed before the copy threads are joined.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  No copy is submitted concurrently.
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDMA_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LOOPDMA_exit (IN ProcessorId dspId) ;
+
+
+/** ============================================================================
+ *  @func   LOOPDMA_submit
+ *
+ *  @desc   Queues a copy to the DMA engine of a DSP and returns without
+ *          waiting for it. The callback of the copy is never called from
+ *          this function, so the caller may hold locks the callback takes.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    request
+ *              Copy to queue, with dst, src, size, fnDone and arg set.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EWRONGSTATE
+ *              The engine is not initialized in the calling process.
+ *          DSP_EFAIL
+ *              No copy thread could be started.
+ *
+ *  @enter  size is not 0.
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDMA_wait
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LOOPDMA_submit (IN ProcessorId dspId, IN LOOPDMA_Request * request) ;
+
+
+/** ============================================================================
+ *  @func   LOOPDMA_wait
+ *
+ *  @desc   Waits for the completion of a copy submitted without callback.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    request
+ *              Copy to wait for.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  The copy has been submitted successfully with a NULL fnDone.
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDMA_submit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LOOPDMA_wait (IN ProcessorId dspId, IN LOOPDMA_Request * request) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (LOOPDMA_H) */
@@ -0,0 +1,768 @@
+/** ============================================================================
+ *  @file   loopdsp.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the emulated loopback DSP used by the host
+ *          backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+#include <pthread.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_ips.h>
+#include <loopdma.h>
+#include <loopdsp.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_ARCH_DSP, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @name   LOOPDSP_Object
+ *
+ *  @desc   State of a loopback DSP in the process running it.
+ *
+ *  @field  thread
+ *              Thread running the DSP.
+ *  @field  running
+ *              TRUE if the thread has been created by the calling process.
+ *  ============================================================================
+ */
+typedef struct LOOPDSP_Object_tag {
+    pthread_t  thread  ;
+    Bool       running ;
+} LOOPDSP_Object ;
+
+
+/*  ============================================================================
+ *  @name   LOOPDSP_objects
+ *
+ *  @desc   State of the loopback DSPs in the calling process.
+ *  ============================================================================
+ */
+STATIC LOOPDSP_Object LOOPDSP_objects [MAX_DSPS] ;
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_echo
+ *
+ *  @desc   Default DSP-side handler, sending the event back to the GPP.
+ *
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    arg
+ *              DSP identifier and IPS identifier.
+ *  @arg    info
+ *              Payload of the event.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+LOOPDSP_echo (IN Uint32 eventNo, IN Pvoid arg, IN Pvoid info)
+{
+    Uint32 id = LDRV_PTR_TO_UINT32 (arg) ;
+
+    LDRV_IPS_raise ((ProcessorId) (id >> 16u),
+                    id & 0xFFFFu,
+                    eventNo,
+                    LDRV_PTR_TO_UINT32 (info)) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_run
+ *
+ *  @desc   Body of the thread running a loopback DSP.
+ *
+ *  @arg    arg
+ *              DSP identifier.
+ *
+ *  @ret    NULL
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void *
+LOOPDSP_run (IN Void * arg)
+{
+    ProcessorId dspId  = (ProcessorId) LDRV_PTR_TO_UINT32 (arg) ;
+    DSP_STATUS  status = DSP_SOK ;
+
+    while (DSP_SUCCEEDED (status)) {
+        /* Events are handled by the registered handlers. */
+        status = LDRV_IPS_dspDispatch (dspId) ;
+    }
+
+    return NULL ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_init
+ *
+ *  @desc   Initializes the loopback DSP and its DMA engine in the calling
+ *          process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              The DMA engine could not be initialized.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDSP_exit
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDSP_init (IN ProcessorId dspId, IN DSP_Object * dspState)
+{
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    dspState->halObject = &(LOOPDSP_objects [dspId]) ;
+    LOOPDSP_objects [dspId].running = FALSE ;
+
+    return LOOPDMA_init (dspId) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_exit
+ *
+ *  @desc   Finalizes the loopback DSP and its DMA engine in the calling
+ *          process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  The DSP is stopped.
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDSP_init
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDSP_exit (IN ProcessorId dspId, IN DSP_Object * dspState)
+{
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    if (LOOPDSP_objects [dspId].running == TRUE) {
+        /* Stopped from another process, the thread has returned already. */
+        pthread_join (LOOPDSP_objects [dspId].thread, NULL) ;
+        LOOPDSP_objects [dspId].running = FALSE ;
+    }
+    LOOPDMA_exit (dspId) ;
+    dspState->halObject = NULL ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_start
+ *
+ *  @desc   Starts the loopback DSP in a thread of the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *  @arg    dspAddr
+ *              Entry point, ignored.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              The thread could not be created.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDSP_stop
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDSP_start (IN ProcessorId dspId, IN DSP_Object * dspState, IN Uint32 dspAddr)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LOOPDSP_Object * dspObj = (LOOPDSP_Object *) dspState->halObject ;
+    LDRV_DspConfig * cfg ;
+    Uint32           ipsId ;
+
+    TRC_3ENTER ("LOOPDSP_start", dspId, dspState, dspAddr) ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    if (dspObj->running == TRUE) {
+        /* A previous run stopped from another process is still joinable. */
+        pthread_join (dspObj->thread, NULL) ;
+        dspObj->running = FALSE ;
+    }
+
+    cfg = LDRV_getDspConfig (dspId) ;
+    for (ipsId = 0u ; ipsId < cfg->numIpsEntries ; ipsId++) {
+        LDRV_IPS_dspRegister (dspId,
+                              ipsId,
+                              LDRV_IPS_ALLEVENTS,
+                              LOOPDSP_echo,
+                              LDRV_UINT32_TO_PTR ((dspId << 16u) | ipsId)) ;
+    }
+
+    LDRV_IPS_dspStart (dspId) ;
+    if (pthread_create (&dspObj->thread,
+                        NULL,
+                        LOOPDSP_run,
+                        LDRV_UINT32_TO_PTR (dspId)) != 0) {
+        LDRV_IPS_dspStop (dspId) ;
+        status = DSP_EFAIL ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        dspObj->running = TRUE ;
+    }
+
+    TRC_1LEAVE ("LOOPDSP_start", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_stop
+ *
+ *  @desc   Stops the loopback DSP. The thread is joined if it runs in the
+ *          calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDSP_start
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDSP_stop (IN ProcessorId dspId, IN DSP_Object * dspState)
+{
+    LOOPDSP_Object * dspObj = (LOOPDSP_Object *) dspState->halObject ;
+
+    TRC_2ENTER ("LOOPDSP_stop", dspId, dspState) ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+
+    LDRV_IPS_dspStop (dspId) ;
+    if (    (dspObj->running == TRUE)
+        &&  (pthread_equal (dspObj->thread, pthread_self ()) == 0)) {
+        pthread_join (dspObj->thread, NULL) ;
+        dspObj->running = FALSE ;
+    }
+
+    TRC_1LEAVE ("LOOPDSP_stop", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_idle
+ *
+ *  @desc   Idles the loopback DSP. Nothing to do.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDSP_idle (IN ProcessorId dspId, IN DSP_Object * dspState)
+{
+    (Void) dspId ;
+    (Void) dspState ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_intCtrl
+ *
+ *  @desc   Interrupt control. Events are delivered by the IPS component, so
+ *          there is no interrupt to control.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *  @arg    intId
+ *              Interrupt identifier.
+ *  @arg    cmd
+ *              Interrupt control command.
+ *  @arg    arg
+ *              Argument of the command.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDSP_intCtrl (IN         ProcessorId       dspId,
+                 IN         DSP_Object *      dspState,
+                 IN         Uint32            intId,
+                 IN         DSP_IntCtrlCmd    cmd,
+                 IN OUT OPT Pvoid             arg)
+{
+    (Void) dspId ;
+    (Void) dspState ;
+    (Void) intId ;
+    (Void) cmd ;
+    (Void) arg ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_toUsr
+ *
+ *  @desc   Translates a range of DSP addresses to an address in the calling
+ *          process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspAddr
+ *              Start of the range.
+ *  @arg    numBytes
+ *              Size of the range.
+ *
+ *  @ret    Address in the calling process, NULL if the range is not mapped.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint8 *
+LOOPDSP_toUsr (IN ProcessorId dspId, IN Uint32 dspAddr, IN Uint32 numBytes)
+{
+    Uint8 * usrAddr = NULL ;
+    Uint32  first ;
+    Uint32  last ;
+
+    first = LDRV_dspToPhy (dspId, dspAddr) ;
+    last  = LDRV_dspToPhy (dspId, dspAddr + numBytes - 1u) ;
+    if (    (numBytes != 0u)
+        &&  (first != LDRV_INVALID_ADDR)
+        &&  (last  == first + numBytes - 1u)) {
+        usrAddr = (Uint8 *) LDRV_phyToUsr (dspId, first) ;
+    }
+
+    return usrAddr ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_read
+ *
+ *  @desc   Reads from the memory of the loopback DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *  @arg    dspAddr
+ *              DSP address to read from.
+ *  @arg    endianism
+ *              Endianism of the data, ignored.
+ *  @arg    numBytes
+ *              Number of bytes to read.
+ *  @arg    buffer
+ *              Buffer to receive the data.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ERANGE
+ *              The range is not mapped.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDSP_write
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDSP_read (IN  ProcessorId  dspId,
+              IN  DSP_Object * dspState,
+              IN  Uint32       dspAddr,
+              IN  Endianism    endianism,
+              IN  Uint32       numBytes,
+              OUT Uint8 *      buffer)
+{
+    DSP_STATUS status = DSP_SOK ;
+    Uint8 *    usrAddr ;
+
+    (Void) dspState ;
+    (Void) endianism ;
+
+    usrAddr = LOOPDSP_toUsr (dspId, dspAddr, numBytes) ;
+    if (usrAddr == NULL) {
+        status = DSP_ERANGE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        memcpy (buffer, usrAddr, numBytes) ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_write
+ *
+ *  @desc   Writes to the memory of the loopback DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *  @arg    dspAddr
+ *              DSP address to write to.
+ *  @arg    endianism
+ *              Endianism of the data, ignored.
+ *  @arg    numBytes
+ *              Number of bytes to write.
+ *  @arg    buffer
+ *              Data to be written.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ERANGE
+ *              The range is not mapped.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LOOPDSP_read
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDSP_write (IN ProcessorId  dspId,
+               IN DSP_Object * dspState,
+               IN Uint32       dspAddr,
+               IN Endianism    endianism,
+               IN Uint32       numBytes,
+               IN Uint8 *      buffer)
+{
+    DSP_STATUS status = DSP_SOK ;
+    Uint8 *    usrAddr ;
+
+    (Void) dspState ;
+    (Void) endianism ;
+
+    usrAddr = LOOPDSP_toUsr (dspId, dspAddr, numBytes) ;
+    if (usrAddr == NULL) {
+        status = DSP_ERANGE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        memcpy (usrAddr, buffer, numBytes) ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_addrConvert
+ *
+ *  @desc   Converts between GPP physical and DSP addresses.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *  @arg    addr
+ *              Address to be converted.
+ *  @arg    type
+ *              Direction of the conversion.
+ *
+ *  @ret    Converted address, LDRV_INVALID_ADDR if not mapped.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint32
+LOOPDSP_addrConvert (IN  ProcessorId        dspId,
+                     IN  DSP_Object *       dspState,
+                     IN  Uint32             addr,
+                     IN  DSP_AddrConvType   type)
+{
+    (Void) dspState ;
+
+    return (type == GppToDsp) ? LDRV_phyToDsp (dspId, addr)
+                              : LDRV_dspToPhy (dspId, addr) ;
+}
+
+
+/*  ============================================================================
+ *  @func   LOOPDSP_control
+ *
+ *  @desc   Platform-specific control. The DSP_DmaCtrlCmd commands copy a
+ *          block between GPP memory and DSP memory with the DMA engine of
+ *          the DSP and return once the copy is complete.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dspState
+ *              DSP object.
+ *  @arg    cmd
+ *              Command identifier.
+ *  @arg    arg
+ *              Argument of the command, the DspDmaArgs of a DMA command:
+ *              the GPP address is a physical address.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The DMA arguments are missing or describe an empty block.
+ *          DSP_ERANGE
+ *              A side of the block is not mapped.
+ *          DSP_ENOTSUPPORTED
+ *              The command is not supported.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+LOOPDSP_control (IN  ProcessorId  dspId,
+                 IN  DSP_Object * dspState,
+                 IN  Int32        cmd,
+                 OPT Pvoid        arg)
+{
+    DSP_STATUS       status  = DSP_SOK ;
+    DspDmaArgs *     dmaArgs = (DspDmaArgs *) arg ;
+    Uint32           gppAddr = 0u ;
+    Uint32           dspAddr = 0u ;
+    Uint8 *          gppUsr  = NULL ;
+    Uint8 *          dspUsr  = NULL ;
+    LOOPDMA_Request  request ;
+
+    (Void) dspState ;
+
+    if (    (cmd != (Int32) DSP_DmaCtrlCmd_GppToDsp)
+        &&  (cmd != (Int32) DSP_DmaCtrlCmd_DspToGpp)) {
+        status = DSP_ENOTSUPPORTED ;
+        SET_FAILURE_REASON ;
+    }
+    else if ((dmaArgs == NULL) || (dmaArgs->size == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        if (cmd == (Int32) DSP_DmaCtrlCmd_GppToDsp) {
+            gppAddr = dmaArgs->srcAddr ;
+            dspAddr = dmaArgs->dstAddr ;
+        }
+        else {
+            gppAddr = dmaArgs->dstAddr ;
+            dspAddr = dmaArgs->srcAddr ;
+        }
+
+        gppUsr = (Uint8 *) LDRV_phyToUsr (dspId, gppAddr) ;
+        dspUsr = LOOPDSP_toUsr (dspId, dspAddr, dmaArgs->size) ;
+        if (    (gppUsr == NULL)
+            ||  (dspUsr == NULL)
+            ||  (   LDRV_usrToPhy (dspId, gppUsr + dmaArgs->size - 1u)
+                 != (gppAddr + dmaArgs->size - 1u))) {
+            status = DSP_ERANGE ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        request.dst    = (cmd == (Int32) DSP_DmaCtrlCmd_GppToDsp) ? dspUsr
+                                                                  : gppUsr ;
+        request.src    = (cmd == (Int32) DSP_DmaCtrlCmd_GppToDsp) ? gppUsr
+                                                                  : dspUsr ;
+        request.size   = dmaArgs->size ;
+        request.fnDone = NULL ;
+        request.arg    = NULL ;
+        status = LOOPDMA_submit (dspId, &request) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = LOOPDMA_wait (dspId, &request) ;
+        }
+        else {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @name   LOOPDSP_Interface
+ *
+ *  @desc   DSP interface of the loopback DSP.
+ *  ============================================================================
+ */
+DSP_Interface LOOPDSP_Interface = {
+    &LOOPDSP_init,
+    &LOOPDSP_exit,
+    &LOOPDSP_start,
+    &LOOPDSP_stop,
+    &LOOPDSP_idle,
+    &LOOPDSP_intCtrl,
+    &LOOPDSP_read,
+    &LOOPDSP_write,
+    &LOOPDSP_addrConvert,
+    &LOOPDSP_control
+} ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
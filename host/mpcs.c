@@ -0,0 +1,534 @@
+/** ============================================================================
+ *  @file   mpcs.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/api/
+ *
+ *  @desc   Implementation of the API sub-component MPCS. The lock combines a
+ *          spin lock among the GPP clients with Peterson's algorithm against
+ *          the DSP.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+#include <sched.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- User API                    */
+#include <pool.h>
+#include <mpcs.h>
+
+/*  ----------------------------------- Host backend                */
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_API_MPCS, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @const  MPCS_FREE, MPCS_BUSY
+ *
+ *  @desc   Values of the flag of a processor in an MPCS object.
+ *  ============================================================================
+ */
+#define MPCS_FREE           0u
+#define MPCS_BUSY           1u
+
+/*  ============================================================================
+ *  @const  MPCS_TURN_GPP, MPCS_TURN_DSP
+ *
+ *  @desc   Values of the turn of an MPCS object.
+ *  ============================================================================
+ */
+#define MPCS_TURN_GPP       0u
+#define MPCS_TURN_DSP       1u
+
+/*  ============================================================================
+ *  @const  MPCS_OBJ_SIZE
+ *
+ *  @desc   Size of an MPCS object allocated from a pool.
+ *  ============================================================================
+ */
+#define MPCS_OBJ_SIZE       DSPLINK_ALIGN (sizeof (MPCS_ShObj),                \
+                                           DSPLINK_BUF_ALIGN)
+
+
+/*  ============================================================================
+ *  @func   MPCS_getCtrl
+ *
+ *  @desc   Gets the MPCS control region of a DSP in the calling process.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    ctrl
+ *              Location to receive the control region.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EACCESSDENIED
+ *              The MPCS component has not been initialized.
+ *
+ *  @enter  procId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+MPCS_getCtrl (IN ProcessorId procId, OUT MPCS_Ctrl ** ctrl)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    args.apiArgs.mpcsMapArgs.mpcsRegionArgs.procId = procId ;
+    status = DRV_INVOKE (DRV_handle, CMD_MPCS_MAPREGION, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        *ctrl = (MPCS_Ctrl *) DRV_phyToUsr (
+                               args.apiArgs.mpcsMapArgs.mpcsRegionArgs.physAddr) ;
+        if ((*ctrl == NULL) || ((*ctrl)->isInitialized != TRUE)) {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+    }
+    else {
+        status = DSP_EACCESSDENIED ;
+        SET_FAILURE_REASON ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   MPCS_findEntry
+ *
+ *  @desc   Finds the entry of an MPCS object in the control region.
+ *
+ *  @arg    ctrl
+ *              Control region.
+ *  @arg    name
+ *              Name of the MPCS object, NULL to find a free entry.
+ *
+ *  @ret    The entry, NULL if not found.
+ *
+ *  @enter  The table lock is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+MPCS_Entry *
+MPCS_findEntry (IN MPCS_Ctrl * ctrl, IN OPT Pstr name)
+{
+    MPCS_Entry * entries = (MPCS_Entry *) (ctrl + 1) ;
+    MPCS_Entry * entry   = NULL ;
+    Uint32       i ;
+
+    for (i = 0u ; (i < ctrl->maxEntries) && (entry == NULL) ; i++) {
+        if (name == NULL) {
+            if (entries [i].name [0] == '\0') {
+                entry = &entries [i] ;
+            }
+        }
+        else if (strncmp (entries [i].name, name, DSP_MAX_STRLEN) == 0) {
+            entry = &entries [i] ;
+        }
+    }
+
+    return entry ;
+}
+
+
+/** ============================================================================
+ *  @func   MPCS_create
+ *
+ *  @desc   This function creates and initializes an instance of the MPCS
+ *          object.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPCS_create (IN     ProcessorId    procId,
+             IN     Pstr           name,
+             IN OPT MPCS_ShObj *   mpcsShObj,
+             IN     MPCS_Attrs *   attrs)
+{
+    DSP_STATUS   status    = DSP_SOK ;
+    MPCS_ShObj * shObj     = mpcsShObj ;
+    Bool         allocated = FALSE ;
+    MPCS_Ctrl *  ctrl ;
+    MPCS_Entry * entry ;
+    Uint32       physAddr ;
+
+    TRC_4ENTER ("MPCS_create", procId, name, mpcsShObj, attrs) ;
+
+    if (    (!IS_VALID_PROCID (procId))
+        ||  (name == NULL)
+        ||  (name [0] == '\0')
+        ||  (strlen (name) >= DSP_MAX_STRLEN)
+        ||  (attrs == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = MPCS_getCtrl (procId, &ctrl) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        MPCS_enter ((MPCS_Handle) &ctrl->lockObj) ;
+
+        if (MPCS_findEntry (ctrl, name) != NULL) {
+            status = DSP_EALREADYEXISTS ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            entry = MPCS_findEntry (ctrl, NULL) ;
+            if (entry == NULL) {
+                status = DSP_ERESOURCE ;
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status) && (shObj == NULL)) {
+            status = POOL_alloc (attrs->poolId,
+                                 (Pvoid *) &shObj,
+                                 MPCS_OBJ_SIZE) ;
+            if (DSP_SUCCEEDED (status)) {
+                allocated = TRUE ;
+            }
+            else {
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            physAddr = DRV_usrToPhy (shObj) ;
+            if (physAddr == 0u) {
+                /* The object must be shared with the DSP. */
+                status = DSP_EINVALIDARG ;
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            memset ((Pvoid) shObj, 0, sizeof (MPCS_ShObj)) ;
+            shObj->gppMpcsObj.flag       = MPCS_FREE ;
+            shObj->gppMpcsObj.freeObject = allocated ;
+            shObj->dspMpcsObj.flag       = MPCS_FREE ;
+            shObj->turn                  = MPCS_TURN_GPP ;
+
+            entry->ownerProcId = ID_GPP ;
+            entry->poolId      = attrs->poolId ;
+            entry->physAddress = DRV_ADDR_TO_PTR (physAddr) ;
+            strncpy (entry->name, name, DSP_MAX_STRLEN - 1u) ;
+            entry->name [DSP_MAX_STRLEN - 1u] = '\0' ;
+        }
+        else if (allocated == TRUE) {
+            POOL_free (attrs->poolId, shObj, MPCS_OBJ_SIZE) ;
+        }
+
+        MPCS_leave ((MPCS_Handle) &ctrl->lockObj) ;
+    }
+
+    TRC_1LEAVE ("MPCS_create", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPCS_delete
+ *
+ *  @desc   This function deletes the instance of the MPCS object.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPCS_delete (IN     ProcessorId procId,
+             IN     Pstr        name)
+{
+    DSP_STATUS   status = DSP_SOK ;
+    MPCS_ShObj * shObj ;
+    MPCS_Ctrl *  ctrl ;
+    MPCS_Entry * entry ;
+
+    TRC_2ENTER ("MPCS_delete", procId, name) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (name == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = MPCS_getCtrl (procId, &ctrl) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        MPCS_enter ((MPCS_Handle) &ctrl->lockObj) ;
+
+        entry = MPCS_findEntry (ctrl, name) ;
+        if (entry == NULL) {
+            status = DSP_ENOTFOUND ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            shObj = (MPCS_ShObj *) DRV_phyToUsr (
+                                       DRV_PTR_TO_ADDR (entry->physAddress)) ;
+            if ((shObj != NULL) && (shObj->gppMpcsObj.freeObject == TRUE)) {
+                POOL_free (entry->poolId, shObj, MPCS_OBJ_SIZE) ;
+            }
+            memset (entry, 0, sizeof (MPCS_Entry)) ;
+        }
+
+        MPCS_leave ((MPCS_Handle) &ctrl->lockObj) ;
+    }
+
+    TRC_1LEAVE ("MPCS_delete", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPCS_open
+ *
+ *  @desc   This function opens an MPCS object specified by its name and gets a
+ *          handle to the object.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPCS_open (IN     ProcessorId    procId,
+           IN     Pstr           name,
+           OUT    MPCS_Handle *  mpcsHandle)
+{
+    DSP_STATUS   status = DSP_SOK ;
+    MPCS_Ctrl *  ctrl ;
+    MPCS_Entry * entry ;
+
+    TRC_3ENTER ("MPCS_open", procId, name, mpcsHandle) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (name == NULL) || (mpcsHandle == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *mpcsHandle = NULL ;
+        status = MPCS_getCtrl (procId, &ctrl) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        MPCS_enter ((MPCS_Handle) &ctrl->lockObj) ;
+
+        entry = MPCS_findEntry (ctrl, name) ;
+        if (entry == NULL) {
+            status = DSP_ENOTFOUND ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            *mpcsHandle = (MPCS_Handle) DRV_phyToUsr (
+                                       DRV_PTR_TO_ADDR (entry->physAddress)) ;
+        }
+
+        MPCS_leave ((MPCS_Handle) &ctrl->lockObj) ;
+    }
+
+    TRC_1LEAVE ("MPCS_open", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPCS_close
+ *
+ *  @desc   This function closes an MPCS object specified by its handle.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPCS_close (IN     ProcessorId    procId,
+            IN     MPCS_Handle    mpcsHandle)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_2ENTER ("MPCS_close", procId, mpcsHandle) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (mpcsHandle == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("MPCS_close", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPCS_enter
+ *
+ *  @desc   This function enters the critical section specified by the MPCS
+ *          object.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPCS_enter (IN     MPCS_Handle mpcsHandle)
+{
+    DSP_STATUS   status = DSP_SOK ;
+    MPCS_ShObj * shObj  = (MPCS_ShObj *) mpcsHandle ;
+
+    TRC_1ENTER ("MPCS_enter", mpcsHandle) ;
+
+    if (shObj == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        /* Serialize the GPP clients first, then contend with the DSP. */
+        while (__sync_lock_test_and_set (
+                          (Uint32 *) &shObj->gppMpcsObj.localLock, 1u) != 0u) {
+#if defined (DDSP_PROFILE)
+            shObj->gppMpcsObj.conflicts++ ;
+#endif /* if defined (DDSP_PROFILE) */
+            sched_yield () ;
+        }
+#if defined (DDSP_PROFILE)
+        shObj->gppMpcsObj.numCalls++ ;
+#endif /* if defined (DDSP_PROFILE) */
+
+        shObj->gppMpcsObj.flag = MPCS_BUSY ;
+        shObj->turn            = MPCS_TURN_DSP ;
+        __sync_synchronize () ;
+        while (    (shObj->dspMpcsObj.flag == MPCS_BUSY)
+               &&  (shObj->turn == MPCS_TURN_DSP)) {
+            sched_yield () ;
+        }
+    }
+
+    TRC_1LEAVE ("MPCS_enter", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPCS_leave
+ *
+ *  @desc   This function leaves the critical section specified by the MPCS
+ *          object.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPCS_leave (IN     MPCS_Handle mpcsHandle)
+{
+    DSP_STATUS   status = DSP_SOK ;
+    MPCS_ShObj * shObj  = (MPCS_ShObj *) mpcsHandle ;
+
+    TRC_1ENTER ("MPCS_leave", mpcsHandle) ;
+
+    if (shObj == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        __sync_synchronize () ;
+        shObj->gppMpcsObj.flag = MPCS_FREE ;
+        __sync_lock_release ((Uint32 *) &shObj->gppMpcsObj.localLock) ;
+    }
+
+    TRC_1LEAVE ("MPCS_leave", status) ;
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,727 @@
+/** ============================================================================
+ *  @file   mplist.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/api/
+ *
+ *  @desc   Implementation of the API sub-component MPLIST. The links of the
+ *          list hold physical addresses so that the list can be walked by all
+ *          the processes and the DSP.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- User API                    */
+#include <pool.h>
+#include <mpcs.h>
+#include <mplist.h>
+
+/*  ----------------------------------- Host backend                */
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_API_MPLIST, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @macro  MPLIST_PHYS, MPLIST_USR
+ *
+ *  @desc   Convert between a list link (physical address) and an element in
+ *          the calling process.
+ *  ============================================================================
+ */
+#define MPLIST_PHYS(elem)   DRV_ADDR_TO_PTR (DRV_usrToPhy ((Pvoid) (elem)))
+#define MPLIST_USR(link)    ((MPLIST_Header *) DRV_phyToUsr (                  \
+                                                  DRV_PTR_TO_ADDR (link)))
+
+/*  ============================================================================
+ *  @const  MPLIST_OBJ_SIZE
+ *
+ *  @desc   Size of a list object allocated from a pool.
+ *  ============================================================================
+ */
+#define MPLIST_OBJ_SIZE     DSPLINK_ALIGN (sizeof (MPLIST_List),               \
+                                           DSPLINK_BUF_ALIGN)
+
+
+/*  ============================================================================
+ *  @func   MPLIST_getCtrl
+ *
+ *  @desc   Gets the MPLIST control region of a DSP in the calling process.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    ctrl
+ *              Location to receive the control region.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EACCESSDENIED
+ *              The MPLIST component has not been initialized.
+ *
+ *  @enter  procId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+MPLIST_getCtrl (IN ProcessorId procId, OUT MPLIST_Ctrl ** ctrl)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    args.apiArgs.mplistArgs.mplistRegionArgs.procId = procId ;
+    status = DRV_INVOKE (DRV_handle, CMD_MPLIST_MAPREGION, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        *ctrl = (MPLIST_Ctrl *) DRV_phyToUsr (
+                               args.apiArgs.mplistArgs.mplistRegionArgs.physAddr) ;
+        if ((*ctrl == NULL) || ((*ctrl)->isInitialized != TRUE)) {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+    }
+    else {
+        status = DSP_EACCESSDENIED ;
+        SET_FAILURE_REASON ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   MPLIST_findEntry
+ *
+ *  @desc   Finds the entry of an MPLIST object in the control region.
+ *
+ *  @arg    ctrl
+ *              Control region.
+ *  @arg    name
+ *              Name of the MPLIST object, NULL to find a free entry.
+ *
+ *  @ret    The entry, NULL if not found.
+ *
+ *  @enter  The region lock is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+MPLIST_Entry *
+MPLIST_findEntry (IN MPLIST_Ctrl * ctrl, IN OPT Char8 * name)
+{
+    MPLIST_Entry * entries = (MPLIST_Entry *) (ctrl + 1) ;
+    MPLIST_Entry * entry   = NULL ;
+    Uint32         i ;
+
+    for (i = 0u ; (i < ctrl->maxEntries) && (entry == NULL) ; i++) {
+        if (name == NULL) {
+            if (entries [i].name [0] == '\0') {
+                entry = &entries [i] ;
+            }
+        }
+        else if (strncmp (entries [i].name, name, DSP_MAX_STRLEN) == 0) {
+            entry = &entries [i] ;
+        }
+    }
+
+    return entry ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_create
+ *
+ *  @desc   Allocates and initializes a doubly linked circular list.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_create (IN     ProcessorId    procId,
+               IN     Char8 *        name,
+               IN OPT MPLIST_List *  mplistObj,
+               IN     MPLIST_Attrs * attrs)
+{
+    DSP_STATUS     status    = DSP_SOK ;
+    MPLIST_List *  list      = mplistObj ;
+    Bool           allocated = FALSE ;
+    MPLIST_Ctrl *  ctrl ;
+    MPLIST_Entry * entry ;
+    Uint32         physAddr ;
+
+    TRC_4ENTER ("MPLIST_create", procId, name, mplistObj, attrs) ;
+
+    if (    (!IS_VALID_PROCID (procId))
+        ||  (name == NULL)
+        ||  (name [0] == '\0')
+        ||  (strlen (name) >= DSP_MAX_STRLEN)
+        ||  (attrs == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = MPLIST_getCtrl (procId, &ctrl) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        MPCS_enter ((MPCS_Handle) &ctrl->lockObj) ;
+
+        if (MPLIST_findEntry (ctrl, name) != NULL) {
+            status = DSP_EALREADYEXISTS ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            entry = MPLIST_findEntry (ctrl, NULL) ;
+            if (entry == NULL) {
+                status = DSP_ERESOURCE ;
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status) && (list == NULL)) {
+            status = POOL_alloc (attrs->poolId,
+                                 (Pvoid *) &list,
+                                 MPLIST_OBJ_SIZE) ;
+            if (DSP_SUCCEEDED (status)) {
+                allocated = TRUE ;
+            }
+            else {
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            physAddr = DRV_usrToPhy (list) ;
+            if (physAddr == 0u) {
+                /* The list must be shared with the DSP. */
+                status = DSP_EINVALIDARG ;
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            memset ((Pvoid) list, 0, sizeof (MPLIST_List)) ;
+            list->head.next = DRV_ADDR_TO_PTR (physAddr) ;
+            list->head.prev = DRV_ADDR_TO_PTR (physAddr) ;
+            list->mpcsObj.gppMpcsObj.freeObject = allocated ;
+
+            entry->ownerProcId   = ID_GPP ;
+            entry->poolId        = attrs->poolId ;
+            entry->phyListHandle = DRV_ADDR_TO_PTR (physAddr) ;
+            strncpy (entry->name, name, DSP_MAX_STRLEN - 1u) ;
+            entry->name [DSP_MAX_STRLEN - 1u] = '\0' ;
+        }
+        else if (allocated == TRUE) {
+            POOL_free (attrs->poolId, list, MPLIST_OBJ_SIZE) ;
+        }
+
+        MPCS_leave ((MPCS_Handle) &ctrl->lockObj) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_create", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_delete
+ *
+ *  @desc   Removes a list by freeing its control structure's memory space.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_delete (IN ProcessorId procId,
+               IN Char8 *     name)
+{
+    DSP_STATUS     status = DSP_SOK ;
+    MPLIST_List *  list ;
+    MPLIST_Ctrl *  ctrl ;
+    MPLIST_Entry * entry ;
+
+    TRC_2ENTER ("MPLIST_delete", procId, name) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (name == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = MPLIST_getCtrl (procId, &ctrl) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        MPCS_enter ((MPCS_Handle) &ctrl->lockObj) ;
+
+        entry = MPLIST_findEntry (ctrl, name) ;
+        if (entry == NULL) {
+            status = DSP_ENOTFOUND ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            list = (MPLIST_List *) DRV_phyToUsr (
+                                       DRV_PTR_TO_ADDR (entry->phyListHandle)) ;
+            if (    (list != NULL)
+                &&  (list->mpcsObj.gppMpcsObj.freeObject == TRUE)) {
+                POOL_free (entry->poolId, list, MPLIST_OBJ_SIZE) ;
+            }
+            memset (entry, 0, sizeof (MPLIST_Entry)) ;
+        }
+
+        MPCS_leave ((MPCS_Handle) &ctrl->lockObj) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_delete", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_open
+ *
+ *  @desc   This function opens an MPLIST object specified by its name and gets
+ *          a handle to the object.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_open (IN     ProcessorId     procId,
+             IN     Char8 *         name,
+             OUT    MPLIST_Handle * mplistHandle)
+{
+    DSP_STATUS     status = DSP_SOK ;
+    MPLIST_Ctrl *  ctrl ;
+    MPLIST_Entry * entry ;
+
+    TRC_3ENTER ("MPLIST_open", procId, name, mplistHandle) ;
+
+    if (    (!IS_VALID_PROCID (procId))
+        ||  (name == NULL)
+        ||  (mplistHandle == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *mplistHandle = NULL ;
+        status = MPLIST_getCtrl (procId, &ctrl) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        MPCS_enter ((MPCS_Handle) &ctrl->lockObj) ;
+
+        entry = MPLIST_findEntry (ctrl, name) ;
+        if (entry == NULL) {
+            status = DSP_ENOTFOUND ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            *mplistHandle = (MPLIST_Handle) DRV_phyToUsr (
+                                       DRV_PTR_TO_ADDR (entry->phyListHandle)) ;
+        }
+
+        MPCS_leave ((MPCS_Handle) &ctrl->lockObj) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_open", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_close
+ *
+ *  @desc   This function closes an MPLIST instance.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_close (IN MPLIST_Handle mplistHandle)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_1ENTER ("MPLIST_close", mplistHandle) ;
+
+    if (mplistHandle == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("MPLIST_close", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_isEmpty
+ *
+ *  @desc   Check for an empty list.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Bool
+MPLIST_isEmpty (IN  MPLIST_Handle mplistHandle)
+{
+    Bool          isEmpty = TRUE ;
+    MPLIST_List * list    = (MPLIST_List *) mplistHandle ;
+
+    TRC_1ENTER ("MPLIST_isEmpty", mplistHandle) ;
+
+    DBC_Require (list != NULL) ;
+
+    if (list != NULL) {
+        MPCS_enter ((MPCS_Handle) &list->mpcsObj) ;
+        isEmpty = (MPLIST_USR (list->head.next) == &list->head) ;
+        MPCS_leave ((MPCS_Handle) &list->mpcsObj) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_isEmpty", isEmpty) ;
+
+    return isEmpty ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_insertBefore
+ *
+ *  @desc   Inserts the element before the existing element.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_insertBefore (IN  MPLIST_Handle mplistHandle,
+                     IN  MPLIST_Elem   insertElement,
+                     IN  MPLIST_Elem   existingElement)
+{
+    DSP_STATUS      status = DSP_SOK ;
+    MPLIST_List *   list   = (MPLIST_List *) mplistHandle ;
+    MPLIST_Header * prev ;
+
+    TRC_3ENTER ("MPLIST_insertBefore",
+                mplistHandle, insertElement, existingElement) ;
+
+    if (    (list == NULL)
+        ||  (insertElement == NULL)
+        ||  (existingElement == NULL)
+        ||  (DRV_usrToPhy (insertElement) == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        MPCS_enter ((MPCS_Handle) &list->mpcsObj) ;
+
+        prev = MPLIST_USR (existingElement->prev) ;
+        insertElement->next   = MPLIST_PHYS (existingElement) ;
+        insertElement->prev   = existingElement->prev ;
+        prev->next            = MPLIST_PHYS (insertElement) ;
+        existingElement->prev = MPLIST_PHYS (insertElement) ;
+
+        MPCS_leave ((MPCS_Handle) &list->mpcsObj) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_insertBefore", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_putTail
+ *
+ *  @desc   Adds the specified element to the tail of the list.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_putTail (IN MPLIST_Handle mplistHandle,
+                IN MPLIST_Elem element)
+{
+    DSP_STATUS    status = DSP_SOK ;
+    MPLIST_List * list   = (MPLIST_List *) mplistHandle ;
+
+    TRC_2ENTER ("MPLIST_putTail", mplistHandle, element) ;
+
+    if ((list == NULL) || (element == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = MPLIST_insertBefore (mplistHandle, element, &list->head) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_putTail", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_removeElement
+ *
+ *  @desc   Removes (unlinks) the given element from the list, if the list is
+ *          not empty.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_removeElement (IN MPLIST_Handle mplistHandle,
+                      IN MPLIST_Elem   element)
+{
+    DSP_STATUS      status = DSP_SOK ;
+    MPLIST_List *   list   = (MPLIST_List *) mplistHandle ;
+    MPLIST_Header * prev ;
+    MPLIST_Header * next ;
+
+    TRC_2ENTER ("MPLIST_removeElement", mplistHandle, element) ;
+
+    if ((list == NULL) || (element == NULL) || (element == &list->head)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        MPCS_enter ((MPCS_Handle) &list->mpcsObj) ;
+
+        if (MPLIST_USR (list->head.next) != &list->head) {
+            prev = MPLIST_USR (element->prev) ;
+            next = MPLIST_USR (element->next) ;
+            prev->next    = element->next ;
+            next->prev    = element->prev ;
+            element->next = NULL ;
+            element->prev = NULL ;
+        }
+
+        MPCS_leave ((MPCS_Handle) &list->mpcsObj) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_removeElement", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_first
+ *
+ *  @desc   Returns a pointer to the first element of the list, or NULL if
+ *          the list is empty.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_first (IN MPLIST_Handle   mplistHandle,
+              OUT MPLIST_Elem *  element)
+{
+    DSP_STATUS      status = DSP_SOK ;
+    MPLIST_List *   list   = (MPLIST_List *) mplistHandle ;
+    MPLIST_Header * first ;
+
+    TRC_2ENTER ("MPLIST_first", mplistHandle, element) ;
+
+    if ((list == NULL) || (element == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        MPCS_enter ((MPCS_Handle) &list->mpcsObj) ;
+
+        first = MPLIST_USR (list->head.next) ;
+        *element = (first == &list->head) ? NULL : first ;
+
+        MPCS_leave ((MPCS_Handle) &list->mpcsObj) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_first", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_next
+ *
+ *  @desc   Returns a pointer to the next element of the list, or NULL if
+ *          the next element is the head of the list or the list is empty.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_next (IN  MPLIST_Handle   mplistHandle,
+             IN  MPLIST_Elem     currentElement,
+             OUT MPLIST_Elem *   nextElement)
+{
+    DSP_STATUS      status = DSP_SOK ;
+    MPLIST_List *   list   = (MPLIST_List *) mplistHandle ;
+    MPLIST_Header * next ;
+
+    TRC_3ENTER ("MPLIST_next", mplistHandle, currentElement, nextElement) ;
+
+    if (    (list == NULL)
+        ||  (currentElement == NULL)
+        ||  (nextElement == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        MPCS_enter ((MPCS_Handle) &list->mpcsObj) ;
+
+        next = MPLIST_USR (currentElement->next) ;
+        *nextElement = (next == &list->head) ? NULL : next ;
+
+        MPCS_leave ((MPCS_Handle) &list->mpcsObj) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_next", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MPLIST_getHead
+ *
+ *  @desc   Pops the head off the list and returns a pointer to it.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MPLIST_getHead (IN MPLIST_Handle mplistHandle, OUT MPLIST_Elem * element)
+{
+    DSP_STATUS      status = DSP_SOK ;
+    MPLIST_List *   list   = (MPLIST_List *) mplistHandle ;
+    MPLIST_Header * first ;
+    MPLIST_Header * next ;
+
+    TRC_2ENTER ("MPLIST_getHead", mplistHandle, element) ;
+
+    if ((list == NULL) || (element == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        MPCS_enter ((MPCS_Handle) &list->mpcsObj) ;
+
+        first = MPLIST_USR (list->head.next) ;
+        if (first == &list->head) {
+            *element = NULL ;
+        }
+        else {
+            next = MPLIST_USR (first->next) ;
+            list->head.next = first->next ;
+            next->prev      = first->prev ;
+            first->next     = NULL ;
+            first->prev     = NULL ;
+            *element        = first ;
+        }
+
+        MPCS_leave ((MPCS_Handle) &list->mpcsObj) ;
+    }
+
+    TRC_1LEAVE ("MPLIST_getHead", status) ;
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,1047 @@
+/** ============================================================================
+ *  @file   msgq.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/api/
+ *
+ *  @desc   Implementation of the API sub-component MSGQ.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Profiling                   */
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* #if defined (DDSP_PROFILE) */
+
+/*  ----------------------------------- User API                    */
+#include <msgq.h>
+
+/*  ----------------------------------- Host backend                */
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_API_MSGQ, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @func   MSGQ_largeToUsr
+ *
+ *  @desc   Translates the scatter list of a large message returned by the
+ *          driver to addresses in the calling process.
+ *
+ *  @arg    largeMsg
+ *              Large message.
+ *
+ *  @ret    None
+ *
+ *  @enter  largeMsg must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_allocLarge, MSGQ_getLarge
+ *  ============================================================================
+ */
+STATIC
+Void
+MSGQ_largeToUsr (IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    Uint32 i ;
+
+    for (i = 0u ;
+         (i < largeMsg->numFrags) && (i < largeMsg->maxFrags) ;
+         i++) {
+        largeMsg->frags [i].msg  = (MSGQ_Msg) DRV_phyToUsr (
+                                   DRV_PTR_TO_ADDR (largeMsg->frags [i].msg)) ;
+        largeMsg->frags [i].data = DRV_phyToUsr (
+                                   DRV_PTR_TO_ADDR (largeMsg->frags [i].data)) ;
+    }
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_transportOpen
+ *
+ *  @desc   This function initializes the transport associated with the
+ *          specified processor.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_transportOpen (IN  ProcessorId procId, IN  Pvoid attrs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("MSGQ_transportOpen", procId, attrs) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqTransportOpenArgs.procId = procId ;
+        args.apiArgs.msgqTransportOpenArgs.attrs  = attrs ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_TRANSPORTOPEN, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_transportOpen", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_transportClose
+ *
+ *  @desc   This function finalizes the transport associated with the
+ *          specified processor.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_transportClose (IN ProcessorId procId)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("MSGQ_transportClose", procId) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqTransportCloseArgs.procId = procId ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_TRANSPORTCLOSE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_transportClose", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_open
+ *
+ *  @desc   This function opens the message queue to be used for receiving
+ *          messages, identified through the specified message queue name.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_open (IN     Pstr         queueName,
+           OUT    MSGQ_Queue * msgqQueue,
+           IN OPT MSGQ_Attrs * attrs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("MSGQ_open", queueName, msgqQueue, attrs) ;
+
+    if (msgqQueue == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqOpenArgs.queueName = queueName ;
+        args.apiArgs.msgqOpenArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqOpenArgs.attrs     = attrs ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_OPEN, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_open", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_close
+ *
+ *  @desc   This function closes the message queue identified by the specified
+ *          MSGQ handle.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_close (IN MSGQ_Queue msgqQueue)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("MSGQ_close", msgqQueue) ;
+
+    args.apiArgs.msgqCloseArgs.msgqQueue = msgqQueue ;
+    status = DRV_INVOKE (DRV_handle, CMD_MSGQ_CLOSE, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    TRC_1LEAVE ("MSGQ_close", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_locate
+ *
+ *  @desc   This function synchronously locates the message queue identified
+ *          by the specified MSGQ name and returns a handle to the located
+ *          message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_locate (IN     Pstr               queueName,
+             OUT    MSGQ_Queue *       msgqQueue,
+             IN OPT MSGQ_LocateAttrs * attrs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("MSGQ_locate", queueName, msgqQueue, attrs) ;
+
+    if ((queueName == NULL) || (msgqQueue == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqLocateArgs.queueName = queueName ;
+        args.apiArgs.msgqLocateArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqLocateArgs.attrs     = attrs ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_LOCATE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_locate", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_locateAsync
+ *
+ *  @desc   This function asynchronously locates the message queue identified
+ *          by the specified MSGQ name.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_locateAsync (IN Pstr                    queueName,
+                  IN MSGQ_Queue              replyQueue,
+                  IN MSGQ_LocateAsyncAttrs * attrs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("MSGQ_locateAsync", queueName, replyQueue, attrs) ;
+
+    if ((queueName == NULL) || (attrs == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqLocateAsyncArgs.queueName  = queueName ;
+        args.apiArgs.msgqLocateAsyncArgs.replyQueue = replyQueue ;
+        args.apiArgs.msgqLocateAsyncArgs.attrs      = attrs ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_LOCATEASYNC, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_locateAsync", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_release
+ *
+ *  @desc   This function releases the message queue identified by the MSGQ
+ *          handle that was located earlier.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_release (IN MSGQ_Queue msgqQueue)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("MSGQ_release", msgqQueue) ;
+
+    args.apiArgs.msgqReleaseArgs.msgqQueue = msgqQueue ;
+    status = DRV_INVOKE (DRV_handle, CMD_MSGQ_RELEASE, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    TRC_1LEAVE ("MSGQ_release", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_alloc
+ *
+ *  @desc   This function allocates a message, and returns the pointer to the
+ *          user.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_alloc (IN PoolId poolId, IN Uint16 size, OUT MSGQ_Msg * msg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("MSGQ_alloc", poolId, size, msg) ;
+
+    if (msg == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *msg = NULL ;
+        args.apiArgs.msgqAllocArgs.poolId = poolId ;
+        args.apiArgs.msgqAllocArgs.size   = size ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_ALLOC, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            *msg = (MSGQ_Msg) DRV_phyToUsr (args.apiArgs.msgqAllocArgs.msgAddr) ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_alloc", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_free
+ *
+ *  @desc   This function frees a message.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_free (IN MSGQ_Msg msg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("MSGQ_free", msg) ;
+
+    if (msg == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqFreeArgs.msg = msg ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_FREE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_free", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_put
+ *
+ *  @desc   This function sends a message to the specified MSGQ.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_put (IN MSGQ_Queue msgqQueue, IN MSGQ_Msg msg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("MSGQ_put", msgqQueue, msg) ;
+
+    if (msg == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqPutArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqPutArgs.msg       = msg ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_PUT, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_put", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_get
+ *
+ *  @desc   This function receives a message on the specified MSGQ.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_get (IN MSGQ_Queue msgqQueue, IN Uint32 timeout, OUT MSGQ_Msg * msg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("MSGQ_get", msgqQueue, timeout, msg) ;
+
+    if (msg == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *msg = NULL ;
+        args.apiArgs.msgqGetArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqGetArgs.timeout   = timeout ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_GET, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            *msg = (MSGQ_Msg) DRV_phyToUsr (args.apiArgs.msgqGetArgs.msgAddr) ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_get", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_putv
+ *
+ *  @desc   This function sends an array of messages to the specified MSGQ in
+ *          a single call.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_putv (IN  MSGQ_Queue msgqQueue,
+           IN  MSGQ_Msg * msgArray,
+           IN  Uint32     numMsgs,
+           OUT Uint32 *   numPut)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+    Uint32     i ;
+
+    TRC_4ENTER ("MSGQ_putv", msgqQueue, msgArray, numMsgs, numPut) ;
+
+    if ((msgArray == NULL) || (numPut == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *numPut = 0u ;
+        for (i = 0u ; (i < numMsgs) && DSP_SUCCEEDED (status) ; i++) {
+            if (msgArray [i] == NULL) {
+                status = DSP_EINVALIDARG ;
+                SET_FAILURE_REASON ;
+            }
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        args.apiArgs.msgqPutvArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqPutvArgs.msgArray  = msgArray ;
+        args.apiArgs.msgqPutvArgs.numMsgs   = numMsgs ;
+        args.apiArgs.msgqPutvArgs.numPut    = 0u ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_PUTV, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status  = args.apiStatus ;
+            *numPut = args.apiArgs.msgqPutvArgs.numPut ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_putv", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_getv
+ *
+ *  @desc   This function receives up to maxMsgs messages on the specified
+ *          MSGQ in a single call.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_getv (IN  MSGQ_Queue msgqQueue,
+           IN  Uint32     timeout,
+           OUT MSGQ_Msg * msgArray,
+           IN  Uint32     maxMsgs,
+           OUT Uint32 *   numMsgs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+    Uint32     i ;
+
+    TRC_5ENTER ("MSGQ_getv", msgqQueue, timeout, msgArray, maxMsgs, numMsgs) ;
+
+    if ((msgArray == NULL) || (maxMsgs == 0u) || (numMsgs == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *numMsgs = 0u ;
+        args.apiArgs.msgqGetvArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqGetvArgs.timeout   = timeout ;
+        args.apiArgs.msgqGetvArgs.msgArray  = msgArray ;
+        args.apiArgs.msgqGetvArgs.maxMsgs   = maxMsgs ;
+        args.apiArgs.msgqGetvArgs.numMsgs   = 0u ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_GETV, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            /* The driver returns the physical address of each message. */
+            *numMsgs = args.apiArgs.msgqGetvArgs.numMsgs ;
+            for (i = 0u ; i < *numMsgs ; i++) {
+                msgArray [i] = (MSGQ_Msg) DRV_phyToUsr (
+                                          DRV_PTR_TO_ADDR (msgArray [i])) ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_getv", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_allocLarge
+ *
+ *  @desc   This function allocates the fragments of a large message and
+ *          fills its scatter list.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_allocLarge (IN     PoolId          poolId,
+                 IN     Uint32          size,
+                 IN     Uint16          fragSize,
+                 IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_4ENTER ("MSGQ_allocLarge", poolId, size, fragSize, largeMsg) ;
+
+    if ((largeMsg == NULL) || (largeMsg->frags == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqAllocLargeArgs.poolId   = poolId ;
+        args.apiArgs.msgqAllocLargeArgs.size     = size ;
+        args.apiArgs.msgqAllocLargeArgs.fragSize = fragSize ;
+        args.apiArgs.msgqAllocLargeArgs.largeMsg = largeMsg ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_ALLOCLARGE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+            MSGQ_largeToUsr (largeMsg) ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_allocLarge", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_freeLarge
+ *
+ *  @desc   This function frees all the fragments of a large message.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_freeLarge (IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("MSGQ_freeLarge", largeMsg) ;
+
+    if ((largeMsg == NULL) || (largeMsg->frags == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqFreeLargeArgs.largeMsg = largeMsg ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_FREELARGE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_freeLarge", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_putLarge
+ *
+ *  @desc   This function sends a large message to the specified MSGQ.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_putLarge (IN MSGQ_Queue msgqQueue, IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("MSGQ_putLarge", msgqQueue, largeMsg) ;
+
+    if ((largeMsg == NULL) || (largeMsg->frags == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqPutLargeArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqPutLargeArgs.largeMsg  = largeMsg ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_PUTLARGE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_putLarge", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_getLarge
+ *
+ *  @desc   This function receives a large message on the specified MSGQ as
+ *          a scatter list of its fragments.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_getLarge (IN     MSGQ_Queue      msgqQueue,
+               IN     Uint32          timeout,
+               IN OUT MSGQ_LargeMsg * largeMsg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("MSGQ_getLarge", msgqQueue, timeout, largeMsg) ;
+
+    if (    (largeMsg == NULL)
+        ||  (largeMsg->frags == NULL)
+        ||  (largeMsg->maxFrags == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqGetLargeArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqGetLargeArgs.timeout   = timeout ;
+        args.apiArgs.msgqGetLargeArgs.largeMsg  = largeMsg ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_GETLARGE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+            MSGQ_largeToUsr (largeMsg) ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_getLarge", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_getSrcQueue
+ *
+ *  @desc   This function returns a handle to the source message queue of a
+ *          message to be used for replying to the message.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_getSrcQueue (IN MSGQ_Msg msg, OUT MSGQ_Queue * msgqQueue)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_2ENTER ("MSGQ_getSrcQueue", msg, msgqQueue) ;
+
+    if ((msg == NULL) || (msgqQueue == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (msg->srcId == MSGQ_INVALIDMSGQ) {
+        status = DSP_ENOTFOUND ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        *msgqQueue = ((Uint32) msg->srcProcId << 16u) | msg->srcId ;
+    }
+
+    TRC_1LEAVE ("MSGQ_getSrcQueue", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_getPollFd
+ *
+ *  @desc   This API returns a file descriptor that is readable while
+ *          messages are queued on a local message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_getPollFd (IN MSGQ_Queue msgqQueue, OUT Int32 * fd)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("MSGQ_getPollFd", msgqQueue, fd) ;
+
+    if (fd == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqGetPollFdArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqGetPollFdArgs.fd        = fd ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_GETPOLLFD, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_getPollFd", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_count
+ *
+ *  @desc   This API returns the count of the number of messages in a local
+ *          message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_count (IN MSGQ_Queue msgqQueue, OUT Uint16 * count)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("MSGQ_count", msgqQueue, count) ;
+
+    if (count == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqCountArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqCountArgs.count     = count ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_COUNT, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_count", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_countLane
+ *
+ *  @desc   This API returns the count of the number of messages in one
+ *          priority lane of a local message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_countLane (IN  MSGQ_Queue msgqQueue,
+                IN  Uint32     lane,
+                OUT Uint16 *   count)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("MSGQ_countLane", msgqQueue, lane, count) ;
+
+    if (count == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqCountLaneArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqCountLaneArgs.lane      = lane ;
+        args.apiArgs.msgqCountLaneArgs.count     = count ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_COUNTLANE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_countLane", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_setErrorHandler
+ *
+ *  @desc   This API allows the user to designate a MSGQ as an error-handler
+ *          MSGQ to receive asynchronous error messages from the transports.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_setErrorHandler (IN MSGQ_Queue errorQueue, IN PoolId poolId)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("MSGQ_setErrorHandler", errorQueue, poolId) ;
+
+    args.apiArgs.msgqSetErrorHandlerArgs.errorQueue = errorQueue ;
+    args.apiArgs.msgqSetErrorHandlerArgs.poolId     = poolId ;
+    status = DRV_INVOKE (DRV_handle, CMD_MSGQ_SETERRORHANDLER, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    TRC_1LEAVE ("MSGQ_setErrorHandler", status) ;
+
+    return status ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   MSGQ_instrument
+ *
+ *  @desc   This function gets the instrumentation information related to the
+ *          specified message queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_instrument (IN MSGQ_Queue msgqQueue, OUT MSGQ_Instrument * retVal)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("MSGQ_instrument", msgqQueue, retVal) ;
+
+    if (retVal == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqInstrumentArgs.msgqQueue = msgqQueue ;
+        args.apiArgs.msgqInstrumentArgs.retVal    = retVal ;
+        status = DRV_INVOKE (DRV_handle, CMD_MSGQ_INSTRUMENT, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_instrument", status) ;
+
+    return status ;
+}
+#endif /* defined (DDSP_PROFILE) */
+
+
+#if defined (DDSP_DEBUG)
+/** ============================================================================
+ *  @func   MSGQ_debug
+ *
+ *  @desc   This function prints the current status of the MSGQ subcomponent.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+MSGQ_debug (IN MSGQ_Queue msgqQueue)
+{
+    CMD_Args args ;
+
+    TRC_1ENTER ("MSGQ_debug", msgqQueue) ;
+
+    args.apiArgs.msgqDebugArgs.msgqQueue = msgqQueue ;
+    DRV_INVOKE (DRV_handle, CMD_MSGQ_DEBUG, &args) ;
+
+    TRC_0LEAVE ("MSGQ_debug") ;
+}
+#endif /* defined (DDSP_DEBUG) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,267 @@
+/** ============================================================================
+ *  @file   notify.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/api/
+ *
+ *  @desc   Implementation of the API sub-component NOTIFY. The callbacks are
+ *          run by the dispatch thread of the driver in the calling process.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Profiling                   */
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* #if defined (DDSP_PROFILE) */
+
+/*  ----------------------------------- User API                    */
+#include <notify.h>
+
+/*  ----------------------------------- Host backend                */
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_API_NOTIFY, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/** ============================================================================
+ *  @func   NOTIFY_register
+ *
+ *  @desc   This function registers a callback for a specific event with the
+ *          Notify component.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+NOTIFY_register (IN     ProcessorId    dspId,
+                 IN     Uint32         ipsId,
+                 IN     Uint32         eventNo,
+                 IN     FnNotifyCbck   fnNotifyCbck,
+                 IN OPT Pvoid          cbckArg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_5ENTER ("NOTIFY_register", dspId, ipsId, eventNo, fnNotifyCbck, cbckArg) ;
+
+    if ((!IS_VALID_PROCID (dspId)) || (fnNotifyCbck == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.notifyRegisterArgs.dspId        = dspId ;
+        args.apiArgs.notifyRegisterArgs.ipsId        = ipsId ;
+        args.apiArgs.notifyRegisterArgs.eventNo      = eventNo ;
+        args.apiArgs.notifyRegisterArgs.fnNotifyCbck = (Pvoid) fnNotifyCbck ;
+        args.apiArgs.notifyRegisterArgs.cbckArg      = cbckArg ;
+        status = DRV_INVOKE (DRV_handle, CMD_NOTIFY_REGISTER, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("NOTIFY_register", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   NOTIFY_unregister
+ *
+ *  @desc   This function un-registers the callback for the specific event with
+ *          the Notify component.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+NOTIFY_unregister (IN     ProcessorId    dspId,
+                   IN     Uint32         ipsId,
+                   IN     Uint32         eventNo,
+                   IN     FnNotifyCbck   fnNotifyCbck,
+                   IN OPT Pvoid          cbckArg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_5ENTER ("NOTIFY_unregister",
+                dspId, ipsId, eventNo, fnNotifyCbck, cbckArg) ;
+
+    if ((!IS_VALID_PROCID (dspId)) || (fnNotifyCbck == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.notifyUnregisterArgs.dspId        = dspId ;
+        args.apiArgs.notifyUnregisterArgs.ipsId        = ipsId ;
+        args.apiArgs.notifyUnregisterArgs.eventNo      = eventNo ;
+        args.apiArgs.notifyUnregisterArgs.fnNotifyCbck = (Pvoid) fnNotifyCbck ;
+        args.apiArgs.notifyUnregisterArgs.cbckArg      = cbckArg ;
+        status = DRV_INVOKE (DRV_handle, CMD_NOTIFY_UNREGISTER, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("NOTIFY_unregister", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   NOTIFY_notify
+ *
+ *  @desc   This function sends a notification of an event to the processor.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+NOTIFY_notify (IN     ProcessorId dspId,
+               IN     Uint32      ipsId,
+               IN     Uint32      eventno,
+               IN OPT Uint32      payload)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_4ENTER ("NOTIFY_notify", dspId, ipsId, eventno, payload) ;
+
+    if (!IS_VALID_PROCID (dspId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.notifyNotifyArgs.dspId   = dspId ;
+        args.apiArgs.notifyNotifyArgs.ipsId   = ipsId ;
+        args.apiArgs.notifyNotifyArgs.eventNo = eventno ;
+        args.apiArgs.notifyNotifyArgs.payload = payload ;
+        status = DRV_INVOKE (DRV_handle, CMD_NOTIFY_NOTIFY, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("NOTIFY_notify", status) ;
+
+    return status ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   NOTIFY_instrument
+ *
+ *  @desc   This function gets the instrumentation information related to the
+ *          specified IPS.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+NOTIFY_instrument (IN  ProcessorId       dspId,
+                   IN  Uint32            ipsId,
+                   OUT IPS_Instrument *  retVal)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("NOTIFY_instrument", dspId, ipsId, retVal) ;
+
+    if ((!IS_VALID_PROCID (dspId)) || (retVal == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.ipsInstrumentArgs.dspId    = dspId ;
+        args.apiArgs.ipsInstrumentArgs.ipsId    = ipsId ;
+        args.apiArgs.ipsInstrumentArgs.ipsStats = retVal ;
+        status = DRV_INVOKE (DRV_handle, CMD_NOTIFY_INSTRUMENT, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("NOTIFY_instrument", status) ;
+
+    return status ;
+}
+#endif /* defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
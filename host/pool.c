@@ -0,0 +1,772 @@
+/** ============================================================================
+ *  @file   pool.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/api/
+ *
+ *  @desc   Implementation of the API sub-component POOL.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- User API                    */
+#include <pool.h>
+
+/*  ----------------------------------- Host backend                */
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_API_POOL, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/*  ============================================================================
+ *  @func   POOL_batchMerge
+ *
+ *  @desc   Widens the ranges of a batch to whole cache lines, sorts them by
+ *          address and merges the overlapping or adjacent ones in place.
+ *
+ *  @arg    ranges
+ *              Ranges to merge.
+ *  @arg    numRanges
+ *              Number of ranges.
+ *  @arg    lines
+ *              Receives the number of cache lines covered by the ranges
+ *              before they are merged.
+ *
+ *  @ret    Number of extents left at the start of the ranges.
+ *
+ *  @enter  numRanges must be greater than 0.
+ *
+ *  @leave  None
+ *
+ *  @see    POOL_batchFlush
+ *  ============================================================================
+ */
+STATIC
+Uint32
+POOL_batchMerge (IN OUT POOL_CacheRange * ranges,
+                 IN     Uint32            numRanges,
+                 OUT    Uint32 *          lines)
+{
+    Uint32          extents = 0 ;
+    POOL_CacheRange range ;
+    unsigned long   start ;
+    unsigned long   end ;
+    unsigned long   last ;
+    Uint32          i ;
+    Uint32          j ;
+
+    *lines = 0 ;
+    for (i = 0 ; i < numRanges ; i++) {
+        start = (unsigned long) ranges [i].buf & ~(CACHE_L2_LINESIZE - 1) ;
+        end   = (  ((unsigned long) ranges [i].buf + ranges [i].size
+                  + CACHE_L2_LINESIZE - 1)
+                 & ~(CACHE_L2_LINESIZE - 1)) ;
+        ranges [i].buf  = (Pvoid) start ;
+        ranges [i].size = (Uint32) (end - start) ;
+        *lines += ranges [i].size / CACHE_L2_LINESIZE ;
+
+        /*  Batches are short and mostly filled in address order, so an
+         *  insertion sort is close to linear here.
+         */
+        range = ranges [i] ;
+        for (j = i ;
+             (j > 0) && ((unsigned long) ranges [j - 1].buf > start) ;
+             j--) {
+            ranges [j] = ranges [j - 1] ;
+        }
+        ranges [j] = range ;
+    }
+
+    for (i = 1 ; i < numRanges ; i++) {
+        last = (unsigned long) ranges [extents].buf + ranges [extents].size ;
+        start = (unsigned long) ranges [i].buf ;
+        if (start <= last) {
+            end = start + ranges [i].size ;
+            if (end > last) {
+                ranges [extents].size += (Uint32) (end - last) ;
+            }
+        }
+        else {
+            extents++ ;
+            ranges [extents] = ranges [i] ;
+        }
+    }
+
+    return extents + 1 ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_open
+ *
+ *  @desc   This function opens a specific pool referenced by the pool Id
+ *          provided.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_open (IN PoolId poolId, IN Pvoid params)
+{
+    DSP_STATUS      status = DSP_SOK ;
+    CMD_Args        args ;
+    POOL_OpenParams poolOpenParams ;
+
+    TRC_2ENTER ("POOL_open", poolId, params) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        poolOpenParams.params = params ;
+        args.apiArgs.poolOpenArgs.poolId = poolId ;
+        args.apiArgs.poolOpenArgs.params = &poolOpenParams ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_OPEN, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_open", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_close
+ *
+ *  @desc   This function closes a specific pool whose pool id is provided.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_close (IN PoolId poolId)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("POOL_close", poolId) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.poolCloseArgs.poolId = poolId ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_CLOSE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_close", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_alloc
+ *
+ *  @desc   This function allocates a buffer of the specified size from a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_alloc (IN PoolId poolId, OUT Pvoid * bufPtr, IN Uint32 size)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("POOL_alloc", poolId, bufPtr, size) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))
+        ||  (bufPtr == NULL)
+        ||  (size == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.poolAllocArgs.poolId = poolId ;
+        args.apiArgs.poolAllocArgs.size   = size ;
+        args.apiArgs.poolAllocArgs.bufPtr = bufPtr ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_ALLOC, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_alloc", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_free
+ *
+ *  @desc   This function frees a buffer into the specified pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_free (IN PoolId poolId, IN Pvoid buf, IN Uint32 size)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("POOL_free", poolId, buf, size) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))
+        ||  (buf == NULL)
+        ||  (size == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.poolFreeArgs.poolId = poolId ;
+        args.apiArgs.poolFreeArgs.size   = size ;
+        args.apiArgs.poolFreeArgs.bufPtr = buf ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_FREE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_free", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_translateAddr
+ *
+ *  @desc   This function translates addresses between two address spaces for
+ *          a buffer that was allocated from the specified pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_translateAddr (IN  PoolId           poolId,
+                    OUT Pvoid *          dstAddr,
+                    IN  AddrType         dstAddrType,
+                    IN  Pvoid            srcAddr,
+                    IN  AddrType         srcAddrType)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_5ENTER ("POOL_translateAddr",
+                poolId, dstAddr, dstAddrType, srcAddr, srcAddrType) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))
+        ||  (dstAddr == NULL)
+        ||  (srcAddr == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.poolTranslateAddrArgs.poolId      = poolId ;
+        args.apiArgs.poolTranslateAddrArgs.dstAddr     = dstAddr ;
+        args.apiArgs.poolTranslateAddrArgs.dstAddrType = dstAddrType ;
+        args.apiArgs.poolTranslateAddrArgs.srcAddr     = srcAddr ;
+        args.apiArgs.poolTranslateAddrArgs.srcAddrType = srcAddrType ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_TRANSLATEADDR, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_translateAddr", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_getPoolId
+ *
+ *  @desc   This function gets the pool id of the buffer that was allocated
+ *          from the pool. The open pools of the processor are searched for
+ *          the one whose region contains the address.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_getPoolId (IN  ProcessorId procId,
+                IN  Pvoid       addr,
+                IN  AddrType    addrType,
+                OUT PoolId *    poolId)
+{
+    DSP_STATUS status    = DSP_ENOTFOUND ;
+    DSP_STATUS tmpStatus ;
+    Pvoid      usrAddr ;
+    Uint32     poolNo ;
+
+    TRC_4ENTER ("POOL_getPoolId", procId, addr, addrType, poolId) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (addr == NULL) || (poolId == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        for (poolNo = 0u ;
+             (poolNo < MAX_POOLENTRIES) && (status == DSP_ENOTFOUND) ;
+             poolNo++) {
+            tmpStatus = POOL_translateAddr (POOL_makePoolId (procId, poolNo),
+                                            &usrAddr,
+                                            AddrType_Usr,
+                                            addr,
+                                            addrType) ;
+            if (DSP_SUCCEEDED (tmpStatus)) {
+                *poolId = POOL_makePoolId (procId, poolNo) ;
+                status  = DSP_SOK ;
+            }
+        }
+
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_getPoolId", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_writeback
+ *
+ *  @desc   This function write backs the content of the buffer to peer's
+ *          memory.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_writeback (IN PoolId poolId, IN Pvoid buf, IN Uint32 size)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("POOL_writeback", poolId, buf, size) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))
+        ||  (buf == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.poolWBArgs.poolId = poolId ;
+        args.apiArgs.poolWBArgs.size   = size ;
+        args.apiArgs.poolWBArgs.bufPtr = buf ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_WRITEBACK, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_writeback", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_invalidate
+ *
+ *  @desc   This function invalidates the content of the buffer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_invalidate (IN PoolId poolId, IN Pvoid buf, IN Uint32 size)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("POOL_invalidate", poolId, buf, size) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))
+        ||  (buf == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.poolInvArgs.poolId = poolId ;
+        args.apiArgs.poolInvArgs.size   = size ;
+        args.apiArgs.poolInvArgs.bufPtr = buf ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_INVALIDATE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_invalidate", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_reconfigure
+ *
+ *  @desc   This function changes the configuration of an open pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_reconfigure (IN PoolId poolId, IN Pvoid params)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("POOL_reconfigure", poolId, params) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))
+        ||  (params == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.poolReconfigureArgs.poolId = poolId ;
+        args.apiArgs.poolReconfigureArgs.args   = params ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_RECONFIGURE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_reconfigure", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_batchInit
+ *
+ *  @desc   This function prepares a batch deferring one cache operation on
+ *          buffers of a pool.
+ *
+ *  @modif  batch
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_batchInit (IN  PoolId            poolId,
+                IN  POOL_CacheOp      op,
+                IN  POOL_CacheRange * ranges,
+                IN  Uint32            maxRanges,
+                OUT POOL_CacheBatch * batch)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_5ENTER ("POOL_batchInit", poolId, op, ranges, maxRanges, batch) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))
+        ||  (   (op != POOL_CacheOp_Writeback)
+             && (op != POOL_CacheOp_Invalidate))
+        ||  (ranges == NULL)
+        ||  (maxRanges == 0)
+        ||  (batch == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        batch->poolId           = poolId ;
+        batch->op               = op ;
+        batch->ranges           = ranges ;
+        batch->maxRanges        = maxRanges ;
+        batch->numRanges        = 0 ;
+        batch->stats.numRanges  = 0 ;
+        batch->stats.numOps     = 0 ;
+        batch->stats.numFlushes = 0 ;
+        batch->stats.bytesSaved = 0 ;
+        batch->stats.linesSaved = 0 ;
+    }
+
+    TRC_1LEAVE ("POOL_batchInit", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_batchAdd
+ *
+ *  @desc   This function records a range of a buffer in a batch.
+ *
+ *  @modif  batch
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_batchAdd (IN OUT POOL_CacheBatch * batch, IN Pvoid buf, IN Uint32 size)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    TRC_3ENTER ("POOL_batchAdd", batch, buf, size) ;
+
+    if ((batch == NULL) || (batch->ranges == NULL) || (buf == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (size != 0) {
+        if (batch->numRanges == batch->maxRanges) {
+            /*  The range is recorded even if the flush failed, the failure
+             *  concerns ranges added before it.
+             */
+            status = POOL_batchFlush (batch) ;
+        }
+        batch->ranges [batch->numRanges].buf  = buf ;
+        batch->ranges [batch->numRanges].size = size ;
+        batch->numRanges++ ;
+        batch->stats.numRanges++ ;
+    }
+
+    TRC_1LEAVE ("POOL_batchAdd", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_batchFlush
+ *
+ *  @desc   This function issues the cache operations of the ranges recorded
+ *          in a batch and empties it.
+ *
+ *  @modif  batch
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_batchFlush (IN OUT POOL_CacheBatch * batch)
+{
+    DSP_STATUS status = DSP_SOK ;
+    Uint32     extents ;
+    Uint32     lines ;
+    Uint32     saved ;
+    Uint32     i ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("POOL_batchFlush", batch) ;
+
+    if ((batch == NULL) || (batch->ranges == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (batch->numRanges != 0) {
+        extents = POOL_batchMerge (batch->ranges, batch->numRanges, &lines) ;
+        saved   = lines ;
+        for (i = 0 ; i < extents ; i++) {
+            saved -= batch->ranges [i].size / CACHE_L2_LINESIZE ;
+        }
+
+        args.apiArgs.poolCacheVArgs.poolId    = batch->poolId ;
+        args.apiArgs.poolCacheVArgs.op        = batch->op ;
+        args.apiArgs.poolCacheVArgs.ranges    = batch->ranges ;
+        args.apiArgs.poolCacheVArgs.numRanges = extents ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_CACHEV, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+
+        batch->numRanges         = 0 ;
+        batch->stats.numOps     += extents ;
+        batch->stats.numFlushes++ ;
+        batch->stats.linesSaved += saved ;
+        batch->stats.bytesSaved += saved * CACHE_L2_LINESIZE ;
+    }
+
+    TRC_1LEAVE ("POOL_batchFlush", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   POOL_getOwners
+ *
+ *  @desc   This function gets the owners of the tracked buffers of a pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_getOwners (IN     PoolId            poolId,
+                OUT    POOL_OwnerStats * stats,
+                OUT    POOL_OwnerInfo *  owners,
+                IN OUT Uint32 *          numOwners)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_4ENTER ("POOL_getOwners", poolId, stats, owners, numOwners) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))
+        ||  (stats == NULL)
+        ||  (owners == NULL)
+        ||  (numOwners == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.poolGetOwnersArgs.poolId    = poolId ;
+        args.apiArgs.poolGetOwnersArgs.stats     = stats ;
+        args.apiArgs.poolGetOwnersArgs.owners    = owners ;
+        args.apiArgs.poolGetOwnersArgs.numOwners = numOwners ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_GETOWNERS, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_getOwners", status) ;
+
+    return status ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   POOL_instrument
+ *
+ *  @desc   This function gets the instrumentation information of an open
+ *          pool.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_instrument (IN PoolId poolId, OUT SMAPOOL_Stats * retVal)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("POOL_instrument", poolId, retVal) ;
+
+    if (    (!IS_VALID_POOLID (poolId))
+        ||  (!IS_VALID_PROCID (POOL_getProcId (poolId)))
+        ||  (retVal == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.poolInstrumentArgs.poolId = poolId ;
+        args.apiArgs.poolInstrumentArgs.retVal = retVal ;
+        status = DRV_INVOKE (DRV_handle, CMD_POOL_INSTRUMENT, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("POOL_instrument", status) ;
+
+    return status ;
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
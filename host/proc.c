@@ -0,0 +1,678 @@
+/** ============================================================================
+ *  @file   proc.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/api/
+ *
+ *  @desc   Implementation of the API sub-component PROC.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Profiling                   */
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* #if defined (DDSP_PROFILE) */
+
+/*  ----------------------------------- User API                    */
+#include <proc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_API_PROC, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+
+/** ============================================================================
+ *  @func   PROC_setup
+ *
+ *  @desc   Sets up the necessary data structures for the PROC sub-component.
+ *
+ *  @modif  DRV_handle
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_setup (IN LINKCFG_Object * linkCfg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("PROC_setup", linkCfg) ;
+
+    status = DRV_INITIALIZE (&DRV_handle) ;
+    if (DSP_SUCCEEDED (status)) {
+        args.apiArgs.procSetupArgs.linkCfg = linkCfg ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_SETUP, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+            DRV_FINALIZE (DRV_handle) ;
+        }
+    }
+    else {
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("PROC_setup", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_destroy
+ *
+ *  @desc   Destroys the data structures for the PROC component, allocated
+ *          earlier by a call to PROC_setup ().
+ *
+ *  @modif  DRV_handle
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_destroy (Void)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_0ENTER ("PROC_destroy") ;
+
+    status = DRV_INVOKE (DRV_handle, CMD_PROC_DESTROY, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        DRV_FINALIZE (DRV_handle) ;
+    }
+    else {
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("PROC_destroy", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_attach
+ *
+ *  @desc   Attaches the client to the specified DSP and also initializes the
+ *          DSP (if required).
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_attach (IN  ProcessorId   procId,
+             OPT PROC_Attrs *  attr)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("PROC_attach", procId, attr) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procAttachArgs.procId = procId ;
+        args.apiArgs.procAttachArgs.attr   = attr ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_ATTACH, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_attach", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_detach
+ *
+ *  @desc   Detaches the client from specified processor.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_detach (IN  ProcessorId procId)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("PROC_detach", procId) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procDetachArgs.procId = procId ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_DETACH, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_detach", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_getState
+ *
+ *  @desc   Gets the current status of DSP by querying the Link Driver.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_getState (IN   ProcessorId    procId,
+               OUT  PROC_State *   procState)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("PROC_getState", procId, procState) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (procState == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procGetStateArgs.procId    = procId ;
+        args.apiArgs.procGetStateArgs.procState = procState ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_GETSTATE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_getState", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_load
+ *
+ *  @desc   Loads the specified DSP executable on the target DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_load (IN   ProcessorId  procId,
+           IN   Char8 *      imagePath,
+           IN   Uint32       argc,
+           IN   Char8 **     argv)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_4ENTER ("PROC_load", procId, imagePath, argc, argv) ;
+
+    if (    (!IS_VALID_PROCID (procId))
+        ||  (imagePath == NULL)
+        ||  ((argc != 0u) && (argv == NULL))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procLoadArgs.procId    = procId ;
+        args.apiArgs.procLoadArgs.imagePath = imagePath ;
+        args.apiArgs.procLoadArgs.argc      = argc ;
+        args.apiArgs.procLoadArgs.argv      = argv ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_LOAD, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_load", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_loadSection
+ *
+ *  @desc   Loads the specified section of DSP executable onto the target DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_loadSection (IN    ProcessorId  procId,
+                  IN    Char8 *      imagePath,
+                  IN    Uint32       sectID)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("PROC_loadSection", procId, imagePath, sectID) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (imagePath == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procLoadSectionArgs.procId    = procId ;
+        args.apiArgs.procLoadSectionArgs.imagePath = imagePath ;
+        args.apiArgs.procLoadSectionArgs.sectID    = sectID ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_LOADSECTION, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_loadSection", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_read
+ *
+ *  @desc   Reads from the memory space of the DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_read (IN     ProcessorId    procId,
+           IN     Uint32         dspAddr,
+           IN     Uint32         numBytes,
+           IN OUT Pvoid          buffer)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_4ENTER ("PROC_read", procId, dspAddr, numBytes, buffer) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (buffer == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procReadArgs.procId   = procId ;
+        args.apiArgs.procReadArgs.dspAddr  = dspAddr ;
+        args.apiArgs.procReadArgs.numBytes = numBytes ;
+        args.apiArgs.procReadArgs.buffer   = buffer ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_READ, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_read", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_write
+ *
+ *  @desc   Writes to the memory space of the DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_write (IN ProcessorId    procId,
+            IN Uint32         dspAddr,
+            IN Uint32         numBytes,
+            IN Pvoid          buffer)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_4ENTER ("PROC_write", procId, dspAddr, numBytes, buffer) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (buffer == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procWriteArgs.procId   = procId ;
+        args.apiArgs.procWriteArgs.dspAddr  = dspAddr ;
+        args.apiArgs.procWriteArgs.numBytes = numBytes ;
+        args.apiArgs.procWriteArgs.buffer   = buffer ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_WRITE, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_write", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_start
+ *
+ *  @desc   Starts execution of the loaded code on DSP from the starting
+ *          point specified in the DSP executable loaded earlier by call to
+ *          PROC_load ().
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_start (IN ProcessorId procId)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("PROC_start", procId) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procStartArgs.procId = procId ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_START, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_start", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_stop
+ *
+ *  @desc   Stops the specified DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_stop (IN ProcessorId procId)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_1ENTER ("PROC_stop", procId) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procStopArgs.procId = procId ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_STOP, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_stop", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_control
+ *
+ *  @desc   Provides a hook to perform device dependent control operations.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_control (IN  ProcessorId procId,
+              IN  Int32       cmd,
+              OPT Pvoid       arg)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("PROC_control", procId, cmd, arg) ;
+
+    if (!IS_VALID_PROCID (procId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procControlArgs.procId = procId ;
+        args.apiArgs.procControlArgs.cmd    = cmd ;
+        args.apiArgs.procControlArgs.arg    = arg ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_CONTROL, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_control", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PROC_GetSymbolAddress
+ *
+ *  @desc   Gets the DSP address of a symbol of the loaded executable.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_GetSymbolAddress (IN   ProcessorId   procId,
+                       IN   Char8 *       symbolName,
+                       OUT  Uint32 *      dspAddr)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_3ENTER ("PROC_GetSymbolAddress", procId, symbolName, dspAddr) ;
+
+    if (    (!IS_VALID_PROCID (procId))
+        ||  (symbolName == NULL)
+        ||  (dspAddr == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procGetSymbolAddressArgs.procId     = procId ;
+        args.apiArgs.procGetSymbolAddressArgs.symbolName = symbolName ;
+        args.apiArgs.procGetSymbolAddressArgs.dspAddr    = dspAddr ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_GETSYMBOLADDRESS, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_GetSymbolAddress", status) ;
+
+    return status ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   PROC_instrument
+ *
+ *  @desc   Gets the instrumentation information related to the specified
+ *          DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_instrument (IN ProcessorId procId, OUT PROC_Instrument * retVal)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    TRC_2ENTER ("PROC_instrument", procId, retVal) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (retVal == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procInstrumentArgs.procId    = procId ;
+        args.apiArgs.procInstrumentArgs.procStats = retVal ;
+        status = DRV_INVOKE (DRV_handle, CMD_PROC_INSTRUMENT, &args) ;
+        if (DSP_SUCCEEDED (status)) {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_instrument", status) ;
+
+    return status ;
+}
+#endif /* defined (DDSP_PROFILE) */
+
+
+#if defined (DDSP_DEBUG)
+/** ============================================================================
+ *  @func   PROC_debug
+ *
+ *  @desc   Prints the current status of this subcomponent.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+PROC_debug (IN ProcessorId procId)
+{
+    CMD_Args args ;
+
+    TRC_1ENTER ("PROC_debug", procId) ;
+
+    if (IS_VALID_PROCID (procId)) {
+        args.apiArgs.procDebugArgs.procId = procId ;
+        DRV_INVOKE (DRV_handle, CMD_PROC_DEBUG, &args) ;
+    }
+
+    TRC_0LEAVE ("PROC_debug") ;
+}
+#endif /* defined (DDSP_DEBUG) */
+
+
+/** ============================================================================
+ *  @func   PROC_Setup
+ *
+ *  @desc   Deprecated form of PROC_setup, using the default configuration.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_Setup (Void)
+{
+    return PROC_setup (NULL) ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
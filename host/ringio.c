@@ -0,0 +1,4195 @@
+/** ============================================================================
+ *  @file   ringio.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/api/
+ *
+ *  @desc   Implementation of the API sub-component RingIO.
+ *          The control structure, the data buffer, the attribute buffer and
+ *          the lock of an instance are allocated from the POOLs shared with
+ *          the DSP. Positions in the buffers are kept as offsets so that the
+ *          reader and the writer may live in different processes.
+ *          The data buffer is shared through the counts of the bytes each
+ *          client acquired and released, each updated by its own client
+ *          only: acquires and releases take no lock, the lock of the
+ *          instance only serializes the attributes, the flushes and the
+ *          notifications.
+ *          A data buffer whose size is a multiple of the page size is placed
+ *          on a page boundary and mapped twice back-to-back by every process
+ *          opening a client, so that buffers acquired across its end are
+ *          contiguous without a foot buffer or a copy.
+ *          Attributes are queued in the attribute buffer in the order of
+ *          their positions in the stream of data, counted like the bytes
+ *          released by the writer. An index of their positions, in a pool
+ *          buffer of its own, finds the attributes to remove from the tail
+ *          of the queue without walking the records.
+ *          A broadcast RingIO has several readers, each with its own counts
+ *          and its own position in the attribute queue: the writer is held
+ *          back by the slowest of them, and the data and the attributes are
+ *          freed once every reader is done with them.
+ *          Notification functions are called directly when the notified
+ *          client has been opened in the calling process, which also raises
+ *          the pollable descriptor of the client if it has one.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+#include <pthread.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <linux/errqueue.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <drvdefs.h>
+#include <_ringiodefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- User API                    */
+#include <pool.h>
+#include <mpcs.h>
+#include <ringio.h>
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+#include <drv_api.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_API_RINGIO, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @const  RINGIO_MAX_LOCALCLIENTS
+ *
+ *  @desc   Maximum number of RingIO clients opened in a process.
+ *  ============================================================================
+ */
+#define RINGIO_MAX_LOCALCLIENTS     128u
+
+/*  ============================================================================
+ *  @macro  RINGIO_ATTR_RECSIZE
+ *
+ *  @desc   Size of an attribute record in the attribute buffer, for a payload
+ *          of the given size.
+ *  ============================================================================
+ */
+#define RINGIO_ATTR_RECSIZE(size)   ((SIZEOF_ATTR (size) + 3u) & ~3u)
+
+/*  ============================================================================
+ *  @macro  RINGIO_ATTR_END
+ *
+ *  @desc   Current end (offset) of the attribute buffer.
+ *  ============================================================================
+ */
+#define RINGIO_ATTR_END(control)    ((Uint32) GET_CUR_ATTR_END (control))
+
+/*  ============================================================================
+ *  @macro  RINGIO_ATTR_INDEXLEN, RINGIO_ATTR_INDEXSIZE
+ *
+ *  @desc   Number of entries and size of the index of an attribute buffer
+ *          of the given size: one entry for every record it can hold.
+ *  ============================================================================
+ */
+#define RINGIO_ATTR_INDEXLEN(size)  ((size) / RINGIO_ATTR_RECSIZE (0u))
+#define RINGIO_ATTR_INDEXSIZE(size) (  RINGIO_ATTR_INDEXLEN (size)             \
+                                     * sizeof (RingIO_AttrEntry))
+
+/*  ============================================================================
+ *  @macro  RINGIO_READER
+ *
+ *  @desc   Reader client of the given index. The readers of a broadcast
+ *          RingIO beyond the first, and the park client after them, follow
+ *          the control structure.
+ *  ============================================================================
+ */
+#define RINGIO_READER(control, i)   (&(control)->reader + (i))
+
+/*  ============================================================================
+ *  @const  RINGIO_CTRL_SIZE, RINGIO_LOCK_SIZE
+ *
+ *  @desc   Sizes of the control structure, with the clients following it for
+ *          the given number of readers, and of the lock of an instance
+ *          allocated from their pools.
+ *  ============================================================================
+ */
+#define RINGIO_CTRL_SIZE(n) DSPLINK_ALIGN (  sizeof (RingIO_ControlStruct)     \
+                                           + (((n) > 1u) ? (n) : 0u)           \
+                                             * sizeof (RingIO_Client),         \
+                                           DSPLINK_BUF_ALIGN)
+#define RINGIO_LOCK_SIZE    DSPLINK_ALIGN (sizeof (MPCS_ShObj),                \
+                                           DSPLINK_BUF_ALIGN)
+
+
+/*  ============================================================================
+ *  @const  RINGIO_SPLICE_ZEROCOPY
+ *
+ *  @desc   Smallest buffer RingIO_spliceOut sends to a socket with
+ *          MSG_ZEROCOPY: pinning the pages and waiting for the completion
+ *          cost more than copying smaller ones.
+ *  ============================================================================
+ */
+#define RINGIO_SPLICE_ZEROCOPY      16384u
+
+/*  ============================================================================
+ *  @const  RINGIO_SPLICE_SENDSIZE
+ *
+ *  @desc   Largest buffer RingIO_spliceOut sends at once with MSG_ZEROCOPY,
+ *          so that the first sends of a large move complete while the next
+ *          ones are made.
+ *  ============================================================================
+ */
+#define RINGIO_SPLICE_SENDSIZE      65536u
+
+/*  ============================================================================
+ *  @const  RINGIO_SPLICE_DGRAMSIZE
+ *
+ *  @desc   Largest buffer RingIO_spliceOut sends at once to a datagram
+ *          socket, each send making one datagram: the largest payload of a
+ *          UDP datagram over IPv4.
+ *  ============================================================================
+ */
+#define RINGIO_SPLICE_DGRAMSIZE     65507u
+
+/*  ============================================================================
+ *  @const  RINGIO_SPLICE_INFLIGHT
+ *
+ *  @desc   Number of MSG_ZEROCOPY sends RingIO_spliceOut keeps in flight
+ *          before it reaps their completions and releases their buffers.
+ *  ============================================================================
+ */
+#define RINGIO_SPLICE_INFLIGHT      8u
+
+/*  ============================================================================
+ *  @const  RINGIO_SPLICE_CTRLSIZE
+ *
+ *  @desc   Size of the control buffer receiving a MSG_ZEROCOPY completion
+ *          from the error queue of an IPv4 or IPv6 socket.
+ *  ============================================================================
+ */
+#define RINGIO_SPLICE_CTRLSIZE                                                 \
+                CMSG_SPACE (  sizeof (struct sock_extended_err)                \
+                            + sizeof (struct sockaddr_in6))
+
+
+/** ============================================================================
+ *  @name   RingIO_Attr
+ *
+ *  @desc   Header of an attribute record in the attribute buffer. The payload
+ *          of the attribute follows the header.
+ *
+ *  @field  type
+ *              User-defined type of the attribute.
+ *  @field  size
+ *              Size of the payload.
+ *  @field  offset
+ *              Position of the attribute in the stream of data.
+ *  @field  prevoffset
+ *              Position of the previous attribute when the attribute was set.
+ *  @field  param
+ *              Optional parameter of the attribute.
+ *  ============================================================================
+ */
+typedef struct RingIO_Attr_tag {
+    Uint16  type ;
+    Uint16  size ;
+    Uint32  offset ;
+    Uint32  prevoffset ;
+    Uint32  param ;
+} RingIO_Attr ;
+
+/** ============================================================================
+ *  @name   RingIO_AttrEntry
+ *
+ *  @desc   Entry of the index of the attributes. The entry of the attribute
+ *          set n-th by the writer is at n modulo the length of the index.
+ *
+ *  @field  offset
+ *              Position of the attribute in the stream of data.
+ *  @field  pos
+ *              Offset of the record of the attribute in the attribute buffer.
+ *  ============================================================================
+ */
+typedef struct RingIO_AttrEntry_tag {
+    Uint32  offset ;
+    Uint32  pos ;
+} RingIO_AttrEntry ;
+
+/** ============================================================================
+ *  @name   RingIO_Local
+ *
+ *  @desc   Entry of the table of the clients opened in the calling process.
+ *
+ *  @field  client
+ *              RingIO client, NULL if the entry is free.
+ *  @field  polled
+ *              TRUE once a pollable descriptor has been asked for.
+ *  @field  pollFd
+ *              Pollable descriptor of the client.
+ *  @field  pollRaised
+ *              Non-zero while the pollable descriptor is raised.
+ *  @field  mirror
+ *              Mirrored mapping of the data buffer, NULL if none.
+ *  @field  mirrorSize
+ *              Size of the data buffer mirrored.
+ *  ============================================================================
+ */
+typedef struct RingIO_Local_tag {
+    RingIO_Client *    client     ;
+    Bool               polled     ;
+    Int32              pollFd     ;
+    volatile Uint32    pollRaised ;
+    Pvoid              mirror     ;
+    Uint32             mirrorSize ;
+} RingIO_Local ;
+
+/** ============================================================================
+ *  @name   RingIO_Notification
+ *
+ *  @desc   Notification to be delivered once the lock of the instance has been
+ *          released.
+ *
+ *  @field  func
+ *              Notification function, NULL if there is none to call.
+ *  @field  handle
+ *              Handle of the notified client.
+ *  @field  param
+ *              Parameter of the notification function.
+ *  @field  local
+ *              Entry of the notified client whose pollable descriptor is to
+ *              be raised, NULL if none.
+ *  ============================================================================
+ */
+typedef struct RingIO_Notification_tag {
+    RingIO_NotifyFunc  func   ;
+    RingIO_Handle      handle ;
+    RingIO_NotifyParam param  ;
+    RingIO_Local *     local  ;
+} RingIO_Notification ;
+
+
+/*  ============================================================================
+ *  @name   RingIO_localClients
+ *
+ *  @desc   Clients opened in the calling process.
+ *  ============================================================================
+ */
+STATIC RingIO_Local RingIO_localClients [RINGIO_MAX_LOCALCLIENTS] ;
+
+/*  ============================================================================
+ *  @name   RingIO_numPolled
+ *
+ *  @desc   Number of the clients of the calling process with a pollable
+ *          descriptor; the acquires skip the descriptors while it is 0.
+ *  ============================================================================
+ */
+STATIC volatile Uint32 RingIO_numPolled = 0u ;
+
+/*  ============================================================================
+ *  @name   RingIO_localLock
+ *
+ *  @desc   Protects the table of the clients opened in the calling process.
+ *  ============================================================================
+ */
+STATIC pthread_mutex_t RingIO_localLock = PTHREAD_MUTEX_INITIALIZER ;
+
+
+/*  ============================================================================
+ *  @func   RingIO_getCtrl
+ *
+ *  @desc   Gets the RingIO control region of a DSP in the calling process.
+ *
+ *  @arg    procId
+ *              DSP identifier.
+ *  @arg    ctrl
+ *              Location to receive the control region.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EACCESSDENIED
+ *              The RingIO component has not been initialized.
+ *
+ *  @enter  procId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_getCtrl (IN ProcessorId procId, OUT RingIO_Ctrl ** ctrl)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args ;
+
+    args.apiArgs.ringIoArgs.ringioRegionArgs.procId = procId ;
+    status = DRV_INVOKE (DRV_handle, CMD_RINGIO_MAPREGION, &args) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = args.apiStatus ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        *ctrl = (RingIO_Ctrl *) DRV_phyToUsr (
+                              args.apiArgs.ringIoArgs.ringioRegionArgs.physAddr) ;
+        if ((*ctrl == NULL) || ((*ctrl)->isInitialized != TRUE)) {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+    }
+    else {
+        status = DSP_EACCESSDENIED ;
+        SET_FAILURE_REASON ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_findEntry
+ *
+ *  @desc   Finds the entry of a RingIO instance in the control region.
+ *
+ *  @arg    ctrl
+ *              Control region.
+ *  @arg    name
+ *              Name of the RingIO, NULL to find a free entry.
+ *
+ *  @ret    The entry, NULL if not found.
+ *
+ *  @enter  The region lock is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+RingIO_Entry *
+RingIO_findEntry (IN RingIO_Ctrl * ctrl, IN OPT Char8 * name)
+{
+    RingIO_Entry * entries = (RingIO_Entry *) (ctrl + 1) ;
+    RingIO_Entry * entry   = NULL ;
+    Uint32         i ;
+
+    for (i = 0u ; (i < ctrl->maxEntries) && (entry == NULL) ; i++) {
+        if (name == NULL) {
+            if (entries [i].name [0] == '\0') {
+                entry = &entries [i] ;
+            }
+        }
+        else if (strncmp (entries [i].name, name, RINGIO_NAME_MAX_LEN) == 0) {
+            entry = &entries [i] ;
+        }
+    }
+
+    return entry ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_findLocal
+ *
+ *  @desc   Finds the entry of a client opened in the calling process.
+ *
+ *  @arg    client
+ *              RingIO client.
+ *
+ *  @ret    The entry, NULL if the client has not been opened in the calling
+ *          process.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+RingIO_Local *
+RingIO_findLocal (IN RingIO_Client * client)
+{
+    RingIO_Local * local = NULL ;
+    Uint32         i ;
+
+    pthread_mutex_lock (&RingIO_localLock) ;
+    for (i = 0u ; (i < RINGIO_MAX_LOCALCLIENTS) && (local == NULL) ; i++) {
+        if (RingIO_localClients [i].client == client) {
+            local = &(RingIO_localClients [i]) ;
+        }
+    }
+    pthread_mutex_unlock (&RingIO_localLock) ;
+
+    return local ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_isPolled
+ *
+ *  @desc   Checks whether a client of the calling process has a pollable
+ *          descriptor.
+ *
+ *  @arg    client
+ *              RingIO client.
+ *
+ *  @ret    TRUE if the client has a pollable descriptor.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_getPollFd
+ *  ============================================================================
+ */
+STATIC
+Bool
+RingIO_isPolled (IN RingIO_Client * client)
+{
+    RingIO_Local * local ;
+
+    local = RingIO_findLocal (client) ;
+
+    return ((local != NULL) && (local->polled == TRUE)) ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_setLocal
+ *
+ *  @desc   Adds a client to, or removes it from, the table of the clients
+ *          opened in the calling process. Removing a client closes its
+ *          pollable descriptor and unmaps its mirror of the data buffer.
+ *
+ *  @arg    client
+ *              RingIO client.
+ *  @arg    isLocal
+ *              TRUE to add the client, FALSE to remove it.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ERESOURCE
+ *              The table is full.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_setLocal (IN RingIO_Client * client, IN Bool isLocal)
+{
+    DSP_STATUS      status = DSP_ERESOURCE ;
+    RingIO_Client * from   = (isLocal == TRUE) ? NULL : client ;
+    RingIO_Client * to     = (isLocal == TRUE) ? client : NULL ;
+    RingIO_Local *  local ;
+    Uint32          i ;
+
+    pthread_mutex_lock (&RingIO_localLock) ;
+    for (i = 0u ; (i < RINGIO_MAX_LOCALCLIENTS) && DSP_FAILED (status) ; i++) {
+        local = &(RingIO_localClients [i]) ;
+        if (local->client == from) {
+            if (local->polled == TRUE) {
+                SYNC_HOST_deletePollFd (local->pollFd) ;
+                RingIO_numPolled-- ;
+            }
+            DRV_unmapMirror (local->mirror, local->mirrorSize) ;
+            local->client     = to ;
+            local->polled     = FALSE ;
+            local->pollRaised = 0u ;
+            local->mirror     = NULL ;
+            local->mirrorSize = 0u ;
+            status = DSP_SOK ;
+        }
+    }
+    pthread_mutex_unlock (&RingIO_localLock) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_prepareNotify
+ *
+ *  @desc   Prepares the notification of a client, if its notification
+ *          conditions are met.
+ *
+ *  @arg    client
+ *              Client to be notified.
+ *  @arg    available
+ *              Size available to the client.
+ *  @arg    notification
+ *              Location to receive the notification.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_deliverNotify
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_prepareNotify (IN  RingIO_Client *       client,
+                      IN  Uint32                available,
+                      OUT RingIO_Notification * notification)
+{
+    RingIO_Local * local = NULL ;
+
+    notification->func  = NULL ;
+    notification->local = NULL ;
+
+    if (    (client->isValid == TRUE)
+        &&  (client->notifyType != RINGIO_NOTIFICATION_NONE)
+        &&  (client->notifyFlag != 0u)
+        &&  (available >= client->notifyWaterMark)) {
+        local = RingIO_findLocal (client) ;
+    }
+
+    /*  The client sets its flag without the lock when an acquire fails, so
+     *  that the flag is only cleared by the notification that wins it.
+     */
+    if (    (local != NULL)
+        &&  ((client->notifyFunc != NULL) || (local->polled == TRUE))
+        &&  (    (    (client->notifyType != RINGIO_NOTIFICATION_ONCE)
+                  &&  (   client->notifyType
+                       != RINGIO_NOTIFICATION_HDWRFIFO_ONCE))
+             ||  __sync_bool_compare_and_swap (&client->notifyFlag, 1u, 0u))) {
+        notification->func   = client->notifyFunc ;
+        notification->handle = (RingIO_Handle) client ;
+        notification->param  = client->notifyParam ;
+        notification->local  = (local->polled == TRUE) ? local : NULL ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_deliverNotify
+ *
+ *  @desc   Delivers a notification prepared by RingIO_prepareNotify.
+ *
+ *  @arg    notification
+ *              Notification to be delivered.
+ *  @arg    msg
+ *              Message sent along with the notification.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is not held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_prepareNotify
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_deliverNotify (IN RingIO_Notification * notification,
+                      IN RingIO_NotifyMsg      msg)
+{
+    if (notification->func != NULL) {
+        notification->func (notification->handle, notification->param, msg) ;
+    }
+
+    if (    (notification->local != NULL)
+        &&  __sync_bool_compare_and_swap (&notification->local->pollRaised,
+                                          0u,
+                                          1u)) {
+        SYNC_HOST_raisePollFd (notification->local->pollFd) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_pollClear
+ *
+ *  @desc   Clears the pollable descriptor of a client before an acquire. A
+ *          notification that races with the clear either raises the
+ *          descriptor again or precedes the acquire, which then sees its
+ *          data or room.
+ *
+ *  @arg    client
+ *              RingIO client.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is not held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_deliverNotify
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_pollClear (IN RingIO_Client * client)
+{
+    RingIO_Local * local ;
+
+    if (RingIO_numPolled != 0u) {
+        local = RingIO_findLocal (client) ;
+        if (    (local != NULL)
+            &&  (local->polled == TRUE)
+            &&  (local->pollRaised != 0u)) {
+            SYNC_HOST_clearPollFd (local->pollFd) ;
+            __sync_lock_release (&local->pollRaised) ;
+            __sync_synchronize () ;
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_dataEnd
+ *
+ *  @desc   Returns the end of the data buffer in the round of a position of
+ *          the reader: the early end if the writer marked one in that round,
+ *          the end of the data buffer otherwise.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *  @arg    pos
+ *              Position of the reader in the data buffer.
+ *  @arg    count
+ *              Number of bytes the reader acquired up to that position.
+ *
+ *  @ret    End of the data buffer for the reader.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_writerAcquire
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_dataEnd (IN RingIO_ControlStruct * control,
+                IN Uint32                 pos,
+                IN Uint32                 count)
+{
+    Uint32 end    = control->dataBufSize ;
+    Uint32 curEnd = control->curBufEnd + 1u ;
+
+    /*  An early end is left marked until the writer sees that the reader
+     *  went past it, so it only applies if the reader reaches it with the
+     *  count of bytes written before it.
+     */
+    if (    (curEnd < control->dataBufSize)
+        &&  (pos <= curEnd)
+        &&  ((control->endCount - count) == (curEnd - pos))) {
+        end = curEnd ;
+    }
+
+    return end ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_readerMask
+ *
+ *  @desc   Returns the readers that hold the writer back: the only reader of
+ *          a RingIO that is not a broadcast one, the readers opened and not
+ *          dropped of a broadcast RingIO, or its park client while there are
+ *          none.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *
+ *  @ret    Bit mask of the indices of the readers.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGIO_READER
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_readerMask (IN RingIO_ControlStruct * control)
+{
+    Uint32          mask = 0u ;
+    RingIO_Client * reader ;
+    Uint32          i ;
+
+    if (control->numReaders <= 1u) {
+        mask = 1u ;
+    }
+    else {
+        for (i = 0u ; i < control->numReaders ; i++) {
+            reader = RINGIO_READER (control, i) ;
+            if ((reader->isValid == TRUE) && (reader->dropped == 0u)) {
+                mask |= 1u << i ;
+            }
+        }
+        if (mask == 0u) {
+            mask = 1u << control->numReaders ;
+        }
+        /* A joining reader publishes its counts before it is valid. */
+        __sync_synchronize () ;
+    }
+
+    return mask ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_readerCount
+ *
+ *  @desc   Returns the least or the largest count of bytes acquired or
+ *          released by the readers that hold the writer back.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *  @arg    released
+ *              TRUE for the counts released, FALSE for the counts acquired.
+ *  @arg    least
+ *              TRUE for the least count, FALSE for the largest.
+ *
+ *  @ret    The count.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_readerMask
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_readerCount (IN RingIO_ControlStruct * control,
+                    IN Bool                   released,
+                    IN Bool                   least)
+{
+    Uint32          mask  = RingIO_readerMask (control) ;
+    Uint32          count = 0u ;
+    Bool            found = FALSE ;
+    RingIO_Client * reader ;
+    Uint32          value ;
+    Uint32          i ;
+
+    for (i = 0u ; mask != 0u ; i++, mask >>= 1u) {
+        if ((mask & 1u) != 0u) {
+            reader = RINGIO_READER (control, i) ;
+            value  = (released == TRUE) ? reader->relCount : reader->acqCount ;
+            if (    (found == FALSE)
+                ||  ((least == TRUE)  && ((Int32) (value - count) < 0))
+                ||  ((least == FALSE) && ((Int32) (value - count) > 0))) {
+                count = value ;
+                found = TRUE ;
+            }
+        }
+    }
+
+    return count ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_emptySize
+ *
+ *  @desc   Returns the empty size of the data buffer, as seen by the writer.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *
+ *  @ret    Size that the writer can still acquire.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_validSize
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_emptySize (IN RingIO_ControlStruct * control)
+{
+    Uint32 released = RingIO_readerCount (control, TRUE, TRUE) ;
+    Uint32 used     = control->writer.acqCount - released ;
+    Uint32 curEnd   = control->curBufEnd + 1u ;
+
+    if (    (curEnd < control->dataBufSize)
+        &&  ((Int32) (released - control->endCount) <= 0)) {
+        /* The reader has not gone past the early end yet. */
+        used += control->dataBufSize - curEnd ;
+    }
+
+    return (used < control->dataBufSize) ? (control->dataBufSize - used) : 0u ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_validSize
+ *
+ *  @desc   Returns the valid size of the data buffer, as seen by a reader.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *  @arg    acquired
+ *              Count of the bytes acquired by the reader.
+ *
+ *  @ret    Size that the reader can still acquire.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_emptySize
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_validSize (IN RingIO_ControlStruct * control, IN Uint32 acquired)
+{
+    Int32 valid = (Int32) (control->writer.relCount - acquired) ;
+
+    return (valid > 0) ? (Uint32) valid : 0u ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_dropSlow
+ *
+ *  @desc   Drops the slowest readers of a broadcast RingIO, if another reader
+ *          is ahead of them.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *
+ *  @ret    TRUE if a reader was dropped.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_readerRejoin
+ *  ============================================================================
+ */
+STATIC
+Bool
+RingIO_dropSlow (IN RingIO_ControlStruct * control)
+{
+    Bool            dropped = FALSE ;
+    Uint32          mask    = RingIO_readerMask (control) ;
+    Uint32          least   = RingIO_readerCount (control, TRUE, TRUE) ;
+    Uint32          most    = RingIO_readerCount (control, TRUE, FALSE) ;
+    RingIO_Client * reader ;
+    Uint32          i ;
+
+    if (((mask >> control->numReaders) == 0u) && (least != most)) {
+        for (i = 0u ; i < control->numReaders ; i++) {
+            reader = RINGIO_READER (control, i) ;
+            if (    (((mask >> i) & 1u) != 0u)
+                &&  (reader->relCount == least)) {
+                reader->dropped = 1u ;
+                dropped         = TRUE ;
+            }
+        }
+        __sync_synchronize () ;
+    }
+
+    return dropped ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_notifyPeer
+ *
+ *  @desc   Notifies the peers of a client after a release, those waiting for
+ *          the size now available to them: the writer, or every reader.
+ *
+ *  @arg    client
+ *              Client that released a buffer.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is not held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_prepareNotify, RingIO_deliverNotify
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_notifyPeer (IN RingIO_Client * client)
+{
+    RingIO_ControlStruct * control  = client->virtControlHandle ;
+    Uint32                 numPeers = 1u ;
+    RingIO_Client *        peer ;
+    RingIO_Notification    notification ;
+    Uint32                 available ;
+    Uint32                 i ;
+
+    if (IS_WRITER (client) && (control->numReaders > 1u)) {
+        numPeers = control->numReaders ;
+    }
+
+    /*  Pairs with the barrier of a failed acquire between setting the flag
+     *  and trying again: either the flag is seen here, or the acquire sees
+     *  the buffer released.
+     */
+    __sync_synchronize () ;
+    for (i = 0u ; i < numPeers ; i++) {
+        notification.func  = NULL ;
+        notification.local = NULL ;
+
+        peer = IS_WRITER (client) ? RINGIO_READER (control, i)
+                                  : &control->writer ;
+        if (    (peer->notifyFlag != 0u)
+            &&  (peer->notifyType != RINGIO_NOTIFICATION_NONE)) {
+            available = IS_WRITER (client)
+                      ? RingIO_validSize (control, peer->acqCount)
+                      : RingIO_emptySize (control) ;
+            MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+            RingIO_prepareNotify (peer, available, &notification) ;
+            MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+        }
+
+        RingIO_deliverNotify (&notification, 0u) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrBufSize
+ *
+ *  @desc   Returns the size of the attribute buffer of an instance.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *
+ *  @ret    Size of the attribute buffer, 0 if there is none.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_attrBufSize (IN RingIO_ControlStruct * control)
+{
+    return (control->phyAttrStart == NULL) ? 0u : (control->phyAttrBufEnd + 1u) ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrAt
+ *
+ *  @desc   Returns the attribute record at an offset of the attribute buffer.
+ *
+ *  @arg    client
+ *              Client accessing the attribute buffer.
+ *  @arg    pos
+ *              Offset of the record.
+ *
+ *  @ret    The attribute record.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+RingIO_Attr *
+RingIO_attrAt (IN RingIO_Client * client, IN Uint32 pos)
+{
+    return (RingIO_Attr *) ((Char8 *) client->pAttrStart + pos) ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrEntry
+ *
+ *  @desc   Returns the entry of an attribute in the index of the attributes.
+ *
+ *  @arg    client
+ *              Client accessing the attribute buffer.
+ *  @arg    seq
+ *              Number of attributes set by the writer before it.
+ *
+ *  @ret    The entry.
+ *
+ *  @enter  The attribute is pending, and the RingIO has an index.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_attrFind
+ *  ============================================================================
+ */
+STATIC
+RingIO_AttrEntry *
+RingIO_attrEntry (IN RingIO_Client * client, IN Uint32 seq)
+{
+    Uint32 attrSize = RingIO_attrBufSize (client->virtControlHandle) ;
+
+    return   (RingIO_AttrEntry *) client->pAttrIndex
+           + (seq % RINGIO_ATTR_INDEXLEN (attrSize)) ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrFind
+ *
+ *  @desc   Searches the index for the first pending attribute located beyond
+ *          a position in the stream of data. The positions of the attributes
+ *          follow the order in which they were set.
+ *
+ *  @arg    client
+ *              Client accessing the attribute buffer.
+ *  @arg    seq
+ *              Sequence number of the first attribute searched.
+ *  @arg    dist
+ *              Position in the stream of data.
+ *
+ *  @ret    Sequence number of the attribute, that of the writer if there is
+ *          none.
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_attrEntry
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_attrFind (IN RingIO_Client * client, IN Uint32 seq, IN Uint32 dist)
+{
+    RingIO_ControlStruct * control = client->virtControlHandle ;
+    Uint32                 first   = seq ;
+    Uint32                 count   = control->writer.attrSeq - seq ;
+    RingIO_AttrEntry *     entry ;
+    Uint32                 half ;
+
+    while (count != 0u) {
+        half  = count / 2u ;
+        entry = RingIO_attrEntry (client, first + half) ;
+        if ((Int32) (entry->offset - dist) > 0) {
+            count = half ;
+        }
+        else {
+            first += half + 1u ;
+            count -= half + 1u ;
+        }
+    }
+
+    return first ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrScan
+ *
+ *  @desc   Walks the pending attributes from the head of the queue to the
+ *          first one located beyond a position in the stream of data, for a
+ *          RingIO without an index.
+ *
+ *  @arg    client
+ *              Client accessing the attribute buffer.
+ *  @arg    seq
+ *              Sequence number of the attribute at the head of the queue.
+ *  @arg    head
+ *              Offset of the head of the queue.
+ *  @arg    dist
+ *              Position in the stream of data.
+ *  @arg    pos
+ *              Location to receive the offset of the attribute found.
+ *  @arg    keepDist
+ *              Location to receive the position of the attribute before it,
+ *              zero if there is none.
+ *
+ *  @ret    Sequence number of the attribute, that of the writer if there is
+ *          none.
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_attrFind
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_attrScan (IN  RingIO_Client * client,
+                 IN  Uint32          seq,
+                 IN  Uint32          head,
+                 IN  Uint32          dist,
+                 OUT Uint32 *        pos,
+                 OUT Uint32 *        keepDist)
+{
+    RingIO_ControlStruct * control = client->virtControlHandle ;
+    Uint32                 bytes   = 0u ;
+    Bool                   found   = FALSE ;
+    RingIO_Attr *          attr ;
+
+    *pos      = head ;
+    *keepDist = 0u ;
+    while ((bytes < control->validAttrSize) && (found == FALSE)) {
+        attr = RingIO_attrAt (client, *pos) ;
+        if ((Int32) (attr->offset - dist) > 0) {
+            found = TRUE ;
+        }
+        else {
+            *keepDist  = attr->offset ;
+            bytes     += RINGIO_ATTR_RECSIZE (attr->size) ;
+            *pos      += RINGIO_ATTR_RECSIZE (attr->size) ;
+            seq++ ;
+            if (*pos >= RINGIO_ATTR_END (control)) {
+                *pos = 0u ;
+            }
+        }
+    }
+
+    return seq ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrCursor
+ *
+ *  @desc   Returns the position of a reader in the attribute buffer: the
+ *          tail of the queue once the reader has taken every attribute, or
+ *          the start of the buffer once it reaches the current end of the
+ *          buffer.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *  @arg    reader
+ *              Reader client.
+ *
+ *  @ret    Offset of the next attribute of the reader.
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_attrCursor (IN RingIO_ControlStruct * control,
+                   IN RingIO_Client *        reader)
+{
+    if (reader->validAttrSize == 0u) {
+        reader->acqAttrStart = control->writer.acqAttrStart ;
+    }
+    else if (reader->acqAttrStart >= RINGIO_ATTR_END (control)) {
+        reader->acqAttrStart = 0u ;
+    }
+
+    return reader->acqAttrStart ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrSlowest
+ *
+ *  @desc   Returns the reader holding the writer back with the most attribute
+ *          bytes left to take, whose position is the head of the queue.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *
+ *  @ret    The reader client.
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_readerMask
+ *  ============================================================================
+ */
+STATIC
+RingIO_Client *
+RingIO_attrSlowest (IN RingIO_ControlStruct * control)
+{
+    Uint32          mask    = RingIO_readerMask (control) ;
+    RingIO_Client * slowest = NULL ;
+    RingIO_Client * reader ;
+    Uint32          i ;
+
+    for (i = 0u ; mask != 0u ; i++, mask >>= 1u) {
+        reader = RINGIO_READER (control, i) ;
+        if (    ((mask & 1u) != 0u)
+            &&  (   (slowest == NULL)
+                 || (reader->validAttrSize > slowest->validAttrSize))) {
+            slowest = reader ;
+        }
+    }
+
+    return slowest ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrNormalize
+ *
+ *  @desc   Frees the attribute bytes taken by every reader holding the
+ *          writer back, resets the queue once empty, and releases the early
+ *          end of the buffer once the head of the queue went past it.
+ *
+ *  @arg    control
+ *              Control structure of the instance.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_attrSlowest
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_attrNormalize (IN RingIO_ControlStruct * control)
+{
+    Uint32          attrSize = RingIO_attrBufSize (control) ;
+    RingIO_Client * slowest  = RingIO_attrSlowest (control) ;
+    Uint32          valid    = slowest->validAttrSize ;
+
+    control->emptyAttrSize += control->validAttrSize - valid ;
+    control->validAttrSize  = valid ;
+
+    if (valid == 0u) {
+        control->writer.acqAttrStart = 0u ;
+        control->curAttrBufEnd       = attrSize - 1u ;
+        control->emptyAttrSize       = attrSize ;
+        control->prevAttrOffset      = 0 ;
+    }
+    else if (    (RINGIO_ATTR_END (control) < attrSize)
+             &&  (   RingIO_attrCursor (control, slowest)
+                  <  control->writer.acqAttrStart)) {
+        /* The head of the queue went past the early end. */
+        control->emptyAttrSize += attrSize - RINGIO_ATTR_END (control) ;
+        control->curAttrBufEnd  = attrSize - 1u ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrHead
+ *
+ *  @desc   Returns the next attribute of a reader, or for the writer the
+ *          attribute at the head of the queue.
+ *
+ *  @arg    client
+ *              Client accessing the attribute buffer.
+ *
+ *  @ret    The attribute record, NULL if the queue is empty.
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+RingIO_Attr *
+RingIO_attrHead (IN RingIO_Client * client)
+{
+    RingIO_ControlStruct * control = client->virtControlHandle ;
+    RingIO_Attr *          attr    = NULL ;
+    RingIO_Client *        reader ;
+
+    reader = IS_READER (client) ? client : RingIO_attrSlowest (control) ;
+    if (reader->validAttrSize != 0u) {
+        attr = RingIO_attrAt (client, RingIO_attrCursor (control, reader)) ;
+    }
+
+    return attr ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrPut
+ *
+ *  @desc   Queues an attribute at the tail of the attribute buffer, for every
+ *          reader holding the writer back.
+ *
+ *  @arg    client
+ *              Writer client.
+ *  @arg    dist
+ *              Position of the attribute in the stream of data.
+ *  @arg    type
+ *              User-defined type of attribute.
+ *  @arg    param
+ *              Optional parameter of the attribute.
+ *  @arg    pdata
+ *              Payload of the attribute.
+ *  @arg    size
+ *              Size of the payload.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Operation successfully completed.
+ *          RINGIO_EFAILURE
+ *              The attribute buffer is full.
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_attrPut (IN RingIO_Client * client,
+                IN Uint32          dist,
+                IN Uint16          type,
+                IN Uint32          param,
+                IN RingIO_BufPtr   pdata,
+                IN Uint32          size)
+{
+    DSP_STATUS             status   = RINGIO_SUCCESS ;
+    RingIO_ControlStruct * control  = client->virtControlHandle ;
+    Uint32                 attrSize = RingIO_attrBufSize (control) ;
+    Uint32                 recSize  = RINGIO_ATTR_RECSIZE (size) ;
+    Uint32                 head ;
+    Uint32                 tail ;
+    Uint32                 mask ;
+    Uint32                 i ;
+    RingIO_Attr *          attr ;
+    RingIO_AttrEntry *     entry ;
+    RingIO_Client *        reader ;
+
+    RingIO_attrNormalize (control) ;
+    head = RingIO_attrCursor (control, RingIO_attrSlowest (control)) ;
+    tail = control->writer.acqAttrStart ;
+
+    if ((control->validAttrSize != 0u) && (tail <= head)) {
+        /* The queue wraps: the free space lies between tail and head. */
+        if ((head - tail) < recSize) {
+            status = RINGIO_EFAILURE ;
+            SET_FAILURE_REASON ;
+        }
+    }
+    else if ((attrSize - tail) < recSize) {
+        /* Mark an early end and restart at the start of the buffer. */
+        if (head < recSize) {
+            status = RINGIO_EFAILURE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            control->emptyAttrSize -= attrSize - tail ;
+            control->curAttrBufEnd  = tail - 1u ;
+            tail                    = 0u ;
+        }
+    }
+
+    if (RINGIO_SUCCEEDED (status)) {
+        attr = RingIO_attrAt (client, tail) ;
+        attr->type       = type ;
+        attr->size       = (Uint16) size ;
+        attr->param      = param ;
+        attr->prevoffset = (Uint32) control->prevAttrOffset ;
+        attr->offset     = dist ;
+        if (size != 0u) {
+            memcpy ((Pvoid) (attr + 1), pdata, size) ;
+        }
+
+        if (client->pAttrIndex != NULL) {
+            entry = RingIO_attrEntry (client, client->attrSeq) ;
+            entry->offset = dist ;
+            entry->pos    = tail ;
+        }
+        client->attrSeq++ ;
+
+        mask = RingIO_readerMask (control) ;
+        for (i = 0u ; mask != 0u ; i++, mask >>= 1u) {
+            reader = RINGIO_READER (control, i) ;
+            if ((mask & 1u) != 0u) {
+                if (reader->validAttrSize == 0u) {
+                    /* The queue may have been reset since its last take. */
+                    reader->acqAttrStart = tail ;
+                }
+                reader->validAttrSize += recSize ;
+            }
+        }
+        control->writer.acqAttrStart = tail + recSize ;
+        control->validAttrSize      += recSize ;
+        control->emptyAttrSize      -= recSize ;
+        control->prevAttrOffset      = (Int32) dist ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrTake
+ *
+ *  @desc   Removes the next attribute of a reader.
+ *
+ *  @arg    client
+ *              Reader client.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is held.
+ *          The reader has an attribute left to take.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_attrTake (IN RingIO_Client * client)
+{
+    RingIO_Attr * attr    = RingIO_attrHead (client) ;
+    Uint32        recSize = RINGIO_ATTR_RECSIZE (attr->size) ;
+
+    /*  The position wraps at once, as the early end it reached goes when
+     *  the slowest reader goes past it.
+     */
+    client->acqAttrStart  += recSize ;
+    client->validAttrSize -= recSize ;
+    client->attrSeq++ ;
+    RingIO_attrCursor (client->virtControlHandle, client) ;
+    RingIO_attrNormalize (client->virtControlHandle) ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrClear
+ *
+ *  @desc   Removes the attributes left to take by a reader, or by every
+ *          reader for the writer.
+ *
+ *  @arg    client
+ *              Client accessing the attribute buffer.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_attrClear (IN RingIO_Client * client)
+{
+    RingIO_ControlStruct * control    = client->virtControlHandle ;
+    Uint32                 numClients = 1u ;
+    Uint32                 i ;
+
+    if (IS_READER (client)) {
+        client->validAttrSize = 0u ;
+        client->attrSeq       = control->writer.attrSeq ;
+    }
+    else {
+        if (control->numReaders > 1u) {
+            /* The park client follows the readers. */
+            numClients = control->numReaders + 1u ;
+        }
+        for (i = 0u ; i < numClients ; i++) {
+            RINGIO_READER (control, i)->validAttrSize = 0u ;
+            RINGIO_READER (control, i)->attrSeq       = client->attrSeq ;
+        }
+    }
+    RingIO_attrNormalize (control) ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_attrTruncate
+ *
+ *  @desc   Removes the attributes located beyond a position in the stream
+ *          of data, found through the index of the attributes, or by walking
+ *          them when the RingIO has none.
+ *
+ *  @arg    client
+ *              Writer client.
+ *  @arg    dist
+ *              Position in the stream of data.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_attrFind, RingIO_attrScan
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_attrTruncate (IN RingIO_Client * client, IN Uint32 dist)
+{
+    RingIO_ControlStruct * control  = client->virtControlHandle ;
+    Uint32                 attrSize = RingIO_attrBufSize (control) ;
+    RingIO_Client *        slowest ;
+    RingIO_Client *        reader ;
+    Uint32                 pos      = 0u ;
+    Uint32                 keepDist = 0u ;
+    Uint32                 first ;
+    Uint32                 head ;
+    Uint32                 removed ;
+    Uint32                 mask ;
+    Uint32                 i ;
+
+    RingIO_attrNormalize (control) ;
+    slowest = RingIO_attrSlowest (control) ;
+    head    = RingIO_attrCursor (control, slowest) ;
+
+    if (client->pAttrIndex != NULL) {
+        first = RingIO_attrFind (client, slowest->attrSeq, dist) ;
+        if (first != client->attrSeq) {
+            pos = RingIO_attrEntry (client, first)->pos ;
+            if (first != slowest->attrSeq) {
+                keepDist = RingIO_attrEntry (client, first - 1u)->offset ;
+            }
+        }
+    }
+    else {
+        first = RingIO_attrScan (client,
+                                 slowest->attrSeq,
+                                 head,
+                                 dist,
+                                 &pos,
+                                 &keepDist) ;
+    }
+
+    if ((control->validAttrSize != 0u) && (first != client->attrSeq)) {
+        if (pos >= head) {
+            removed = control->validAttrSize - (pos - head) ;
+            if (RINGIO_ATTR_END (control) < attrSize) {
+                /* The early end lies beyond the new tail and is released. */
+                control->emptyAttrSize += attrSize - RINGIO_ATTR_END (control) ;
+                control->curAttrBufEnd  = attrSize - 1u ;
+            }
+        }
+        else {
+            removed =   control->validAttrSize
+                      - (RINGIO_ATTR_END (control) - head)
+                      - pos ;
+        }
+
+        /* The attributes removed are the last ones of every reader. */
+        mask = RingIO_readerMask (control) ;
+        for (i = 0u ; mask != 0u ; i++, mask >>= 1u) {
+            reader = RINGIO_READER (control, i) ;
+            if ((mask & 1u) != 0u) {
+                reader->validAttrSize -= (reader->validAttrSize < removed)
+                                       ? reader->validAttrSize
+                                       : removed ;
+            }
+        }
+        control->writer.acqAttrStart = pos ;
+        control->prevAttrOffset      = (Int32) keepDist ;
+        client->attrSeq              = first ;
+        RingIO_attrNormalize (control) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_readerAdvance
+ *
+ *  @desc   Moves the read position forward and releases the bytes passed to
+ *          the writer, once data has been released or flushed by the reader.
+ *
+ *  @arg    client
+ *              Reader client.
+ *  @arg    size
+ *              Number of bytes.
+ *
+ *  @ret    None
+ *
+ *  @enter  size bytes have been acquired, and not yet released.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_readerAdvance (IN RingIO_Client * client, IN Uint32 size)
+{
+    RingIO_ControlStruct * control = client->virtControlHandle ;
+    Uint32                 end ;
+
+    /* A joining reader of a broadcast RingIO copies both at once. */
+    if (control->numReaders > 1u) {
+        client->posSeq++ ;
+        __sync_synchronize () ;
+    }
+
+    end = RingIO_dataEnd (control, client->acqStart, client->relCount) ;
+    client->acqStart += size ;
+    if (client->acqStart >= end) {
+        client->acqStart -= end ;
+    }
+
+    /* The data must have been read before the writer may reuse it. */
+    __sync_synchronize () ;
+    client->relCount += size ;
+
+    if (control->numReaders > 1u) {
+        __sync_synchronize () ;
+        client->posSeq++ ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_writerRewind
+ *
+ *  @desc   Moves the write position backward, once committed data has been
+ *          flushed by the writer. The data acquired by the readers meanwhile
+ *          is kept.
+ *
+ *  @arg    client
+ *              Writer client.
+ *  @arg    count
+ *              Count of the bytes written to rewind to.
+ *
+ *  @ret    Number of bytes dropped.
+ *
+ *  @enter  The lock of the instance is held.
+ *          The writer has no buffer acquired.
+ *          count lies between the counts acquired by the readers and
+ *          released by the writer.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_readerAcquire
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RingIO_writerRewind (IN RingIO_Client * client, IN Uint32 count)
+{
+    RingIO_ControlStruct * control  = client->virtControlHandle ;
+    Uint32                 released = client->relCount ;
+    Uint32                 pos      = client->acqStart ;
+    Uint32                 curEnd   = control->curBufEnd + 1u ;
+    Uint32                 acquired ;
+    Uint32                 drop ;
+
+    /*  Pairs with the barrier of the reader between publishing its count
+     *  and checking the flush count: either the reader sees the flush and
+     *  gives its buffer up, or the buffer is seen here and kept.
+     */
+    control->flushCount++ ;
+    __sync_synchronize () ;
+    client->relCount = count ;
+    client->acqCount = count ;
+    __sync_synchronize () ;
+    acquired = RingIO_readerCount (control, FALSE, FALSE) ;
+    if ((Int32) (acquired - count) > 0) {
+        count            = acquired ;
+        client->relCount = count ;
+        client->acqCount = count ;
+    }
+
+    drop = released - count ;
+    if (drop <= pos) {
+        pos -= drop ;
+    }
+    else if (    (curEnd < control->dataBufSize)
+             &&  (control->endCount == (released - pos))) {
+        /* Back before the early end of the previous round, which goes. */
+        pos                = curEnd - (drop - pos) ;
+        control->curBufEnd = control->dataBufEnd ;
+    }
+    else {
+        pos = control->dataBufSize - (drop - pos) ;
+    }
+    client->acqStart = pos ;
+
+    return drop ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_writerAcquire
+ *
+ *  @desc   Acquires an empty buffer for the writer.
+ *
+ *  @arg    client
+ *              Writer client.
+ *  @arg    dataBuf
+ *              Location to receive the buffer.
+ *  @arg    size
+ *              Requested size, returns the acquired size.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Operation successfully completed.
+ *          RINGIO_EBUFFULL
+ *              Less than the requested size is empty.
+ *          RINGIO_EBUFWRAP
+ *              The requested size is not contiguous.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_dataEnd
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_writerAcquire (IN     RingIO_Client * client,
+                      OUT    RingIO_BufPtr * dataBuf,
+                      IN OUT Uint32 *        size)
+{
+    DSP_STATUS             status   = RINGIO_SUCCESS ;
+    RingIO_ControlStruct * control  = client->virtControlHandle ;
+    Uint32                 request  = *size ;
+    Uint32                 granted  = 0u ;
+    Uint32                 released ;
+    Uint32                 curEnd ;
+    Uint32                 empty ;
+    Uint32                 wpos ;
+    Uint32                 contig ;
+
+    /* A mirrored data buffer wraps even under the buffers acquired. */
+    if (    (client->acqStart >= control->dataBufSize)
+        &&  ((client->acqSize == 0u) || (control->mirrored != 0u))) {
+        client->acqStart -= control->dataBufSize ;
+    }
+
+    do {
+        /* The readers must be done with the data before it is overwritten. */
+        released = RingIO_readerCount (control, TRUE, TRUE) ;
+        __sync_synchronize () ;
+
+        curEnd = control->curBufEnd + 1u ;
+        if (    (curEnd < control->dataBufSize)
+            &&  ((Int32) (released - control->endCount) > 0)) {
+            /* The readers are past the early end: the whole buffer is used. */
+            control->curBufEnd = control->dataBufEnd ;
+            curEnd             = control->dataBufSize ;
+        }
+        empty =   control->dataBufSize
+                - (client->acqCount - released)
+                - (control->dataBufSize - curEnd) ;
+    } while (    (empty < request)
+             &&  (control->bcastPolicy == RINGIO_BCAST_DROPSLOW)
+             &&  (RingIO_dropSlow (control) == TRUE)) ;
+
+    wpos = client->acqStart + client->acqSize ;
+    if (control->mirrored != 0u) {
+        contig = empty ;
+    }
+    else {
+        contig = (wpos < control->dataBufSize) ? (control->dataBufSize - wpos)
+                                               : 0u ;
+    }
+    if (contig > empty) {
+        contig = empty ;
+    }
+
+    if (contig >= request) {
+        granted = request ;
+    }
+    else if (    ((client->flags & RINGIO_NEED_EXACT_SIZE) != 0u)
+             &&  (client->acqSize == 0u)
+             &&  (wpos != 0u)
+             &&  (empty >= (control->dataBufSize - wpos))
+             &&  ((empty - (control->dataBufSize - wpos)) >= request)) {
+        /*  Mark an early end so that the request is served contiguously.
+         *  The reader sees it before the data written after it.
+         */
+        control->endCount  = client->acqCount ;
+        control->curBufEnd = wpos - 1u ;
+        client->acqStart   = 0u ;
+        wpos               = 0u ;
+        granted            = request ;
+    }
+    else {
+        status = (empty < request) ? RINGIO_EBUFFULL : RINGIO_EBUFWRAP ;
+        if ((client->flags & RINGIO_NEED_EXACT_SIZE) == 0u) {
+            granted = contig ;
+        }
+        client->notifyFlag = 1u ;
+    }
+
+    if (granted != 0u) {
+        *dataBuf          = (RingIO_BufPtr) ((Char8 *) client->pDataStart
+                                             + wpos) ;
+        client->acqSize  += granted ;
+        client->acqCount += granted ;
+    }
+    *size = granted ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_readerAcquire
+ *
+ *  @desc   Acquires a buffer of valid data for the reader. The lock of the
+ *          instance is taken only while attributes are pending.
+ *
+ *  @arg    client
+ *              Reader client.
+ *  @arg    dataBuf
+ *              Location to receive the buffer.
+ *  @arg    size
+ *              Requested size, returns the acquired size.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Operation successfully completed.
+ *          RINGIO_SPENDINGATTRIBUTE
+ *              Less than the requested size could be acquired because of an
+ *              attribute.
+ *          RINGIO_EBUFEMPTY
+ *              No valid data is present.
+ *          RINGIO_EBUFFULL
+ *              Less than the requested size is valid.
+ *          RINGIO_EBUFWRAP
+ *              The requested size is not contiguous.
+ *          RINGIO_ENOTCONTIGUOUSDATA
+ *              The valid data does not follow the foot buffer in use.
+ *
+ *  @enter  The lock of the instance is not held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_dataEnd, RingIO_writerRewind
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_readerAcquire (IN     RingIO_Client * client,
+                      OUT    RingIO_BufPtr * dataBuf,
+                      IN OUT Uint32 *        size)
+{
+    DSP_STATUS             status  = RINGIO_SUCCESS ;
+    RingIO_ControlStruct * control = client->virtControlHandle ;
+    Uint32                 request = *size ;
+    Uint32                 granted = 0u ;
+    Bool                   locked  = FALSE ;
+    Bool                   retry   = FALSE ;
+    Char8 *                data    = (Char8 *) client->pDataStart ;
+    RingIO_Attr *          attr ;
+    Bool                   limited ;
+    Uint32                 flushes ;
+    Uint32                 count ;
+    Uint32                 avail ;
+    Uint32                 rpos ;
+    Uint32                 end ;
+    Uint32                 contig ;
+    Uint32                 copyStart ;
+
+    do {
+        status    = RINGIO_SUCCESS ;
+        granted   = 0u ;
+        limited   = FALSE ;
+        copyStart = 0u ;
+
+        if (client->acqSize == 0u) {
+            end = RingIO_dataEnd (control, client->acqStart, client->acqCount) ;
+            if (client->acqStart >= end) {
+                client->acqStart -= end ;
+            }
+        }
+
+        flushes = control->flushCount ;
+        __sync_synchronize () ;
+        count = client->acqCount ;
+        avail = control->writer.relCount - count ;
+        if ((Int32) avail < 0) {
+            avail = 0u ;
+        }
+        __sync_synchronize () ;
+
+        /* The writer sets an attribute before releasing the data it marks. */
+        if ((locked == FALSE) && (client->validAttrSize != 0u)) {
+            MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+            locked = TRUE ;
+        }
+
+        attr = (locked == TRUE) ? RingIO_attrHead (client) : NULL ;
+        if ((attr != NULL) && ((attr->offset - count) <= avail)) {
+            avail   = attr->offset - count ;
+            limited = TRUE ;
+        }
+
+        rpos = client->acqStart + client->acqSize ;
+        end  = RingIO_dataEnd (control, rpos, count) ;
+        if (control->mirrored != 0u) {
+            contig = avail ;
+        }
+        else {
+            contig = (rpos < end) ? (end - rpos) : 0u ;
+        }
+        if (contig > avail) {
+            contig = avail ;
+        }
+
+        if ((avail == 0u) && (limited == TRUE)) {
+            status = RINGIO_SPENDINGATTRIBUTE ;
+        }
+        else if (avail == 0u) {
+            status = RINGIO_EBUFEMPTY ;
+        }
+        else if (contig >= request) {
+            granted = request ;
+        }
+        else if (    (avail >= request)
+                 &&  (end == control->dataBufSize)
+                 &&  ((rpos + request - control->dataBufSize)
+                      <= control->footBufSize)) {
+            /* The wrapped data is copied to the foot buffer. */
+            copyStart = (rpos > control->dataBufSize) ? rpos
+                                                      : control->dataBufSize ;
+            granted   = request ;
+        }
+        else if ((control->mirrored == 0u) && (rpos > end)) {
+            status = RINGIO_ENOTCONTIGUOUSDATA ;
+        }
+        else {
+            if (avail < request) {
+                status = (limited == TRUE) ? RINGIO_SPENDINGATTRIBUTE
+                                           : RINGIO_EBUFFULL ;
+            }
+            else {
+                status = RINGIO_EBUFWRAP ;
+            }
+            if (    ((client->flags & RINGIO_NEED_EXACT_SIZE) == 0u)
+                ||  (status == RINGIO_SPENDINGATTRIBUTE)) {
+                granted = contig ;
+            }
+        }
+
+        if (granted != 0u) {
+            client->acqCount = count + granted ;
+            __sync_synchronize () ;
+            if (control->flushCount != flushes) {
+                /* The writer flushed meanwhile: the data may be gone. */
+                client->acqCount = count ;
+                retry            = TRUE ;
+            }
+            else {
+                retry = FALSE ;
+            }
+        }
+    } while ((granted != 0u) && (retry == TRUE)) ;
+
+    if (granted != request) {
+        client->notifyFlag = 1u ;
+    }
+
+    if (granted != 0u) {
+        if (copyStart != 0u) {
+            memcpy (data + copyStart,
+                    data + (copyStart - control->dataBufSize),
+                    rpos + request - copyStart) ;
+        }
+        *dataBuf         = (RingIO_BufPtr) (data + rpos) ;
+        client->acqSize += granted ;
+    }
+    *size = granted ;
+
+    if (locked == TRUE) {
+        MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_cancelClient
+ *
+ *  @desc   Cancels the buffers acquired by a client.
+ *
+ *  @arg    client
+ *              RingIO client.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is held.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_cancelClient (IN RingIO_Client * client)
+{
+    client->acqCount -= client->acqSize ;
+    client->acqSize   = 0u ;
+    if (IS_WRITER (client)) {
+        RingIO_attrTruncate (client, client->relCount) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_readerJoin
+ *
+ *  @desc   Places a reader of a broadcast RingIO, opened or dropped, at the
+ *          position of the slowest reader holding the writer back, in the
+ *          data and in the attributes, and makes it hold the writer back.
+ *
+ *  @arg    client
+ *              Reader client.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is held.
+ *          The reader has no buffer acquired and does not hold the writer
+ *          back.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_readerLeave
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_readerJoin (IN RingIO_Client * client)
+{
+    RingIO_ControlStruct * control    = client->virtControlHandle ;
+    RingIO_Client *        attrSource = RingIO_attrSlowest (control) ;
+    RingIO_Client *        source ;
+    RingIO_Client *        reader ;
+    RingIO_Attr *          attr ;
+    Uint32                 mask ;
+    Uint32                 seq ;
+    Uint32                 start ;
+    Uint32                 count = 0u ;
+    Uint32                 i ;
+
+    /*  The slowest reader goes on releasing meanwhile: the position is
+     *  taken again until it is seen not to have moved once the new reader
+     *  holds the writer back.
+     */
+    do {
+        source = NULL ;
+        mask   = RingIO_readerMask (control) ;
+        for (i = 0u ; mask != 0u ; i++, mask >>= 1u) {
+            reader = RINGIO_READER (control, i) ;
+            if (    ((mask & 1u) != 0u)
+                &&  (reader != client)
+                &&  (   (source == NULL)
+                     || ((Int32) (reader->relCount - source->relCount) < 0))) {
+                source = reader ;
+            }
+        }
+
+        if (source != NULL) {
+            do {
+                seq = source->posSeq ;
+                __sync_synchronize () ;
+                start = source->acqStart ;
+                count = source->relCount ;
+                __sync_synchronize () ;
+            } while (((seq & 1u) != 0u) || (source->posSeq != seq)) ;
+
+            client->acqStart = start ;
+            client->acqCount = count ;
+            client->relCount = count ;
+            __sync_synchronize () ;
+            client->dropped  = 0u ;
+            client->isValid  = TRUE ;
+            __sync_synchronize () ;
+        }
+    } while ((source != NULL) && (source->relCount != count)) ;
+
+    /* The attributes marking data before the position are skipped. */
+    client->acqAttrStart  = RingIO_attrCursor (control, attrSource) ;
+    client->validAttrSize = attrSource->validAttrSize ;
+    client->attrSeq       = attrSource->attrSeq ;
+    attr = RingIO_attrHead (client) ;
+    while ((attr != NULL) && ((Int32) (attr->offset - client->acqCount) < 0)) {
+        RingIO_attrTake (client) ;
+        attr = RingIO_attrHead (client) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_readerLeave
+ *
+ *  @desc   Makes a reader of a broadcast RingIO being closed stop holding the
+ *          writer back. The position of the last one is kept by the park
+ *          client for the next reader.
+ *
+ *  @arg    client
+ *              Reader client.
+ *
+ *  @ret    None
+ *
+ *  @enter  The lock of the instance is held.
+ *          The reader has no buffer acquired.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_readerJoin
+ *  ============================================================================
+ */
+STATIC
+Void
+RingIO_readerLeave (IN RingIO_Client * client)
+{
+    RingIO_ControlStruct * control = client->virtControlHandle ;
+    RingIO_Client *        park ;
+    Uint32                 index ;
+
+    park  = RINGIO_READER (control, control->numReaders) ;
+    index = (Uint32) (client - RINGIO_READER (control, 0u)) ;
+    if (    (client->dropped == 0u)
+        &&  (RingIO_readerMask (control) == (1u << index))) {
+        park->acqStart      = client->acqStart ;
+        park->acqCount      = client->relCount ;
+        park->relCount      = client->relCount ;
+        park->acqAttrStart  = client->acqAttrStart ;
+        park->validAttrSize = client->validAttrSize ;
+        park->attrSeq       = client->attrSeq ;
+        __sync_synchronize () ;
+    }
+
+    client->isValid = FALSE ;
+    __sync_synchronize () ;
+    RingIO_attrNormalize (control) ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_checkDropped
+ *
+ *  @desc   Places a reader dropped by the writer of a broadcast RingIO back at
+ *          the position of the slowest reader, giving its buffers up.
+ *
+ *  @arg    client
+ *              RingIO client.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The client was not dropped.
+ *          RINGIO_EDROPPED
+ *              The reader was dropped.
+ *
+ *  @enter  The lock of the instance is not held.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_dropSlow, RingIO_readerJoin
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_checkDropped (IN RingIO_Client * client)
+{
+    DSP_STATUS status = RINGIO_SUCCESS ;
+
+    if (IS_READER (client) && (client->dropped != 0u)) {
+        MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+        RingIO_cancelClient (client) ;
+        RingIO_readerJoin (client) ;
+        MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+        status = RINGIO_EDROPPED ;
+        SET_FAILURE_REASON ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_allocData
+ *
+ *  @desc   Allocates the data buffer of an instance. When the data buffer is
+ *          a multiple of the page size, it is placed on a page boundary so
+ *          that the GPP clients can map it twice back-to-back, and no foot
+ *          buffer is allocated. Otherwise the foot buffer follows it.
+ *
+ *  @arg    poolId
+ *              Pool to allocate from.
+ *  @arg    attrs
+ *              Attributes of the instance.
+ *  @arg    dataBuf
+ *              Location to receive the data buffer.
+ *  @arg    bufOffset
+ *              Location to receive the offset of the data buffer in the pool
+ *              buffer.
+ *  @arg    bufSize
+ *              Location to receive the size of the pool buffer.
+ *  @arg    mirrored
+ *              Location to receive TRUE if the data buffer can be mirrored.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The pool has no buffer to hold the data buffer.
+ *
+ *  @enter  All arguments must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_mapMirror
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_allocData (IN  PoolId         poolId,
+                  IN  RingIO_Attrs * attrs,
+                  OUT Char8 **       dataBuf,
+                  OUT Uint32 *       bufOffset,
+                  OUT Uint32 *       bufSize,
+                  OUT Bool *         mirrored)
+{
+    DSP_STATUS status   = DSP_SOK ;
+    Uint32     pageSize = 0u ;
+    Uint32     misalign = 0u ;
+    Char8 *    buf      = NULL ;
+
+    *bufOffset = 0u ;
+    *mirrored  = FALSE ;
+
+    /* A misaligned data buffer is allocated again with a page to spare. */
+    status = POOL_alloc (poolId, (Pvoid *) &buf, attrs->dataBufSize) ;
+    if (DSP_SUCCEEDED (status)) {
+        pageSize = DRV_pageSize (DRV_usrToPhy (buf)) ;
+        misalign = (Uint32) ((unsigned long) buf & (pageSize - 1u)) ;
+        if ((pageSize == 0u) || ((attrs->dataBufSize % pageSize) != 0u)) {
+            POOL_free (poolId, buf, attrs->dataBufSize) ;
+            buf = NULL ;
+        }
+        else if (misalign == 0u) {
+            *bufSize  = attrs->dataBufSize ;
+            *mirrored = TRUE ;
+        }
+        else {
+            POOL_free (poolId, buf, attrs->dataBufSize) ;
+            buf    = NULL ;
+            status = POOL_alloc (poolId,
+                                 (Pvoid *) &buf,
+                                 attrs->dataBufSize + pageSize) ;
+            if (DSP_SUCCEEDED (status)) {
+                misalign   = (Uint32) ((unsigned long) buf & (pageSize - 1u)) ;
+                *bufOffset = (misalign == 0u) ? 0u : (pageSize - misalign) ;
+                *bufSize   = attrs->dataBufSize + pageSize ;
+                *mirrored  = TRUE ;
+            }
+            else {
+                buf = NULL ;
+            }
+        }
+    }
+
+    if (buf == NULL) {
+        *bufSize = attrs->dataBufSize + attrs->footBufSize ;
+        status   = POOL_alloc (poolId, (Pvoid *) &buf, *bufSize) ;
+        if (DSP_FAILED (status)) {
+            buf = NULL ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    *dataBuf = (buf == NULL) ? NULL : (buf + *bufOffset) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_zeroCopyWait
+ *
+ *  @desc   Waits until the kernel is done with the pages of the given number
+ *          of MSG_ZEROCOPY sends on a socket, as told by the completions
+ *          queued on its error queue.
+ *
+ *  @arg    fd
+ *              Socket.
+ *  @arg    sends
+ *              Number of sends to wait for.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFILE
+ *              The socket failed: the kernel may still hold some pages.
+ *
+ *  @enter  No other MSG_ZEROCOPY send on the socket is pending.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_spliceRelease
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_zeroCopyWait (IN Int32 fd, IN Uint32 sends)
+{
+    DSP_STATUS                 status = DSP_SOK ;
+    Uint32                     done   = 0u ;
+    Char8                      ctrlBuf [RINGIO_SPLICE_CTRLSIZE] ;
+    struct sock_extended_err * serr ;
+    struct cmsghdr *           cmsg ;
+    struct msghdr              msg ;
+    struct pollfd              pfd ;
+    int                        err ;
+    socklen_t                  len ;
+
+    while ((DSP_SUCCEEDED (status)) && (done < sends)) {
+        memset (&msg, 0, sizeof (msg)) ;
+        msg.msg_control    = ctrlBuf ;
+        msg.msg_controllen = sizeof (ctrlBuf) ;
+        if (recvmsg (fd, &msg, MSG_ERRQUEUE) >= 0) {
+            for (cmsg = CMSG_FIRSTHDR (&msg) ;
+                 cmsg != NULL ;
+                 cmsg = CMSG_NXTHDR (&msg, cmsg)) {
+                serr = (struct sock_extended_err *) CMSG_DATA (cmsg) ;
+                if (    (    ((cmsg->cmsg_level == SOL_IP)
+                          &&  (cmsg->cmsg_type == IP_RECVERR))
+                     ||  (    (cmsg->cmsg_level == SOL_IPV6)
+                          &&  (cmsg->cmsg_type == IPV6_RECVERR)))
+                    &&  (serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+                    &&  (serr->ee_errno == 0u)) {
+                    /* The completions of sends ee_info to ee_data. */
+                    done += serr->ee_data - serr->ee_info + 1u ;
+                }
+            }
+        }
+        else if (errno == EAGAIN) {
+            err = 0 ;
+            len = sizeof (err) ;
+            getsockopt (fd, SOL_SOCKET, SO_ERROR, &err, &len) ;
+            if (err != 0) {
+                errno  = err ;
+                status = DSP_EFILE ;
+                SET_FAILURE_REASON ;
+            }
+            else {
+                /* Completions raise POLLERR, which needs no event. */
+                pfd.fd      = fd ;
+                pfd.events  = 0 ;
+                pfd.revents = 0 ;
+                poll (&pfd, 1u, -1) ;
+            }
+        }
+        else if (errno != EINTR) {
+            status = DSP_EFILE ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_fdWrite
+ *
+ *  @desc   Writes a buffer to a file descriptor straight from the data
+ *          buffer of a RingIO. Large writes to a socket that takes
+ *          MSG_ZEROCOPY are sent from the pages of the buffer, which the
+ *          kernel holds until their completions come back.
+ *
+ *  @arg    fd
+ *              File descriptor.
+ *  @arg    buf
+ *              Buffer to write.
+ *  @arg    size
+ *              Size of the buffer.
+ *  @arg    isSocket
+ *              TRUE if the descriptor is a socket.
+ *  @arg    zeroCopy
+ *              TRUE if the socket takes MSG_ZEROCOPY.
+ *  @arg    done
+ *              Location to receive the size written.
+ *  @arg    sends
+ *              Location to receive the number of MSG_ZEROCOPY sends made.
+ *
+ *  @ret    DSP_SOK
+ *              The whole buffer has been written.
+ *          DSP_EPENDING
+ *              The descriptor is non-blocking and takes no more data now.
+ *          DSP_EFILE
+ *              The write failed, errno tells why.
+ *
+ *  @enter  None
+ *
+ *  @leave  The kernel may use the buffer until the completions of the sends
+ *          come back.
+ *
+ *  @see    RingIO_spliceRelease
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_fdWrite (IN  Int32    fd,
+                IN  Char8 *  buf,
+                IN  Uint32   size,
+                IN  Bool     isSocket,
+                IN  Bool     zeroCopy,
+                OUT Uint32 * done,
+                OUT Uint32 * sends)
+{
+    DSP_STATUS status = DSP_SOK ;
+    int        flags  = 0 ;
+    ssize_t    count ;
+
+    if ((zeroCopy == TRUE) && (size >= RINGIO_SPLICE_ZEROCOPY)) {
+        flags |= MSG_ZEROCOPY ;
+    }
+
+    *done  = 0u ;
+    *sends = 0u ;
+    while ((DSP_SUCCEEDED (status)) && (*done < size)) {
+        if (isSocket == TRUE) {
+            count = send (fd, buf + *done, size - *done, flags) ;
+        }
+        else {
+            count = write (fd, buf + *done, size - *done) ;
+        }
+
+        if (count > 0) {
+            *done += (Uint32) count ;
+            if ((flags & MSG_ZEROCOPY) != 0) {
+                (*sends)++ ;
+            }
+        }
+        else if ((count < 0) && (errno == ENOBUFS) && (flags != 0)) {
+            /* Out of memory to pin the pages: the rest is copied. */
+            flags = 0 ;
+        }
+        else if ((count < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+            status = DSP_EPENDING ;
+        }
+        else if ((count == 0) || (errno != EINTR)) {
+            status = DSP_EFILE ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_fdRead
+ *
+ *  @desc   Reads from a file descriptor straight into the data buffer of a
+ *          RingIO.
+ *
+ *  @arg    fd
+ *              File descriptor.
+ *  @arg    buf
+ *              Buffer to fill.
+ *  @arg    size
+ *              Size of the buffer.
+ *  @arg    done
+ *              Location to receive the size read, less than the size of the
+ *              buffer at the end of the file.
+ *
+ *  @ret    DSP_SOK
+ *              The buffer has been filled, or the end of the file reached.
+ *          DSP_EPENDING
+ *              The descriptor is non-blocking and has no more data now.
+ *          DSP_EFILE
+ *              The read failed, errno tells why.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_fdRead (IN  Int32    fd,
+               IN  Char8 *  buf,
+               IN  Uint32   size,
+               OUT Uint32 * done)
+{
+    DSP_STATUS status = DSP_SOK ;
+    Bool       eof    = FALSE ;
+    ssize_t    count ;
+
+    *done = 0u ;
+    while ((DSP_SUCCEEDED (status)) && (eof == FALSE) && (*done < size)) {
+        count = read (fd, buf + *done, size - *done) ;
+        if (count > 0) {
+            *done += (Uint32) count ;
+        }
+        else if (count == 0) {
+            eof = TRUE ;
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            status = DSP_EPENDING ;
+        }
+        else if (errno != EINTR) {
+            status = DSP_EFILE ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_spliceRelease
+ *
+ *  @desc   Waits for the MSG_ZEROCOPY sends in flight on a socket, if any,
+ *          then releases the size moved through the buffers of a client.
+ *
+ *  @arg    client
+ *              RingIO client.
+ *  @arg    fd
+ *              File descriptor.
+ *  @arg    held
+ *              Size moved and not released yet, returns zero.
+ *  @arg    sends
+ *              Number of sends in flight, returns zero.
+ *  @arg    size
+ *              Size moved, increased by the size released.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Operation successfully completed.
+ *          DSP_EFILE
+ *              The socket failed: nothing is released while the kernel may
+ *              still hold some pages.
+ *          Others
+ *              Status of RingIO_release.
+ *
+ *  @enter  The size moved is the start of the buffers acquired.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_zeroCopyWait
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_spliceRelease (IN     RingIO_Client * client,
+                      IN     Int32           fd,
+                      IN OUT Uint32 *        held,
+                      IN OUT Uint32 *        sends,
+                      IN OUT Uint32 *        size)
+{
+    DSP_STATUS status = RINGIO_SUCCESS ;
+
+    if (*sends != 0u) {
+        status = RingIO_zeroCopyWait (fd, *sends) ;
+        *sends = 0u ;
+    }
+
+    if ((DSP_SUCCEEDED (status)) && (*held != 0u)) {
+        status = RingIO_release ((RingIO_Handle) client, *held) ;
+        if (DSP_SUCCEEDED (status)) {
+            *size += *held ;
+        }
+    }
+    *held = 0u ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RingIO_splice
+ *
+ *  @desc   Moves data between a RingIO client and a file descriptor through
+ *          the buffers it acquires: the reader writes them to the
+ *          descriptor, the writer fills them from it. Each buffer is
+ *          released once the kernel is done with its pages, for the size
+ *          moved, and the rest of it cancelled. A reader opened with
+ *          RINGIO_ZEROCOPY sends the data in buffers of up to
+ *          RINGIO_SPLICE_SENDSIZE, keeps up to RINGIO_SPLICE_INFLIGHT of
+ *          them in flight, and releases them together once their
+ *          completions come back. A datagram socket is sent buffers of up
+ *          to RINGIO_SPLICE_DGRAMSIZE.
+ *
+ *  @arg    client
+ *              RingIO client.
+ *  @arg    fd
+ *              File descriptor.
+ *  @arg    size
+ *              Size to move, returns the size moved.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The size has been moved, or the end of the file reached.
+ *          DSP_EPENDING
+ *              The descriptor is non-blocking and cannot move more now.
+ *          DSP_EFILE
+ *              The descriptor failed, errno tells why.
+ *          Others
+ *              Status of RingIO_acquire or RingIO_release when it stopped
+ *              the move.
+ *
+ *  @enter  The client has no buffer acquired.
+ *
+ *  @leave  The client has no buffer acquired, and SO_ZEROCOPY is set on the
+ *          socket as it was on entry.
+ *
+ *  @see    RingIO_spliceOut, RingIO_spliceIn
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RingIO_splice (IN     RingIO_Client * client,
+               IN     Int32           fd,
+               IN OUT Uint32 *        size)
+{
+    DSP_STATUS             status   = RINGIO_SUCCESS ;
+    RingIO_ControlStruct * control  = client->virtControlHandle ;
+    Uint32                 request  = *size ;
+    Uint32                 held     = 0u ;
+    Uint32                 sends    = 0u ;
+    Uint32                 sent     = 0u ;
+    Uint32                 sendSize = 0u ;
+    Bool                   isSocket = FALSE ;
+    Bool                   zeroCopy = FALSE ;
+    Bool                   restore  = FALSE ;
+    Bool                   more     = TRUE ;
+    int                    enable   = 0 ;
+    int                    type     = 0 ;
+    socklen_t              len ;
+    DSP_STATUS             acqStatus ;
+    DSP_STATUS             relStatus ;
+    DSP_STATUS             fdStatus ;
+    RingIO_BufPtr          buf ;
+    struct stat            info ;
+    Uint32                 chunk ;
+    Uint32                 done ;
+    Uint32                 start ;
+    Uint32                 end ;
+
+    if ((!IS_WRITER (client)) && (fstat (fd, &info) == 0)) {
+        isSocket = (S_ISSOCK (info.st_mode)) ? TRUE : FALSE ;
+    }
+
+    if (isSocket == TRUE) {
+        len = sizeof (type) ;
+        if (    (getsockopt (fd, SOL_SOCKET, SO_TYPE, &type, &len) == 0)
+            &&  (type == SOCK_DGRAM)) {
+            /* A larger send fails with EMSGSIZE. */
+            sendSize = RINGIO_SPLICE_DGRAMSIZE ;
+        }
+        len = sizeof (enable) ;
+    }
+
+    if (    (isSocket == TRUE)
+        &&  ((client->flags & RINGIO_ZEROCOPY) != 0u)
+        &&  (getsockopt (fd, SOL_SOCKET, SO_ZEROCOPY, &enable, &len) == 0)) {
+        if (enable != 0) {
+            zeroCopy = TRUE ;
+        }
+        else {
+            /* Set for this call only: the socket is the caller's. */
+            enable = 1 ;
+            if (setsockopt (fd, SOL_SOCKET, SO_ZEROCOPY,
+                            &enable, sizeof (enable)) == 0) {
+                zeroCopy = TRUE ;
+                restore  = TRUE ;
+            }
+        }
+    }
+
+    if (    (zeroCopy == TRUE)
+        &&  ((sendSize == 0u) || (sendSize > RINGIO_SPLICE_SENDSIZE))) {
+        sendSize = RINGIO_SPLICE_SENDSIZE ;
+    }
+
+    *size = 0u ;
+    while ((more == TRUE) && ((*size + held) < request)) {
+        chunk = request - *size - held ;
+        if ((sendSize != 0u) && (chunk > sendSize)) {
+            chunk = sendSize ;
+        }
+        if ((!IS_WRITER (client)) && (control->mirrored == 0u)) {
+            start = client->acqStart + client->acqSize ;
+            end   = RingIO_dataEnd (control, start, client->acqCount) ;
+            if ((held != 0u) && (start >= end)) {
+                /* The buffers in flight are released before the wrap. */
+                status = RingIO_spliceRelease (client, fd,
+                                               &held, &sends, size) ;
+                start  = client->acqStart ;
+                end    = RingIO_dataEnd (control, start, client->acqCount) ;
+            }
+            /* The data wrapped past the end is not copied to the foot. */
+            if (start >= end) {
+                start -= end ;
+            }
+            if ((start < end) && ((end - start) < chunk)) {
+                chunk = end - start ;
+            }
+        }
+
+        if (DSP_FAILED (status)) {
+            RingIO_cancel ((RingIO_Handle) client) ;
+            chunk = 0u ;
+            more  = FALSE ;
+        }
+        else {
+            acqStatus = RingIO_acquire ((RingIO_Handle) client, &buf, &chunk) ;
+            status    = acqStatus ;
+            more      = (acqStatus == RINGIO_SUCCESS) ? TRUE : FALSE ;
+        }
+
+        if (chunk != 0u) {
+            if (IS_WRITER (client)) {
+                fdStatus = RingIO_fdRead (fd, (Char8 *) buf, chunk, &done) ;
+                if ((DSP_SUCCEEDED (fdStatus)) && (done < chunk)) {
+                    /* The end of the file, whatever room is left. */
+                    acqStatus = RINGIO_SUCCESS ;
+                    more      = FALSE ;
+                }
+            }
+            else {
+                fdStatus = RingIO_fdWrite (fd, (Char8 *) buf, chunk,
+                                           isSocket, zeroCopy, &done, &sent) ;
+            }
+
+            held  += done ;
+            sends += sent ;
+            relStatus = RINGIO_SUCCESS ;
+            if (    (sends == 0u)
+                ||  (sends >= RINGIO_SPLICE_INFLIGHT)
+                ||  (done != chunk)
+                ||  (DSP_FAILED (fdStatus))) {
+                relStatus = RingIO_spliceRelease (client, fd,
+                                                  &held, &sends, size) ;
+            }
+            if ((done != chunk) || (DSP_FAILED (relStatus))) {
+                RingIO_cancel ((RingIO_Handle) client) ;
+            }
+
+            if (DSP_FAILED (relStatus)) {
+                status = relStatus ;
+                more   = FALSE ;
+            }
+            else if (DSP_FAILED (fdStatus)) {
+                status = fdStatus ;
+                more   = FALSE ;
+            }
+            else if ((acqStatus == RINGIO_EBUFWRAP) && (done == chunk)) {
+                /* The rest follows from the start of the buffer. */
+                status = RINGIO_SUCCESS ;
+                more   = TRUE ;
+            }
+            else {
+                status = acqStatus ;
+            }
+        }
+    }
+
+    if (held != 0u) {
+        relStatus = RingIO_spliceRelease (client, fd, &held, &sends, size) ;
+        if (DSP_FAILED (relStatus)) {
+            RingIO_cancel ((RingIO_Handle) client) ;
+            status = relStatus ;
+        }
+    }
+
+    if (restore == TRUE) {
+        enable = 0 ;
+        setsockopt (fd, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof (enable)) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getValidSize
+ *
+ *  @desc   This function returns the valid size in the RingIO.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+RingIO_getValidSize (IN RingIO_Handle handle)
+{
+    RingIO_Client *        client = (RingIO_Client *) handle ;
+    Uint32                 size   = 0u ;
+    RingIO_ControlStruct * control ;
+
+    TRC_1ENTER ("RingIO_getValidSize", handle) ;
+
+    if (client != NULL) {
+        /* The writer sees the valid size of the slowest reader. */
+        control = client->virtControlHandle ;
+        size    = RingIO_validSize (control,
+                                    IS_READER (client)
+                                  ? client->acqCount
+                                  : RingIO_readerCount (control, FALSE, TRUE)) ;
+    }
+
+    TRC_1LEAVE ("RingIO_getValidSize", size) ;
+
+    return size ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getEmptySize
+ *
+ *  @desc   This function returns the empty size in the RingIO.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+RingIO_getEmptySize (IN RingIO_Handle handle)
+{
+    RingIO_Client * client = (RingIO_Client *) handle ;
+    Uint32          size   = 0u ;
+
+    TRC_1ENTER ("RingIO_getEmptySize", handle) ;
+
+    if (client != NULL) {
+        size = RingIO_emptySize (client->virtControlHandle) ;
+    }
+
+    TRC_1LEAVE ("RingIO_getEmptySize", size) ;
+
+    return size ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getValidAttrSize
+ *
+ *  @desc   This function returns the valid attribute size in the RingIO.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+RingIO_getValidAttrSize (IN RingIO_Handle handle)
+{
+    RingIO_Client * client = (RingIO_Client *) handle ;
+    Uint32          size   = 0u ;
+
+    TRC_1ENTER ("RingIO_getValidAttrSize", handle) ;
+
+    if (client != NULL) {
+        size = IS_READER (client) ? client->validAttrSize
+                                  : client->virtControlHandle->validAttrSize ;
+    }
+
+    TRC_1LEAVE ("RingIO_getValidAttrSize", size) ;
+
+    return size ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getEmptyAttrSize
+ *
+ *  @desc   This function returns the empty attribute size in the RingIO.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+RingIO_getEmptyAttrSize (IN RingIO_Handle handle)
+{
+    RingIO_Client * client = (RingIO_Client *) handle ;
+    Uint32          size   = 0u ;
+
+    TRC_1ENTER ("RingIO_getEmptyAttrSize", handle) ;
+
+    if (client != NULL) {
+        size = client->virtControlHandle->emptyAttrSize ;
+    }
+
+    TRC_1LEAVE ("RingIO_getEmptyAttrSize", size) ;
+
+    return size ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_create
+ *
+ *  @desc   This function creates a RingIO instance in Shared memory using the
+ *          creation params specified.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+#if defined (DSPLINK_LEGACY_SUPPORT)
+RingIO_create (IN Char8 *         name,
+               IN RingIO_Attrs *  attrs)
+#else
+RingIO_create (IN ProcessorId     procId,
+               IN Char8 *         name,
+               IN RingIO_Attrs *  attrs)
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+{
+    DSP_STATUS             status     = RINGIO_SUCCESS ;
+    RingIO_ControlStruct * control    = NULL ;
+    Char8 *                dataBuf    = NULL ;
+    Char8 *                attrBuf    = NULL ;
+    Char8 *                attrIndex  = NULL ;
+    MPCS_ShObj *           lockObj    = NULL ;
+    Uint32                 bufOffset  = 0u ;
+    Uint32                 bufSize    = 0u ;
+    Bool                   mirrored   = FALSE ;
+    Uint32                 numReaders = 1u ;
+    RingIO_BcastAttrs *    bcast      = NULL ;
+    RingIO_Ctrl *          ctrl ;
+    RingIO_Entry *         entry ;
+    Uint32                 i ;
+#if defined (DSPLINK_LEGACY_SUPPORT)
+    ProcessorId            procId     = 0u ;
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+
+    TRC_3ENTER ("RingIO_create", procId, name, attrs) ;
+
+    if (    (!IS_VALID_PROCID (procId))
+        ||  (name == NULL)
+        ||  (name [0] == '\0')
+        ||  (strlen (name) >= RINGIO_NAME_MAX_LEN)
+        ||  (attrs == NULL)
+        ||  (attrs->dataBufSize == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        /* The fields after attrBufSize are only read when versioned. */
+        if (attrs->version == RINGIO_ATTRS_VERSION) {
+            bcast = attrs->bcastAttrs ;
+        }
+        if (    (bcast != NULL)
+            &&  (   (bcast->numReaders > RINGIO_MAX_READERS)
+                 || (bcast->policy > RINGIO_BCAST_DROPSLOW))) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            if ((bcast != NULL) && (bcast->numReaders != 0u)) {
+                numReaders = bcast->numReaders ;
+            }
+            status = RingIO_getCtrl (procId, &ctrl) ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        MPCS_enter ((MPCS_Handle) &ctrl->lockObj) ;
+
+        if (RingIO_findEntry (ctrl, name) != NULL) {
+            status = RINGIO_EALREADYEXISTS ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            entry = RingIO_findEntry (ctrl, NULL) ;
+            if (entry == NULL) {
+                status = DSP_ERESOURCE ;
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            status = POOL_alloc (POOL_makePoolId (procId, attrs->ctrlPoolId),
+                                 (Pvoid *) &control,
+                                 RINGIO_CTRL_SIZE (numReaders)) ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            status = RingIO_allocData (
+                                 POOL_makePoolId (procId, attrs->dataPoolId),
+                                 attrs,
+                                 &dataBuf,
+                                 &bufOffset,
+                                 &bufSize,
+                                 &mirrored) ;
+        }
+
+        if (DSP_SUCCEEDED (status) && (attrs->attrBufSize != 0u)) {
+            status = POOL_alloc (POOL_makePoolId (procId, attrs->attrPoolId),
+                                 (Pvoid *) &attrBuf,
+                                 attrs->attrBufSize) ;
+            if (DSP_SUCCEEDED (status)) {
+                /*  The index is optional: a pool without a buffer of its
+                 *  size, as with exactMatchReq, leaves the writer walking
+                 *  the attributes.
+                 */
+                status = POOL_alloc (
+                                  POOL_makePoolId (procId, attrs->attrPoolId),
+                                  (Pvoid *) &attrIndex,
+                                  RINGIO_ATTR_INDEXSIZE (attrs->attrBufSize)) ;
+                if (DSP_FAILED (status)) {
+                    attrIndex = NULL ;
+                    status    = RINGIO_SUCCESS ;
+                }
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            status = POOL_alloc (POOL_makePoolId (procId, attrs->lockPoolId),
+                                 (Pvoid *) &lockObj,
+                                 RINGIO_LOCK_SIZE) ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            memset ((Pvoid) control, 0, RINGIO_CTRL_SIZE (numReaders)) ;
+            memset ((Pvoid) lockObj, 0, sizeof (MPCS_ShObj)) ;
+
+            control->procId        = procId ;
+            control->entryId       = (Uint32) (entry
+                                             - (RingIO_Entry *) (ctrl + 1)) ;
+            control->transportType = attrs->transportType ;
+            control->phyBufStart   = DRV_ADDR_TO_PTR (DRV_usrToPhy (dataBuf)) ;
+            control->curBufEnd     = attrs->dataBufSize - 1u ;
+            control->dataBufEnd    = attrs->dataBufSize - 1u ;
+            control->dataBufSize   = attrs->dataBufSize ;
+            control->footBufSize   = (mirrored == TRUE) ? 0u
+                                                        : attrs->footBufSize ;
+            control->phyBufEnd     =   control->dataBufSize
+                                     + control->footBufSize - 1u ;
+            control->mirrored      = (mirrored == TRUE) ? 1u : 0u ;
+            control->bufOffset     = bufOffset ;
+            control->bufSize       = bufSize ;
+            control->numReaders    = numReaders ;
+            control->bcastPolicy   = (numReaders > 1u)
+                                   ? (Uint32) bcast->policy
+                                   : (Uint32) RINGIO_BCAST_BLOCK ;
+            control->phyAttrStart  = (attrBuf == NULL)
+                                   ? NULL
+                                   : DRV_ADDR_TO_PTR (DRV_usrToPhy (attrBuf)) ;
+            control->phyAttrIndex  = (attrIndex == NULL)
+                                   ? NULL
+                                   : DRV_ADDR_TO_PTR (
+                                                 DRV_usrToPhy (attrIndex)) ;
+            control->phyAttrBufEnd = attrs->attrBufSize - 1u ;
+            control->curAttrBufEnd = attrs->attrBufSize - 1u ;
+            control->emptyAttrSize = attrs->attrBufSize ;
+            control->phyLockHandle = DRV_ADDR_TO_PTR (DRV_usrToPhy (lockObj)) ;
+            control->writer.openMode = RINGIO_MODE_WRITE ;
+            for (i = 0u ; i < numReaders ; i++) {
+                RINGIO_READER (control, i)->openMode = RINGIO_MODE_READ ;
+            }
+            if (numReaders > 1u) {
+                /* The park client of a broadcast RingIO. */
+                RINGIO_READER (control, i)->openMode = RINGIO_MODE_READ ;
+            }
+
+            entry->phyControl  = DRV_ADDR_TO_PTR (DRV_usrToPhy (control)) ;
+            entry->virtControl = (Pvoid) control ;
+            entry->ownerProcId = ID_GPP ;
+            entry->ctrlPoolId  = attrs->ctrlPoolId ;
+            entry->dataPoolId  = attrs->dataPoolId ;
+            entry->attrPoolId  = attrs->attrPoolId ;
+            entry->lockPoolId  = attrs->lockPoolId ;
+            strncpy (entry->name, name, RINGIO_NAME_MAX_LEN - 1u) ;
+            entry->name [RINGIO_NAME_MAX_LEN - 1u] = '\0' ;
+        }
+        else {
+            SET_FAILURE_REASON ;
+            if (lockObj != NULL) {
+                POOL_free (POOL_makePoolId (procId, attrs->lockPoolId),
+                           lockObj,
+                           RINGIO_LOCK_SIZE) ;
+            }
+            if (attrIndex != NULL) {
+                POOL_free (POOL_makePoolId (procId, attrs->attrPoolId),
+                           attrIndex,
+                           RINGIO_ATTR_INDEXSIZE (attrs->attrBufSize)) ;
+            }
+            if (attrBuf != NULL) {
+                POOL_free (POOL_makePoolId (procId, attrs->attrPoolId),
+                           attrBuf,
+                           attrs->attrBufSize) ;
+            }
+            if (dataBuf != NULL) {
+                POOL_free (POOL_makePoolId (procId, attrs->dataPoolId),
+                           dataBuf - bufOffset,
+                           bufSize) ;
+            }
+            if (control != NULL) {
+                POOL_free (POOL_makePoolId (procId, attrs->ctrlPoolId),
+                           control,
+                           RINGIO_CTRL_SIZE (numReaders)) ;
+            }
+        }
+
+        MPCS_leave ((MPCS_Handle) &ctrl->lockObj) ;
+    }
+
+    TRC_1LEAVE ("RingIO_create", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_delete
+ *
+ *  @desc   This function deletes a RingIO channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+#if defined (DSPLINK_LEGACY_SUPPORT)
+RingIO_delete (IN Char8 * name)
+#else
+RingIO_delete (IN ProcessorId procId, IN Char8 * name)
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+{
+    DSP_STATUS             status = RINGIO_SUCCESS ;
+    RingIO_ControlStruct * control ;
+    RingIO_Ctrl *          ctrl ;
+    RingIO_Entry *         entry ;
+    Bool                   opened ;
+    Uint32                 i ;
+#if defined (DSPLINK_LEGACY_SUPPORT)
+    ProcessorId            procId = 0u ;
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+
+    TRC_2ENTER ("RingIO_delete", procId, name) ;
+
+    if ((!IS_VALID_PROCID (procId)) || (name == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = RingIO_getCtrl (procId, &ctrl) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        MPCS_enter ((MPCS_Handle) &ctrl->lockObj) ;
+
+        entry = RingIO_findEntry (ctrl, name) ;
+        if (entry == NULL) {
+            status = DSP_ENOTFOUND ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            control = (RingIO_ControlStruct *) DRV_phyToUsr (
+                                       DRV_PTR_TO_ADDR (entry->phyControl)) ;
+            opened = control->writer.isValid ;
+            for (i = 0u ; i < control->numReaders ; i++) {
+                if (RINGIO_READER (control, i)->isValid == TRUE) {
+                    opened = TRUE ;
+                }
+            }
+            if (opened == TRUE) {
+                /* The clients must be closed first. */
+                status = RINGIO_EFAILURE ;
+                SET_FAILURE_REASON ;
+            }
+            else {
+                POOL_free (POOL_makePoolId (procId, entry->lockPoolId),
+                           DRV_phyToUsr (
+                                  DRV_PTR_TO_ADDR (control->phyLockHandle)),
+                           RINGIO_LOCK_SIZE) ;
+                if (control->phyAttrIndex != NULL) {
+                    POOL_free (POOL_makePoolId (procId, entry->attrPoolId),
+                               DRV_phyToUsr (
+                                   DRV_PTR_TO_ADDR (control->phyAttrIndex)),
+                               RINGIO_ATTR_INDEXSIZE (
+                                              RingIO_attrBufSize (control))) ;
+                }
+                if (control->phyAttrStart != NULL) {
+                    POOL_free (POOL_makePoolId (procId, entry->attrPoolId),
+                               DRV_phyToUsr (
+                                   DRV_PTR_TO_ADDR (control->phyAttrStart)),
+                               RingIO_attrBufSize (control)) ;
+                }
+                POOL_free (POOL_makePoolId (procId, entry->dataPoolId),
+                             (Char8 *) DRV_phyToUsr (
+                                   DRV_PTR_TO_ADDR (control->phyBufStart))
+                           - control->bufOffset,
+                           control->bufSize) ;
+                POOL_free (POOL_makePoolId (procId, entry->ctrlPoolId),
+                           control,
+                           RINGIO_CTRL_SIZE (control->numReaders)) ;
+                memset (entry, 0, sizeof (RingIO_Entry)) ;
+            }
+        }
+
+        MPCS_leave ((MPCS_Handle) &ctrl->lockObj) ;
+    }
+
+    TRC_1LEAVE ("RingIO_delete", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_open
+ *
+ *  @desc   This function opens a RingIO channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+RingIO_Handle
+RingIO_open (IN Char8 *         name,
+             IN RingIO_OpenMode openMode,
+             IN Uint32          flags)
+{
+    DSP_STATUS             status  = RINGIO_SUCCESS ;
+    DSP_STATUS             tmpStatus ;
+    RingIO_Client *        client  = NULL ;
+    RingIO_ControlStruct * control = NULL ;
+    RingIO_Entry *         entry   = NULL ;
+    RingIO_Local *         local   = NULL ;
+    RingIO_Ctrl *          ctrl ;
+    ProcessorId            procId ;
+    Uint32                 i ;
+
+    TRC_3ENTER ("RingIO_open", name, openMode, flags) ;
+
+    if (    (name == NULL)
+        ||  (   (openMode != RINGIO_MODE_READ)
+             && (openMode != RINGIO_MODE_WRITE))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    for (procId = 0u ;
+         (procId < MAX_DSPS) && DSP_SUCCEEDED (status) && (client == NULL) ;
+         procId++) {
+        tmpStatus = RingIO_getCtrl (procId, &ctrl) ;
+        if (DSP_FAILED (tmpStatus)) {
+            continue ;
+        }
+
+        MPCS_enter ((MPCS_Handle) &ctrl->lockObj) ;
+
+        entry = RingIO_findEntry (ctrl, name) ;
+        if (entry != NULL) {
+            control = (RingIO_ControlStruct *) DRV_phyToUsr (
+                                       DRV_PTR_TO_ADDR (entry->phyControl)) ;
+            client  = (openMode == RINGIO_MODE_WRITE) ? &control->writer
+                                                      : &control->reader ;
+            for (i = 1u ;
+                 (i < control->numReaders) && (client->isValid == TRUE) ;
+                 i++) {
+                client = RINGIO_READER (control, i) ;
+            }
+            if (client->isValid == TRUE) {
+                /* Only numReaders readers and one writer may be opened. */
+                status = RINGIO_EFAILURE ;
+                SET_FAILURE_REASON ;
+            }
+            else if (RingIO_setLocal (client, TRUE) == DSP_ERESOURCE) {
+                status = DSP_ERESOURCE ;
+                SET_FAILURE_REASON ;
+            }
+            else if (control->mirrored != 0u) {
+                local  = RingIO_findLocal (client) ;
+                status = DRV_mapMirror (DRV_PTR_TO_ADDR (control->phyBufStart),
+                                        control->dataBufSize,
+                                        &local->mirror) ;
+                if (DSP_FAILED (status)) {
+                    RingIO_setLocal (client, FALSE) ;
+                    SET_FAILURE_REASON ;
+                }
+                else {
+                    local->mirrorSize = control->dataBufSize ;
+                }
+            }
+
+            if (DSP_SUCCEEDED (status)) {
+                client->procId            = ID_GPP ;
+                client->openMode          = openMode ;
+                client->flags             = flags ;
+                client->pDataStart        = (local != NULL)
+                                          ? local->mirror
+                                          : DRV_phyToUsr (
+                                       DRV_PTR_TO_ADDR (control->phyBufStart)) ;
+                client->pAttrStart        = DRV_phyToUsr (
+                                       DRV_PTR_TO_ADDR (control->phyAttrStart)) ;
+                client->pAttrIndex        = (control->phyAttrIndex == NULL)
+                                          ? NULL
+                                          : DRV_phyToUsr (
+                                      DRV_PTR_TO_ADDR (control->phyAttrIndex)) ;
+                client->virtControlHandle = control ;
+                client->virtLockHandle    = DRV_phyToUsr (
+                                       DRV_PTR_TO_ADDR (control->phyLockHandle)) ;
+                client->acqSize           = 0u ;
+                client->acqAttrSize       = 0u ;
+                client->notifyType        = RINGIO_NOTIFICATION_NONE ;
+                client->notifyFunc        = NULL ;
+                client->notifyParam       = NULL ;
+                client->notifyWaterMark   = 0u ;
+                client->notifyFlag        = 0u ;
+                client->refCount++ ;
+                if (IS_READER (client) && (control->numReaders > 1u)) {
+                    MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+                    RingIO_readerJoin (client) ;
+                    MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+                }
+                else {
+                    client->isValid = TRUE ;
+                }
+            }
+        }
+
+        MPCS_leave ((MPCS_Handle) &ctrl->lockObj) ;
+    }
+
+    if (DSP_FAILED (status)) {
+        client = NULL ;
+    }
+
+    TRC_1LEAVE ("RingIO_open", client) ;
+
+    return (RingIO_Handle) client ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_close
+ *
+ *  @desc   This function closes a RingIO instance.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_close (IN RingIO_Handle handle)
+{
+    DSP_STATUS      status = RINGIO_SUCCESS ;
+    RingIO_Client * client = (RingIO_Client *) handle ;
+
+    TRC_1ENTER ("RingIO_close", handle) ;
+
+    if ((client == NULL) || (client->isValid != TRUE)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+        RingIO_cancelClient (client) ;
+        client->notifyType = RINGIO_NOTIFICATION_NONE ;
+        client->notifyFunc = NULL ;
+        if (    IS_READER (client)
+            &&  (client->virtControlHandle->numReaders > 1u)) {
+            RingIO_readerLeave (client) ;
+        }
+        else {
+            client->isValid = FALSE ;
+        }
+        MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+
+        RingIO_setLocal (client, FALSE) ;
+    }
+
+    TRC_1LEAVE ("RingIO_close", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_acquire
+ *
+ *  @desc   This function acquires a data buffer from RingIO for reading or
+ *          writing, depending on the mode in which the client (represented
+ *          by the handle) has been opened.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_acquire (IN     RingIO_Handle   handle,
+                OUT    RingIO_BufPtr * dataBuf,
+                IN OUT Uint32 *        size)
+{
+    DSP_STATUS      status  = RINGIO_SUCCESS ;
+    RingIO_Client * client  = (RingIO_Client *) handle ;
+    Uint32          request ;
+    Uint32          attempt ;
+
+    TRC_3ENTER ("RingIO_acquire", handle, dataBuf, size) ;
+
+    if (    (client == NULL)
+        ||  (client->isValid != TRUE)
+        ||  (dataBuf == NULL)
+        ||  (size == NULL)
+        ||  (*size == 0u)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        RingIO_pollClear (client) ;
+        request = *size ;
+        status  = RingIO_checkDropped (client) ;
+        if (DSP_FAILED (status)) {
+            *size = 0u ;
+        }
+        for (attempt = 0u ;
+             (attempt < 2u) && (status != RINGIO_EDROPPED) ;
+             attempt++) {
+            if (IS_WRITER (client)) {
+                status = RingIO_writerAcquire (client, dataBuf, size) ;
+            }
+            else {
+                status = RingIO_readerAcquire (client, dataBuf, size) ;
+            }
+            if (DSP_SUCCEEDED (status) || (*size != 0u) || (attempt != 0u)) {
+                break ;
+            }
+            /*  The notification flag is set now: look once more, so that a
+             *  release of the peer that missed it (RingIO_notifyPeer) is
+             *  not missed here as well.
+             */
+            __sync_synchronize () ;
+            *size = request ;
+        }
+    }
+
+    TRC_1LEAVE ("RingIO_acquire", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_release
+ *
+ *  @desc   This function releases a data buffer to RingIO.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_release (IN RingIO_Handle handle, IN Uint32 size)
+{
+    DSP_STATUS      status = RINGIO_SUCCESS ;
+    RingIO_Client * client = (RingIO_Client *) handle ;
+
+    TRC_2ENTER ("RingIO_release", handle, size) ;
+
+    if ((client == NULL) || (client->isValid != TRUE)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (size > client->acqSize) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (RingIO_checkDropped (client) == RINGIO_EDROPPED) {
+        status = RINGIO_EDROPPED ;
+    }
+    else {
+        if (IS_WRITER (client)) {
+            client->acqStart += size ;
+            client->acqSize  -= size ;
+            /* The data must be written before the reader may see it. */
+            __sync_synchronize () ;
+            client->relCount += size ;
+        }
+        else {
+            client->acqSize -= size ;
+            RingIO_readerAdvance (client, size) ;
+        }
+        RingIO_notifyPeer (client) ;
+    }
+
+    TRC_1LEAVE ("RingIO_release", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_cancel
+ *
+ *  @desc   This function cancels any data buffers acquired by reader or writer.
+ *          The attributes set by the writer within the cancelled buffer are
+ *          removed.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_cancel (IN RingIO_Handle handle)
+{
+    DSP_STATUS      status = RINGIO_SUCCESS ;
+    RingIO_Client * client = (RingIO_Client *) handle ;
+
+    TRC_1ENTER ("RingIO_cancel", handle) ;
+
+    if ((client == NULL) || (client->isValid != TRUE)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+        if (client->acqSize == 0u) {
+            status = RINGIO_EFAILURE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            RingIO_cancelClient (client) ;
+        }
+        MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+    }
+
+    TRC_1LEAVE ("RingIO_cancel", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getvAttribute
+ *
+ *  @desc   This function gets an attribute with a variable-sized payload from
+ *          the attribute buffer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_getvAttribute (IN     RingIO_Handle handle,
+                      OUT    Uint16 *      type,
+                      OUT    Uint32 *      param,
+                      IN     RingIO_BufPtr vptr,
+                      IN OUT Uint32 *      size)
+{
+    DSP_STATUS      status = RINGIO_SUCCESS ;
+    RingIO_Client * client = (RingIO_Client *) handle ;
+    RingIO_Attr *   attr ;
+
+    TRC_5ENTER ("RingIO_getvAttribute", handle, type, param, vptr, size) ;
+
+    if (    (client == NULL)
+        ||  (client->isValid != TRUE)
+        ||  (!IS_READER (client))
+        ||  (type == NULL)
+        ||  (param == NULL)
+        ||  (size == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (RingIO_checkDropped (client) == RINGIO_EDROPPED) {
+        status = RINGIO_EDROPPED ;
+    }
+    else {
+        MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+
+        attr = RingIO_attrHead (client) ;
+        if (attr == NULL) {
+            status = RINGIO_EFAILURE ;
+        }
+        else if (attr->offset != client->acqCount) {
+            status = RINGIO_EPENDINGDATA ;
+        }
+        else if ((attr->size != 0u) && ((vptr == NULL) || (*size < attr->size))) {
+            *size  = attr->size ;
+            status = RINGIO_EVARIABLEATTRIBUTE ;
+        }
+        else {
+            *type  = attr->type ;
+            *param = attr->param ;
+            *size  = attr->size ;
+            if (attr->size != 0u) {
+                memcpy (vptr, (Pvoid) (attr + 1), attr->size) ;
+            }
+            RingIO_attrTake (client) ;
+
+            attr = RingIO_attrHead (client) ;
+            if ((attr != NULL) && (attr->offset == client->acqCount)) {
+                status = RINGIO_SPENDINGATTRIBUTE ;
+            }
+        }
+
+        MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+    }
+
+    TRC_1LEAVE ("RingIO_getvAttribute", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_setvAttribute
+ *
+ *  @desc   This function sets an attribute with a variable sized payload at the
+ *          offset provided in the acquired data buffer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_setvAttribute (IN     RingIO_Handle handle,
+                      IN     Uint32        offset,
+                      IN     Uint16        type,
+                      IN OPT Uint32        param,
+                      IN     RingIO_BufPtr pdata,
+                      IN     Uint32        size)
+{
+    DSP_STATUS             status = RINGIO_SUCCESS ;
+    RingIO_Client *        client = (RingIO_Client *) handle ;
+    RingIO_ControlStruct * control ;
+    Uint32                 dist ;
+    Int32                  order ;
+
+    TRC_6ENTER ("RingIO_setvAttribute",
+                handle, offset, type, param, pdata, size) ;
+
+    if (    (client == NULL)
+        ||  (client->isValid != TRUE)
+        ||  (!IS_WRITER (client))
+        ||  (size > 0xFFFFu)
+        ||  ((size != 0u) && (pdata == NULL))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        control = client->virtControlHandle ;
+        MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+
+        dist  = client->relCount + offset ;
+        order = (Int32) (dist - (Uint32) control->prevAttrOffset) ;
+        if (offset > client->acqSize) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else if (    (RingIO_attrBufSize (control) == 0u)
+                 ||  ((control->validAttrSize != 0u) && (order < 0))) {
+            /* Attributes must be set in the order of their offsets. */
+            status = RINGIO_EFAILURE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            status = RingIO_attrPut (client, dist, type, param, pdata, size) ;
+        }
+
+        MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+    }
+
+    TRC_1LEAVE ("RingIO_setvAttribute", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getAttribute
+ *
+ *  @desc   This function gets a fixed-size attribute from the attribute buffer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_getAttribute (IN  RingIO_Handle handle,
+                     OUT Uint16 *      type,
+                     OUT Uint32*       param)
+{
+    DSP_STATUS status = RINGIO_SUCCESS ;
+    Uint32     size   = 0u ;
+
+    TRC_3ENTER ("RingIO_getAttribute", handle, type, param) ;
+
+    status = RingIO_getvAttribute (handle, type, param, NULL, &size) ;
+
+    TRC_1LEAVE ("RingIO_getAttribute", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_setAttribute
+ *
+ *  @desc   This function sets a fixed-size attribute at the offset provided in
+ *          the acquired data buffer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_setAttribute (IN     RingIO_Handle handle,
+                     IN     Uint32        offset,
+                     IN     Uint16        type,
+                     IN OPT Uint32        param)
+{
+    DSP_STATUS status = RINGIO_SUCCESS ;
+
+    TRC_4ENTER ("RingIO_setAttribute", handle, offset, type, param) ;
+
+    status = RingIO_setvAttribute (handle, offset, type, param, NULL, 0u) ;
+
+    TRC_1LEAVE ("RingIO_setAttribute", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_flush
+ *
+ *  @desc   This function flushes the data buffer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_flush (IN  RingIO_Handle handle,
+              IN  Bool          hardFlush,
+              OUT Uint16 *      type,
+              OUT Uint32 *      param,
+              OUT Uint32 *      bytesFlushed)
+{
+    DSP_STATUS             status = RINGIO_SUCCESS ;
+    RingIO_Client *        client = (RingIO_Client *) handle ;
+    RingIO_ControlStruct * control ;
+    RingIO_Attr *          attr ;
+    Uint32                 drop ;
+    Uint32                 valid ;
+    Uint32                 target ;
+    RingIO_Notification    notification ;
+
+    TRC_5ENTER ("RingIO_flush", handle, hardFlush, type, param, bytesFlushed) ;
+
+    notification.func  = NULL ;
+    notification.local = NULL ;
+
+    if (    (client == NULL)
+        ||  (client->isValid != TRUE)
+        ||  (type == NULL)
+        ||  (param == NULL)
+        ||  (bytesFlushed == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        control = client->virtControlHandle ;
+        MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+
+        RingIO_cancelClient (client) ;
+
+        attr = RingIO_attrHead (client) ;
+        *type  = (attr == NULL) ? RINGIO_INVALID_ATTR : attr->type ;
+        *param = (attr == NULL) ? 0u                  : attr->param ;
+
+        if (IS_WRITER (client)) {
+            /* Committed data beyond the readers' acquired buffers is
+             * dropped entirely (hard) or from the first attribute on (soft).
+             */
+            target = client->relCount ;
+            if (hardFlush == TRUE) {
+                target = RingIO_readerCount (control, FALSE, FALSE) ;
+            }
+            else if (attr != NULL) {
+                target = attr->offset ;
+            }
+            /* The first attribute and all the following ones are removed. */
+            RingIO_attrClear (client) ;
+            drop = RingIO_writerRewind (client, target) ;
+            RingIO_prepareNotify (&control->writer,
+                                  RingIO_emptySize (control),
+                                  &notification) ;
+        }
+        else {
+            /* Valid data is dropped up to the next attribute (soft), or
+             * entirely together with the attributes (hard).
+             */
+            valid = control->writer.relCount - client->acqCount ;
+            __sync_synchronize () ;
+            if (hardFlush == TRUE) {
+                drop = valid ;
+                RingIO_attrClear (client) ;
+            }
+            else {
+                drop = (    (attr != NULL)
+                        &&  ((attr->offset - client->acqCount) < valid))
+                     ? (attr->offset - client->acqCount)
+                     : valid ;
+            }
+            client->acqCount += drop ;
+            RingIO_readerAdvance (client, drop) ;
+            RingIO_prepareNotify (&control->writer,
+                                  RingIO_emptySize (control),
+                                  &notification) ;
+        }
+        *bytesFlushed = drop ;
+
+        MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+    }
+
+    RingIO_deliverNotify (&notification, 0u) ;
+
+    TRC_1LEAVE ("RingIO_flush", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_setNotifier
+ *
+ *  @desc   This function sets Notification parameters for the RingIO Client.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_setNotifier (IN  RingIO_Handle      handle,
+                    IN  RingIO_NotifyType  notifyType,
+                    IN  Uint32             notifyWatermark,
+                    IN  RingIO_NotifyFunc  notifyFunc,
+                    IN  RingIO_NotifyParam notifyParam)
+{
+    DSP_STATUS      status = RINGIO_SUCCESS ;
+    RingIO_Client * client = (RingIO_Client *) handle ;
+
+    TRC_5ENTER ("RingIO_setNotifier",
+                handle, notifyType, notifyWatermark, notifyFunc, notifyParam) ;
+
+    if (    (client == NULL)
+        ||  (client->isValid != TRUE)
+        ||  (notifyType > RINGIO_NOTIFICATION_HDWRFIFO_ONCE)
+        ||  (   (notifyType != RINGIO_NOTIFICATION_NONE)
+             && (notifyFunc == NULL)
+             && (RingIO_isPolled (client) == FALSE))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+        client->notifyType      = notifyType ;
+        client->notifyWaterMark = notifyWatermark ;
+        client->notifyFunc      = notifyFunc ;
+        client->notifyParam     = notifyParam ;
+        client->notifyFlag      = 1u ;
+        MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+    }
+
+    TRC_1LEAVE ("RingIO_setNotifier", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getPollFd
+ *
+ *  @desc   This function returns a file descriptor raised by the
+ *          notifications of the RingIO client.
+ *
+ *  @modif  RingIO_localClients, RingIO_numPolled
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_getPollFd (IN RingIO_Handle handle, OUT Int32 * fd)
+{
+    DSP_STATUS      status = RINGIO_SUCCESS ;
+    RingIO_Client * client = (RingIO_Client *) handle ;
+    RingIO_Local *  local  = NULL ;
+
+    TRC_2ENTER ("RingIO_getPollFd", handle, fd) ;
+
+    if ((client == NULL) || (client->isValid != TRUE) || (fd == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        local = RingIO_findLocal (client) ;
+        if (local == NULL) {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        pthread_mutex_lock (&RingIO_localLock) ;
+        if (local->client != client) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else if (local->polled == FALSE) {
+            status = SYNC_HOST_createPollFd (&local->pollFd) ;
+            if (DSP_SUCCEEDED (status)) {
+                /* Raised at first, so that the client tries an acquire
+                 * before waiting for a notification.
+                 */
+                local->pollRaised = 1u ;
+                SYNC_HOST_raisePollFd (local->pollFd) ;
+                local->polled = TRUE ;
+                RingIO_numPolled++ ;
+            }
+            else {
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            *fd = local->pollFd ;
+        }
+        pthread_mutex_unlock (&RingIO_localLock) ;
+    }
+
+    TRC_1LEAVE ("RingIO_getPollFd", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_spliceOut
+ *
+ *  @desc   This function moves valid data of the RingIO reader to a file
+ *          descriptor without copying it to a buffer of the application.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_spliceOut (IN     RingIO_Handle handle,
+                  IN     Int32         fd,
+                  IN OUT Uint32 *      size)
+{
+    DSP_STATUS      status = RINGIO_SUCCESS ;
+    RingIO_Client * client = (RingIO_Client *) handle ;
+
+    TRC_3ENTER ("RingIO_spliceOut", handle, fd, size) ;
+
+    if (    (client == NULL)
+        ||  (client->isValid != TRUE)
+        ||  (IS_WRITER (client))
+        ||  (fd < 0)
+        ||  (size == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (client->acqSize != 0u) {
+        *size  = 0u ;
+        status = RINGIO_EFAILURE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = RingIO_splice (client, fd, size) ;
+    }
+
+    TRC_1LEAVE ("RingIO_spliceOut", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_spliceIn
+ *
+ *  @desc   This function moves data from a file descriptor to the RingIO
+ *          writer without copying it from a buffer of the application.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_spliceIn (IN     RingIO_Handle handle,
+                 IN     Int32         fd,
+                 IN OUT Uint32 *      size)
+{
+    DSP_STATUS      status = RINGIO_SUCCESS ;
+    RingIO_Client * client = (RingIO_Client *) handle ;
+
+    TRC_3ENTER ("RingIO_spliceIn", handle, fd, size) ;
+
+    if (    (client == NULL)
+        ||  (client->isValid != TRUE)
+        ||  (!IS_WRITER (client))
+        ||  (fd < 0)
+        ||  (size == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (client->acqSize != 0u) {
+        *size  = 0u ;
+        status = RINGIO_EFAILURE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = RingIO_splice (client, fd, size) ;
+    }
+
+    TRC_1LEAVE ("RingIO_spliceIn", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_sendNotify
+ *
+ *  @desc   Send a notification to the other client manually
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_sendNotify (IN RingIO_Handle handle, IN RingIO_NotifyMsg msg)
+{
+    DSP_STATUS             status   = RINGIO_SUCCESS ;
+    RingIO_Client *        client   = (RingIO_Client *) handle ;
+    Uint32                 numPeers = 1u ;
+    Bool                   sent     = FALSE ;
+    RingIO_Client *        peer ;
+    RingIO_ControlStruct * control ;
+    RingIO_Notification    notification ;
+    RingIO_Local *         local ;
+    Uint32                 i ;
+
+    TRC_2ENTER ("RingIO_sendNotify", handle, msg) ;
+
+    if ((client == NULL) || (client->isValid != TRUE)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        /* The writer of a broadcast RingIO notifies every reader. */
+        control = client->virtControlHandle ;
+        if (IS_WRITER (client) && (control->numReaders > 1u)) {
+            numPeers = control->numReaders ;
+        }
+
+        for (i = 0u ; i < numPeers ; i++) {
+            notification.func  = NULL ;
+            notification.local = NULL ;
+
+            peer = IS_WRITER (client) ? RINGIO_READER (control, i)
+                                      : &control->writer ;
+            MPCS_enter ((MPCS_Handle) client->virtLockHandle) ;
+            local = (peer->isValid == TRUE) ? RingIO_findLocal (peer) : NULL ;
+            if (    (local != NULL)
+                &&  ((peer->notifyFunc != NULL) || (local->polled == TRUE))) {
+                notification.func   = peer->notifyFunc ;
+                notification.handle = (RingIO_Handle) peer ;
+                notification.param  = peer->notifyParam ;
+                notification.local  = (local->polled == TRUE) ? local : NULL ;
+                sent                = TRUE ;
+            }
+            MPCS_leave ((MPCS_Handle) client->virtLockHandle) ;
+
+            RingIO_deliverNotify (&notification, msg) ;
+        }
+
+        if (sent == FALSE) {
+            status = RINGIO_EFAILURE ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("RingIO_sendNotify", status) ;
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,1297 @@
+/** ============================================================================
+ *  @file   ringmqt.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the ring Message Queue Transport (RINGMQT) of
+ *          the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <msgqdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+#include <ldrv.h>
+#include <ldrv_ips.h>
+#include <ldrv_pool.h>
+#include <ldrv_proc.h>
+#include <ldrv_msgq.h>
+#include <zcpymqt.h>
+#include <ringmqt.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_MQT, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @const  RINGMQT_CTRLPAYLOAD
+ *
+ *  @desc   Payload of the events carrying a locate request or answer.
+ *  ============================================================================
+ */
+#define RINGMQT_CTRLPAYLOAD     0u
+
+/*  ============================================================================
+ *  @const  RINGMQT_RINGPAYLOAD
+ *
+ *  @desc   Payload of the events telling the consumer of a ring that messages
+ *          were put into it while it waited.
+ *  ============================================================================
+ */
+#define RINGMQT_RINGPAYLOAD     1u
+
+/*  ============================================================================
+ *  @const  RINGMQT_EMPTY
+ *
+ *  @desc   Value returned by RINGMQT_pop when the ring holds no message.
+ *  ============================================================================
+ */
+#define RINGMQT_EMPTY           0u
+
+/*  ============================================================================
+ *  @const  RINGMQT_PADWORDS
+ *
+ *  @desc   Number of words keeping the indices of the producers and of the
+ *          consumer of a ring on separate cache lines.
+ *  ============================================================================
+ */
+#define RINGMQT_PADWORDS        15u
+
+
+/*  ============================================================================
+ *  @name   RINGMQT_Slot
+ *
+ *  @desc   Slot of a ring.
+ *
+ *  @field  seq
+ *              Index at which the slot can be claimed by a producer, plus one
+ *              once the message of that index is published.
+ *  @field  physAddr
+ *              Physical address of the message.
+ *  ============================================================================
+ */
+typedef struct RINGMQT_Slot_tag {
+    volatile Uint32  seq      ;
+    volatile Uint32  physAddr ;
+} RINGMQT_Slot ;
+
+/*  ============================================================================
+ *  @name   RINGMQT_Ring
+ *
+ *  @desc   Indices of a ring, shared with the DSP.
+ *
+ *  @field  tail
+ *              Number of slots claimed by the producers.
+ *  @field  head
+ *              Number of messages taken by the consumer.
+ *  @field  armed
+ *              TRUE when the consumer found the ring empty and waits for an
+ *              event. The producer clearing it sends the event.
+ *  ============================================================================
+ */
+typedef struct RINGMQT_Ring_tag {
+    volatile Uint32  tail    ;
+    Uint32           tailPad [RINGMQT_PADWORDS] ;
+    volatile Uint32  head    ;
+    volatile Uint32  armed   ;
+    Uint32           headPad [RINGMQT_PADWORDS - 1u] ;
+} RINGMQT_Ring ;
+
+/*  ============================================================================
+ *  @name   RINGMQT_Ctrl
+ *
+ *  @desc   Control structure of the transport, shared with the DSP. The slots
+ *          of the ring to the DSP, then of the ring to the GPP, follow it.
+ *
+ *  @field  locateLock
+ *              Serializes the locates.
+ *  @field  lock
+ *              Protects the answer of a locate.
+ *  @field  cond
+ *              Signalled when a locate is answered.
+ *  @field  isOpen
+ *              TRUE while the transport is open.
+ *  @field  poolId
+ *              Pool given at open.
+ *  @field  locateSeq
+ *              Sequence number of the last locate request.
+ *  @field  answerSeq
+ *              Sequence number of the last locate answered by the GPP side.
+ *  @field  dspSeq
+ *              Sequence number of the last locate answered by the DSP side.
+ *  @field  locateStatus
+ *              Status of the last locate.
+ *  @field  locateQueue
+ *              Message queue found by the last locate.
+ *  @field  numSlots
+ *              Number of slots of each ring.
+ *  @field  locateName
+ *              Name of the message queue to locate.
+ *  @field  toDsp
+ *              Ring of the messages sent to the DSP.
+ *  @field  toGpp
+ *              Ring of the messages sent to the GPP.
+ *  ============================================================================
+ */
+typedef struct RINGMQT_Ctrl_tag {
+    SYNC_HostLock  locateLock   ;
+    SYNC_HostLock  lock         ;
+    SYNC_HostCond  cond         ;
+    Uint32         isOpen       ;
+    Uint32         poolId       ;
+    Uint32         locateSeq    ;
+    Uint32         answerSeq    ;
+    Uint32         dspSeq       ;
+    Uint32         locateStatus ;
+    Uint32         locateQueue  ;
+    Uint32         numSlots     ;
+    Char8          locateName [DSP_MAX_STRLEN] ;
+    RINGMQT_Ring   toDsp        ;
+    RINGMQT_Ring   toGpp        ;
+} RINGMQT_Ctrl ;
+
+/*  ============================================================================
+ *  @name   RINGMQT_Object
+ *
+ *  @desc   State of the transports in the driver segment.
+ *
+ *  @field  ctrlPhys
+ *              Physical address of the control structure of each DSP.
+ *  ============================================================================
+ */
+typedef struct RINGMQT_Object_tag {
+    Uint32  ctrlPhys [MAX_DSPS] ;
+} RINGMQT_Object ;
+
+/*  ============================================================================
+ *  @name   RINGMQT_Handler
+ *
+ *  @desc   Signature of the function handling a message taken from a ring.
+ *          It returns TRUE if it put a message into the other ring whose
+ *          consumer waits for an event.
+ *  ============================================================================
+ */
+typedef Bool (*RINGMQT_Handler) (IN ProcessorId dspId, IN Uint32 physAddr) ;
+
+
+/*  ============================================================================
+ *  @name   RINGMQT_ctrls
+ *
+ *  @desc   Control structure of each DSP in the calling process.
+ *  ============================================================================
+ */
+STATIC RINGMQT_Ctrl * RINGMQT_ctrls [MAX_DSPS] ;
+
+/*  ============================================================================
+ *  @name   RINGMQT_toDspSlots
+ *
+ *  @desc   Slots of the ring to each DSP in the calling process.
+ *  ============================================================================
+ */
+STATIC RINGMQT_Slot * RINGMQT_toDspSlots [MAX_DSPS] ;
+
+/*  ============================================================================
+ *  @name   RINGMQT_toGppSlots
+ *
+ *  @desc   Slots of the ring from each DSP in the calling process.
+ *  ============================================================================
+ */
+STATIC RINGMQT_Slot * RINGMQT_toGppSlots [MAX_DSPS] ;
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_push
+ *
+ *  @desc   Puts a message into a ring. Any number of producers may push
+ *          concurrently: a slot is claimed by moving the tail of the ring,
+ *          then published by updating its sequence number.
+ *
+ *  @arg    ring
+ *              Ring.
+ *  @arg    slots
+ *              Slots of the ring.
+ *  @arg    numSlots
+ *              Number of slots of the ring.
+ *  @arg    physAddr
+ *              Physical address of the message.
+ *  @arg    wake
+ *              Location to receive TRUE if the consumer waits for an event.
+ *
+ *  @ret    TRUE
+ *              The message is in the ring.
+ *          FALSE
+ *              The ring is full.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_pop
+ *  ============================================================================
+ */
+STATIC
+Bool
+RINGMQT_push (IN  RINGMQT_Ring * ring,
+              IN  RINGMQT_Slot * slots,
+              IN  Uint32         numSlots,
+              IN  Uint32         physAddr,
+              OUT Bool *         wake)
+{
+    Bool           claimed = FALSE ;
+    Bool           full    = FALSE ;
+    RINGMQT_Slot * slot    = NULL ;
+    Uint32         pos ;
+    Int32          diff ;
+
+    pos = ring->tail ;
+    while ((claimed == FALSE) && (full == FALSE)) {
+        slot = &(slots [pos & (numSlots - 1u)]) ;
+        diff = (Int32) (slot->seq - pos) ;
+        if (diff == 0) {
+            if (   __sync_bool_compare_and_swap (&ring->tail, pos, pos + 1u)
+                == TRUE) {
+                claimed = TRUE ;
+            }
+            else {
+                pos = ring->tail ;
+            }
+        }
+        else if (diff < 0) {
+            /* The consumer has not taken the message of the last round. */
+            full = TRUE ;
+        }
+        else {
+            pos = ring->tail ;
+        }
+    }
+
+    *wake = FALSE ;
+    if (claimed == TRUE) {
+        slot->physAddr = physAddr ;
+        __sync_synchronize () ;
+        slot->seq = pos + 1u ;
+
+        /* Pairs with the barrier of the consumer between arming and
+         * checking the ring again: one of them sees the other.
+         */
+        __sync_synchronize () ;
+        if (    (ring->armed == TRUE)
+            &&  (   __sync_bool_compare_and_swap (&ring->armed, TRUE, FALSE)
+                 == TRUE)) {
+            *wake = TRUE ;
+        }
+    }
+
+    return claimed ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_pop
+ *
+ *  @desc   Takes the next message from a ring. Only the consumer of the ring
+ *          may call it.
+ *
+ *  @arg    ring
+ *              Ring.
+ *  @arg    slots
+ *              Slots of the ring.
+ *  @arg    numSlots
+ *              Number of slots of the ring.
+ *
+ *  @ret    Physical address of the message, RINGMQT_EMPTY if the next
+ *          message is not published yet.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_push
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RINGMQT_pop (IN RINGMQT_Ring * ring,
+             IN RINGMQT_Slot * slots,
+             IN Uint32         numSlots)
+{
+    Uint32         physAddr = RINGMQT_EMPTY ;
+    Uint32         pos      = ring->head ;
+    RINGMQT_Slot * slot     = &(slots [pos & (numSlots - 1u)]) ;
+
+    if (slot->seq == (pos + 1u)) {
+        __sync_synchronize () ;
+        physAddr = slot->physAddr ;
+        __sync_synchronize () ;
+        slot->seq  = pos + numSlots ;
+        ring->head = pos + 1u ;
+    }
+
+    return physAddr ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_drain
+ *
+ *  @desc   Handles the messages of a ring until it is found empty, then arms
+ *          the ring so that the next producer sends an event.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    ring
+ *              Ring.
+ *  @arg    slots
+ *              Slots of the ring.
+ *  @arg    numSlots
+ *              Number of slots of the ring.
+ *  @arg    handler
+ *              Function handling each message.
+ *
+ *  @ret    TRUE if a handler asked for an event to the other side.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_push
+ *  ============================================================================
+ */
+STATIC
+Bool
+RINGMQT_drain (IN ProcessorId     dspId,
+               IN RINGMQT_Ring *  ring,
+               IN RINGMQT_Slot *  slots,
+               IN Uint32          numSlots,
+               IN RINGMQT_Handler handler)
+{
+    Bool   drained = FALSE ;
+    Bool   wake    = FALSE ;
+    Uint32 physAddr ;
+    Uint32 pos ;
+
+    while (drained == FALSE) {
+        physAddr = RINGMQT_pop (ring, slots, numSlots) ;
+        while (physAddr != RINGMQT_EMPTY) {
+            if (handler (dspId, physAddr) == TRUE) {
+                wake = TRUE ;
+            }
+            physAddr = RINGMQT_pop (ring, slots, numSlots) ;
+        }
+
+        ring->armed = TRUE ;
+        __sync_synchronize () ;
+
+        /* A message published before the ring was armed sent no event. If a
+         * producer disarmed the ring meanwhile, its event drains it.
+         */
+        pos = ring->head ;
+        if (    (slots [pos & (numSlots - 1u)].seq != (pos + 1u))
+            ||  (   __sync_bool_compare_and_swap (&ring->armed, TRUE, FALSE)
+                 == FALSE)) {
+            drained = TRUE ;
+        }
+    }
+
+    return wake ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_deliver
+ *
+ *  @desc   Delivers a message taken from the ring to the GPP to its local
+ *          queue.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    physAddr
+ *              Physical address of the message.
+ *
+ *  @ret    FALSE
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_echo
+ *  ============================================================================
+ */
+STATIC
+Bool
+RINGMQT_deliver (IN ProcessorId dspId, IN Uint32 physAddr)
+{
+    MSGQ_Msg msg ;
+
+    msg = (MSGQ_Msg) LDRV_phyToUsr (dspId, physAddr) ;
+    if (msg != NULL) {
+        LDRV_MSGQ_deliver (msg) ;
+    }
+
+    return FALSE ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_dspQueue
+ *
+ *  @desc   Gets the number of a message queue of the DSP from its name.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    queueName
+ *              Name of the message queue.
+ *
+ *  @ret    Number of the message queue, MSGQ_INVALIDMSGQ if the DSP has no
+ *          message queue with that name.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint32
+RINGMQT_dspQueue (IN ProcessorId dspId, IN Char8 * queueName)
+{
+    Uint32   id     = MSGQ_INVALIDMSGQ ;
+    Uint32   prefix = sizeof (ZCPYMQT_DSPQUEUEPREFIX) - 1u ;
+    Char8 *  end ;
+    Uint32   num ;
+
+    if (    (strncmp (queueName, ZCPYMQT_DSPQUEUEPREFIX, prefix) == 0)
+        &&  (queueName [prefix] >= '0')
+        &&  (queueName [prefix] <= '9')) {
+        num = (Uint32) strtoul (queueName + prefix, &end, 10) ;
+        if (    (*end == '\0')
+            &&  (num < LDRV_getDspConfig (dspId)->dspObject.arg1)) {
+            id = num ;
+        }
+    }
+
+    return id ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_echo
+ *
+ *  @desc   DSP side of the transport for a message taken from the ring to the
+ *          DSP: sends it back to its source queue through the ring to the
+ *          GPP. The event to the GPP is sent once the whole ring to the DSP
+ *          is handled.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    physAddr
+ *              Physical address of the message.
+ *
+ *  @ret    TRUE if the GPP side waits for an event.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_deliver
+ *  ============================================================================
+ */
+STATIC
+Bool
+RINGMQT_echo (IN ProcessorId dspId, IN Uint32 physAddr)
+{
+    RINGMQT_Ctrl *   ctrl = RINGMQT_ctrls [dspId] ;
+    LDRV_DspConfig * cfg  = LDRV_getDspConfig (dspId) ;
+    Bool             wake = FALSE ;
+    MSGQ_Msg         msg ;
+    Uint32           id ;
+
+    msg = (MSGQ_Msg) LDRV_phyToUsr (dspId, physAddr) ;
+    if (msg != NULL) {
+        if (    (msg->dstId < cfg->dspObject.arg1)
+            &&  (msg->srcProcId == ID_GPP)
+            &&  (msg->srcId != MSGQ_INVALIDMSGQ)) {
+            id             = msg->dstId ;
+            msg->dstId     = msg->srcId ;
+            msg->srcId     = (MSGQ_Id) id ;
+            msg->srcProcId = (Uint16) dspId ;
+            while (RINGMQT_push (&ctrl->toGpp,
+                                 RINGMQT_toGppSlots [dspId],
+                                 ctrl->numSlots,
+                                 physAddr,
+                                 &wake) == FALSE) {
+                /* Messages pushed before this pass may not be signalled. */
+                LDRV_IPS_raise (dspId,
+                                cfg->mqtObject.ipsId,
+                                cfg->mqtObject.ipsEventNo,
+                                RINGMQT_RINGPAYLOAD) ;
+                sched_yield () ;
+            }
+        }
+        else {
+            /* No reply possible: the DSP frees the message. */
+            LDRV_POOL_free (msg->poolId, msg, msg->size) ;
+        }
+    }
+
+    return wake ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_gppCallback
+ *
+ *  @desc   Handles the events of the DSP side: messages in the ring to the
+ *          GPP and locate answers.
+ *
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    arg
+ *              DSP identifier.
+ *  @arg    info
+ *              RINGMQT_RINGPAYLOAD or RINGMQT_CTRLPAYLOAD.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_dspCallback
+ *  ============================================================================
+ */
+STATIC
+Void
+RINGMQT_gppCallback (IN Uint32 eventNo, IN Pvoid arg, IN Pvoid info)
+{
+    ProcessorId    dspId   = (ProcessorId) LDRV_PTR_TO_UINT32 (arg) ;
+    Uint32         payload = LDRV_PTR_TO_UINT32 (info) ;
+    RINGMQT_Ctrl * ctrl    = RINGMQT_ctrls [dspId] ;
+
+    (Void) eventNo ;
+
+    if (payload == RINGMQT_CTRLPAYLOAD) {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        ctrl->answerSeq = ctrl->dspSeq ;
+        SYNC_HOST_broadcast (&ctrl->cond) ;
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+    else {
+        RINGMQT_drain (dspId,
+                       &ctrl->toGpp,
+                       RINGMQT_toGppSlots [dspId],
+                       ctrl->numSlots,
+                       &RINGMQT_deliver) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_dspCallback
+ *
+ *  @desc   DSP side of the transport. Answers the locates and sends the
+ *          messages put on a DSP queue back to their source queue.
+ *
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    arg
+ *              DSP identifier.
+ *  @arg    info
+ *              RINGMQT_RINGPAYLOAD or RINGMQT_CTRLPAYLOAD.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_gppCallback
+ *  ============================================================================
+ */
+STATIC
+Void
+RINGMQT_dspCallback (IN Uint32 eventNo, IN Pvoid arg, IN Pvoid info)
+{
+    ProcessorId      dspId   = (ProcessorId) LDRV_PTR_TO_UINT32 (arg) ;
+    Uint32           payload = LDRV_PTR_TO_UINT32 (info) ;
+    RINGMQT_Ctrl *   ctrl    = RINGMQT_ctrls [dspId] ;
+    LDRV_DspConfig * cfg     = LDRV_getDspConfig (dspId) ;
+    Uint32           id ;
+
+    if (payload == RINGMQT_CTRLPAYLOAD) {
+        id = RINGMQT_dspQueue (dspId, ctrl->locateName) ;
+        if (id == MSGQ_INVALIDMSGQ) {
+            ctrl->locateStatus = (Uint32) DSP_ENOTFOUND ;
+        }
+        else {
+            ctrl->locateStatus = (Uint32) DSP_SOK ;
+            ctrl->locateQueue  = ((Uint32) dspId << 16u) | id ;
+        }
+        ctrl->dspSeq = ctrl->locateSeq ;
+        LDRV_IPS_raise (dspId,
+                        cfg->mqtObject.ipsId,
+                        eventNo,
+                        RINGMQT_CTRLPAYLOAD) ;
+    }
+    else if (RINGMQT_drain (dspId,
+                            &ctrl->toDsp,
+                            RINGMQT_toDspSlots [dspId],
+                            ctrl->numSlots,
+                            &RINGMQT_echo) == TRUE) {
+        LDRV_IPS_raise (dspId,
+                        cfg->mqtObject.ipsId,
+                        eventNo,
+                        RINGMQT_RINGPAYLOAD) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_initRing
+ *
+ *  @desc   Empties a ring and arms it.
+ *
+ *  @arg    ring
+ *              Ring.
+ *  @arg    slots
+ *              Slots of the ring.
+ *  @arg    numSlots
+ *              Number of slots of the ring.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+RINGMQT_initRing (IN RINGMQT_Ring * ring,
+                  IN RINGMQT_Slot * slots,
+                  IN Uint32         numSlots)
+{
+    Uint32 i ;
+
+    for (i = 0u ; i < numSlots ; i++) {
+        slots [i].seq      = i ;
+        slots [i].physAddr = RINGMQT_EMPTY ;
+    }
+    ring->tail  = 0u ;
+    ring->head  = 0u ;
+    ring->armed = TRUE ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_init
+ *
+ *  @desc   Initializes the transport to a DSP in the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    create
+ *              TRUE if the shared state is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              Out of memory.
+ *          DSP_ECONFIG
+ *              The number of slots is not a power of two.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_exit
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RINGMQT_init (IN ProcessorId dspId, IN Bool create)
+{
+    DSP_STATUS       status   = DSP_SOK ;
+    LDRV_DspConfig * cfg      = LDRV_getDspConfig (dspId) ;
+    Uint32           numSlots = cfg->mqtObject.arg1 ;
+    RINGMQT_Object * mqtState ;
+    RINGMQT_Ctrl *   ctrl ;
+
+    TRC_2ENTER ("RINGMQT_init", dspId, create) ;
+
+    if (numSlots == 0u) {
+        numSlots = RINGMQT_DEFAULTSLOTS ;
+    }
+
+    if ((numSlots & (numSlots - 1u)) != 0u) {
+        status = DSP_ECONFIG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (    (create == TRUE)
+             &&  (LDRV_Obj->compState [LDRV_Comp_Mqt] == 0u)) {
+        LDRV_Obj->compState [LDRV_Comp_Mqt] =
+                                    LDRV_drvAlloc (sizeof (RINGMQT_Object)) ;
+        if (LDRV_Obj->compState [LDRV_Comp_Mqt] == 0u) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        mqtState = (RINGMQT_Object *) LDRV_compState (LDRV_Comp_Mqt) ;
+        if (create == TRUE) {
+            status = LDRV_SMM_alloc (dspId,
+                                       sizeof (RINGMQT_Ctrl)
+                                     + (2u * numSlots * sizeof (RINGMQT_Slot)),
+                                     &mqtState->ctrlPhys [dspId]) ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            ctrl = (RINGMQT_Ctrl *) LDRV_phyToUsr (dspId,
+                                                   mqtState->ctrlPhys [dspId]) ;
+            RINGMQT_ctrls [dspId]      = ctrl ;
+            RINGMQT_toDspSlots [dspId] = (RINGMQT_Slot *) (ctrl + 1) ;
+            RINGMQT_toGppSlots [dspId] = RINGMQT_toDspSlots [dspId] + numSlots ;
+            if (create == TRUE) {
+                ctrl->numSlots = numSlots ;
+                RINGMQT_initRing (&ctrl->toDsp,
+                                  RINGMQT_toDspSlots [dspId],
+                                  numSlots) ;
+                RINGMQT_initRing (&ctrl->toGpp,
+                                  RINGMQT_toGppSlots [dspId],
+                                  numSlots) ;
+                status = SYNC_HOST_createLock (&ctrl->locateLock) ;
+                if (DSP_SUCCEEDED (status)) {
+                    status = SYNC_HOST_createLock (&ctrl->lock) ;
+                }
+                if (DSP_SUCCEEDED (status)) {
+                    status = SYNC_HOST_createCond (&ctrl->cond) ;
+                }
+            }
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_IPS_register (dspId,
+                                    cfg->mqtObject.ipsId,
+                                    cfg->mqtObject.ipsEventNo,
+                                    RINGMQT_gppCallback,
+                                    LDRV_UINT32_TO_PTR (dspId)) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_IPS_dspRegister (dspId,
+                                       cfg->mqtObject.ipsId,
+                                       cfg->mqtObject.ipsEventNo,
+                                       RINGMQT_dspCallback,
+                                       LDRV_UINT32_TO_PTR (dspId)) ;
+    }
+
+    TRC_1LEAVE ("RINGMQT_init", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_exit
+ *
+ *  @desc   Finalizes the transport to a DSP in the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    destroy
+ *              TRUE if the shared state is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_init
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RINGMQT_exit (IN ProcessorId dspId, IN Bool destroy)
+{
+    LDRV_DspConfig * cfg  = LDRV_getDspConfig (dspId) ;
+    RINGMQT_Ctrl *   ctrl = RINGMQT_ctrls [dspId] ;
+
+    TRC_2ENTER ("RINGMQT_exit", dspId, destroy) ;
+
+    LDRV_IPS_dspRegister (dspId,
+                          cfg->mqtObject.ipsId,
+                          cfg->mqtObject.ipsEventNo,
+                          NULL,
+                          NULL) ;
+    LDRV_IPS_unregister (dspId,
+                         cfg->mqtObject.ipsId,
+                         cfg->mqtObject.ipsEventNo) ;
+
+    if ((ctrl != NULL) && (destroy == TRUE)) {
+        SYNC_HOST_deleteCond (&ctrl->cond) ;
+        SYNC_HOST_deleteLock (&ctrl->lock) ;
+        SYNC_HOST_deleteLock (&ctrl->locateLock) ;
+    }
+    RINGMQT_ctrls [dspId]      = NULL ;
+    RINGMQT_toDspSlots [dspId] = NULL ;
+    RINGMQT_toGppSlots [dspId] = NULL ;
+
+    TRC_1LEAVE ("RINGMQT_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_open
+ *
+ *  @desc   Opens the transport to a DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    attrs
+ *              ZCPYMQT_Attrs of the transport.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid attributes.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_close
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RINGMQT_open (IN ProcessorId dspId, IN Pvoid attrs)
+{
+    DSP_STATUS      status   = DSP_SOK ;
+    ZCPYMQT_Attrs * mqtAttrs = (ZCPYMQT_Attrs *) attrs ;
+    RINGMQT_Ctrl *  ctrl     = RINGMQT_ctrls [dspId] ;
+
+    TRC_2ENTER ("RINGMQT_open", dspId, attrs) ;
+
+    if (mqtAttrs == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        ctrl->poolId = mqtAttrs->poolId ;
+        ctrl->isOpen = TRUE ;
+    }
+
+    TRC_1LEAVE ("RINGMQT_open", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_close
+ *
+ *  @desc   Closes the transport to a DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_open
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RINGMQT_close (IN ProcessorId dspId)
+{
+    TRC_1ENTER ("RINGMQT_close", dspId) ;
+
+    RINGMQT_ctrls [dspId]->isOpen = FALSE ;
+
+    TRC_1LEAVE ("RINGMQT_close", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_locate
+ *
+ *  @desc   Asks the DSP for a message queue and waits for the answer.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    queueName
+ *              Name of the message queue.
+ *  @arg    msgqQueue
+ *              Location to receive the message queue.
+ *  @arg    timeout
+ *              Time to wait for the answer.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The DSP has no message queue with that name.
+ *          DSP_ETIMEOUT
+ *              The DSP did not answer in time.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_release
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RINGMQT_locate (IN  ProcessorId  dspId,
+                IN  Pstr         queueName,
+                OUT MSGQ_Queue * msgqQueue,
+                IN  Uint32       timeout)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    RINGMQT_Ctrl *   ctrl   = RINGMQT_ctrls [dspId] ;
+    LDRV_DspConfig * cfg    = LDRV_getDspConfig (dspId) ;
+    struct timespec  deadline ;
+    Uint32           seq ;
+
+    TRC_4ENTER ("RINGMQT_locate", dspId, queueName, msgqQueue, timeout) ;
+
+    SYNC_HOST_enter (&ctrl->locateLock) ;
+
+    SYNC_HOST_enter (&ctrl->lock) ;
+    strncpy (ctrl->locateName, queueName, DSP_MAX_STRLEN - 1u) ;
+    ctrl->locateName [DSP_MAX_STRLEN - 1u] = '\0' ;
+    seq = ++ctrl->locateSeq ;
+    SYNC_HOST_leave (&ctrl->lock) ;
+
+    status = LDRV_IPS_notify (dspId,
+                              cfg->mqtObject.ipsId,
+                              cfg->mqtObject.ipsEventNo,
+                              RINGMQT_CTRLPAYLOAD) ;
+    if (DSP_SUCCEEDED (status)) {
+        if ((timeout != WAIT_FOREVER) && (timeout != WAIT_NONE)) {
+            SYNC_HOST_deadline (timeout, &deadline) ;
+        }
+
+        SYNC_HOST_enter (&ctrl->lock) ;
+        while (DSP_SUCCEEDED (status) && (ctrl->answerSeq != seq)) {
+            if (timeout == WAIT_NONE) {
+                status = DSP_ETIMEOUT ;
+            }
+            else {
+                status = SYNC_HOST_waitUntil (&ctrl->cond,
+                                              &ctrl->lock,
+                                              (timeout == WAIT_FOREVER) ?
+                                              NULL : &deadline) ;
+            }
+        }
+
+        if (ctrl->answerSeq == seq) {
+            status = (DSP_STATUS) ctrl->locateStatus ;
+            if (DSP_SUCCEEDED (status)) {
+                *msgqQueue = ctrl->locateQueue ;
+            }
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    SYNC_HOST_leave (&ctrl->locateLock) ;
+
+    TRC_1LEAVE ("RINGMQT_locate", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_release
+ *
+ *  @desc   Releases a located message queue. Nothing is held for it.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    msgqQueue
+ *              Message queue.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_locate
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RINGMQT_release (IN ProcessorId dspId, IN MSGQ_Queue msgqQueue)
+{
+    (Void) dspId ;
+    (Void) msgqQueue ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_notify
+ *
+ *  @desc   Sends the event telling the DSP side that the ring to the DSP is no
+ *          longer empty.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_putv
+ *  ============================================================================
+ */
+STATIC
+Void
+RINGMQT_notify (IN ProcessorId dspId)
+{
+    DSP_STATUS       status ;
+    LDRV_DspConfig * cfg  = LDRV_getDspConfig (dspId) ;
+    RINGMQT_Ctrl *   ctrl = RINGMQT_ctrls [dspId] ;
+
+    status = LDRV_IPS_notify (dspId,
+                              cfg->mqtObject.ipsId,
+                              cfg->mqtObject.ipsEventNo,
+                              RINGMQT_RINGPAYLOAD) ;
+    if (DSP_FAILED (status)) {
+        /* The DSP stopped meanwhile. The messages stay in the ring, and the
+         * next producer sends the event again.
+         */
+        SET_FAILURE_REASON ;
+        ctrl->toDsp.armed = TRUE ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_putv
+ *
+ *  @desc   Sends an array of messages to the DSP through the ring to the DSP.
+ *          At most one event is sent, if the DSP side waits for one.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    msgArray
+ *              Messages.
+ *  @arg    numMsgs
+ *              Number of messages.
+ *  @arg    numPut
+ *              Location to receive the number of messages sent.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              A message is not shared with the DSP.
+ *          DSP_EWRONGSTATE
+ *              The DSP is not running.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_put
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RINGMQT_putv (IN  ProcessorId dspId,
+              IN  MSGQ_Msg *  msgArray,
+              IN  Uint32      numMsgs,
+              OUT Uint32 *    numPut)
+{
+    DSP_STATUS     status = DSP_SOK ;
+    RINGMQT_Ctrl * ctrl   = RINGMQT_ctrls [dspId] ;
+    Bool           wake   = FALSE ;
+    Bool           pushWake ;
+    Uint32         physAddr ;
+
+    *numPut = 0u ;
+    while (DSP_SUCCEEDED (status) && (*numPut < numMsgs)) {
+        physAddr = LDRV_usrToPhy (dspId, msgArray [*numPut]) ;
+        if (physAddr == LDRV_INVALID_ADDR) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else if (LDRV_PROC_isStarted (dspId) == FALSE) {
+            status = DSP_EWRONGSTATE ;
+            SET_FAILURE_REASON ;
+        }
+        else if (RINGMQT_push (&ctrl->toDsp,
+                               RINGMQT_toDspSlots [dspId],
+                               ctrl->numSlots,
+                               physAddr,
+                               &pushWake) == TRUE) {
+            (*numPut)++ ;
+            if (pushWake == TRUE) {
+                wake = TRUE ;
+            }
+        }
+        else {
+            /* The DSP may be waiting for the event of this very call. */
+            if (wake == TRUE) {
+                RINGMQT_notify (dspId) ;
+                wake = FALSE ;
+            }
+            sched_yield () ;
+        }
+    }
+
+    if (wake == TRUE) {
+        RINGMQT_notify (dspId) ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   RINGMQT_put
+ *
+ *  @desc   Sends a message to the DSP through the ring to the DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    msg
+ *              Message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The message is not shared with the DSP.
+ *          DSP_EWRONGSTATE
+ *              The DSP is not running.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RINGMQT_putv
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+RINGMQT_put (IN ProcessorId dspId, IN MSGQ_Msg msg)
+{
+    Uint32 numPut ;
+
+    return RINGMQT_putv (dspId, &msg, 1u, &numPut) ;
+}
+
+
+/** ============================================================================
+ *  @name   RINGMQT_Interface
+ *
+ *  @desc   Interface of the RINGMQT.
+ *  ============================================================================
+ */
+MQT_Interface RINGMQT_Interface = {
+    &RINGMQT_init,
+    &RINGMQT_exit,
+    &RINGMQT_open,
+    &RINGMQT_close,
+    &RINGMQT_locate,
+    &RINGMQT_release,
+    &RINGMQT_put,
+    &RINGMQT_putv
+} ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
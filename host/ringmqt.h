@@ -0,0 +1,101 @@
+/** ============================================================================
+ *  @file   ringmqt.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the ring Message Queue Transport
+ *          (RINGMQT) of the host backend.
+ *          Messages are passed by the physical address of their buffer
+ *          through two rings in the memory shared with the DSP, one for each
+ *          direction. The producers claim the slots of a ring without
+ *          locking; each ring has a single consumer. An IPS event is only
+ *          sent when the consumer of a ring has found it empty and waits for
+ *          more messages, so a burst of messages costs one event.
+ *          The number of slots of each ring is the first argument of the MQT
+ *          in the configuration (a power of two, RINGMQT_DEFAULTSLOTS if 0).
+ *          The DSP side behaves as the one of the ZCPYMQT, and the transport
+ *          is opened with ZCPYMQT_Attrs.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (RINGMQT_H)
+#define RINGMQT_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <msgqdefs.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv_mqt.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  RINGMQT_DEFAULTSLOTS
+ *
+ *  @desc   Number of slots of each ring when the configuration gives none.
+ *  ============================================================================
+ */
+#define RINGMQT_DEFAULTSLOTS    256u
+
+
+/** ============================================================================
+ *  @name   RINGMQT_Interface
+ *
+ *  @desc   Interface of the RINGMQT.
+ *  ============================================================================
+ */
+extern MQT_Interface RINGMQT_Interface ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (RINGMQT_H) */
@@ -0,0 +1,2537 @@
+/** ============================================================================
+ *  @file   smapool.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the shared memory allocator pool (SMAPOOL) of
+ *          the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_pool.h>
+#include <smapool.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_POOL_SMA, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @macro  SMAPOOL_ALIGN
+ *
+ *  @desc   Rounds a size up to the buffer alignment.
+ *  ============================================================================
+ */
+#define SMAPOOL_ALIGN(size)     (  ((size) + DSPLINK_BUF_ALIGN - 1u)           \
+                                 & ~(DSPLINK_BUF_ALIGN - 1u))
+
+/*  ============================================================================
+ *  @macro  SMAPOOL_HEADOFS
+ *
+ *  @desc   Offset of the first free buffer held in the head of a free list.
+ *  ============================================================================
+ */
+#define SMAPOOL_HEADOFS(head)   ((Uint32) (head))
+
+/*  ============================================================================
+ *  @const  SMAPOOL_ADDRTYPES
+ *
+ *  @desc   Number of address types the pool translates between.
+ *  ============================================================================
+ */
+#define SMAPOOL_ADDRTYPES       ((Uint32) AddrType_Dsp + 1u)
+
+/*  ============================================================================
+ *  @const  SMAPOOL_MAXEXTENTS
+ *
+ *  @desc   Maximum number of extents of buffers in a pool.
+ *  ============================================================================
+ */
+#define SMAPOOL_MAXEXTENTS      (MAX_SMABUFENTRIES * 4u)
+
+/*  ============================================================================
+ *  @const  SMAPOOL_EXTFREE, SMAPOOL_EXTLIVE, SMAPOOL_EXTRETIRING
+ *
+ *  @desc   States of an extent of buffers.
+ *  ============================================================================
+ */
+#define SMAPOOL_EXTFREE         0u
+#define SMAPOOL_EXTLIVE         1u
+#define SMAPOOL_EXTRETIRING     2u
+
+/*  ============================================================================
+ *  @const  SMAPOOL_NOLIST
+ *
+ *  @desc   Class slot of a new class while a reconfiguration is planned.
+ *  ============================================================================
+ */
+#define SMAPOOL_NOLIST          MAX_SMABUFENTRIES
+
+/*  ============================================================================
+ *  @macro  SMAPOOL_MKHEAD
+ *
+ *  @desc   Builds the head following a head of a free list, pointing to the
+ *          buffer at an offset and carrying the next tag.
+ *  ============================================================================
+ */
+#define SMAPOOL_MKHEAD(head, ofs)                                             \
+            (  ((((head) >> 32u) + 1u) << 32u)                                \
+             | (SMAPOOL_Head) (ofs))
+
+/*  ============================================================================
+ *  @macro  SMAPOOL_FREEOF, SMAPOOL_TOTALOF, SMAPOOL_TOTALS
+ *
+ *  @desc   Free and total numbers of buffers held in the counts of a class,
+ *          and the counts holding a total number of buffers.
+ *  ============================================================================
+ */
+#define SMAPOOL_FREEOF(counts)  ((Uint32) (counts))
+#define SMAPOOL_TOTALOF(counts) ((Uint32) ((counts) >> 32u))
+#define SMAPOOL_TOTALS(num)     (((SMAPOOL_Count) (num)) << 32u)
+
+/*  ============================================================================
+ *  @macro  SMAPOOL_AVAILGEN
+ *
+ *  @desc   Generation held in the availability map of an order. The low
+ *          half of the map has a bit for every position of the order, the
+ *          high half the generation of the order.
+ *  ============================================================================
+ */
+#define SMAPOOL_AVAILGEN(avail) ((avail) >> 16u)
+
+#if (MAX_SMABUFENTRIES > 16u)
+#error "The availability map of an order holds at most 16 classes."
+#endif /* if (MAX_SMABUFENTRIES > 16u) */
+
+
+/*  ============================================================================
+ *  @name   SMAPOOL_Head
+ *
+ *  @desc   Head of a free list. The low word is the offset of the first free
+ *          buffer from the start of the region, 0 if the list is empty, so
+ *          that the head is valid in every process mapping the region. The
+ *          high word is a tag bumped by every update, so that a head read
+ *          before the list was popped and pushed back never compares equal
+ *          to the current one.
+ *  ============================================================================
+ */
+typedef unsigned long long SMAPOOL_Head ;
+
+/*  ============================================================================
+ *  @name   SMAPOOL_Count
+ *
+ *  @desc   Numbers of buffers of a class. The low word is the number of free
+ *          buffers and the high word the total number, so that both are read
+ *          and updated together and a reader never sees a free count above
+ *          the total one.
+ *  ============================================================================
+ */
+typedef unsigned long long SMAPOOL_Count ;
+
+
+/*  ============================================================================
+ *  @name   SMAPOOL_BufList
+ *
+ *  @desc   Buffers of one size class. The free buffers form a lock-free stack
+ *          linked through their first word, which holds the offset of the
+ *          next free buffer.
+ *
+ *  @field  freeHead
+ *              Head of the free list.
+ *  @field  size
+ *              Size of the buffers, as configured.
+ *  @field  stride
+ *              Distance between two buffers.
+ *  @field  counts
+ *              Numbers of buffers. The total includes the retiring buffers
+ *              not yet retired. The free number is raised before a buffer is
+ *              pushed and lowered after one is popped, so it is never below
+ *              the length of the free list.
+ *  @field  maxUsed
+ *              Highest number of buffers in use at the same time.
+ *  @field  retiring
+ *              Number of buffers of retiring extents not yet retired. Popped
+ *              buffers are only checked for retirement while it is not 0.
+ *  @field  isLive
+ *              TRUE while the class is part of the configuration. A class
+ *              removed by a reconfiguration keeps its slot until all its
+ *              buffers are retired.
+ *  @field  orderBits
+ *              Bit of the class in the availability map of each order, 0 if
+ *              the order does not hold the class.
+ *  ============================================================================
+ */
+typedef struct SMAPOOL_BufList_tag {
+    SMAPOOL_Head            freeHead ;
+    volatile SMAPOOL_Count  counts   ;
+    Uint32                  size     ;
+    Uint32                  stride   ;
+    volatile Uint32         maxUsed  ;
+    volatile Uint32         retiring ;
+    Uint32                  isLive   ;
+    volatile Uint32         orderBits [2] ;
+} SMAPOOL_BufList ;
+
+/*  ============================================================================
+ *  @name   SMAPOOL_Extent
+ *
+ *  @desc   Contiguous run of buffers of one class. A class gets an extent
+ *          when it is created and another one every time it grows. Shrinking
+ *          a class marks whole extents, or the tail of one split off, as
+ *          retiring: their buffers are retired instead of being freed, and
+ *          the extent is released once all of them are.
+ *
+ *  @field  version
+ *              Odd while the extent is being rewritten, bumped again when it
+ *              is done, so that a lookup racing with the reuse of the slot
+ *              notices it and reads the extent again.
+ *  @field  state
+ *              SMAPOOL_EXTFREE, SMAPOOL_EXTLIVE or SMAPOOL_EXTRETIRING.
+ *  @field  list
+ *              Slot of the class owning the buffers.
+ *  @field  startPhys
+ *              Physical address of the first buffer.
+ *  @field  endPhys
+ *              Physical address following the last buffer.
+ *  @field  numBuffers
+ *              Number of buffers.
+ *  @field  retired
+ *              Number of buffers retired.
+ *  ============================================================================
+ */
+typedef struct SMAPOOL_Extent_tag {
+    volatile Uint32  version    ;
+    volatile Uint32  state      ;
+    Uint32           list       ;
+    Uint32           startPhys  ;
+    volatile Uint32  endPhys    ;
+    Uint32           numBuffers ;
+    volatile Uint32  retired    ;
+} SMAPOOL_Extent ;
+
+/*  ============================================================================
+ *  @name   SMAPOOL_Order
+ *
+ *  @desc   Live classes by increasing buffer size, for best-fit allocation.
+ *
+ *  @field  avail
+ *              Availability map: the bit of a position is set whenever the
+ *              class there may have free buffers. It is set by the free
+ *              making a class non-empty and cleared by the allocation that
+ *              finds it empty, so allocations skip exhausted classes without
+ *              touching their free lists.
+ *  @field  numBufPools
+ *              Number of live classes.
+ *  @field  sizes
+ *              Sizes of the live classes.
+ *  @field  lists
+ *              Slots of the live classes.
+ *  ============================================================================
+ */
+typedef struct SMAPOOL_Order_tag {
+    volatile Uint32  avail ;
+    Uint32           numBufPools ;
+    Uint32           sizes [MAX_SMABUFENTRIES] ;
+    Uint32           lists [MAX_SMABUFENTRIES] ;
+} SMAPOOL_Order ;
+
+/*  ============================================================================
+ *  @name   SMAPOOL_Ctrl
+ *
+ *  @desc   Control structure of the pool, at the start of its region.
+ *
+ *  @field  isOpen
+ *              TRUE while the pool is open.
+ *  @field  exactMatchReq
+ *              TRUE if allocations must match the size of a class exactly.
+ *  @field  conflicts
+ *              Number of updates of a free list retried because another
+ *              thread updated it first.
+ *  @field  numCalls
+ *              Number of allocation and free calls.
+ *  @field  current
+ *              Index of the order in use. A reconfiguration fills the other
+ *              one and then flips it, so allocations never see an order
+ *              being written.
+ *  @field  numExtents
+ *              Number of extent slots ever used.
+ *  @field  orders
+ *              Current and next order of the live classes.
+ *  @field  lists
+ *              Class slots.
+ *  @field  extents
+ *              Extent slots.
+ *  ============================================================================
+ */
+typedef struct SMAPOOL_Ctrl_tag {
+    Uint32           isOpen        ;
+    volatile Uint32  exactMatchReq ;
+    Uint32           conflicts     ;
+    Uint32           numCalls      ;
+    volatile Uint32  current       ;
+    volatile Uint32  numExtents    ;
+    SMAPOOL_Order    orders  [2] ;
+    SMAPOOL_BufList  lists   [MAX_SMABUFENTRIES] ;
+    SMAPOOL_Extent   extents [SMAPOOL_MAXEXTENTS] ;
+} SMAPOOL_Ctrl ;
+
+/*  ============================================================================
+ *  @name   SMAPOOL_Object
+ *
+ *  @desc   Pool object in the calling process.
+ *
+ *  @field  ctrl
+ *              Control structure of the pool.
+ *  @field  usrBase
+ *              Start of the region of the pool in the calling process.
+ *  @field  physAddr
+ *              Physical address of the region of the pool.
+ *  @field  size
+ *              Size of the region of the pool.
+ *  @field  xltBase
+ *              Start of the region of the pool in every address space,
+ *              indexed by AddrType. The region is contiguous in all of them,
+ *              so any translation is an offset from one base to another.
+ *  @field  pageSize
+ *              Size of the GPP pages backing the region of the pool.
+ *  ============================================================================
+ */
+typedef struct SMAPOOL_Object_tag {
+    SMAPOOL_Ctrl * ctrl     ;
+    Uint8 *        usrBase  ;
+    Uint32         physAddr ;
+    Uint32         size     ;
+    unsigned long  xltBase [SMAPOOL_ADDRTYPES] ;
+    Uint32         pageSize ;
+} SMAPOOL_Object ;
+
+
+/*  ============================================================================
+ *  @name   SMAPOOL_objects
+ *
+ *  @desc   Pool objects in the calling process.
+ *  ============================================================================
+ */
+STATIC SMAPOOL_Object SMAPOOL_objects [MAX_DSPS][MAX_POOLENTRIES] ;
+
+
+#if defined (DDSP_PROFILE)
+/*  ============================================================================
+ *  @func   SMAPOOL_count
+ *
+ *  @desc   Counts a call to the pool and the retries it made.
+ *
+ *  @arg    ctrl
+ *              Control structure of the pool.
+ *  @arg    retries
+ *              Number of updates of a free list the call retried.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_count (IN SMAPOOL_Ctrl * ctrl, IN Uint32 retries)
+{
+    __sync_add_and_fetch (&ctrl->numCalls, 1u) ;
+    if (retries != 0u) {
+        __sync_add_and_fetch (&ctrl->conflicts, retries) ;
+    }
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_usrToPhy
+ *
+ *  @desc   Translates an address in the calling process to a physical address
+ *          within the pool.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    usrAddr
+ *              Address in the calling process.
+ *
+ *  @ret    Physical address, 0 if the address is outside the pool.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint32
+SMAPOOL_usrToPhy (IN SMAPOOL_Object * obj, IN Pvoid usrAddr)
+{
+    Uint32 physAddr = 0u ;
+
+    if (    ((Uint8 *) usrAddr >= obj->usrBase)
+        &&  ((Uint8 *) usrAddr <  obj->usrBase + obj->size)) {
+        physAddr = obj->physAddr + (Uint32) ((Uint8 *) usrAddr - obj->usrBase) ;
+    }
+
+    return physAddr ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_findExtent
+ *
+ *  @desc   Finds the extent containing a buffer.
+ *
+ *  @arg    ctrl
+ *              Control structure of the pool.
+ *  @arg    physAddr
+ *              Physical address of the buffer.
+ *
+ *  @ret    Extent, NULL if the address is not the start of a buffer.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+SMAPOOL_Extent *
+SMAPOOL_findExtent (IN SMAPOOL_Ctrl * ctrl, IN Uint32 physAddr)
+{
+    SMAPOOL_Extent * ext = NULL ;
+    SMAPOOL_Extent * cur ;
+    Bool             found ;
+    Uint32           version ;
+    Uint32           i ;
+
+    for (i = 0u ; (i < ctrl->numExtents) && (ext == NULL) ; i++) {
+        cur = &(ctrl->extents [i]) ;
+        do {
+            version = cur->version ;
+            __sync_synchronize () ;
+            found = (    (cur->state != SMAPOOL_EXTFREE)
+                     &&  (physAddr >= cur->startPhys)
+                     &&  (physAddr <  cur->endPhys)
+                     &&  (  ((physAddr - cur->startPhys)
+                          % ctrl->lists [cur->list].stride) == 0u)) ;
+            __sync_synchronize () ;
+        } while (((version & 1u) != 0u) || (version != cur->version)) ;
+
+        if (found == TRUE) {
+            ext = cur ;
+        }
+    }
+
+    return ext ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_retire
+ *
+ *  @desc   Retires a buffer of a retiring extent, releasing the extent with
+ *          its last buffer.
+ *
+ *  @arg    list
+ *              Class of the buffer.
+ *  @arg    ext
+ *              Extent of the buffer.
+ *
+ *  @ret    None
+ *
+ *  @enter  The buffer is neither free nor in use.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_drain
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_retire (IN SMAPOOL_BufList * list, IN SMAPOOL_Extent * ext)
+{
+    /* The total goes last: the slot of a removed class is only reused once
+     * its total is 0, and must not be reset under a retirement in flight.
+     */
+    __sync_sub_and_fetch (&list->retiring, 1u) ;
+    if (__sync_add_and_fetch (&ext->retired, 1u) == ext->numBuffers) {
+        ext->state = SMAPOOL_EXTFREE ;
+    }
+    __sync_sub_and_fetch (&list->counts, SMAPOOL_TOTALS (1u)) ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_pop
+ *
+ *  @desc   Pops the first free buffer of a class.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    list
+ *              Class to allocate from.
+ *  @arg    retries
+ *              Incremented for every retried update of the free list.
+ *
+ *  @ret    Address of the buffer, NULL if the class has no free buffer.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_push
+ *  ============================================================================
+ */
+STATIC
+Pvoid
+SMAPOOL_pop (IN     SMAPOOL_Object *  obj,
+             IN     SMAPOOL_BufList * list,
+             IN OUT Uint32 *          retries)
+{
+    Uint8 *       buf = NULL ;
+    SMAPOOL_Head  head ;
+    SMAPOOL_Head  seen ;
+    SMAPOOL_Count counts ;
+    Uint32        next ;
+    Uint32        used ;
+    Uint32        max ;
+
+    head = list->freeHead ;
+    while ((buf == NULL) && (SMAPOOL_HEADOFS (head) != 0u)) {
+        /* The link may be overwritten by the owner of the buffer if another
+         * thread pops it first. The tag of the head has then moved on and
+         * the swap below fails, so the stale link is never installed.
+         */
+        next = *((volatile Uint32 *) (obj->usrBase + SMAPOOL_HEADOFS (head))) ;
+        seen = __sync_val_compare_and_swap (&list->freeHead,
+                                            head,
+                                            SMAPOOL_MKHEAD (head, next)) ;
+        if (seen == head) {
+            buf = obj->usrBase + SMAPOOL_HEADOFS (head) ;
+        }
+        else {
+            head = seen ;
+            (*retries)++ ;
+        }
+    }
+
+    if (buf != NULL) {
+        counts = __sync_sub_and_fetch (&list->counts, 1u) ;
+        used   = SMAPOOL_TOTALOF (counts) - SMAPOOL_FREEOF (counts) ;
+        max  = list->maxUsed ;
+        while (    (used > max)
+               &&  (__sync_bool_compare_and_swap (&list->maxUsed, max, used)
+                    == FALSE)) {
+            max = list->maxUsed ;
+        }
+    }
+
+    return buf ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_mark
+ *
+ *  @desc   Marks a class as having free buffers in the availability map of
+ *          both orders.
+ *
+ *  @arg    ctrl
+ *              Control structure of the pool.
+ *  @arg    list
+ *              Class to mark.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_exhausted
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_mark (IN SMAPOOL_Ctrl * ctrl, IN SMAPOOL_BufList * list)
+{
+    __sync_fetch_and_or (&(ctrl->orders [0].avail), list->orderBits [0]) ;
+    __sync_fetch_and_or (&(ctrl->orders [1].avail), list->orderBits [1]) ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_push
+ *
+ *  @desc   Pushes a chain of buffers on the free list of their class, and
+ *          marks the class available if the list was empty.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    list
+ *              Class of the buffers.
+ *  @arg    first
+ *              Offset of the first buffer of the chain from the start of the
+ *              region.
+ *  @arg    last
+ *              Offset of the last buffer of the chain.
+ *  @arg    count
+ *              Number of buffers in the chain.
+ *  @arg    retries
+ *              Incremented for every retried update of the free list.
+ *
+ *  @ret    None
+ *
+ *  @enter  The buffers from first to last are linked.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_pop
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_push (IN     SMAPOOL_Object *  obj,
+              IN     SMAPOOL_BufList * list,
+              IN     Uint32            first,
+              IN     Uint32            last,
+              IN     Uint32            count,
+              IN OUT Uint32 *          retries)
+{
+    Bool         done = FALSE ;
+    SMAPOOL_Head head ;
+    SMAPOOL_Head seen ;
+
+    __sync_add_and_fetch (&list->counts, (SMAPOOL_Count) count) ;
+    head = list->freeHead ;
+    while (done == FALSE) {
+        *((volatile Uint32 *) (obj->usrBase + last)) = SMAPOOL_HEADOFS (head) ;
+        seen = __sync_val_compare_and_swap (&list->freeHead,
+                                            head,
+                                            SMAPOOL_MKHEAD (head, first)) ;
+        if (seen == head) {
+            done = TRUE ;
+        }
+        else {
+            head = seen ;
+            (*retries)++ ;
+        }
+    }
+
+    if (SMAPOOL_HEADOFS (head) == 0u) {
+        SMAPOOL_mark (obj->ctrl, list) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_popLive
+ *
+ *  @desc   Pops the first free buffer of a class that is not retiring,
+ *          retiring the ones popped before it.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    list
+ *              Class to allocate from.
+ *  @arg    size
+ *              Size the buffer must hold.
+ *  @arg    retries
+ *              Incremented for every retried update of the free list.
+ *
+ *  @ret    Address of the buffer, NULL if the class has no free buffer or
+ *          no longer holds buffers of the size.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_pop
+ *  ============================================================================
+ */
+STATIC
+Pvoid
+SMAPOOL_popLive (IN     SMAPOOL_Object *  obj,
+                 IN     SMAPOOL_BufList * list,
+                 IN     Uint32            size,
+                 IN OUT Uint32 *          retries)
+{
+    Pvoid            buf ;
+    SMAPOOL_Extent * ext ;
+    Bool             retired ;
+    Uint32           offset ;
+
+    do {
+        retired = FALSE ;
+        buf     = SMAPOOL_pop (obj, list, retries) ;
+        if ((buf != NULL) && (list->retiring != 0u)) {
+            ext = SMAPOOL_findExtent (obj->ctrl,
+                                      SMAPOOL_usrToPhy (obj, buf)) ;
+            if ((ext != NULL) && (ext->state == SMAPOOL_EXTRETIRING)) {
+                SMAPOOL_retire (list, ext) ;
+                retired = TRUE ;
+            }
+        }
+    } while (retired == TRUE) ;
+
+    /* The class was chosen from an order read before the pop. If it has
+     * been removed and its slot reused for a smaller size since, the buffer
+     * is too small and goes back.
+     */
+    if ((buf != NULL) && (list->size < size)) {
+        offset = (Uint32) ((Uint8 *) buf - obj->usrBase) ;
+        SMAPOOL_push (obj, list, offset, offset, 1u, retries) ;
+        buf = NULL ;
+    }
+
+    return buf ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_drain
+ *
+ *  @desc   Retires the free buffers of the retiring extents of a class. The
+ *          whole free list is detached at once, the buffers to keep are
+ *          pushed back as one chain, so allocations from the class only miss
+ *          its free buffers while the list is walked.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    list
+ *              Class to drain.
+ *  @arg    retries
+ *              Incremented for every retried update of the free list.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_retire
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_drain (IN     SMAPOOL_Object *  obj,
+               IN     SMAPOOL_BufList * list,
+               IN OUT Uint32 *          retries)
+{
+    Uint32           first = 0u ;
+    Uint32           last  = 0u ;
+    Uint32           count = 0u ;
+    SMAPOOL_Head     head ;
+    SMAPOOL_Head     seen ;
+    SMAPOOL_Extent * ext ;
+    Uint32           offset ;
+    Uint32           next ;
+
+    head = list->freeHead ;
+    seen = __sync_val_compare_and_swap (&list->freeHead,
+                                        head,
+                                        SMAPOOL_MKHEAD (head, 0u)) ;
+    while (seen != head) {
+        head = seen ;
+        (*retries)++ ;
+        seen = __sync_val_compare_and_swap (&list->freeHead,
+                                            head,
+                                            SMAPOOL_MKHEAD (head, 0u)) ;
+    }
+
+    for (offset = SMAPOOL_HEADOFS (head) ; offset != 0u ; offset = next) {
+        next = *((Uint32 *) (obj->usrBase + offset)) ;
+        ext  = SMAPOOL_findExtent (obj->ctrl, obj->physAddr + offset) ;
+        __sync_sub_and_fetch (&list->counts, 1u) ;
+        if ((ext != NULL) && (ext->state == SMAPOOL_EXTRETIRING)) {
+            SMAPOOL_retire (list, ext) ;
+        }
+        else {
+            if (count == 0u) {
+                first = offset ;
+            }
+            else {
+                *((Uint32 *) (obj->usrBase + last)) = offset ;
+            }
+            last = offset ;
+            count++ ;
+        }
+    }
+
+    if (count != 0u) {
+        SMAPOOL_push (obj, list, first, last, count, retries) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_rank
+ *
+ *  @desc   Finds the position of the first class of an order whose buffers
+ *          hold a size.
+ *
+ *  @arg    order
+ *              Order of the classes.
+ *  @arg    size
+ *              Size of the buffer.
+ *
+ *  @ret    Position of the class, the number of classes if none fits.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_take
+ *  ============================================================================
+ */
+STATIC
+Uint32
+SMAPOOL_rank (IN SMAPOOL_Order * order, IN Uint32 size)
+{
+    Uint32 low  = 0u ;
+    Uint32 high = order->numBufPools ;
+    Uint32 mid ;
+
+    while (low < high) {
+        mid = (low + high) / 2u ;
+        if (order->sizes [mid] < size) {
+            low = mid + 1u ;
+        }
+        else {
+            high = mid ;
+        }
+    }
+
+    return low ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_exhausted
+ *
+ *  @desc   Clears the bit of a class found empty in the availability map of
+ *          an order, unless the order has been rebuilt since it was read, and
+ *          sets it back if a buffer was freed to the class meanwhile.
+ *
+ *  @arg    ctrl
+ *              Control structure of the pool.
+ *  @arg    order
+ *              Order of the classes.
+ *  @arg    seen
+ *              Availability map read when the class was chosen.
+ *  @arg    bit
+ *              Bit of the class.
+ *  @arg    list
+ *              Class found empty.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_mark
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_exhausted (IN SMAPOOL_Ctrl *    ctrl,
+                   IN SMAPOOL_Order *   order,
+                   IN Uint32            seen,
+                   IN Uint32            bit,
+                   IN SMAPOOL_BufList * list)
+{
+    Uint32 avail = order->avail ;
+    Uint32 prev ;
+
+    while (    (SMAPOOL_AVAILGEN (avail) == SMAPOOL_AVAILGEN (seen))
+           &&  ((avail & bit) != 0u)) {
+        prev = __sync_val_compare_and_swap (&order->avail,
+                                            avail,
+                                            avail & ~bit) ;
+        avail = (prev == avail) ? (avail & ~bit) : prev ;
+    }
+
+    /* A free that found the list empty after the failed pop may have set
+     * the bit before it was cleared above.
+     */
+    if (SMAPOOL_HEADOFS (list->freeHead) != 0u) {
+        SMAPOOL_mark (ctrl, list) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_take
+ *
+ *  @desc   Takes a buffer of a size from the smallest class that fits the
+ *          size and has a free buffer, or from a class of exactly that size
+ *          if exact match is required. The classes are picked from the
+ *          availability map of the order, lowest bit first.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    size
+ *              Size of the buffer.
+ *  @arg    list
+ *              Location to receive the class the buffer was taken from.
+ *  @arg    retries
+ *              Incremented for every retried update of a free list.
+ *
+ *  @ret    Address of the buffer, NULL if none is available.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_pop
+ *  ============================================================================
+ */
+STATIC
+Pvoid
+SMAPOOL_take (IN     SMAPOOL_Object *   obj,
+              IN     Uint32             size,
+              OUT    SMAPOOL_BufList ** list,
+              IN OUT Uint32 *           retries)
+{
+    SMAPOOL_Ctrl *  ctrl  = obj->ctrl ;
+    SMAPOOL_Order * order = &(ctrl->orders [ctrl->current & 1u]) ;
+    Pvoid           buf   = NULL ;
+    Uint32          seen  = order->avail ;
+    Uint32          first ;
+    Uint32          end   ;
+    Uint32          avail ;
+    Uint32          bit ;
+
+    first = SMAPOOL_rank (order, size) ;
+    end   = order->numBufPools ;
+    if (ctrl->exactMatchReq == TRUE) {
+        end = first ;
+        while ((end < order->numBufPools) && (order->sizes [end] == size)) {
+            end++ ;
+        }
+    }
+
+    avail = seen & ~((1u << first) - 1u) & ((1u << end) - 1u) ;
+    while ((buf == NULL) && (avail != 0u)) {
+        bit   = avail & (~avail + 1u) ;
+        *list = &(ctrl->lists [order->lists [__builtin_ctz (avail)]]) ;
+        buf   = SMAPOOL_popLive (obj, *list, size, retries) ;
+        if (buf == NULL) {
+            SMAPOOL_exhausted (ctrl, order, seen, bit, *list) ;
+        }
+        avail &= ~bit ;
+    }
+
+    return buf ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_give
+ *
+ *  @desc   Returns a buffer to its class, or retires it if its extent is
+ *          retiring.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    buf
+ *              Address of the buffer.
+ *  @arg    size
+ *              Size of the buffer.
+ *  @arg    retries
+ *              Incremented for every retried update of the free list.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The buffer does not belong to the pool.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_take
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_give (IN     SMAPOOL_Object * obj,
+              IN     Pvoid            buf,
+              IN     Uint32           size,
+              IN OUT Uint32 *         retries)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    SMAPOOL_BufList * list   = NULL ;
+    SMAPOOL_Extent *  ext ;
+    SMAPOOL_Count     counts ;
+    Uint32            physAddr ;
+    Uint32            offset ;
+
+    physAddr = SMAPOOL_usrToPhy (obj, buf) ;
+    ext      = SMAPOOL_findExtent (obj->ctrl, physAddr) ;
+    if (ext != NULL) {
+        list   = &(obj->ctrl->lists [ext->list]) ;
+        /* Atomic read, the counts may not be a single word. */
+        counts = __sync_fetch_and_add (&list->counts, 0u) ;
+    }
+
+    if (    (list == NULL)
+        ||  (size > list->size)
+        ||  (SMAPOOL_FREEOF (counts) == SMAPOOL_TOTALOF (counts))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if (ext->state == SMAPOOL_EXTRETIRING) {
+        SMAPOOL_retire (list, ext) ;
+    }
+    else {
+        offset = physAddr - obj->physAddr ;
+        SMAPOOL_push (obj, list, offset, offset, 1u, retries) ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_liveBuffers
+ *
+ *  @desc   Counts the buffers of the live extents of a class.
+ *
+ *  @arg    ctrl
+ *              Control structure of the pool.
+ *  @arg    slot
+ *              Slot of the class.
+ *
+ *  @ret    Number of buffers.
+ *
+ *  @enter  Reconfigurations of the pool are serialized.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_apply
+ *  ============================================================================
+ */
+STATIC
+Uint32
+SMAPOOL_liveBuffers (IN SMAPOOL_Ctrl * ctrl, IN Uint32 slot)
+{
+    Uint32 count = 0u ;
+    Uint32 i ;
+
+    for (i = 0u ; i < ctrl->numExtents ; i++) {
+        if (    (ctrl->extents [i].state == SMAPOOL_EXTLIVE)
+            &&  (ctrl->extents [i].list == slot)) {
+            count += ctrl->extents [i].numBuffers ;
+        }
+    }
+
+    return count ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_freeExtents
+ *
+ *  @desc   Counts the extent slots available.
+ *
+ *  @arg    ctrl
+ *              Control structure of the pool.
+ *
+ *  @ret    Number of extent slots.
+ *
+ *  @enter  Reconfigurations of the pool are serialized.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_newExtent
+ *  ============================================================================
+ */
+STATIC
+Uint32
+SMAPOOL_freeExtents (IN SMAPOOL_Ctrl * ctrl)
+{
+    Uint32 count = SMAPOOL_MAXEXTENTS - ctrl->numExtents ;
+    Uint32 i ;
+
+    for (i = 0u ; i < ctrl->numExtents ; i++) {
+        if (ctrl->extents [i].state == SMAPOOL_EXTFREE) {
+            count++ ;
+        }
+    }
+
+    return count ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_newExtent
+ *
+ *  @desc   Fills an available extent slot and publishes it, so that the
+ *          buffers it describes can be freed once they are handed out.
+ *
+ *  @arg    ctrl
+ *              Control structure of the pool.
+ *  @arg    slot
+ *              Slot of the class owning the buffers.
+ *  @arg    startPhys
+ *              Physical address of the first buffer.
+ *  @arg    numBuffers
+ *              Number of buffers.
+ *  @arg    state
+ *              State of the extent.
+ *
+ *  @ret    None
+ *
+ *  @enter  Reconfigurations of the pool are serialized.
+ *          An extent slot is available.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_freeExtents
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_newExtent (IN SMAPOOL_Ctrl * ctrl,
+                   IN Uint32         slot,
+                   IN Uint32         startPhys,
+                   IN Uint32         numBuffers,
+                   IN Uint32         state)
+{
+    SMAPOOL_Extent * ext ;
+    Uint32           i ;
+
+    for (i = 0u ; i < ctrl->numExtents ; i++) {
+        if (ctrl->extents [i].state == SMAPOOL_EXTFREE) {
+            break ;
+        }
+    }
+
+    DBC_Assert (i < SMAPOOL_MAXEXTENTS) ;
+
+    ext             = &(ctrl->extents [i]) ;
+    __sync_add_and_fetch (&ext->version, 1u) ;
+    ext->list       = slot ;
+    ext->startPhys  = startPhys ;
+    ext->endPhys    = startPhys + (numBuffers * ctrl->lists [slot].stride) ;
+    ext->numBuffers = numBuffers ;
+    ext->retired    = 0u ;
+    __sync_add_and_fetch (&ext->version, 1u) ;
+    ext->state      = state ;
+    if (i == ctrl->numExtents) {
+        __sync_add_and_fetch (&ctrl->numExtents, 1u) ;
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_place
+ *
+ *  @desc   Chooses, first fit, where runs of buffers go in the space of the
+ *          region not used by the control structure or an extent.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    bytes
+ *              Size of every run, 0 for none.
+ *  @arg    numRuns
+ *              Number of runs.
+ *  @arg    startPhys
+ *              Location to receive the physical address of every run.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The runs do not fit in the region.
+ *
+ *  @enter  Reconfigurations of the pool are serialized.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_apply
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_place (IN  SMAPOOL_Object * obj,
+               IN  Uint32 *         bytes,
+               IN  Uint32           numRuns,
+               OUT Uint32 *         startPhys)
+{
+    DSP_STATUS       status  = DSP_SOK ;
+    SMAPOOL_Ctrl *   ctrl    = obj->ctrl ;
+    Uint32           numUsed = 1u ;
+    Uint32           numGaps = 0u ;
+    Uint32           usedStart [SMAPOOL_MAXEXTENTS + 1u] ;
+    Uint32           usedEnd   [SMAPOOL_MAXEXTENTS + 1u] ;
+    Uint32           gapStart  [SMAPOOL_MAXEXTENTS + 2u] ;
+    Uint32           gapEnd    [SMAPOOL_MAXEXTENTS + 2u] ;
+    SMAPOOL_Extent * ext ;
+    Uint32           cursor ;
+    Uint32           tmp ;
+    Uint32           i ;
+    Uint32           j ;
+
+    usedStart [0] = obj->physAddr ;
+    usedEnd   [0] = obj->physAddr + SMAPOOL_ALIGN (sizeof (SMAPOOL_Ctrl)) ;
+    for (i = 0u ; i < ctrl->numExtents ; i++) {
+        ext = &(ctrl->extents [i]) ;
+        if (ext->state != SMAPOOL_EXTFREE) {
+            usedStart [numUsed] = ext->startPhys ;
+            usedEnd   [numUsed] = ext->endPhys ;
+            for (j = numUsed ;
+                 (j > 0u) && (usedStart [j - 1u] > usedStart [j]) ;
+                 j--) {
+                tmp               = usedStart [j] ;
+                usedStart [j]     = usedStart [j - 1u] ;
+                usedStart [j - 1u] = tmp ;
+                tmp               = usedEnd [j] ;
+                usedEnd [j]       = usedEnd [j - 1u] ;
+                usedEnd [j - 1u]  = tmp ;
+            }
+            numUsed++ ;
+        }
+    }
+
+    cursor = obj->physAddr ;
+    for (i = 0u ; i < numUsed ; i++) {
+        if (usedStart [i] > cursor) {
+            gapStart [numGaps] = cursor ;
+            gapEnd   [numGaps] = usedStart [i] ;
+            numGaps++ ;
+        }
+        if (usedEnd [i] > cursor) {
+            cursor = usedEnd [i] ;
+        }
+    }
+    if (obj->physAddr + obj->size > cursor) {
+        gapStart [numGaps] = cursor ;
+        gapEnd   [numGaps] = obj->physAddr + obj->size ;
+        numGaps++ ;
+    }
+
+    for (i = 0u ; (i < numRuns) && DSP_SUCCEEDED (status) ; i++) {
+        if (bytes [i] != 0u) {
+            for (j = 0u ; j < numGaps ; j++) {
+                if ((gapEnd [j] - gapStart [j]) >= bytes [i]) {
+                    break ;
+                }
+            }
+            if (j == numGaps) {
+                status = DSP_EMEMORY ;
+                SET_FAILURE_REASON ;
+            }
+            else {
+                startPhys [i]  = gapStart [j] ;
+                gapStart [j]  += bytes [i] ;
+            }
+        }
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_grow
+ *
+ *  @desc   Adds a run of buffers to a class as a new extent and frees them.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    slot
+ *              Slot of the class.
+ *  @arg    startPhys
+ *              Physical address of the first buffer.
+ *  @arg    count
+ *              Number of buffers.
+ *  @arg    retries
+ *              Incremented for every retried update of the free list.
+ *
+ *  @ret    None
+ *
+ *  @enter  Reconfigurations of the pool are serialized.
+ *          An extent slot is available.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_shrink
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_grow (IN     SMAPOOL_Object * obj,
+              IN     Uint32           slot,
+              IN     Uint32           startPhys,
+              IN     Uint32           count,
+              IN OUT Uint32 *         retries)
+{
+    SMAPOOL_BufList * list  = &(obj->ctrl->lists [slot]) ;
+    Uint32            first = startPhys - obj->physAddr ;
+    Uint32            i ;
+
+    for (i = 1u ; i < count ; i++) {
+        *((Uint32 *) (obj->usrBase + first + ((i - 1u) * list->stride))) =
+                                                first + (i * list->stride) ;
+    }
+
+    SMAPOOL_newExtent (obj->ctrl, slot, startPhys, count, SMAPOOL_EXTLIVE) ;
+    __sync_add_and_fetch (&list->counts, SMAPOOL_TOTALS (count)) ;
+    SMAPOOL_push (obj,
+                  list,
+                  first,
+                  first + ((count - 1u) * list->stride),
+                  count,
+                  retries) ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_shrink
+ *
+ *  @desc   Marks buffers of a class as retiring, whole extents first, from
+ *          the last extent slot down, and then the tail of an extent split
+ *          off as an extent of its own.
+ *
+ *  @arg    ctrl
+ *              Control structure of the pool.
+ *  @arg    slot
+ *              Slot of the class.
+ *  @arg    count
+ *              Number of buffers to retire.
+ *
+ *  @ret    None
+ *
+ *  @enter  Reconfigurations of the pool are serialized.
+ *          The class has at least count buffers in live extents.
+ *          An extent slot is available.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_drain
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_shrink (IN SMAPOOL_Ctrl * ctrl, IN Uint32 slot, IN Uint32 count)
+{
+    SMAPOOL_BufList * list = &(ctrl->lists [slot]) ;
+    SMAPOOL_Extent *  ext ;
+    Uint32            tail ;
+    Uint32            i ;
+
+    for (i = ctrl->numExtents ; (i > 0u) && (count != 0u) ; i--) {
+        ext = &(ctrl->extents [i - 1u]) ;
+        if ((ext->state == SMAPOOL_EXTLIVE) && (ext->list == slot)) {
+            if (ext->numBuffers <= count) {
+                count -= ext->numBuffers ;
+                __sync_add_and_fetch (&list->retiring, ext->numBuffers) ;
+                ext->state = SMAPOOL_EXTRETIRING ;
+            }
+            else {
+                /* Until the live extent is cut, it covers the tail too, and
+                 * a buffer of the tail freed meanwhile goes to the free
+                 * list, to be retired when it is popped or drained.
+                 */
+                tail = ext->endPhys - (count * list->stride) ;
+                __sync_add_and_fetch (&list->retiring, count) ;
+                SMAPOOL_newExtent (ctrl,
+                                   slot,
+                                   tail,
+                                   count,
+                                   SMAPOOL_EXTRETIRING) ;
+                __sync_add_and_fetch (&ext->version, 1u) ;
+                ext->endPhys     = tail ;
+                ext->numBuffers -= count ;
+                __sync_add_and_fetch (&ext->version, 1u) ;
+                count            = 0u ;
+            }
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_publish
+ *
+ *  @desc   Fills an order with classes sorted by size and builds its
+ *          availability map.
+ *
+ *  @arg    ctrl
+ *              Control structure of the pool.
+ *  @arg    index
+ *              Index of the order, the one not in use.
+ *  @arg    slots
+ *              Slots of the classes, by increasing buffer size.
+ *  @arg    numBufPools
+ *              Number of classes.
+ *
+ *  @ret    None
+ *
+ *  @enter  Reconfigurations of the pool are serialized.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_apply
+ *  ============================================================================
+ */
+STATIC
+Void
+SMAPOOL_publish (IN SMAPOOL_Ctrl * ctrl,
+                 IN Uint32         index,
+                 IN Uint32 *       slots,
+                 IN Uint32         numBufPools)
+{
+    SMAPOOL_Order * order = &(ctrl->orders [index]) ;
+    Uint32          bits  = 0u ;
+    Uint32          avail ;
+    Uint32          prev ;
+    Uint32          i ;
+
+    for (i = 0u ; i < MAX_SMABUFENTRIES ; i++) {
+        ctrl->lists [i].orderBits [index] = 0u ;
+    }
+    for (i = 0u ; i < numBufPools ; i++) {
+        order->lists [i] = slots [i] ;
+        order->sizes [i] = ctrl->lists [slots [i]].size ;
+        ctrl->lists [slots [i]].orderBits [index] = 1u << i ;
+    }
+    order->numBufPools = numBufPools ;
+    __sync_synchronize () ;
+
+    /* A free making a class non-empty after its list is read here finds the
+     * bit set above and marks the class itself.
+     */
+    for (i = 0u ; i < numBufPools ; i++) {
+        if (SMAPOOL_HEADOFS (ctrl->lists [slots [i]].freeHead) != 0u) {
+            bits |= 1u << i ;
+        }
+    }
+
+    /* Bits left by the previous use of the order only cost a failed pop.
+     * The new generation stops allocations that read the previous one from
+     * clearing bits of the new classes.
+     */
+    avail = order->avail ;
+    do {
+        prev  = avail ;
+        avail = __sync_val_compare_and_swap (
+                        &order->avail,
+                        prev,
+                          ((ctrl->current + 1u) << 16u)
+                        | bits
+                        | (prev & ((1u << numBufPools) - 1u))) ;
+    } while (avail != prev) ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_apply
+ *
+ *  @desc   Brings the classes of the pool to the attributes given. A class
+ *          of the pool is kept for every size in the attributes, grown or
+ *          shrunk to the number of buffers given, and the remaining classes
+ *          are retired. Nothing is changed unless all the new buffers fit.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    attrs
+ *              Attributes of the pool.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid attributes.
+ *          DSP_EMEMORY
+ *              The new buffers do not fit in the space of the region that is
+ *              not used by buffers or retiring buffers.
+ *          DSP_ERESOURCE
+ *              No class or extent slot is left for the change, for instance
+ *              because classes removed earlier have buffers still in use.
+ *
+ *  @enter  Reconfigurations of the pool are serialized.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_open, SMAPOOL_reconfigure
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_apply (IN SMAPOOL_Object * obj, IN SMAPOOL_Attrs * attrs)
+{
+    DSP_STATUS        status   = DSP_SOK ;
+    SMAPOOL_Ctrl *    ctrl     = obj->ctrl ;
+    Uint32            retries  = 0u ;
+    Uint32            numNew   = 0u ;
+    Uint32            numExt   = 0u ;
+    Uint32            numFree  = 0u ;
+    Bool              matched [MAX_SMABUFENTRIES] ;
+    Uint32            target  [MAX_SMABUFENTRIES] ;
+    Uint32            live    [MAX_SMABUFENTRIES] ;
+    Uint32            bytes   [MAX_SMABUFENTRIES] ;
+    Uint32            start   [MAX_SMABUFENTRIES] ;
+    Uint32            sorted  [MAX_SMABUFENTRIES] ;
+    SMAPOOL_BufList * list ;
+    Uint32            stride ;
+    Uint32            i ;
+    Uint32            j ;
+
+    if (    (attrs == NULL)
+        ||  (attrs->numBufPools == 0u)
+        ||  (attrs->numBufPools > MAX_SMABUFENTRIES)
+        ||  (attrs->bufSizes == NULL)
+        ||  (attrs->numBuffers == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    for (i = 0u ; DSP_SUCCEEDED (status) && (i < MAX_SMABUFENTRIES) ; i++) {
+        matched [i] = FALSE ;
+        if (    (ctrl->lists [i].isLive == FALSE)
+            &&  (SMAPOOL_TOTALOF (ctrl->lists [i].counts) == 0u)) {
+            numFree++ ;
+        }
+    }
+
+    /* Match every size to a live class, and size the runs to add. */
+    for (i = 0u ; DSP_SUCCEEDED (status) && (i < attrs->numBufPools) ; i++) {
+        target [i] = SMAPOOL_NOLIST ;
+        live [i]   = 0u ;
+        bytes [i]  = 0u ;
+        if (attrs->bufSizes [i] == 0u) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        for (j = 0u ;
+             DSP_SUCCEEDED (status) && (j < MAX_SMABUFENTRIES) ;
+             j++) {
+            if (    (ctrl->lists [j].isLive == TRUE)
+                &&  (matched [j] == FALSE)
+                &&  (ctrl->lists [j].size == attrs->bufSizes [i])) {
+                matched [j] = TRUE ;
+                target [i]  = j ;
+                live [i]    = SMAPOOL_liveBuffers (ctrl, j) ;
+                break ;
+            }
+        }
+
+        stride = SMAPOOL_ALIGN (attrs->bufSizes [i]) ;
+        if (    DSP_SUCCEEDED (status)
+            &&  (attrs->numBuffers [i] > live [i])) {
+            if ((attrs->numBuffers [i] - live [i]) > (obj->size / stride)) {
+                status = DSP_EMEMORY ;
+                SET_FAILURE_REASON ;
+            }
+            else {
+                bytes [i] = (attrs->numBuffers [i] - live [i]) * stride ;
+                numExt++ ;
+            }
+        }
+        else if (attrs->numBuffers [i] < live [i]) {
+            numExt++ ;
+        }
+
+        if (target [i] == SMAPOOL_NOLIST) {
+            numNew++ ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        if (    (numNew > numFree)
+            ||  (numExt > SMAPOOL_freeExtents (ctrl))) {
+            status = DSP_ERESOURCE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            status = SMAPOOL_place (obj, bytes, attrs->numBufPools, start) ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        for (i = 0u ; i < attrs->numBufPools ; i++) {
+            if (target [i] == SMAPOOL_NOLIST) {
+                for (j = 0u ; j < MAX_SMABUFENTRIES ; j++) {
+                    list = &(ctrl->lists [j]) ;
+                    if (    (list->isLive == FALSE)
+                        &&  (SMAPOOL_TOTALOF (list->counts) == 0u)) {
+                        break ;
+                    }
+                }
+                list->size     = attrs->bufSizes [i] ;
+                list->stride   = SMAPOOL_ALIGN (list->size) ;
+                list->maxUsed  = 0u ;
+                list->retiring = 0u ;
+                list->isLive   = TRUE ;
+                matched [j]    = TRUE ;
+                target [i]     = j ;
+            }
+
+            if (bytes [i] != 0u) {
+                SMAPOOL_grow (obj,
+                              target [i],
+                              start [i],
+                              attrs->numBuffers [i] - live [i],
+                              &retries) ;
+            }
+            else if (attrs->numBuffers [i] < live [i]) {
+                SMAPOOL_shrink (ctrl,
+                                target [i],
+                                live [i] - attrs->numBuffers [i]) ;
+            }
+        }
+
+        /* Classes left out are retired with all their buffers. */
+        for (j = 0u ; j < MAX_SMABUFENTRIES ; j++) {
+            list = &(ctrl->lists [j]) ;
+            if ((list->isLive == TRUE) && (matched [j] == FALSE)) {
+                SMAPOOL_shrink (ctrl, j, SMAPOOL_liveBuffers (ctrl, j)) ;
+                list->isLive = FALSE ;
+            }
+        }
+
+        for (i = 0u ; i < attrs->numBufPools ; i++) {
+            for (j = i ;
+                 (j > 0u) && (   ctrl->lists [sorted [j - 1u]].size
+                              >  ctrl->lists [target [i]].size) ;
+                 j--) {
+                sorted [j] = sorted [j - 1u] ;
+            }
+            sorted [j] = target [i] ;
+        }
+
+        SMAPOOL_publish (ctrl,
+                         (ctrl->current + 1u) & 1u,
+                         sorted,
+                         attrs->numBufPools) ;
+        ctrl->exactMatchReq = attrs->exactMatchReq ;
+        __sync_add_and_fetch (&ctrl->current, 1u) ;
+
+        for (j = 0u ; j < MAX_SMABUFENTRIES ; j++) {
+            if (ctrl->lists [j].retiring != 0u) {
+                SMAPOOL_drain (obj, &(ctrl->lists [j]), &retries) ;
+            }
+        }
+    }
+
+#if defined (DDSP_PROFILE)
+    if (retries != 0u) {
+        __sync_add_and_fetch (&ctrl->conflicts, retries) ;
+    }
+#endif /* if defined (DDSP_PROFILE) */
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   SMAPOOL_init
+ *
+ *  @desc   Initializes the SMAPOOL in the calling process.
+ *
+ *  @modif  SMAPOOL_objects
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SMAPOOL_init (IN  ProcessorId dspId,
+              IN  Uint32      poolId,
+              OUT Uint32 *    shDspAddr,
+              OUT Pvoid *     object)
+{
+    DSP_STATUS       status ;
+    SMAPOOL_Object * obj ;
+
+    TRC_4ENTER ("SMAPOOL_init", dspId, poolId, shDspAddr, object) ;
+
+    DBC_Require (IS_VALID_PROCID (dspId)) ;
+    DBC_Require (poolId < MAX_POOLENTRIES) ;
+    DBC_Require (shDspAddr != NULL) ;
+    DBC_Require (object != NULL) ;
+
+    obj    = &(SMAPOOL_objects [dspId][poolId]) ;
+    status = LDRV_POOL_getRegion (dspId, poolId, &obj->physAddr, &obj->size) ;
+    if (DSP_SUCCEEDED (status)) {
+        obj->usrBase = (Uint8 *) LDRV_phyToUsr (dspId, obj->physAddr) ;
+        if (    (obj->usrBase == NULL)
+            ||  (obj->size < SMAPOOL_ALIGN (sizeof (SMAPOOL_Ctrl)))) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            obj->ctrl  = (SMAPOOL_Ctrl *) obj->usrBase ;
+            *shDspAddr = LDRV_phyToDsp (dspId, obj->physAddr) ;
+            *object    = obj ;
+            obj->xltBase [AddrType_Usr] = (unsigned long) obj->usrBase ;
+            obj->xltBase [AddrType_Knl] = (unsigned long) obj->usrBase ;
+            obj->xltBase [AddrType_Phy] = obj->physAddr ;
+            obj->xltBase [AddrType_Dsp] = *shDspAddr ;
+            obj->pageSize = LDRV_pageSize (dspId, obj->physAddr) ;
+        }
+    }
+
+    TRC_1LEAVE ("SMAPOOL_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   SMAPOOL_exit
+ *
+ *  @desc   Finalizes the SMAPOOL in the calling process.
+ *
+ *  @modif  SMAPOOL_objects
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SMAPOOL_exit (IN ProcessorId dspId,
+              IN Uint32      poolId,
+              IN Void *      object)
+{
+    SMAPOOL_Object * obj = (SMAPOOL_Object *) object ;
+
+    TRC_3ENTER ("SMAPOOL_exit", dspId, poolId, object) ;
+
+    if (obj != NULL) {
+        obj->ctrl    = NULL ;
+        obj->usrBase = NULL ;
+    }
+
+    TRC_1LEAVE ("SMAPOOL_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_open
+ *
+ *  @desc   Lays out the buffers of the pool as described by its attributes.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    poolOpenParams
+ *              Open parameters, params points to the SMAPOOL_Attrs.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid attributes.
+ *          DSP_EMEMORY
+ *              The buffers do not fit in the region of the pool.
+ *
+ *  @enter  The pool is not open.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_close
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_open (IN  ProcessorId       dspId,
+              IN  Uint32            poolId,
+              IN  Void *            object,
+              IN  POOL_OpenParams * poolOpenParams)
+{
+    DSP_STATUS       status ;
+    SMAPOOL_Object * obj  = (SMAPOOL_Object *) object ;
+    SMAPOOL_Ctrl *   ctrl = obj->ctrl ;
+
+    TRC_4ENTER ("SMAPOOL_open", dspId, poolId, object, poolOpenParams) ;
+
+    DBC_Require (poolOpenParams != NULL) ;
+
+    /* An empty pool reconfigured to its attributes. */
+    memset (ctrl, 0, sizeof (SMAPOOL_Ctrl)) ;
+    status = SMAPOOL_apply (obj, (SMAPOOL_Attrs *) poolOpenParams->params) ;
+    if (DSP_SUCCEEDED (status)) {
+        ctrl->isOpen = TRUE ;
+    }
+
+    TRC_1LEAVE ("SMAPOOL_open", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_close
+ *
+ *  @desc   Releases the pool.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  The pool is open.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_open
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_close (IN  ProcessorId dspId,
+               IN  Uint32      poolId,
+               IN  Void *      object)
+{
+    SMAPOOL_Ctrl * ctrl = ((SMAPOOL_Object *) object)->ctrl ;
+
+    TRC_3ENTER ("SMAPOOL_close", dspId, poolId, object) ;
+
+    ctrl->isOpen = FALSE ;
+
+    TRC_1LEAVE ("SMAPOOL_close", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_alloc
+ *
+ *  @desc   Allocates a buffer from the first class that fits the size, or
+ *          from the class of exactly that size if exact match is required.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    bufPtr
+ *              Location to receive the address of the buffer.
+ *  @arg    size
+ *              Size of the buffer.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              No buffer is available.
+ *
+ *  @enter  The pool is open.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_free
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_alloc (IN  ProcessorId       dspId,
+               IN  Uint32            poolId,
+               IN  Void *            object,
+               OUT Pvoid *           bufPtr,
+               IN  Uint32            size)
+{
+    DSP_STATUS        status  = DSP_EMEMORY ;
+    SMAPOOL_Object *  obj     = (SMAPOOL_Object *) object ;
+    Uint32            retries = 0u ;
+    SMAPOOL_BufList * list ;
+
+    (Void) dspId ;
+    (Void) poolId ;
+
+    *bufPtr = SMAPOOL_take (obj, size, &list, &retries) ;
+    if (*bufPtr != NULL) {
+        status = DSP_SOK ;
+    }
+
+#if defined (DDSP_PROFILE)
+    SMAPOOL_count (obj->ctrl, retries) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_allocv
+ *
+ *  @desc   Allocates several buffers of the same size from one class. Beyond
+ *          the first buffer, at most half of the free buffers of the class
+ *          are handed out, so that a bulk caller cannot starve the others.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    bufArray
+ *              Location to receive the addresses of the buffers.
+ *  @arg    size
+ *              Size of the buffers.
+ *  @arg    numBufs
+ *              Number of buffers requested.
+ *  @arg    numAlloc
+ *              Location to receive the number of buffers allocated.
+ *
+ *  @ret    DSP_SOK
+ *              At least one buffer has been allocated.
+ *          DSP_EMEMORY
+ *              No buffer is available.
+ *
+ *  @enter  The pool is open.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_freev
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_allocv (IN  ProcessorId       dspId,
+                IN  Uint32            poolId,
+                IN  Void *            object,
+                OUT Pvoid *           bufArray,
+                IN  Uint32            size,
+                IN  Uint32            numBufs,
+                OUT Uint32 *          numAlloc)
+{
+    DSP_STATUS        status  = DSP_EMEMORY ;
+    SMAPOOL_Object *  obj     = (SMAPOOL_Object *) object ;
+    Uint32            retries = 0u ;
+    SMAPOOL_BufList * list ;
+    Uint32            limit ;
+
+    (Void) dspId ;
+    (Void) poolId ;
+
+    *numAlloc    = 0u ;
+    bufArray [0] = SMAPOOL_take (obj, size, &list, &retries) ;
+    if (bufArray [0] != NULL) {
+        *numAlloc = 1u ;
+        /* Half of the free buffers the class had before the first pop. */
+        limit = (SMAPOOL_FREEOF (list->counts) + 1u) / 2u ;
+        if (limit > numBufs) {
+            limit = numBufs ;
+        }
+
+        while (*numAlloc < limit) {
+            bufArray [*numAlloc] = SMAPOOL_popLive (obj,
+                                                    list,
+                                                    size,
+                                                    &retries) ;
+            if (bufArray [*numAlloc] == NULL) {
+                limit = *numAlloc ;
+            }
+            else {
+                (*numAlloc)++ ;
+            }
+        }
+        status = DSP_SOK ;
+    }
+
+#if defined (DDSP_PROFILE)
+    SMAPOOL_count (obj->ctrl, retries) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_free
+ *
+ *  @desc   Returns a buffer to its class.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    buf
+ *              Address of the buffer.
+ *  @arg    size
+ *              Size of the buffer.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The buffer does not belong to the pool.
+ *
+ *  @enter  The pool is open.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_alloc
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_free (IN  ProcessorId       dspId,
+              IN  Uint32            poolId,
+              IN  Void *            object,
+              IN  Void *            buf,
+              IN  Uint32            size)
+{
+    DSP_STATUS       status ;
+    SMAPOOL_Object * obj     = (SMAPOOL_Object *) object ;
+    Uint32           retries = 0u ;
+
+    (Void) dspId ;
+    (Void) poolId ;
+
+    status = SMAPOOL_give (obj, buf, size, &retries) ;
+
+#if defined (DDSP_PROFILE)
+    SMAPOOL_count (obj->ctrl, retries) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_freev
+ *
+ *  @desc   Returns several buffers to their classes.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    bufArray
+ *              Addresses of the buffers.
+ *  @arg    size
+ *              Size of the buffers.
+ *  @arg    numBufs
+ *              Number of buffers.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              A buffer does not belong to the pool. The other buffers have
+ *              been freed.
+ *
+ *  @enter  The pool is open.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_allocv
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_freev (IN  ProcessorId       dspId,
+               IN  Uint32            poolId,
+               IN  Void *            object,
+               IN  Pvoid *           bufArray,
+               IN  Uint32            size,
+               IN  Uint32            numBufs)
+{
+    DSP_STATUS       status  = DSP_SOK ;
+    SMAPOOL_Object * obj     = (SMAPOOL_Object *) object ;
+    Uint32           retries = 0u ;
+    DSP_STATUS       tmpStatus ;
+    Uint32           i ;
+
+    (Void) dspId ;
+    (Void) poolId ;
+
+    for (i = 0u ; i < numBufs ; i++) {
+        tmpStatus = SMAPOOL_give (obj, bufArray [i], size, &retries) ;
+        if (DSP_FAILED (tmpStatus)) {
+            status = tmpStatus ;
+        }
+    }
+
+#if defined (DDSP_PROFILE)
+    SMAPOOL_count (obj->ctrl, retries) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_numBufs
+ *
+ *  @desc   Returns the number of buffers, free or not, of the classes of the
+ *          smallest size serving a size.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    size
+ *              Size of the buffers.
+ *
+ *  @ret    Number of buffers, 0 if no class serves the size.
+ *
+ *  @enter  The pool is open.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_allocv
+ *  ============================================================================
+ */
+STATIC
+Uint32
+SMAPOOL_numBufs (IN  ProcessorId       dspId,
+                 IN  Uint32            poolId,
+                 IN  Void *            object,
+                 IN  Uint32            size)
+{
+    SMAPOOL_Object *  obj   = (SMAPOOL_Object *) object ;
+    SMAPOOL_Ctrl *    ctrl  = obj->ctrl ;
+    SMAPOOL_Order *   order = &(ctrl->orders [ctrl->current & 1u]) ;
+    Uint32            total = 0u ;
+    SMAPOOL_BufList * list ;
+    SMAPOOL_Count     counts ;
+    Uint32            first ;
+    Uint32            i ;
+
+    (Void) dspId ;
+    (Void) poolId ;
+
+    first = SMAPOOL_rank (order, size) ;
+    for (i = first ;
+            (i < order->numBufPools)
+         && (order->sizes [i] == order->sizes [first]) ;
+         i++) {
+        list   = &(ctrl->lists [order->lists [i]]) ;
+        /* The counts change under the other processes. */
+        counts = __sync_fetch_and_add (&list->counts, 0u) ;
+        total += SMAPOOL_TOTALOF (counts) ;
+    }
+
+    return total ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_reconfigure
+ *
+ *  @desc   Changes the classes of the open pool while it is in use. A class
+ *          is kept for every size in the new attributes and grown or shrunk
+ *          to its new number of buffers, classes of other sizes are removed,
+ *          and classes of new sizes are added. New buffers are taken from
+ *          the space of the region left free by the control structure and the
+ *          buffers. Buffers shrunk or removed are retired as they are freed,
+ *          or when they are found free, and their space can be used again
+ *          once all the buffers sharing their extent are retired.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    args
+ *              New SMAPOOL_Attrs of the pool.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid attributes.
+ *          DSP_EMEMORY
+ *              The new buffers do not fit in the free space of the region.
+ *          DSP_ERESOURCE
+ *              No class or extent slot is left for the change.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  Reconfigurations of the pool are serialized.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_apply
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_reconfigure (IN  ProcessorId       dspId,
+                     IN  Uint32            poolId,
+                     IN  Void *            object,
+                     IN  Pvoid             args)
+{
+    DSP_STATUS       status ;
+    SMAPOOL_Object * obj = (SMAPOOL_Object *) object ;
+
+    TRC_4ENTER ("SMAPOOL_reconfigure", dspId, poolId, object, args) ;
+
+    if (obj->ctrl->isOpen != TRUE) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = SMAPOOL_apply (obj, (SMAPOOL_Attrs *) args) ;
+    }
+
+    TRC_1LEAVE ("SMAPOOL_reconfigure", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_checkRange
+ *
+ *  @desc   Checks a range of the pool for cache maintenance. The host is cache
+ *          coherent with the emulated DSP, so there is nothing else to do.
+ *
+ *  @arg    obj
+ *              Pool object.
+ *  @arg    buf
+ *              Start of the range.
+ *  @arg    size
+ *              Size of the range.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ERANGE
+ *              The range is outside the pool.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_checkRange (IN SMAPOOL_Object * obj, IN Void * buf, IN Uint32 size)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    if (    ((Uint8 *) buf < obj->usrBase)
+        ||  ((Uint8 *) buf + size > obj->usrBase + obj->size)) {
+        status = DSP_ERANGE ;
+        SET_FAILURE_REASON ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_writeback
+ *
+ *  @desc   Writes back a range of the pool.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    buf
+ *              Start of the range.
+ *  @arg    size
+ *              Size of the range.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ERANGE
+ *              The range is outside the pool.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_invalidate
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_writeback (IN  ProcessorId       dspId,
+                   IN  Uint32            poolId,
+                   IN  Void *            object,
+                   IN  Void *            buf,
+                   IN  Uint32            size)
+{
+    (Void) dspId ;
+    (Void) poolId ;
+
+    return SMAPOOL_checkRange ((SMAPOOL_Object *) object, buf, size) ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_invalidate
+ *
+ *  @desc   Invalidates a range of the pool.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    buf
+ *              Start of the range.
+ *  @arg    size
+ *              Size of the range.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ERANGE
+ *              The range is outside the pool.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_writeback
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_invalidate (IN  ProcessorId       dspId,
+                    IN  Uint32            poolId,
+                    IN  Void *            object,
+                    IN  Void *            buf,
+                    IN  Uint32            size)
+{
+    (Void) dspId ;
+    (Void) poolId ;
+
+    return SMAPOOL_checkRange ((SMAPOOL_Object *) object, buf, size) ;
+}
+
+
+/*  ============================================================================
+ *  @func   SMAPOOL_xltBuf
+ *
+ *  @desc   Translates the address of a buffer of the pool in constant time,
+ *          as an offset between the bases of the region of the pool in the
+ *          two address spaces. User and kernel addresses are the same on the
+ *          host.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *  @arg    buf
+ *              Address to be translated.
+ *  @arg    cBuf
+ *              Location to receive the translated address.
+ *  @arg    xltFlag
+ *              Translation to be done.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ETRANSLATE
+ *              The address is outside the pool.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+SMAPOOL_xltBuf (IN  ProcessorId       dspId,
+                IN  Uint32            poolId,
+                IN  Void *            object,
+                IN  Void *            buf,
+                OUT Pvoid *           cBuf,
+                IN  POOL_AddrXltFlag  xltFlag)
+{
+    DSP_STATUS       status  = DSP_SOK ;
+    SMAPOOL_Object * obj     = (SMAPOOL_Object *) object ;
+    Uint32           srcType = (Uint32) xltFlag & 0xFFu ;
+    Uint32           dstType = (Uint32) xltFlag >> 8u ;
+    unsigned long    offset  ;
+
+    (Void) dspId ;
+    (Void) poolId ;
+
+    if ((srcType >= SMAPOOL_ADDRTYPES) || (dstType >= SMAPOOL_ADDRTYPES)) {
+        status = DSP_ETRANSLATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        /* Unsigned, so an address below the region is out of range too. */
+        offset = (unsigned long) buf - obj->xltBase [srcType] ;
+        if (offset >= obj->size) {
+            status = DSP_ETRANSLATE ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            *cBuf = (Pvoid) (obj->xltBase [dstType] + offset) ;
+        }
+    }
+
+    return status ;
+}
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   SMAPOOL_instrument
+ *
+ *  @desc   Gets the instrumentation information of the SMAPOOL.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SMAPOOL_instrument (IN Void * object, OUT SMAPOOL_Stats * retVal)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    SMAPOOL_Object *  obj    = (SMAPOOL_Object *) object ;
+    SMAPOOL_Ctrl *    ctrl   = obj->ctrl ;
+    SMAPOOL_Order *   order ;
+    SMAPOOL_BufList * list ;
+    SMAPOOL_Count     counts ;
+    Uint32            i ;
+
+    DBC_Require (retVal != NULL) ;
+
+    if (ctrl->isOpen != TRUE) {
+        status = DSP_EWRONGSTATE ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        memset (retVal, 0, sizeof (SMAPOOL_Stats)) ;
+        order = &(ctrl->orders [ctrl->current & 1u]) ;
+        for (i = 0u ; i < order->numBufPools ; i++) {
+            list   = &(ctrl->lists [order->lists [i]]) ;
+            counts = __sync_fetch_and_add (&list->counts, 0u) ;
+            retVal->mpBufStats [i].size         = (Uint16) list->size ;
+            retVal->mpBufStats [i].totalBuffers =
+                                        (Uint16) SMAPOOL_TOTALOF (counts) ;
+            retVal->mpBufStats [i].freeBuffers  =
+                                        (Uint16) SMAPOOL_FREEOF (counts) ;
+            retVal->mpBufStats [i].maxUsed      = (Uint16) list->maxUsed ;
+        }
+        retVal->bufHandleCount = (Uint16) order->numBufPools ;
+        retVal->conflicts      = ctrl->conflicts ;
+        retVal->numCalls       = ctrl->numCalls ;
+        retVal->pageSize       = obj->pageSize ;
+    }
+
+    return status ;
+}
+#endif /* if defined (DDSP_PROFILE) */
+
+
+/** ============================================================================
+ *  @name   SMAPOOL_Interface
+ *
+ *  @desc   Interface of the SMAPOOL.
+ *  ============================================================================
+ */
+POOL_Interface SMAPOOL_Interface = {
+    &SMAPOOL_open,
+    &SMAPOOL_close,
+    &SMAPOOL_alloc,
+    &SMAPOOL_free,
+    &SMAPOOL_reconfigure,
+    &SMAPOOL_writeback,
+    &SMAPOOL_invalidate,
+    &SMAPOOL_xltBuf,
+    &SMAPOOL_allocv,
+    &SMAPOOL_freev,
+    &SMAPOOL_numBufs
+} ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
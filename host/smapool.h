@@ -0,0 +1,179 @@
+/** ============================================================================
+ *  @file   smapool.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the shared memory allocator pool (SMAPOOL)
+ *          of the host backend.
+ *          The pool is carved out of its region of the POOL memory entry. The
+ *          control structure sits at the start of the region and is followed
+ *          by the buffers of every size class, each class keeping a lock-free
+ *          free list linked through the first word of the free buffers.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (SMAPOOL_H)
+#define SMAPOOL_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <pooldefs.h>
+#include <_pooldefs.h>
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @name   SMAPOOL_Interface
+ *
+ *  @desc   Interface of the SMAPOOL.
+ *  ============================================================================
+ */
+extern POOL_Interface SMAPOOL_Interface ;
+
+
+/** ============================================================================
+ *  @func   SMAPOOL_init
+ *
+ *  @desc   Initializes the SMAPOOL in the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    shDspAddr
+ *              Location to receive the DSP address of the control structure.
+ *  @arg    object
+ *              Location to receive the pool object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              The region of the pool is not mapped.
+ *
+ *  @enter  The region of the pool has been assigned.
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SMAPOOL_init (IN  ProcessorId dspId,
+              IN  Uint32      poolId,
+              OUT Uint32 *    shDspAddr,
+              OUT Pvoid *     object) ;
+
+
+/** ============================================================================
+ *  @func   SMAPOOL_exit
+ *
+ *  @desc   Finalizes the SMAPOOL in the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    poolId
+ *              Pool number.
+ *  @arg    object
+ *              Pool object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    SMAPOOL_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SMAPOOL_exit (IN ProcessorId dspId,
+              IN Uint32      poolId,
+              IN Void *      object) ;
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   SMAPOOL_instrument
+ *
+ *  @desc   Gets the instrumentation information of the SMAPOOL.
+ *
+ *  @arg    object
+ *              Pool object.
+ *  @arg    retVal
+ *              Location to receive the instrumentation information.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SMAPOOL_instrument (IN Void * object, OUT SMAPOOL_Stats * retVal) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (SMAPOOL_H) */
@@ -0,0 +1,641 @@
+/** ============================================================================
+ *  @file   sync_host.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the process-shared synchronization objects used
+ *          by the host loopback backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_bitops.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @const  SYNC_HOST_MAXPOLLFDS
+ *
+ *  @desc   Bound on the file descriptors usable as pollable descriptors.
+ *  ============================================================================
+ */
+#define SYNC_HOST_MAXPOLLFDS    4096u
+
+
+/*  ============================================================================
+ *  @name   SYNC_HOST_pollFds
+ *
+ *  @desc   Bitmap of the pollable descriptors open in the calling process.
+ *          A raise received from another process may name a descriptor that
+ *          has been closed meanwhile and whose number has been reused; only
+ *          the descriptors in the bitmap are written to.
+ *  ============================================================================
+ */
+STATIC Uint32 SYNC_HOST_pollFds [SYNC_HOST_MAXPOLLFDS / 32u] ;
+
+/*  ============================================================================
+ *  @name   SYNC_HOST_pollLock
+ *
+ *  @desc   Protects SYNC_HOST_pollFds, and orders the raises of a descriptor
+ *          before its close.
+ *  ============================================================================
+ */
+STATIC pthread_mutex_t SYNC_HOST_pollLock = PTHREAD_MUTEX_INITIALIZER ;
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_createLock
+ *
+ *  @desc   Initializes a process-shared lock in place.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_createLock (IN SYNC_HostLock * lock)
+{
+    DSP_STATUS          status = DSP_SOK ;
+    pthread_mutexattr_t attr ;
+
+    DBC_Require (lock != NULL) ;
+
+    pthread_mutexattr_init (&attr) ;
+    pthread_mutexattr_setpshared (&attr, PTHREAD_PROCESS_SHARED) ;
+    if (pthread_mutex_init (&lock->mutex, &attr) != 0) {
+        status = DSP_EFAIL ;
+    }
+    pthread_mutexattr_destroy (&attr) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deleteLock
+ *
+ *  @desc   Finalizes a process-shared lock.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_deleteLock (IN SYNC_HostLock * lock)
+{
+    DBC_Require (lock != NULL) ;
+
+    pthread_mutex_destroy (&lock->mutex) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_enter
+ *
+ *  @desc   Acquires a process-shared lock.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_enter (IN SYNC_HostLock * lock)
+{
+    DBC_Require (lock != NULL) ;
+
+    pthread_mutex_lock (&lock->mutex) ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_tryEnter
+ *
+ *  @desc   Attempts to acquire a process-shared lock without blocking.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+SYNC_HOST_tryEnter (IN SYNC_HostLock * lock)
+{
+    DBC_Require (lock != NULL) ;
+
+    return (pthread_mutex_trylock (&lock->mutex) == 0) ? TRUE : FALSE ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_leave
+ *
+ *  @desc   Releases a process-shared lock.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_leave (IN SYNC_HostLock * lock)
+{
+    DBC_Require (lock != NULL) ;
+
+    pthread_mutex_unlock (&lock->mutex) ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_createCond
+ *
+ *  @desc   Initializes a process-shared condition in place.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_createCond (IN SYNC_HostCond * cond)
+{
+    DSP_STATUS         status = DSP_SOK ;
+    pthread_condattr_t attr ;
+
+    DBC_Require (cond != NULL) ;
+
+    pthread_condattr_init (&attr) ;
+    pthread_condattr_setpshared (&attr, PTHREAD_PROCESS_SHARED) ;
+    pthread_condattr_setclock (&attr, CLOCK_MONOTONIC) ;
+    if (pthread_cond_init (&cond->cond, &attr) != 0) {
+        status = DSP_EFAIL ;
+    }
+    pthread_condattr_destroy (&attr) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deleteCond
+ *
+ *  @desc   Finalizes a process-shared condition.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_deleteCond (IN SYNC_HostCond * cond)
+{
+    DBC_Require (cond != NULL) ;
+
+    pthread_cond_destroy (&cond->cond) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deadline
+ *
+ *  @desc   Converts a relative timeout in milliseconds to an absolute
+ *          CLOCK_MONOTONIC deadline.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_deadline (IN Uint32 timeout, OUT struct timespec * deadline)
+{
+    DBC_Require (deadline != NULL) ;
+    DBC_Require (timeout != WAIT_FOREVER) ;
+
+    clock_gettime (CLOCK_MONOTONIC, deadline) ;
+    deadline->tv_sec  += timeout / 1000u ;
+    deadline->tv_nsec += (long) (timeout % 1000u) * 1000000L ;
+    if (deadline->tv_nsec >= 1000000000L) {
+        deadline->tv_sec  += 1 ;
+        deadline->tv_nsec -= 1000000000L ;
+    }
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_usecs
+ *
+ *  @desc   Returns the CLOCK_MONOTONIC time in microseconds, modulo 2^32.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Uint32
+SYNC_HOST_usecs (Void)
+{
+    struct timespec now ;
+
+    clock_gettime (CLOCK_MONOTONIC, &now) ;
+
+    return   ((Uint32) now.tv_sec * 1000000u)
+           + ((Uint32) now.tv_nsec / 1000u) ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_ticks
+ *
+ *  @desc   Returns the CLOCK_MONOTONIC time in ticks of SYNC_HOST_TICKNS
+ *          nanoseconds.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+SYNC_HostTicks
+SYNC_HOST_ticks (Void)
+{
+    struct timespec now ;
+
+    clock_gettime (CLOCK_MONOTONIC, &now) ;
+
+    return   ((SYNC_HostTicks) now.tv_sec * (1000000000u / SYNC_HOST_TICKNS))
+           + ((SYNC_HostTicks) now.tv_nsec / SYNC_HOST_TICKNS) ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_waitUntil
+ *
+ *  @desc   Waits on a condition until an absolute CLOCK_MONOTONIC deadline.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_waitUntil (IN     SYNC_HostCond *         cond,
+                     IN     SYNC_HostLock *         lock,
+                     IN OPT const struct timespec * deadline)
+{
+    DSP_STATUS status = DSP_SOK ;
+    int        osStatus ;
+
+    DBC_Require (cond != NULL) ;
+    DBC_Require (lock != NULL) ;
+
+    if (deadline == NULL) {
+        pthread_cond_wait (&cond->cond, &lock->mutex) ;
+    }
+    else {
+        osStatus = pthread_cond_timedwait (&cond->cond,
+                                           &lock->mutex,
+                                           deadline) ;
+        if (osStatus == ETIMEDOUT) {
+            status = DSP_ETIMEOUT ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_wait
+ *
+ *  @desc   Waits on a condition with the associated lock held.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_wait (IN SYNC_HostCond * cond,
+                IN SYNC_HostLock * lock,
+                IN Uint32          timeout)
+{
+    DSP_STATUS      status = DSP_SOK ;
+    struct timespec deadline ;
+
+    DBC_Require (cond != NULL) ;
+    DBC_Require (lock != NULL) ;
+
+    if (timeout == WAIT_NONE) {
+        status = DSP_ENOTCOMPLETE ;
+    }
+    else if (timeout == WAIT_FOREVER) {
+        status = SYNC_HOST_waitUntil (cond, lock, NULL) ;
+    }
+    else {
+        SYNC_HOST_deadline (timeout, &deadline) ;
+        status = SYNC_HOST_waitUntil (cond, lock, &deadline) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_signal
+ *
+ *  @desc   Wakes up one waiter on a condition.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_signal (IN SYNC_HostCond * cond)
+{
+    DBC_Require (cond != NULL) ;
+
+    pthread_cond_signal (&cond->cond) ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_broadcast
+ *
+ *  @desc   Wakes up all waiters on a condition.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_broadcast (IN SYNC_HostCond * cond)
+{
+    DBC_Require (cond != NULL) ;
+
+    pthread_cond_broadcast (&cond->cond) ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_createEvent
+ *
+ *  @desc   Initializes a process-shared counting event in place.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_createEvent (IN SYNC_HostEvent * event)
+{
+    DSP_STATUS status ;
+
+    DBC_Require (event != NULL) ;
+
+    event->count = 0u ;
+    status = SYNC_HOST_createLock (&event->lock) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = SYNC_HOST_createCond (&event->cond) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deleteEvent
+ *
+ *  @desc   Finalizes a process-shared counting event.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_deleteEvent (IN SYNC_HostEvent * event)
+{
+    DBC_Require (event != NULL) ;
+
+    SYNC_HOST_deleteCond (&event->cond) ;
+    SYNC_HOST_deleteLock (&event->lock) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_post
+ *
+ *  @desc   Posts a counting event, waking up one waiter.
+ *
+ *  @modif  event->count
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_post (IN SYNC_HostEvent * event)
+{
+    DBC_Require (event != NULL) ;
+
+    SYNC_HOST_enter (&event->lock) ;
+    event->count++ ;
+    SYNC_HOST_signal (&event->cond) ;
+    SYNC_HOST_leave (&event->lock) ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_pend
+ *
+ *  @desc   Waits for a counting event to be posted and consumes one post.
+ *
+ *  @modif  event->count
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_pend (IN SYNC_HostEvent * event, IN Uint32 timeout)
+{
+    DSP_STATUS        status = DSP_SOK ;
+    struct timespec   deadline ;
+    struct timespec * until  = NULL ;
+
+    DBC_Require (event != NULL) ;
+
+    if ((timeout != WAIT_FOREVER) && (timeout != WAIT_NONE)) {
+        SYNC_HOST_deadline (timeout, &deadline) ;
+        until = &deadline ;
+    }
+
+    SYNC_HOST_enter (&event->lock) ;
+    while ((event->count == 0u) && DSP_SUCCEEDED (status)) {
+        if (timeout == WAIT_NONE) {
+            status = DSP_ENOTCOMPLETE ;
+        }
+        else {
+            status = SYNC_HOST_waitUntil (&event->cond, &event->lock, until) ;
+        }
+    }
+    if (event->count != 0u) {
+        /* A post that raced with the timeout still counts. */
+        event->count-- ;
+        status = DSP_SOK ;
+    }
+    SYNC_HOST_leave (&event->lock) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_createPollFd
+ *
+ *  @desc   Creates a non-blocking eventfd of the calling process.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+SYNC_HOST_createPollFd (OUT Int32 * fd)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    DBC_Require (fd != NULL) ;
+
+    *fd = (Int32) eventfd (0u, EFD_NONBLOCK | EFD_CLOEXEC) ;
+    if (*fd < 0) {
+        status = (errno == ENOMEM) ? DSP_EMEMORY : DSP_ERESOURCE ;
+    }
+    else if ((Uint32) *fd >= SYNC_HOST_MAXPOLLFDS) {
+        close (*fd) ;
+        *fd    = -1 ;
+        status = DSP_ERESOURCE ;
+    }
+    else {
+        pthread_mutex_lock (&SYNC_HOST_pollLock) ;
+        SET_BIT (SYNC_HOST_pollFds [*fd / 32], *fd % 32) ;
+        pthread_mutex_unlock (&SYNC_HOST_pollLock) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_deletePollFd
+ *
+ *  @desc   Closes an eventfd created by SYNC_HOST_createPollFd.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_deletePollFd (IN Int32 fd)
+{
+    DBC_Require ((fd >= 0) && ((Uint32) fd < SYNC_HOST_MAXPOLLFDS)) ;
+
+    pthread_mutex_lock (&SYNC_HOST_pollLock) ;
+    CLEAR_BIT (SYNC_HOST_pollFds [fd / 32], fd % 32) ;
+    close (fd) ;
+    pthread_mutex_unlock (&SYNC_HOST_pollLock) ;
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_raisePollFd
+ *
+ *  @desc   Makes an eventfd readable, if it is still open.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_raisePollFd (IN Int32 fd)
+{
+    if ((fd >= 0) && ((Uint32) fd < SYNC_HOST_MAXPOLLFDS)) {
+        pthread_mutex_lock (&SYNC_HOST_pollLock) ;
+        if (TEST_BIT (SYNC_HOST_pollFds [fd / 32], fd % 32) != 0u) {
+            eventfd_write (fd, 1u) ;
+        }
+        pthread_mutex_unlock (&SYNC_HOST_pollLock) ;
+    }
+}
+
+
+/** ============================================================================
+ *  @func   SYNC_HOST_clearPollFd
+ *
+ *  @desc   Makes an eventfd unreadable again.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+SYNC_HOST_clearPollFd (IN Int32 fd)
+{
+    eventfd_t value ;
+
+    eventfd_read (fd, &value) ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,284 @@
+/** ============================================================================
+ *  @file   zcpydata.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the zero-copy data driver (ZCPYDATA) of the host
+ *          backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <ldrv.h>
+#include <ldrv_ips.h>
+#include <ldrv_chnl.h>
+#include <zcpydata.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_DATA_ZCPY, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @macro  ZCPYDATA_ARG
+ *
+ *  @desc   Argument of the callbacks of a data driver.
+ *  ============================================================================
+ */
+#define ZCPYDATA_ARG(dspId, dataDrvId)                                         \
+                    LDRV_UINT32_TO_PTR (((dspId) << 16u) | (dataDrvId))
+
+
+/*  ============================================================================
+ *  @func   ZCPYDATA_gppCallback
+ *
+ *  @desc   GPP side of the driver: wakes up the reclaimers of the channels
+ *          the DSP completed requests on.
+ *
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    arg
+ *              DSP identifier and index of the data driver.
+ *  @arg    info
+ *              Channel identifier.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYDATA_dspCallback
+ *  ============================================================================
+ */
+STATIC
+Void
+ZCPYDATA_gppCallback (IN Uint32 eventNo, IN Pvoid arg, IN Pvoid info)
+{
+    (Void) eventNo ;
+
+    LDRV_CHNL_complete ((ProcessorId) (LDRV_PTR_TO_UINT32 (arg) >> 16u),
+                        (ChannelId) LDRV_PTR_TO_UINT32 (info)) ;
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYDATA_dspCallback
+ *
+ *  @desc   DSP side of the driver: transfers the data of the loopback pair
+ *          of the channel and signals the completions to the GPP.
+ *
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    arg
+ *              DSP identifier and index of the data driver.
+ *  @arg    info
+ *              Channel identifier.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYDATA_gppCallback
+ *  ============================================================================
+ */
+STATIC
+Void
+ZCPYDATA_dspCallback (IN Uint32 eventNo, IN Pvoid arg, IN Pvoid info)
+{
+    ProcessorId dspId     = (ProcessorId) (LDRV_PTR_TO_UINT32 (arg) >> 16u) ;
+    Uint32      dataDrvId = LDRV_PTR_TO_UINT32 (arg) & 0xFFFFu ;
+    ChannelId   chnlId    = (ChannelId) LDRV_PTR_TO_UINT32 (info) ;
+
+    (Void) eventNo ;
+
+    if (LDRV_CHNL_dspTransfer (dspId, chnlId) == TRUE) {
+        ZCPYDATA_complete (dspId, dataDrvId, chnlId) ;
+    }
+}
+
+
+/** ============================================================================
+ *  @func   ZCPYDATA_init
+ *
+ *  @desc   Registers the GPP and DSP sides of the data driver of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+ZCPYDATA_init (IN ProcessorId dspId, IN Uint32 dataDrvId)
+{
+    DSP_STATUS        status ;
+    LINKCFG_DataDrv * dataDrv ;
+
+    TRC_2ENTER ("ZCPYDATA_init", dspId, dataDrvId) ;
+
+    dataDrv = &(LDRV_getDspConfig (dspId)->dataTable [dataDrvId]) ;
+    status  = LDRV_IPS_register (dspId,
+                                 dataDrv->ipsId,
+                                 dataDrv->ipsEventNo,
+                                 ZCPYDATA_gppCallback,
+                                 ZCPYDATA_ARG (dspId, dataDrvId)) ;
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_IPS_dspRegister (dspId,
+                                       dataDrv->ipsId,
+                                       dataDrv->ipsEventNo,
+                                       ZCPYDATA_dspCallback,
+                                       ZCPYDATA_ARG (dspId, dataDrvId)) ;
+    }
+
+    if (DSP_FAILED (status)) {
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("ZCPYDATA_init", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   ZCPYDATA_exit
+ *
+ *  @desc   Unregisters the data driver of a DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+ZCPYDATA_exit (IN ProcessorId dspId, IN Uint32 dataDrvId)
+{
+    LINKCFG_DataDrv * dataDrv ;
+
+    TRC_2ENTER ("ZCPYDATA_exit", dspId, dataDrvId) ;
+
+    dataDrv = &(LDRV_getDspConfig (dspId)->dataTable [dataDrvId]) ;
+    LDRV_IPS_dspRegister (dspId,
+                          dataDrv->ipsId,
+                          dataDrv->ipsEventNo,
+                          NULL,
+                          NULL) ;
+    LDRV_IPS_unregister (dspId, dataDrv->ipsId, dataDrv->ipsEventNo) ;
+
+    TRC_1LEAVE ("ZCPYDATA_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/** ============================================================================
+ *  @func   ZCPYDATA_request
+ *
+ *  @desc   Signals a new I/O request on a channel to the DSP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+ZCPYDATA_request (IN ProcessorId dspId,
+                  IN Uint32      dataDrvId,
+                  IN ChannelId   chnlId)
+{
+    LINKCFG_DataDrv * dataDrv ;
+
+    dataDrv = &(LDRV_getDspConfig (dspId)->dataTable [dataDrvId]) ;
+
+    return LDRV_IPS_notify (dspId, dataDrv->ipsId, dataDrv->ipsEventNo, chnlId) ;
+}
+
+
+/** ============================================================================
+ *  @func   ZCPYDATA_complete
+ *
+ *  @desc   Signals requests completed by the DSP on a channel to the GPP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+ZCPYDATA_complete (IN ProcessorId dspId,
+                   IN Uint32      dataDrvId,
+                   IN ChannelId   chnlId)
+{
+    LINKCFG_DataDrv * dataDrv ;
+
+    dataDrv = &(LDRV_getDspConfig (dspId)->dataTable [dataDrvId]) ;
+
+    return LDRV_IPS_raise (dspId, dataDrv->ipsId, dataDrv->ipsEventNo, chnlId) ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
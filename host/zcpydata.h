@@ -0,0 +1,199 @@
+/** ============================================================================
+ *  @file   zcpydata.h
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Defines the interface of the zero-copy data driver (ZCPYDATA) of
+ *          the host backend.
+ *          An I/O request issued on a channel is signalled to the DSP with
+ *          one IPS event carrying the channel identifier. The DSP side of
+ *          the driver loops every output channel back to the input channel
+ *          with the identifier differing in the lowest bit, and signals the
+ *          completions back to the GPP the same way.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (ZCPYDATA_H)
+#define ZCPYDATA_H
+
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  ZCPYDATA_NAME
+ *
+ *  @desc   Name of the data driver in the configuration.
+ *  ============================================================================
+ */
+#define ZCPYDATA_NAME           "ZCPYDATA"
+
+
+/** ============================================================================
+ *  @func   ZCPYDATA_init
+ *
+ *  @desc   Registers the GPP and DSP sides of the data driver of a DSP in
+ *          the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dataDrvId
+ *              Index of the data driver in the configuration.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid IPS event in the configuration.
+ *
+ *  @enter  LDRV_IPS_init has been successful.
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYDATA_exit
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+ZCPYDATA_init (IN ProcessorId dspId, IN Uint32 dataDrvId) ;
+
+
+/** ============================================================================
+ *  @func   ZCPYDATA_exit
+ *
+ *  @desc   Unregisters the data driver of a DSP in the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dataDrvId
+ *              Index of the data driver in the configuration.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYDATA_init
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+ZCPYDATA_exit (IN ProcessorId dspId, IN Uint32 dataDrvId) ;
+
+
+/** ============================================================================
+ *  @func   ZCPYDATA_request
+ *
+ *  @desc   Signals a new I/O request on a channel to the DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dataDrvId
+ *              Index of the data driver in the configuration.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EWRONGSTATE
+ *              The DSP is not running.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+ZCPYDATA_request (IN ProcessorId dspId,
+                  IN Uint32      dataDrvId,
+                  IN ChannelId   chnlId) ;
+
+
+/** ============================================================================
+ *  @func   ZCPYDATA_complete
+ *
+ *  @desc   Signals requests completed by the DSP on a channel to the GPP,
+ *          for completions happening outside the DSP side of the driver.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    dataDrvId
+ *              Index of the data driver in the configuration.
+ *  @arg    chnlId
+ *              Channel identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid IPS event in the configuration.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+ZCPYDATA_complete (IN ProcessorId dspId,
+                   IN Uint32      dataDrvId,
+                   IN ChannelId   chnlId) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (ZCPYDATA_H) */
@@ -0,0 +1,785 @@
+/** ============================================================================
+ *  @file   zcpymqt.c
+ *
+ *  @path   $(DSPLINK)/gpp/src/host/
+ *
+ *  @desc   Implementation of the zero-copy Message Queue Transport (ZCPYMQT)
+ *          of the host backend.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- OS Specific Headers         */
+#include <stdlib.h>
+#include <string.h>
+
+/*  ----------------------------------- DSP/BIOS Link               */
+#include <dsplink.h>
+#include <_dsplink.h>
+#include <msgqdefs.h>
+
+/*  ----------------------------------- Trace & Debug               */
+#include <_trace.h>
+#include <dbc.h>
+
+/*  ----------------------------------- Host backend                */
+#include <_sync_host.h>
+#include <ldrv.h>
+#include <ldrv_ips.h>
+#include <ldrv_pool.h>
+#include <ldrv_msgq.h>
+#include <zcpymqt.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @macro  SET_FAILURE_REASON
+ *
+ *  @desc   Sets failure reason.
+ *  ============================================================================
+ */
+#if defined (DDSP_DEBUG)
+#define SET_FAILURE_REASON  TRC_3PRINT (TRC_LEVEL7,                            \
+                                        "\nFailure: Status:[0x%x] File:[0x%x]" \
+                                        " Line:[%d]\n",                        \
+                                        status, FID_C_LDRV_MQT_ZCPY, __LINE__)
+#else
+#define SET_FAILURE_REASON
+#endif /* if defined (DDSP_DEBUG) */
+
+/*  ============================================================================
+ *  @const  ZCPYMQT_CTRLPAYLOAD
+ *
+ *  @desc   Payload of the events carrying a locate request or answer instead
+ *          of a message.
+ *  ============================================================================
+ */
+#define ZCPYMQT_CTRLPAYLOAD     0u
+
+
+/*  ============================================================================
+ *  @name   ZCPYMQT_Ctrl
+ *
+ *  @desc   Control structure of the transport, shared with the DSP.
+ *
+ *  @field  locateLock
+ *              Serializes the locates.
+ *  @field  lock
+ *              Protects the answer of a locate.
+ *  @field  cond
+ *              Signalled when a locate is answered.
+ *  @field  isOpen
+ *              TRUE while the transport is open.
+ *  @field  poolId
+ *              Pool given at open.
+ *  @field  locateSeq
+ *              Sequence number of the last locate request.
+ *  @field  answerSeq
+ *              Sequence number of the last locate answered by the GPP side.
+ *  @field  dspSeq
+ *              Sequence number of the last locate answered by the DSP side.
+ *  @field  locateStatus
+ *              Status of the last locate.
+ *  @field  locateQueue
+ *              Message queue found by the last locate.
+ *  @field  locateName
+ *              Name of the message queue to locate.
+ *  ============================================================================
+ */
+typedef struct ZCPYMQT_Ctrl_tag {
+    SYNC_HostLock  locateLock   ;
+    SYNC_HostLock  lock         ;
+    SYNC_HostCond  cond         ;
+    Uint32         isOpen       ;
+    Uint32         poolId       ;
+    Uint32         locateSeq    ;
+    Uint32         answerSeq    ;
+    Uint32         dspSeq       ;
+    Uint32         locateStatus ;
+    Uint32         locateQueue  ;
+    Char8          locateName [DSP_MAX_STRLEN] ;
+} ZCPYMQT_Ctrl ;
+
+/*  ============================================================================
+ *  @name   ZCPYMQT_Object
+ *
+ *  @desc   State of the transports in the driver segment.
+ *
+ *  @field  ctrlPhys
+ *              Physical address of the control structure of each DSP.
+ *  ============================================================================
+ */
+typedef struct ZCPYMQT_Object_tag {
+    Uint32  ctrlPhys [MAX_DSPS] ;
+} ZCPYMQT_Object ;
+
+
+/*  ============================================================================
+ *  @name   ZCPYMQT_ctrls
+ *
+ *  @desc   Control structure of each DSP in the calling process.
+ *  ============================================================================
+ */
+STATIC ZCPYMQT_Ctrl * ZCPYMQT_ctrls [MAX_DSPS] ;
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_gppCallback
+ *
+ *  @desc   Handles the events of the DSP side: messages for local queues and
+ *          locate answers.
+ *
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    arg
+ *              DSP identifier.
+ *  @arg    info
+ *              Physical address of the message, or ZCPYMQT_CTRLPAYLOAD.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYMQT_dspCallback
+ *  ============================================================================
+ */
+STATIC
+Void
+ZCPYMQT_gppCallback (IN Uint32 eventNo, IN Pvoid arg, IN Pvoid info)
+{
+    ProcessorId    dspId    = (ProcessorId) LDRV_PTR_TO_UINT32 (arg) ;
+    Uint32         physAddr = LDRV_PTR_TO_UINT32 (info) ;
+    ZCPYMQT_Ctrl * ctrl     = ZCPYMQT_ctrls [dspId] ;
+    MSGQ_Msg       msg ;
+
+    (Void) eventNo ;
+
+    if (physAddr == ZCPYMQT_CTRLPAYLOAD) {
+        SYNC_HOST_enter (&ctrl->lock) ;
+        ctrl->answerSeq = ctrl->dspSeq ;
+        SYNC_HOST_broadcast (&ctrl->cond) ;
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+    else {
+        msg = (MSGQ_Msg) LDRV_phyToUsr (dspId, physAddr) ;
+        if (msg != NULL) {
+            LDRV_MSGQ_deliver (msg) ;
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_dspQueue
+ *
+ *  @desc   Gets the number of a message queue of the DSP from its name.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    queueName
+ *              Name of the message queue.
+ *
+ *  @ret    Number of the message queue, MSGQ_INVALIDMSGQ if the DSP has no
+ *          message queue with that name.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+Uint32
+ZCPYMQT_dspQueue (IN ProcessorId dspId, IN Char8 * queueName)
+{
+    Uint32   id     = MSGQ_INVALIDMSGQ ;
+    Uint32   prefix = sizeof (ZCPYMQT_DSPQUEUEPREFIX) - 1u ;
+    Char8 *  end ;
+    Uint32   num ;
+
+    if (    (strncmp (queueName, ZCPYMQT_DSPQUEUEPREFIX, prefix) == 0)
+        &&  (queueName [prefix] >= '0')
+        &&  (queueName [prefix] <= '9')) {
+        num = (Uint32) strtoul (queueName + prefix, &end, 10) ;
+        if (    (*end == '\0')
+            &&  (num < LDRV_getDspConfig (dspId)->dspObject.arg1)) {
+            id = num ;
+        }
+    }
+
+    return id ;
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_dspCallback
+ *
+ *  @desc   DSP side of the transport. Answers the locates and sends the
+ *          messages put on a DSP queue back to their source queue.
+ *
+ *  @arg    eventNo
+ *              Event number.
+ *  @arg    arg
+ *              DSP identifier.
+ *  @arg    info
+ *              Physical address of the message, or ZCPYMQT_CTRLPAYLOAD.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYMQT_gppCallback
+ *  ============================================================================
+ */
+STATIC
+Void
+ZCPYMQT_dspCallback (IN Uint32 eventNo, IN Pvoid arg, IN Pvoid info)
+{
+    ProcessorId      dspId    = (ProcessorId) LDRV_PTR_TO_UINT32 (arg) ;
+    Uint32           physAddr = LDRV_PTR_TO_UINT32 (info) ;
+    ZCPYMQT_Ctrl *   ctrl     = ZCPYMQT_ctrls [dspId] ;
+    LDRV_DspConfig * cfg      = LDRV_getDspConfig (dspId) ;
+    MSGQ_Msg         msg ;
+    Uint32           id ;
+
+    if (physAddr == ZCPYMQT_CTRLPAYLOAD) {
+        id = ZCPYMQT_dspQueue (dspId, ctrl->locateName) ;
+        if (id == MSGQ_INVALIDMSGQ) {
+            ctrl->locateStatus = (Uint32) DSP_ENOTFOUND ;
+        }
+        else {
+            ctrl->locateStatus = (Uint32) DSP_SOK ;
+            ctrl->locateQueue  = ((Uint32) dspId << 16u) | id ;
+        }
+        ctrl->dspSeq = ctrl->locateSeq ;
+        LDRV_IPS_raise (dspId,
+                        cfg->mqtObject.ipsId,
+                        eventNo,
+                        ZCPYMQT_CTRLPAYLOAD) ;
+    }
+    else {
+        msg = (MSGQ_Msg) LDRV_phyToUsr (dspId, physAddr) ;
+        if (msg != NULL) {
+            if (    (msg->dstId < cfg->dspObject.arg1)
+                &&  (msg->srcProcId == ID_GPP)
+                &&  (msg->srcId != MSGQ_INVALIDMSGQ)) {
+                id                = msg->dstId ;
+                msg->dstId        = msg->srcId ;
+                msg->srcId        = (MSGQ_Id) id ;
+                msg->srcProcId    = (Uint16) dspId ;
+                LDRV_IPS_raise (dspId,
+                                cfg->mqtObject.ipsId,
+                                eventNo,
+                                physAddr) ;
+            }
+            else {
+                /* No reply possible: the DSP frees the message. */
+                LDRV_POOL_free (msg->poolId, msg, msg->size) ;
+            }
+        }
+    }
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_init
+ *
+ *  @desc   Initializes the transport to a DSP in the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    create
+ *              TRUE if the shared state is to be created.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EMEMORY
+ *              Out of memory.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYMQT_exit
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+ZCPYMQT_init (IN ProcessorId dspId, IN Bool create)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_DspConfig * cfg    = LDRV_getDspConfig (dspId) ;
+    ZCPYMQT_Object * mqtState ;
+    ZCPYMQT_Ctrl *   ctrl ;
+
+    TRC_2ENTER ("ZCPYMQT_init", dspId, create) ;
+
+    if ((create == TRUE) && (LDRV_Obj->compState [LDRV_Comp_Mqt] == 0u)) {
+        LDRV_Obj->compState [LDRV_Comp_Mqt] =
+                                    LDRV_drvAlloc (sizeof (ZCPYMQT_Object)) ;
+        if (LDRV_Obj->compState [LDRV_Comp_Mqt] == 0u) {
+            status = DSP_EMEMORY ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        mqtState = (ZCPYMQT_Object *) LDRV_compState (LDRV_Comp_Mqt) ;
+        if (create == TRUE) {
+            status = LDRV_SMM_alloc (dspId,
+                                     sizeof (ZCPYMQT_Ctrl),
+                                     &mqtState->ctrlPhys [dspId]) ;
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            ctrl = (ZCPYMQT_Ctrl *) LDRV_phyToUsr (dspId,
+                                                   mqtState->ctrlPhys [dspId]) ;
+            ZCPYMQT_ctrls [dspId] = ctrl ;
+            if (create == TRUE) {
+                status = SYNC_HOST_createLock (&ctrl->locateLock) ;
+                if (DSP_SUCCEEDED (status)) {
+                    status = SYNC_HOST_createLock (&ctrl->lock) ;
+                }
+                if (DSP_SUCCEEDED (status)) {
+                    status = SYNC_HOST_createCond (&ctrl->cond) ;
+                }
+            }
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_IPS_register (dspId,
+                                    cfg->mqtObject.ipsId,
+                                    cfg->mqtObject.ipsEventNo,
+                                    ZCPYMQT_gppCallback,
+                                    LDRV_UINT32_TO_PTR (dspId)) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_IPS_dspRegister (dspId,
+                                       cfg->mqtObject.ipsId,
+                                       cfg->mqtObject.ipsEventNo,
+                                       ZCPYMQT_dspCallback,
+                                       LDRV_UINT32_TO_PTR (dspId)) ;
+    }
+
+    TRC_1LEAVE ("ZCPYMQT_init", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_exit
+ *
+ *  @desc   Finalizes the transport to a DSP in the calling process.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    destroy
+ *              TRUE if the shared state is to be destroyed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYMQT_init
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+ZCPYMQT_exit (IN ProcessorId dspId, IN Bool destroy)
+{
+    LDRV_DspConfig * cfg  = LDRV_getDspConfig (dspId) ;
+    ZCPYMQT_Ctrl *   ctrl = ZCPYMQT_ctrls [dspId] ;
+
+    TRC_2ENTER ("ZCPYMQT_exit", dspId, destroy) ;
+
+    LDRV_IPS_dspRegister (dspId,
+                          cfg->mqtObject.ipsId,
+                          cfg->mqtObject.ipsEventNo,
+                          NULL,
+                          NULL) ;
+    LDRV_IPS_unregister (dspId,
+                         cfg->mqtObject.ipsId,
+                         cfg->mqtObject.ipsEventNo) ;
+
+    if ((ctrl != NULL) && (destroy == TRUE)) {
+        SYNC_HOST_deleteCond (&ctrl->cond) ;
+        SYNC_HOST_deleteLock (&ctrl->lock) ;
+        SYNC_HOST_deleteLock (&ctrl->locateLock) ;
+    }
+    ZCPYMQT_ctrls [dspId] = NULL ;
+
+    TRC_1LEAVE ("ZCPYMQT_exit", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_open
+ *
+ *  @desc   Opens the transport to a DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    attrs
+ *              ZCPYMQT_Attrs of the transport.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid attributes.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYMQT_close
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+ZCPYMQT_open (IN ProcessorId dspId, IN Pvoid attrs)
+{
+    DSP_STATUS      status   = DSP_SOK ;
+    ZCPYMQT_Attrs * mqtAttrs = (ZCPYMQT_Attrs *) attrs ;
+    ZCPYMQT_Ctrl *  ctrl     = ZCPYMQT_ctrls [dspId] ;
+
+    TRC_2ENTER ("ZCPYMQT_open", dspId, attrs) ;
+
+    if (mqtAttrs == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        ctrl->poolId = mqtAttrs->poolId ;
+        ctrl->isOpen = TRUE ;
+    }
+
+    TRC_1LEAVE ("ZCPYMQT_open", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_close
+ *
+ *  @desc   Closes the transport to a DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYMQT_open
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+ZCPYMQT_close (IN ProcessorId dspId)
+{
+    TRC_1ENTER ("ZCPYMQT_close", dspId) ;
+
+    ZCPYMQT_ctrls [dspId]->isOpen = FALSE ;
+
+    TRC_1LEAVE ("ZCPYMQT_close", DSP_SOK) ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_locate
+ *
+ *  @desc   Asks the DSP for a message queue and waits for the answer.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    queueName
+ *              Name of the message queue.
+ *  @arg    msgqQueue
+ *              Location to receive the message queue.
+ *  @arg    timeout
+ *              Time to wait for the answer.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The DSP has no message queue with that name.
+ *          DSP_ETIMEOUT
+ *              The DSP did not answer in time.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYMQT_release
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+ZCPYMQT_locate (IN  ProcessorId  dspId,
+                IN  Pstr         queueName,
+                OUT MSGQ_Queue * msgqQueue,
+                IN  Uint32       timeout)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    ZCPYMQT_Ctrl *   ctrl   = ZCPYMQT_ctrls [dspId] ;
+    LDRV_DspConfig * cfg    = LDRV_getDspConfig (dspId) ;
+    struct timespec  deadline ;
+    Uint32           seq ;
+
+    TRC_4ENTER ("ZCPYMQT_locate", dspId, queueName, msgqQueue, timeout) ;
+
+    SYNC_HOST_enter (&ctrl->locateLock) ;
+
+    SYNC_HOST_enter (&ctrl->lock) ;
+    strncpy (ctrl->locateName, queueName, DSP_MAX_STRLEN - 1u) ;
+    ctrl->locateName [DSP_MAX_STRLEN - 1u] = '\0' ;
+    seq = ++ctrl->locateSeq ;
+    SYNC_HOST_leave (&ctrl->lock) ;
+
+    status = LDRV_IPS_notify (dspId,
+                              cfg->mqtObject.ipsId,
+                              cfg->mqtObject.ipsEventNo,
+                              ZCPYMQT_CTRLPAYLOAD) ;
+    if (DSP_SUCCEEDED (status)) {
+        if ((timeout != WAIT_FOREVER) && (timeout != WAIT_NONE)) {
+            SYNC_HOST_deadline (timeout, &deadline) ;
+        }
+
+        SYNC_HOST_enter (&ctrl->lock) ;
+        while (DSP_SUCCEEDED (status) && (ctrl->answerSeq != seq)) {
+            if (timeout == WAIT_NONE) {
+                status = DSP_ETIMEOUT ;
+            }
+            else {
+                status = SYNC_HOST_waitUntil (&ctrl->cond,
+                                              &ctrl->lock,
+                                              (timeout == WAIT_FOREVER) ?
+                                              NULL : &deadline) ;
+            }
+        }
+
+        if (ctrl->answerSeq == seq) {
+            status = (DSP_STATUS) ctrl->locateStatus ;
+            if (DSP_SUCCEEDED (status)) {
+                *msgqQueue = ctrl->locateQueue ;
+            }
+        }
+        SYNC_HOST_leave (&ctrl->lock) ;
+    }
+
+    SYNC_HOST_leave (&ctrl->locateLock) ;
+
+    TRC_1LEAVE ("ZCPYMQT_locate", status) ;
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_release
+ *
+ *  @desc   Releases a located message queue. Nothing is held for it.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    msgqQueue
+ *              Message queue.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYMQT_locate
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+ZCPYMQT_release (IN ProcessorId dspId, IN MSGQ_Queue msgqQueue)
+{
+    (Void) dspId ;
+    (Void) msgqQueue ;
+
+    return DSP_SOK ;
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_put
+ *
+ *  @desc   Sends a message to the DSP.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    msg
+ *              Message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              The message is not shared with the DSP.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+ZCPYMQT_put (IN ProcessorId dspId, IN MSGQ_Msg msg)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    LDRV_DspConfig * cfg    = LDRV_getDspConfig (dspId) ;
+    Uint32           physAddr ;
+
+    physAddr = LDRV_usrToPhy (dspId, msg) ;
+    if (physAddr == LDRV_INVALID_ADDR) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = LDRV_IPS_notify (dspId,
+                                  cfg->mqtObject.ipsId,
+                                  cfg->mqtObject.ipsEventNo,
+                                  physAddr) ;
+    }
+
+    return status ;
+}
+
+
+/*  ============================================================================
+ *  @func   ZCPYMQT_putv
+ *
+ *  @desc   Sends an array of messages to the DSP. Each event of the ZCPYMQT
+ *          carries a single message, so the DSP is notified per message.
+ *
+ *  @arg    dspId
+ *              DSP identifier.
+ *  @arg    msgArray
+ *              Messages.
+ *  @arg    numMsgs
+ *              Number of messages.
+ *  @arg    numPut
+ *              Location to receive the number of messages sent.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              A message is not shared with the DSP.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    ZCPYMQT_put
+ *  ============================================================================
+ */
+STATIC
+DSP_STATUS
+ZCPYMQT_putv (IN  ProcessorId dspId,
+              IN  MSGQ_Msg *  msgArray,
+              IN  Uint32      numMsgs,
+              OUT Uint32 *    numPut)
+{
+    DSP_STATUS status = DSP_SOK ;
+
+    *numPut = 0u ;
+    while (DSP_SUCCEEDED (status) && (*numPut < numMsgs)) {
+        status = ZCPYMQT_put (dspId, msgArray [*numPut]) ;
+        if (DSP_SUCCEEDED (status)) {
+            (*numPut)++ ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @name   ZCPYMQT_Interface
+ *
+ *  @desc   Interface of the ZCPYMQT.
+ *  ============================================================================
+ */
+MQT_Interface ZCPYMQT_Interface = {
+    &ZCPYMQT_init,
+    &ZCPYMQT_exit,
+    &ZCPYMQT_open,
+    &ZCPYMQT_close,
+    &ZCPYMQT_locate,
+    &ZCPYMQT_release,
+    &ZCPYMQT_put,
+    &ZCPYMQT_putv
+} ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -56,6 +56,9 @@
 /*  ----------------------------------- DSP/BIOS Link                   */
 #include <dsplink.h>
 #include <procdefs.h>
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* if defined (DDSP_PROFILE) */
 
 
 #if defined (__cplusplus)
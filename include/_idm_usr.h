@@ -0,0 +1,248 @@
+/** ============================================================================
+ *  @file   _idm_usr.h
+ *
+ *  @path   $(DSPLINK)/gpp/inc/usr/
+ *
+ *  @desc   Defines the interface of the user side of the ID Manager (IDM).
+ *          An IDM object hands out the identifiers of a range, one per
+ *          distinct key string.
+ *
+ *  @ver    1.60
+ *  ============================================================================
+ *  Copyright (c) 2002-2008, Texas Instruments Incorporated
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  Contact information for paper mail:
+ *  Texas Instruments
+ *  Post Office Box 655303
+ *  Dallas, Texas 75265
+ *  Contact information: 
+ *  http://www-k.ext.ti.com/sc/technical-support/product-information-centers.htm?
+ *  DCMP=TIHomeTracking&HQS=Other+OT+home_d_contact
+ *  ============================================================================
+ */
+
+
+#if !defined (_IDM_USR_H)
+#define _IDM_USR_H
+
+
+/*  ----------------------------------- DSP/BIOS LINK Headers       */
+#include <dsplink.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @name   IDM_Attrs
+ *
+ *  @desc   Attributes of an IDM object.
+ *
+ *  @field  baseId
+ *              First identifier managed by the object.
+ *  @field  endId
+ *              Last identifier managed by the object.
+ *  ============================================================================
+ */
+typedef struct IDM_Attrs_tag {
+    Uint32      baseId ;
+    Uint32      endId  ;
+} IDM_Attrs ;
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_init
+ *
+ *  @desc   Initializes the IDM component.
+ *
+ *  @arg    None
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    _IDM_USR_exit
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_init (Void) ;
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_exit
+ *
+ *  @desc   Finalizes the IDM component.
+ *
+ *  @arg    None
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    _IDM_USR_init
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_exit (Void) ;
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_create
+ *
+ *  @desc   Creates an IDM object.
+ *
+ *  @arg    key
+ *              Key of the IDM object.
+ *  @arg    attrs
+ *              Attributes of the IDM object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EALREADYEXISTS
+ *              An IDM object with this key already exists.
+ *          DSP_ERESOURCE
+ *              No free IDM object is available.
+ *          DSP_EINVALIDARG
+ *              Invalid range of identifiers.
+ *
+ *  @enter  attrs must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    _IDM_USR_delete
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_create (IN Uint32 key, IN IDM_Attrs * attrs) ;
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_delete
+ *
+ *  @desc   Deletes an IDM object.
+ *
+ *  @arg    key
+ *              Key of the IDM object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              No IDM object with this key exists.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    _IDM_USR_create
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_delete (IN Uint32 key) ;
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_acquireId
+ *
+ *  @desc   Acquires the identifier of a key string. A key string that already
+ *          has an identifier gets the same one again.
+ *
+ *  @arg    key
+ *              Key of the IDM object.
+ *  @arg    idKey
+ *              Key string of the identifier.
+ *  @arg    id
+ *              Location to receive the identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              No IDM object with this key exists.
+ *          DSP_ERESOURCE
+ *              All the identifiers are in use.
+ *
+ *  @enter  idKey and id must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    _IDM_USR_releaseId
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_acquireId (IN Uint32 key, IN Pstr idKey, OUT Uint32 * id) ;
+
+
+/** ============================================================================
+ *  @func   _IDM_USR_releaseId
+ *
+ *  @desc   Releases an identifier once for every time it was acquired.
+ *
+ *  @arg    key
+ *              Key of the IDM object.
+ *  @arg    id
+ *              Identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              No IDM object with this key exists.
+ *          DSP_EINVALIDARG
+ *              The identifier is not acquired.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    _IDM_USR_acquireId
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+_IDM_USR_releaseId (IN Uint32 key, IN Uint32 id) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (_IDM_USR_H) */
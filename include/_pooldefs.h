@@ -290,6 +290,101 @@ typedef DSP_STATUS (*FnPoolFree) (IN  ProcessorId       dspId,
                                   IN  Void *            buf,
                                   IN  Uint32            size) ;
 
+/** ============================================================================
+ *  @name   FnPoolAllocv
+ *
+ *  @desc   Signature of function that allocates several buffers of the same
+ *          size in one call. Fewer buffers than requested may be returned.
+ *
+ *  @arg    dspId
+ *              DSP Identifier.
+ *  @arg    poolId
+ *              Pool Identifier.
+ *  @arg    object
+ *              Pointer to the pool-specific object.
+ *  @arg    bufArray
+ *              Location to receive the allocated buffers.
+ *  @arg    size
+ *              Size of the buffers to be allocated.
+ *  @arg    numBufs
+ *              Number of buffers requested.
+ *  @arg    numAlloc
+ *              Location to receive the number of buffers allocated.
+ *
+ *  @ret    DSP_SOK
+ *              At least one buffer has been allocated.
+ *          DSP_EMEMORY
+ *              Operation failed due to a memory error.
+ *          DSP_EFAIL
+ *              General failure.
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnPoolAllocv) (IN  ProcessorId       dspId,
+                                    IN  Uint32            poolId,
+                                    IN  Void *            object,
+                                    OUT Pvoid *           bufArray,
+                                    IN  Uint32            size,
+                                    IN  Uint32            numBufs,
+                                    OUT Uint32 *          numAlloc) ;
+
+/** ============================================================================
+ *  @name   FnPoolFreev
+ *
+ *  @desc   Signature of function that frees several buffers of the same size
+ *          in one call.
+ *
+ *  @arg    dspId
+ *              DSP Identifier.
+ *  @arg    poolId
+ *              Pool Identifier.
+ *  @arg    object
+ *              Pointer to the pool-specific object.
+ *  @arg    bufArray
+ *              Buffers to be freed.
+ *  @arg    size
+ *              Size of the buffers to be freed.
+ *  @arg    numBufs
+ *              Number of buffers to be freed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              A buffer does not belong to the pool. The other buffers have
+ *              been freed.
+ *          DSP_EFAIL
+ *              General failure.
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnPoolFreev) (IN  ProcessorId       dspId,
+                                   IN  Uint32            poolId,
+                                   IN  Void *            object,
+                                   IN  Pvoid *           bufArray,
+                                   IN  Uint32            size,
+                                   IN  Uint32            numBufs) ;
+
+/** ============================================================================
+ *  @name   FnPoolNumBufs
+ *
+ *  @desc   Signature of function that returns the number of buffers of the
+ *          classes serving a size.
+ *
+ *  @arg    dspId
+ *              DSP Identifier.
+ *  @arg    poolId
+ *              Pool Identifier.
+ *  @arg    object
+ *              Pointer to the pool-specific object.
+ *  @arg    size
+ *              Size of the buffers.
+ *
+ *  @ret    Number of buffers, 0 if no class serves the size.
+ *  ============================================================================
+ */
+typedef Uint32 (*FnPoolNumBufs) (IN  ProcessorId       dspId,
+                                 IN  Uint32            poolId,
+                                 IN  Void *            object,
+                                 IN  Uint32            size) ;
+
 /** ============================================================================
  *  @name   FnPoolWriteback
  *
@@ -432,6 +527,15 @@ typedef DSP_STATUS (*FnPoolReconfigure) (IN  ProcessorId       dspId,
  *              Function pointer to the plugged pool's invalidate function.
  *  @field  xltBuf
  *              Function pointer to the plugged pool's xltBuf function.
+ *  @field  allocv
+ *              Function pointer to the plugged pool's allocv function, NULL
+ *              if the pool only allocates one buffer per call.
+ *  @field  freev
+ *              Function pointer to the plugged pool's freev function, NULL
+ *              if the pool only frees one buffer per call.
+ *  @field  numBufs
+ *              Function pointer to the plugged pool's numBufs function, NULL
+ *              if the pool does not tell.
  *  ============================================================================
  */
 typedef struct POOL_Interface_tag {
@@ -443,6 +547,9 @@ typedef struct POOL_Interface_tag {
     FnPoolWriteback   writeback   ;
     FnPoolInvalidate  invalidate  ;
     FnPoolXltBuf      xltBuf      ;
+    FnPoolAllocv      allocv      ;
+    FnPoolFreev       freev       ;
+    FnPoolNumBufs     numBufs     ;
 } POOL_Interface ;
 
 
@@ -355,8 +355,8 @@ extern "C" {
  *  ============================================================================
  */
 #define RINGIO_CLIENT_PADDING ((  CACHE_L2_LINESIZE                            \
-                                - (  (sizeof (RingIO_BufPtr) * 2)              \
-                                   + (sizeof (Uint32) * 11)                    \
+                                - (  (sizeof (RingIO_BufPtr) * 3)              \
+                                   + (sizeof (Uint32) * 17)                    \
                                    + sizeof (RingIO_NotifyFunc)                \
                                    + sizeof (RingIO_NotifyParam)               \
                                    + sizeof (RingIO_ControlStruct *)           \
@@ -370,9 +370,9 @@ extern "C" {
  *  ============================================================================
  */
 #define RINGIO_CONTROLSTRUCT_PADDING ((  CACHE_L2_LINESIZE                     \
-                                       - (  (sizeof (Uint32) * 14)             \
+                                       - (  (sizeof (Uint32) * 21)             \
                                           + sizeof  (Int32)                    \
-                                          + (sizeof (RingIO_BufPtr)* 2)        \
+                                          + (sizeof (RingIO_BufPtr)* 3)        \
                                           + sizeof (Void *))) /2)
 #endif /* if defined (RINGIO_COMPONENT) */
 
@@ -394,6 +394,48 @@ CHNL_flush (IN ProcessorId         procId,
             IN ChannelId           chnlId) ;
 
 
+/** ============================================================================
+ *  @func   CHNL_getPollFd
+ *
+ *  @desc   Returns a file descriptor that can be waited on with poll, select
+ *          or epoll. It is readable while completed buffers of the channel
+ *          wait to be reclaimed, and becomes unreadable again once
+ *          CHNL_reclaim has taken the last of them. The descriptor belongs
+ *          to the channel: it must not be read or closed by the application,
+ *          and is closed by CHNL_delete.
+ *
+ *  @arg    procId
+ *              Processor Identifier.
+ *  @arg    chnlId
+ *              Channel Identifier.
+ *  @arg    fd
+ *              Location to receive the file descriptor.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid parameter passed.
+ *          DSP_EACCESSDENIED
+ *              The channel has been created by another process.
+ *          DSP_ERESOURCE
+ *              The file descriptor cannot be created.
+ *
+ *  @enter  Channels for specified processor must be initialized.
+ *          Processor and  channel ids must be valid.
+ *          CHNL_create has been successful in the calling process.
+ *
+ *  @leave  None
+ *
+ *  @see    CHNL_reclaim
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_getPollFd (IN  ProcessorId procId,
+                IN  ChannelId   chnlId,
+                OUT Int32 *     fd) ;
+
+
 /** ============================================================================
  *  @func   CHNL_control
  *
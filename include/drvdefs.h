@@ -158,6 +158,10 @@ extern "C" {
 #if defined (DDSP_DEBUG)
 #define CMD_CHNL_DEBUG                     (CHNL_BASE_CMD + 11)
 #endif /* if defined (DDSP_DEBUG) */
+
+#define CMD_CHNL_GETPOLLFD                 (CHNL_BASE_CMD + 12)
+
+
 #endif /* if defined (CHNL_COMPONENT) */
 
 
@@ -205,6 +209,15 @@ extern "C" {
 #define CMD_MSGQ_DEBUG                     (MSGQ_BASE_CMD + 15)
 #endif /* if defined (DDSP_DEBUG) */
 
+#define CMD_MSGQ_PUTV                      (MSGQ_BASE_CMD + 16)
+#define CMD_MSGQ_GETV                      (MSGQ_BASE_CMD + 17)
+#define CMD_MSGQ_COUNTLANE                 (MSGQ_BASE_CMD + 18)
+#define CMD_MSGQ_GETPOLLFD                 (MSGQ_BASE_CMD + 19)
+#define CMD_MSGQ_ALLOCLARGE                (MSGQ_BASE_CMD + 20)
+#define CMD_MSGQ_FREELARGE                 (MSGQ_BASE_CMD + 21)
+#define CMD_MSGQ_PUTLARGE                  (MSGQ_BASE_CMD + 22)
+#define CMD_MSGQ_GETLARGE                  (MSGQ_BASE_CMD + 23)
+
 
 #endif /* if defined (MSGQ_COMPONENT) */
 
@@ -223,6 +236,9 @@ extern "C" {
 #define CMD_POOL_RECONFIGURE               (POOL_BASE_CMD + 6)
 #define CMD_POOL_WRITEBACK                 (POOL_BASE_CMD + 7)
 #define CMD_POOL_INVALIDATE                (POOL_BASE_CMD + 8)
+#define CMD_POOL_CACHEV                    (POOL_BASE_CMD + 9)
+#define CMD_POOL_INSTRUMENT                (POOL_BASE_CMD + 10)
+#define CMD_POOL_GETOWNERS                 (POOL_BASE_CMD + 11)
 
 #if defined (MPCS_COMPONENT)
 /*  ============================================================================
@@ -481,6 +497,12 @@ typedef struct CMD_Args_tag {
             Pvoid           arg    ;
         } chnlControlArgs ;
 
+        struct {
+            ProcessorId     procId ;
+            ChannelId       chnlId ;
+            Int32 *         fd     ;
+        } chnlGetPollFdArgs ;
+
 #if defined (DDSP_PROFILE)
         struct {
             ProcessorId       procId    ;
@@ -559,6 +581,21 @@ typedef struct CMD_Args_tag {
             Uint32      msgAddr ;
         } msgqGetArgs ;
 
+        struct {
+            MSGQ_Queue   msgqQueue ;
+            MSGQ_Msg *   msgArray ;
+            Uint32       numMsgs ;
+            Uint32       numPut ;
+        } msgqPutvArgs ;
+
+        struct {
+            MSGQ_Queue   msgqQueue ;
+            Uint32       timeout ;
+            MSGQ_Msg *   msgArray ;
+            Uint32       maxMsgs ;
+            Uint32       numMsgs ;
+        } msgqGetvArgs ;
+
         struct {
             MSGQ_Queue  errorQueue ;
             PoolId      poolId  ;
@@ -569,6 +606,39 @@ typedef struct CMD_Args_tag {
             Uint16 *    count  ;
         } msgqCountArgs ;
 
+        struct {
+            MSGQ_Queue  msgqQueue ;
+            Uint32      lane   ;
+            Uint16 *    count  ;
+        } msgqCountLaneArgs ;
+
+        struct {
+            MSGQ_Queue  msgqQueue ;
+            Int32 *     fd     ;
+        } msgqGetPollFdArgs ;
+
+        struct {
+            PoolId          poolId   ;
+            Uint32          size     ;
+            Uint16          fragSize ;
+            MSGQ_LargeMsg * largeMsg ;
+        } msgqAllocLargeArgs ;
+
+        struct {
+            MSGQ_LargeMsg * largeMsg ;
+        } msgqFreeLargeArgs ;
+
+        struct {
+            MSGQ_Queue      msgqQueue ;
+            MSGQ_LargeMsg * largeMsg  ;
+        } msgqPutLargeArgs ;
+
+        struct {
+            MSGQ_Queue      msgqQueue ;
+            Uint32          timeout   ;
+            MSGQ_LargeMsg * largeMsg  ;
+        } msgqGetLargeArgs ;
+
 #if defined (DDSP_PROFILE)
         struct {
             MSGQ_Queue          msgqQueue ;
@@ -624,6 +694,32 @@ typedef struct CMD_Args_tag {
             Uint32  size ;
             Pvoid   bufPtr ;
         } poolInvArgs ;
+
+        struct {
+            PoolId  poolId ;
+            Pvoid   args ;
+        } poolReconfigureArgs ;
+
+        struct {
+            PoolId            poolId ;
+            POOL_CacheOp      op ;
+            POOL_CacheRange * ranges ;
+            Uint32            numRanges ;
+        } poolCacheVArgs ;
+
+        struct {
+            PoolId            poolId ;
+            POOL_OwnerStats * stats ;
+            POOL_OwnerInfo *  owners ;
+            Uint32 *          numOwners ;
+        } poolGetOwnersArgs ;
+
+#if defined (DDSP_PROFILE)
+        struct {
+            PoolId            poolId ;
+            SMAPOOL_Stats *   retVal ;
+        } poolInstrumentArgs ;
+#endif /* if defined (DDSP_PROFILE) */
 #endif /* #if defined (POOL_COMPONENT) */
 
 #if defined (RINGIO_COMPONENT)
@@ -410,6 +410,9 @@ typedef Int32  DSP_STATUS ;
 /* Indicates that the RingIO is in a wrong state */
 #define RINGIO_EWRONGSTATE          (RINGIO_EBASE + 0x08l)
 
+/* Indicates that the writer of a broadcast RingIO dropped the reader */
+#define RINGIO_EDROPPED             (RINGIO_EBASE + 0x09l)
+
 
 /* Reserved error code */
 #define DSP_ERESERVED_BASE_1        (DSP_COMP_EBASE + 0x000l)
@@ -96,6 +96,8 @@ typedef signed char         Int8 ;      /*  8 bit value */
 typedef signed short int    Int16 ;     /* 16 bit value */
 #endif
 #if defined  xdc_target__
+#elif defined (__LP64__)
+typedef signed int          Int32 ;     /* 32 bit value */
 #else
 typedef signed long  int    Int32 ;     /* 32 bit value */
 #endif
@@ -109,6 +111,8 @@ typedef unsigned char       Uint8 ;     /*  8 bit value */
 typedef unsigned short int  Uint16 ;    /* 16 bit value */
 #endif
 #if defined  xdc_target__
+#elif defined (__LP64__)
+typedef unsigned int        Uint32 ;    /* 32 bit value */
 #else
 typedef unsigned long  int  Uint32 ;    /* 32 bit value */
 #endif
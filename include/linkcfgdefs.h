@@ -306,6 +306,13 @@ typedef struct LINKCFG_Dsp_tag {
  *  @field  syncd
  *              Flag indicating whether the memory region is synchonized
  *              between GPP and DSP.
+ *  @field  pageSize
+ *              Size of the GPP pages requested to back the memory region, for
+ *              instance 0x200000 or 0x40000000 for 2 MB or 1 GB huge pages.
+ *              0 selects the default page size. Huge pages are taken from a
+ *              hugetlbfs mount of that page size, and the region falls back
+ *              to default pages if none can be used. Once the region is
+ *              mapped, the field holds the size of the pages backing it.
  *  ============================================================================
  */
 typedef struct LINKCFG_MemEntry_tag {
@@ -317,6 +324,7 @@ typedef struct LINKCFG_MemEntry_tag {
     Uint32                   size ;
     Bool                     shared ;
     Bool                     syncd  ;
+    Uint32                   pageSize ;
 } LINKCFG_MemEntry ;
 
 
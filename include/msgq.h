@@ -217,7 +217,8 @@ MSGQ_transportClose (IN ProcessorId procId) ;
  *  @arg    msgqQueue
  *              Location to store the handle to the message queue.
  *  @arg    attrs
- *              Optional attributes for creation of the MSGQ.
+ *              Optional attributes for creation of the MSGQ, best started
+ *              from MSGQ_ATTRS_INIT.
  *
  *  @ret    DSP_SOK
  *              Operation successfully completed.
@@ -478,13 +479,17 @@ MSGQ_free (IN MSGQ_Msg msg) ;
  *              Operation successfully completed.
  *          DSP_EINVALIDARG
  *              Invalid argument.
+ *          DSP_ENOTFOUND
+ *              The local destination MSGQ is not open.
  *          DSP_EFAIL
  *              General failure.
  *
  *  @enter  msgqQueue must be valid.
  *          msg must be valid.
  *
- *  @leave  None
+ *  @leave  On success, the message belongs to the destination MSGQ. On
+ *          failure, it remains owned by the caller, which frees or reuses it
+ *          as with MSGQ_putv.
  *
  *  @see    MSGQ_Queue, MSGQ_MsgHeader, MSGQ_get ()
  *  ============================================================================
@@ -533,6 +538,247 @@ DSP_STATUS
 MSGQ_get (IN MSGQ_Queue msgqQueue, IN Uint32 timeout, OUT MSGQ_Msg * msg) ;
 
 
+/** ============================================================================
+ *  @func   MSGQ_putv
+ *
+ *  @desc   This function sends an array of messages to the specified MSGQ in
+ *          a single call. The messages are received in the order of the
+ *          array, and the transport is notified once for the whole array.
+ *
+ *  @arg    msgqQueue
+ *              Handle to the destination MSGQ.
+ *  @arg    msgArray
+ *              Array of the messages to be sent to the destination MSGQ.
+ *  @arg    numMsgs
+ *              Number of messages in the array.
+ *  @arg    numPut
+ *              Location to receive the number of messages sent. On failure,
+ *              the messages after them remain owned by the caller.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  msgqQueue must be valid.
+ *          msgArray must contain numMsgs valid messages.
+ *          numPut must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_put (), MSGQ_getv ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_putv (IN  MSGQ_Queue msgqQueue,
+           IN  MSGQ_Msg * msgArray,
+           IN  Uint32     numMsgs,
+           OUT Uint32 *   numPut) ;
+
+
+/** ============================================================================
+ *  @func   MSGQ_getv
+ *
+ *  @desc   This function receives up to maxMsgs messages on the specified
+ *          MSGQ in a single call. It waits for the first message as MSGQ_get
+ *          does, then takes the messages already queued behind it.
+ *
+ *  @arg    msgqQueue
+ *              Handle to the MSGQ on which the messages are to be received.
+ *  @arg    timeout
+ *              Timeout value to wait for the first message (in milliseconds).
+ *  @arg    msgArray
+ *              Array to receive the messages.
+ *  @arg    maxMsgs
+ *              Number of entries of the array.
+ *  @arg    numMsgs
+ *              Location to receive the number of messages received.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_ETIMEOUT
+ *              Timeout occurred while receiving the first message.
+ *          DSP_ENOTCOMPLETE
+ *               Operation not complete when WAIT_NONE was specified as timeout.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  msgqQueue must be a local queue.
+ *          msgArray must have maxMsgs entries.
+ *          maxMsgs must be greater than 0.
+ *          numMsgs must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_get (), MSGQ_putv ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_getv (IN  MSGQ_Queue msgqQueue,
+           IN  Uint32     timeout,
+           OUT MSGQ_Msg * msgArray,
+           IN  Uint32     maxMsgs,
+           OUT Uint32 *   numMsgs) ;
+
+
+/** ============================================================================
+ *  @func   MSGQ_allocLarge
+ *
+ *  @desc   This function allocates a large message, whose data may exceed
+ *          the size of any single message. The data is split into fragments,
+ *          each held in a message of fragSize bytes from the given pool, and
+ *          the scatter list of the large message points at the data of each
+ *          fragment so that it can be filled in place.
+ *
+ *  @arg    poolId
+ *              Pool from which the fragments are allocated.
+ *  @arg    size
+ *              Size in bytes of the data of the large message.
+ *  @arg    fragSize
+ *              Size in bytes of the message holding each fragment, including
+ *              its MSGQ_FragMsg header.
+ *  @arg    largeMsg
+ *              Large message. Its frags and maxFrags fields must be set.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_ESIZE
+ *              The scatter list has fewer than the needed entries.
+ *          DSP_EMEMORY
+ *              Operation failed due to insufficient memory.
+ *
+ *  @enter  largeMsg must be a valid pointer.
+ *
+ *  @leave  On failure, no fragment is allocated.
+ *
+ *  @see    MSGQ_putLarge (), MSGQ_freeLarge ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_allocLarge (IN     PoolId          poolId,
+                 IN     Uint32          size,
+                 IN     Uint16          fragSize,
+                 IN OUT MSGQ_LargeMsg * largeMsg) ;
+
+
+/** ============================================================================
+ *  @func   MSGQ_freeLarge
+ *
+ *  @desc   This function frees all the fragments of a large message, either
+ *          allocated with MSGQ_allocLarge or received with MSGQ_getLarge.
+ *
+ *  @arg    largeMsg
+ *              Large message to be freed.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *
+ *  @enter  largeMsg must be a valid pointer.
+ *
+ *  @leave  The large message has no fragment.
+ *
+ *  @see    MSGQ_allocLarge (), MSGQ_getLarge ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_freeLarge (IN OUT MSGQ_LargeMsg * largeMsg) ;
+
+
+/** ============================================================================
+ *  @func   MSGQ_putLarge
+ *
+ *  @desc   This function sends a large message to the specified MSGQ. Its
+ *          msgId field gives the message ID, and the source MSGQ set on the
+ *          first fragment with MSGQ_setSrcQueue applies to the whole message.
+ *          The size of each entry of the scatter list may be reduced before
+ *          the call.
+ *          A local MSGQ receives the large message as a single entry. A
+ *          remote MSGQ receives its fragments in order, and a large message
+ *          from a DSP is reassembled on its local MSGQ before it can be
+ *          received.
+ *
+ *  @arg    msgqQueue
+ *              Handle to the destination MSGQ.
+ *  @arg    largeMsg
+ *              Large message allocated with MSGQ_allocLarge.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  largeMsg must be a valid pointer.
+ *
+ *  @leave  On success, the large message belongs to the receiver. On
+ *          failure, it stays with the caller unless some fragments were
+ *          already sent, in which case the others are freed.
+ *
+ *  @see    MSGQ_getLarge (), MSGQ_putv ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_putLarge (IN MSGQ_Queue msgqQueue, IN OUT MSGQ_LargeMsg * largeMsg) ;
+
+
+/** ============================================================================
+ *  @func   MSGQ_getLarge
+ *
+ *  @desc   This function receives a large message on the specified MSGQ. The
+ *          scatter list points at the data of the fragments, which are not
+ *          copied. Any other message is received as a large message of a
+ *          single fragment.
+ *
+ *  @arg    msgqQueue
+ *              Handle to the MSGQ on which the message is to be received.
+ *  @arg    timeout
+ *              Timeout value to wait for the message (in milliseconds).
+ *  @arg    largeMsg
+ *              Large message. Its frags and maxFrags fields must be set.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ETRUNCATED
+ *              The scatter list holds only the first maxFrags fragments. The
+ *              large message is received and must still be freed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_ETIMEOUT
+ *              Timeout occurred while receiving the message.
+ *          DSP_ENOTCOMPLETE
+ *               Operation not complete when WAIT_NONE was specified as timeout.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  msgqQueue must be a local queue.
+ *          largeMsg must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_putLarge (), MSGQ_freeLarge ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_getLarge (IN     MSGQ_Queue      msgqQueue,
+               IN     Uint32          timeout,
+               IN OUT MSGQ_LargeMsg * largeMsg) ;
+
+
 /** ============================================================================
  *  @func   MSGQ_getSrcQueue
  *
@@ -566,6 +812,44 @@ DSP_STATUS
 MSGQ_getSrcQueue (IN MSGQ_Msg msg, OUT MSGQ_Queue * msgqQueue) ;
 
 
+/** ============================================================================
+ *  @func   MSGQ_getPollFd
+ *
+ *  @desc   This API returns a file descriptor that can be waited on with
+ *          poll, select or epoll. It is readable while messages are queued
+ *          on the local message queue, and becomes unreadable again once a
+ *          get has found the queue empty. The descriptor belongs to the
+ *          queue: it must not be read or closed by the application, and is
+ *          closed by MSGQ_close.
+ *
+ *  @arg    msgqQueue
+ *              Handle to the MSGQ to be polled.
+ *  @arg    fd
+ *              Location to receive the file descriptor.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid argument
+ *          DSP_EACCESSDENIED
+ *              The MSGQ has been opened by another process.
+ *          DSP_ERESOURCE
+ *              The file descriptor cannot be created.
+ *
+ *  @enter  msgqQueue must be valid.
+ *          msgqQueue must be a local queue opened by the calling process.
+ *          fd must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_get, MSGQ_getv
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_getPollFd (IN MSGQ_Queue msgqQueue, OUT Int32 * fd) ;
+
+
 /** ============================================================================
  *  @func   MSGQ_count
  *
@@ -598,6 +882,43 @@ DSP_STATUS
 MSGQ_count (IN MSGQ_Queue msgqQueue, OUT Uint16 * count) ;
 
 
+/** ============================================================================
+ *  @func   MSGQ_countLane
+ *
+ *  @desc   This API returns the count of the number of messages in one
+ *          priority lane of a local message queue.
+ *
+ *  @arg    msgqQueue
+ *              Handle to the MSGQ for which the count is to be retrieved.
+ *  @arg    lane
+ *              Priority lane of the MSGQ, 0 being the highest priority.
+ *  @arg    count
+ *              Location to receive the message count.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid argument
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  msgqQueue must be valid.
+ *          msgqQueue must be a local queue.
+ *          lane must be lower than the number of lanes of the queue.
+ *          count must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_LaneAttrs, MSGQ_count
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_countLane (IN  MSGQ_Queue msgqQueue,
+                IN  Uint32     lane,
+                OUT Uint16 *   count) ;
+
+
 /** ============================================================================
  *  @func   MSGQ_setErrorHandler
  *
@@ -634,7 +955,8 @@ MSGQ_setErrorHandler (IN MSGQ_Queue errorQueue, IN PoolId poolId) ;
  *  @func   MSGQ_instrument
  *
  *  @desc   This function gets the instrumentation information related to the
- *          specified message queue.
+ *          specified message queue, including the percentiles of the time
+ *          messages waited in the queue between being put and being got.
  *
  *  @arg    msgqQueue
  *              Handle to the message queue.
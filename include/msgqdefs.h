@@ -128,6 +128,15 @@ typedef Uint32   MSGQ_Queue ;
  */
 #define MSGQ_ASYNCERRORMSGID (Uint16) 0xFF01u
 
+/** ============================================================================
+ *  @const  MSGQ_FRAGMSGID
+ *
+ *  @desc   This constant defines the message ID of the fragments of a large
+ *          message.
+ *  ============================================================================
+ */
+#define MSGQ_FRAGMSGID (Uint16) 0xFF02u
+
 /** ============================================================================
  *  @const  MSGQ_INTERNALIDSEND
  *
@@ -187,6 +196,34 @@ typedef Uint32   MSGQ_Queue ;
  */
 #define MSG_HEADER_RESERVED_SIZE    2u
 
+/** ============================================================================
+ *  @const  MSGQ_MAXLANES
+ *
+ *  @desc   Highest number of priority lanes of a message queue.
+ *  ============================================================================
+ */
+#define MSGQ_MAXLANES               4u
+
+/** ============================================================================
+ *  @const  MSGQ_ATTRS_VERSION
+ *
+ *  @desc   Value of MSGQ_Attrs.version telling that the fields following it
+ *          are set. With any other value they are ignored, and the message
+ *          queue blocks in MSGQ_get and has a single lane.
+ *  ============================================================================
+ */
+#define MSGQ_ATTRS_VERSION          0x4D510001u
+
+/** ============================================================================
+ *  @macro  MSGQ_ATTRS_INIT
+ *
+ *  @desc   Initializer of a MSGQ_Attrs giving the default attributes, to be
+ *          used before setting some of its fields.
+ *  ============================================================================
+ */
+#define MSGQ_ATTRS_INIT    { NULL, NULL, NULL, MSGQ_ATTRS_VERSION,            \
+                             (Uint32) MSGQ_WaitPolicy_Block, 0u, NULL }
+
 /** ============================================================================
  *  @macro  IS_VALID_MSGQ
  *
@@ -240,6 +277,76 @@ typedef DSP_STATUS (*MsgqPend) (Pvoid notifyHandle, Uint32 timeout) ;
 typedef DSP_STATUS (*MsgqPost) (Pvoid notifyHandle) ;
 
 
+/** ============================================================================
+ *  @name   MSGQ_WaitPolicy
+ *
+ *  @desc   Enumerates the ways MSGQ_get waits for a message on an empty
+ *          message queue.
+ *
+ *  @field  MSGQ_WaitPolicy_Block
+ *              Block until a message arrives. This is the default.
+ *  @field  MSGQ_WaitPolicy_Poll
+ *              Busy-poll the message queue until a message arrives or the
+ *              timeout expires, without ever blocking.
+ *  @field  MSGQ_WaitPolicy_Adaptive
+ *              Spin for a time derived from the observed inter-arrival time
+ *              of the messages, bounded by the spin budget, then block.
+ *  ============================================================================
+ */
+typedef enum {
+    MSGQ_WaitPolicy_Block    = 0u,
+    MSGQ_WaitPolicy_Poll     = 1u,
+    MSGQ_WaitPolicy_Adaptive = 2u
+} MSGQ_WaitPolicy ;
+
+
+/** ============================================================================
+ *  @name   MSGQ_LanePolicy
+ *
+ *  @desc   Enumerates the orders in which MSGQ_get takes messages from the
+ *          priority lanes of a message queue.
+ *
+ *  @field  MSGQ_LanePolicy_Strict
+ *              Always take from the first non-empty lane.
+ *  @field  MSGQ_LanePolicy_Weighted
+ *              Visit the non-empty lanes in turn, taking up to the weight of
+ *              a lane from it before moving to the next one.
+ *  ============================================================================
+ */
+typedef enum {
+    MSGQ_LanePolicy_Strict   = 0u,
+    MSGQ_LanePolicy_Weighted = 1u
+} MSGQ_LanePolicy ;
+
+
+/** ============================================================================
+ *  @name   MSGQ_LaneAttrs
+ *
+ *  @desc   This structure defines the priority lanes of a message queue. Lane
+ *          0 has the highest priority. A message goes to the first lane i
+ *          whose msgIdStart [i] is not above its msgId, and to the last lane
+ *          if there is none. Messages with an internal MSGQ message ID, such
+ *          as MSGQ_ASYNCERRORMSGID, always go to lane 0, and messages with
+ *          MSGQ_INVALIDMSGID always to the last lane.
+ *
+ *  @field  numLanes
+ *              Number of lanes, from 1 to MSGQ_MAXLANES.
+ *  @field  policy
+ *              Order of the dequeues (MSGQ_LanePolicy).
+ *  @field  msgIdStart
+ *              Lowest message ID of each lane but the last one.
+ *  @field  weight
+ *              Weight of each lane for MSGQ_LanePolicy_Weighted, 0 for 1.
+ *  ============================================================================
+ */
+typedef struct MSGQ_LaneAttrs_tag {
+    Uint32    numLanes ;
+    Uint32    policy ;
+    Uint16    msgIdStart [MSGQ_MAXLANES] ;
+    Uint32    weight     [MSGQ_MAXLANES] ;
+} MSGQ_LaneAttrs ;
+
+
 /** ============================================================================
  *  @name   MSGQ_Attrs
  *
@@ -252,12 +359,25 @@ typedef DSP_STATUS (*MsgqPost) (Pvoid notifyHandle) ;
  *              Function to be used to wait to receive a message.
  *  @field  post
  *              Function to be used to indicate arrival of a message.
+ *  @field  version
+ *              MSGQ_ATTRS_VERSION when the following fields are set.
+ *  @field  waitPolicy
+ *              Wait policy of MSGQ_get on the message queue (MSGQ_WaitPolicy).
+ *  @field  spinBudget
+ *              Longest spin in microseconds of MSGQ_WaitPolicy_Adaptive, 0
+ *              for the default.
+ *  @field  laneAttrs
+ *              Priority lanes of the message queue, NULL for a single lane.
  *  ============================================================================
  */
 typedef struct MSGQ_Attrs_tag {
-    Pvoid    notifyHandle ;
-    MsgqPend pend ;
-    MsgqPost post ;
+    Pvoid            notifyHandle ;
+    MsgqPend         pend ;
+    MsgqPost         post ;
+    Uint32           version ;
+    Uint32           waitPolicy ;
+    Uint32           spinBudget ;
+    MSGQ_LaneAttrs * laneAttrs ;
 } MSGQ_Attrs ;
 
 /** ============================================================================
@@ -423,6 +543,90 @@ typedef struct MSGQ_AsyncErrorMsg_tag {
  */
 typedef MSGQ_MsgHeader * MSGQ_Msg ;
 
+/** ============================================================================
+ *  @name   MSGQ_FragMsg
+ *
+ *  @desc   This structure defines the format of a fragment of a large
+ *          message. The data of the fragment follows this structure.
+ *
+ *  @field  header
+ *              Fixed message header required for all messages. Its msgId is
+ *              MSGQ_FRAGMSGID.
+ *  @field  xferId
+ *              Identifier of the large message, unique for its sender.
+ *  @field  totalSize
+ *              Size in bytes of the data of the whole large message.
+ *  @field  link
+ *              Physical address of the next fragment of the large message, 0
+ *              if none. Used by the sending and the receiving MSGQ only.
+ *  @field  msgId
+ *              Message ID of the large message.
+ *  @field  index
+ *              Position of the fragment in the large message.
+ *  @field  numFrags
+ *              Number of fragments of the large message.
+ *  @field  length
+ *              Size in bytes of the data of the fragment.
+ *  ============================================================================
+ */
+typedef struct MSGQ_FragMsg_tag {
+    MSGQ_MsgHeader  header    ;
+    Uint32          xferId    ;
+    Uint32          totalSize ;
+    Uint32          link      ;
+    Uint16          msgId     ;
+    Uint16          index     ;
+    Uint16          numFrags  ;
+    Uint16          length    ;
+} MSGQ_FragMsg ;
+
+/** ============================================================================
+ *  @name   MSGQ_Frag
+ *
+ *  @desc   This structure defines one entry of the scatter list of a large
+ *          message.
+ *
+ *  @field  msg
+ *              Message holding the fragment.
+ *  @field  data
+ *              Data of the fragment, inside msg.
+ *  @field  size
+ *              Size in bytes of the data of the fragment.
+ *  ============================================================================
+ */
+typedef struct MSGQ_Frag_tag {
+    MSGQ_Msg        msg  ;
+    Pvoid           data ;
+    Uint32          size ;
+} MSGQ_Frag ;
+
+/** ============================================================================
+ *  @name   MSGQ_LargeMsg
+ *
+ *  @desc   This structure describes a large message as a scatter list of
+ *          fragments held in pool buffers.
+ *
+ *  @field  msgId
+ *              Message ID of the large message.
+ *  @field  size
+ *              Size in bytes of the data of the large message.
+ *  @field  numFrags
+ *              Number of fragments of the large message.
+ *  @field  maxFrags
+ *              Number of entries of frags, set by the caller.
+ *  @field  frags
+ *              Scatter list of the fragments, provided by the caller. Entry 0
+ *              is the first fragment.
+ *  ============================================================================
+ */
+typedef struct MSGQ_LargeMsg_tag {
+    Uint16          msgId    ;
+    Uint32          size     ;
+    Uint32          numFrags ;
+    Uint32          maxFrags ;
+    MSGQ_Frag *     frags    ;
+} MSGQ_LargeMsg ;
+
 /** ============================================================================
  *  @name   MQT_Interface
  *
@@ -55,6 +55,11 @@
 #include <dsplink.h>
 #include <pooldefs.h>
 
+/*  ----------------------------------- Profiling                   */
+#if defined (DDSP_PROFILE)
+#include <profile.h>
+#endif /* #if defined (DDSP_PROFILE) */
+
 
 #if defined (__cplusplus)
 extern "C" {
@@ -363,6 +368,242 @@ DSP_STATUS
 POOL_invalidate (IN PoolId poolId, IN Pvoid buf, IN Uint32 size) ;
 
 
+/** ============================================================================
+ *  @func   POOL_reconfigure
+ *
+ *  @desc   This function changes the configuration of an open pool while its
+ *          buffers are in use. For an SMAPOOL, params points to the new
+ *          SMAPOOL_Attrs: a buffer class is kept for every size listed and
+ *          grown or shrunk to its new number of buffers, classes of other
+ *          sizes are removed and classes of new sizes are added. Buffers
+ *          removed stay valid until they are freed.
+ *
+ *  @arg    poolId
+ *              Pool Identification number.
+ *  @arg    params
+ *              Pool-specific parameters.
+ *
+ *  @ret    DSP_SOK
+ *              Operation completed successfully.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *          DSP_EMEMORY
+ *              The new buffers do not fit in the free space of the pool.
+ *          DSP_ERESOURCE
+ *              The pool cannot track more classes or runs of buffers until
+ *              the buffers removed earlier are freed.
+ *          DSP_ENOTSUPPORTED
+ *              The pool cannot be reconfigured.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  Pool ID must be less than maximum allowed value.
+ *          params must be a valid pointer.
+ *
+ *  @leave  None.
+ *
+ *  @see    POOL_open ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_reconfigure (IN PoolId poolId, IN Pvoid params) ;
+
+
+/** ============================================================================
+ *  @func   POOL_batchInit
+ *
+ *  @desc   This function prepares a batch deferring one cache operation on
+ *          buffers of a pool. Writing back or invalidating many small
+ *          adjacent buffers through a batch costs one driver call per flush
+ *          and one cache operation per merged extent, instead of one of
+ *          each per buffer.
+ *
+ *  @arg    poolId
+ *              Pool Identification number.
+ *  @arg    op
+ *              Cache operation to defer.
+ *  @arg    ranges
+ *              Storage for the ranges recorded, provided by the caller and
+ *              used until the batch is no longer needed.
+ *  @arg    maxRanges
+ *              Number of ranges the storage can hold.
+ *  @arg    batch
+ *              Batch to prepare.
+ *
+ *  @ret    DSP_SOK
+ *              Operation completed successfully.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *
+ *  @enter  Pool ID must be less than maximum allowed value.
+ *          ranges and batch must be valid pointers.
+ *          maxRanges must be greater than 0.
+ *
+ *  @leave  None.
+ *
+ *  @see    POOL_batchAdd (), POOL_batchFlush ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_batchInit (IN  PoolId            poolId,
+                IN  POOL_CacheOp      op,
+                IN  POOL_CacheRange * ranges,
+                IN  Uint32            maxRanges,
+                OUT POOL_CacheBatch * batch) ;
+
+
+/** ============================================================================
+ *  @func   POOL_batchAdd
+ *
+ *  @desc   This function records a range of a buffer in a batch. The batch is
+ *          flushed first if it is full.
+ *
+ *  @arg    batch
+ *              Batch prepared by POOL_batchInit.
+ *  @arg    buf
+ *              Start of the range.
+ *  @arg    size
+ *              Size of the range in bytes.
+ *
+ *  @ret    DSP_SOK
+ *              Operation completed successfully.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *          DSP_ERANGE
+ *              The batch was full and a range of the flush is outside the
+ *              pool. The range passed has been recorded.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  batch must have been prepared by POOL_batchInit.
+ *          buf must be a valid pointer.
+ *
+ *  @leave  None.
+ *
+ *  @see    POOL_batchFlush ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_batchAdd (IN OUT POOL_CacheBatch * batch, IN Pvoid buf, IN Uint32 size) ;
+
+
+/** ============================================================================
+ *  @func   POOL_batchFlush
+ *
+ *  @desc   This function issues the cache operations of the ranges recorded
+ *          in a batch and empties it. The ranges are widened to whole cache
+ *          lines of CACHE_L2_LINESIZE bytes, and overlapping or adjacent
+ *          ranges are merged, so that each cache line is maintained once.
+ *
+ *  @arg    batch
+ *              Batch prepared by POOL_batchInit.
+ *
+ *  @ret    DSP_SOK
+ *              Operation completed successfully.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *          DSP_ERANGE
+ *              A range is outside the pool. The other ranges have been
+ *              maintained.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  batch must have been prepared by POOL_batchInit.
+ *
+ *  @leave  The batch is empty.
+ *
+ *  @see    POOL_batchAdd ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_batchFlush (IN OUT POOL_CacheBatch * batch) ;
+
+
+/** ============================================================================
+ *  @func   POOL_getOwners
+ *
+ *  @desc   This function gets the owners of the buffers of a pool that are
+ *          allocated and tracked by the owner tracking, oldest first. The
+ *          tracking is enabled for all the processes by setting
+ *          DSPLINK_POOL_OWNERS to the sampling period in the environment of
+ *          the process that sets up the link.
+ *
+ *  @arg    poolId
+ *              Pool Identification number.
+ *  @arg    stats
+ *              Location to retrieve the counters of the tracking.
+ *  @arg    owners
+ *              Location to retrieve the owners.
+ *  @arg    numOwners
+ *              On entry, number of owners the location can hold. On exit,
+ *              number of owners retrieved.
+ *
+ *  @ret    DSP_SOK
+ *              Operation completed successfully.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *          DSP_ENOTSUPPORTED
+ *              The owner tracking is not enabled.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  Pool ID must be less than maximum allowed value.
+ *          stats, owners and numOwners must be valid pointers.
+ *
+ *  @leave  None.
+ *
+ *  @see    POOL_alloc ()
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_getOwners (IN     PoolId            poolId,
+                OUT    POOL_OwnerStats * stats,
+                OUT    POOL_OwnerInfo *  owners,
+                IN OUT Uint32 *          numOwners) ;
+
+
+#if defined (DDSP_PROFILE)
+/** ============================================================================
+ *  @func   POOL_instrument
+ *
+ *  @desc   This function gets the instrumentation information of an open
+ *          pool: the state of its buffer classes and the size of the GPP
+ *          pages backing it, which shows whether it is backed by huge pages.
+ *
+ *  @arg    poolId
+ *              Pool Identification number.
+ *  @arg    retVal
+ *              Location to retrieve the instrumentation information.
+ *
+ *  @ret    DSP_SOK
+ *              Operation completed successfully.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *          DSP_ENOTSUPPORTED
+ *              The allocator of the pool does not provide instrumentation
+ *              information.
+ *          DSP_EWRONGSTATE
+ *              The pool is not open.
+ *
+ *  @enter  Pool ID must be less than maximum allowed value.
+ *          retVal must be a valid pointer.
+ *
+ *  @leave  None.
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+POOL_instrument (IN PoolId poolId, OUT SMAPOOL_Stats * retVal) ;
+#endif /* if defined (DDSP_PROFILE) */
+
+
 /** ============================================================================
  *  @deprecated The deprecated API POOL_Open has been replaced
  *              with POOL_open.
@@ -145,6 +145,162 @@ typedef enum {
 } AddrType ;
 
 
+/** ============================================================================
+ *  @name   POOL_CacheOp
+ *
+ *  @desc   Enumerates the cache operations a POOL_CacheBatch can defer.
+ *
+ *  @field  POOL_CacheOp_Writeback
+ *              Write back the ranges, as POOL_writeback.
+ *  @field  POOL_CacheOp_Invalidate
+ *              Invalidate the ranges, as POOL_invalidate.
+ *  ============================================================================
+ */
+typedef enum {
+    POOL_CacheOp_Writeback  = 0u,
+    POOL_CacheOp_Invalidate = 1u
+} POOL_CacheOp ;
+
+/** ============================================================================
+ *  @name   POOL_CacheRange
+ *
+ *  @desc   Range of a buffer recorded in a POOL_CacheBatch.
+ *
+ *  @field  buf
+ *              Start of the range.
+ *  @field  size
+ *              Size of the range in bytes.
+ *  ============================================================================
+ */
+typedef struct POOL_CacheRange_tag {
+    Pvoid   buf  ;
+    Uint32  size ;
+} POOL_CacheRange ;
+
+/** ============================================================================
+ *  @name   POOL_CacheStats
+ *
+ *  @desc   Counters of a POOL_CacheBatch since POOL_batchInit.
+ *
+ *  @field  numRanges
+ *              Number of ranges recorded.
+ *  @field  numOps
+ *              Number of cache operations issued, one per merged extent.
+ *  @field  numFlushes
+ *              Number of flushes that issued at least one operation, each
+ *              one crossing into the driver.
+ *  @field  bytesSaved
+ *              Number of bytes a POOL_writeback or POOL_invalidate on every
+ *              range would have walked, counting whole cache lines, beyond
+ *              the bytes of the merged extents.
+ *  @field  linesSaved
+ *              Same as bytesSaved, in cache lines of CACHE_L2_LINESIZE bytes.
+ *  ============================================================================
+ */
+typedef struct POOL_CacheStats_tag {
+    Uint32  numRanges  ;
+    Uint32  numOps     ;
+    Uint32  numFlushes ;
+    Uint32  bytesSaved ;
+    Uint32  linesSaved ;
+} POOL_CacheStats ;
+
+/** ============================================================================
+ *  @name   POOL_CacheBatch
+ *
+ *  @desc   Batch of deferred cache operations on buffers of one pool. The
+ *          ranges recorded are merged when the batch is flushed: overlapping
+ *          and adjacent ranges, once widened to whole cache lines, are
+ *          maintained by a single operation.
+ *
+ *  @field  poolId
+ *              Pool the buffers belong to.
+ *  @field  op
+ *              Cache operation deferred by the batch.
+ *  @field  ranges
+ *              Storage of the ranges, provided by the caller.
+ *  @field  maxRanges
+ *              Number of ranges the storage can hold.
+ *  @field  numRanges
+ *              Number of ranges recorded since the last flush.
+ *  @field  stats
+ *              Counters of the batch.
+ *  ============================================================================
+ */
+typedef struct POOL_CacheBatch_tag {
+    PoolId             poolId    ;
+    POOL_CacheOp       op        ;
+    POOL_CacheRange *  ranges    ;
+    Uint32             maxRanges ;
+    Uint32             numRanges ;
+    POOL_CacheStats    stats     ;
+} POOL_CacheBatch ;
+
+/** ============================================================================
+ *  @const  POOL_OWNERCALLERS
+ *
+ *  @desc   Number of return addresses recorded for the owner of a buffer.
+ *  ============================================================================
+ */
+#define POOL_OWNERCALLERS   8u
+
+/** ============================================================================
+ *  @name   POOL_OwnerInfo
+ *
+ *  @desc   Owner of a buffer tracked by the owner tracking of the pools.
+ *
+ *  @field  physAddr
+ *              Physical address of the buffer.
+ *  @field  size
+ *              Size passed to the allocation.
+ *  @field  usecs
+ *              CLOCK_MONOTONIC time of the allocation in microseconds, modulo
+ *              2^32.
+ *  @field  processId
+ *              Process that allocated the buffer.
+ *  @field  threadId
+ *              Thread that allocated the buffer.
+ *  @field  poolId
+ *              Pool of the buffer.
+ *  @field  callers
+ *              Return addresses of the allocation in the process that made
+ *              it, innermost first, NULL past the last one.
+ *  ============================================================================
+ */
+typedef struct POOL_OwnerInfo_tag {
+    Uint32  physAddr  ;
+    Uint32  size      ;
+    Uint32  usecs     ;
+    Uint32  processId ;
+    Uint32  threadId  ;
+    PoolId  poolId    ;
+    Pvoid   callers [POOL_OWNERCALLERS] ;
+} POOL_OwnerInfo ;
+
+/** ============================================================================
+ *  @name   POOL_OwnerStats
+ *
+ *  @desc   Counters of the owner tracking of a pool.
+ *
+ *  @field  period
+ *              One allocation in period is tracked, 1 if all are.
+ *  @field  numTracked
+ *              Number of buffers of the pool tracked and not yet freed.
+ *  @field  maxTracked
+ *              Highest value of numTracked.
+ *  @field  numDropped
+ *              Number of allocations picked for tracking that found no room
+ *              left to record their owner.
+ *  ============================================================================
+ */
+typedef struct POOL_OwnerStats_tag {
+    Uint32  period     ;
+    Uint32  numTracked ;
+    Uint32  maxTracked ;
+    Uint32  numDropped ;
+} POOL_OwnerStats ;
+
+
 /** ============================================================================
  *  @name   BUFPOOL_Attrs
  *
@@ -260,11 +260,34 @@ struct DSP_Stats_tag {
  *  @field  queued
  *              Number of messages currently queued on this MSGQ, pending calls
  *              to get them.
+ *  @field  spinHits
+ *              Number of calls to get messages satisfied while spinning,
+ *              without blocking.
+ *  @field  latencyCount
+ *              Number of messages received on this MSGQ whose latency from
+ *              their arrival on the MSGQ to their get was measured.
+ *  @field  latencyP50
+ *              Median latency in nanoseconds. Like the other percentiles, it
+ *              is the upper bound of a histogram bucket, at most 25% above
+ *              the exact value.
+ *  @field  latencyP99
+ *              99th percentile of the latency in nanoseconds.
+ *  @field  latencyP999
+ *              99.9th percentile of the latency in nanoseconds.
+ *  @field  latencyMax
+ *              Highest latency in nanoseconds. Latencies that do not fit in
+ *              32 bits are reported as 0xFFFFFFFF.
  *  ============================================================================
  */
 typedef struct MSGQ_Instrument_tag {
     Uint32      transferred ;
     Uint32      queued ;
+    Uint32      spinHits ;
+    Uint32      latencyCount ;
+    Uint32      latencyP50 ;
+    Uint32      latencyP99 ;
+    Uint32      latencyP999 ;
+    Uint32      latencyMax ;
 } MSGQ_Instrument ;
 
 /** ============================================================================
@@ -322,6 +345,9 @@ typedef struct MPBUF_Stats_tag {
  *              Total number of conflicts.
  *  @field  numCalls
  *              Total number of calls made to MPCS entry and leave functions.
+ *  @field  pageSize
+ *              Size of the GPP pages backing the pool, larger than the default
+ *              page size when the pool is backed by huge pages.
  *  ============================================================================
  */
 typedef struct SMAPOOL_Stats_tag {
@@ -329,6 +355,7 @@ typedef struct SMAPOOL_Stats_tag {
     Uint16      bufHandleCount ;
     Uint32      conflicts ;
     Uint32      numCalls ;
+    Uint32      pageSize ;
 } SMAPOOL_Stats ;
 #endif /* if defined (POOL_COMPONENT) */
 
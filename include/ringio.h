@@ -347,7 +347,10 @@ RingIO_delete (IN ProcessorId procId, IN Char8 * name) ;
  *
  *  @desc   This function opens a RingIO channel.
  *          This function is used to open an RingIO Channel either for reading
- *          or writing. Only one reader and one writer can be opened on a RingIO
+ *          or writing. Only one reader and one writer can be opened on a RingIO,
+ *          except for a broadcast RingIO (RingIO_Attrs.bcastAttrs), which takes
+ *          up to numReaders readers. A reader of a broadcast RingIO opened
+ *          while others are reading starts at the position of the slowest.
  *
  *  @arg    name
  *              Name of the RingIO channel to be opened.
@@ -445,6 +448,9 @@ RingIO_close (IN RingIO_Handle handle) ;
  *          RINGIO_ENOTCONTIGUOUSDATA
  *              Valid data is present but is not contiguous because the data
  *              has been acquired using the foot buffer.
+ *          RINGIO_EDROPPED
+ *              The writer of a broadcast RingIO dropped the reader, which
+ *              goes on from the position of the slowest reader left.
  *
  *  @enter  handle must be valid.
  *          dataBuf must be a valid pointer.
@@ -481,6 +487,11 @@ RingIO_acquire (IN     RingIO_Handle   handle,
  *              General failure.
  *          DSP_EINVALIDARG
  *              Invalid arguments.
+ *          RINGIO_EDROPPED
+ *              The writer of a broadcast RingIO dropped the reader, and the
+ *              data acquired may have been overwritten. Nothing is released:
+ *              the reader goes on from the position of the slowest reader
+ *              left.
  *
  *  @enter  RINGIO_acquire has been successful.
  *
@@ -559,6 +570,8 @@ RingIO_cancel (IN RingIO_Handle handle) ;
  *              No valid attributes are present, or general failure.
  *          DSP_EINVALIDARG
  *              Invalid arguments.
+ *          RINGIO_EDROPPED
+ *              The writer of a broadcast RingIO dropped the reader.
  *
  *  @enter  handle must be a valid pointer.
  *          type must be valid.
@@ -829,6 +842,151 @@ RingIO_setNotifier (IN  RingIO_Handle      handle,
                     IN  RingIO_NotifyFunc  notifyFunc,
                     IN  RingIO_NotifyParam notifyParam) ;
 
+/** ============================================================================
+ *  @func   RingIO_getPollFd
+ *
+ *  @desc   This function returns a file descriptor that can be waited on
+ *          with poll, select or epoll instead of a notification function.
+ *          The descriptor is raised whenever a notification is due to the
+ *          client according to the parameters set with RingIO_setNotifier,
+ *          which then accepts a NULL notification function, and is cleared
+ *          by the next RingIO_acquire of the client. It is raised when
+ *          created, so that the client tries an acquire first. The
+ *          descriptor belongs to the client: it must not be read or closed
+ *          by the application, and is closed by RingIO_close.
+ *
+ *  @arg    handle
+ *              Handle to the RingIO client.
+ *  @arg    fd
+ *              Location to receive the file descriptor.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid arguments.
+ *          DSP_EACCESSDENIED
+ *              The client has been opened by another process.
+ *          DSP_ERESOURCE
+ *              The file descriptor cannot be created.
+ *
+ *  @enter  RingIO_open for the client has been successful in the calling
+ *          process.
+ *          Like notification functions, the descriptor is only raised by
+ *          the peer clients opened in the same process.
+ *
+ *  @leave  None.
+ *
+ *  @see    RingIO_setNotifier, RingIO_acquire
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_getPollFd (IN RingIO_Handle handle, OUT Int32 * fd) ;
+
+
+/** ============================================================================
+ *  @func   RingIO_spliceOut
+ *
+ *  @desc   This function writes valid data of the reader to a file
+ *          descriptor straight from the data buffer: the buffers are
+ *          acquired, written and released in turn, each released only once
+ *          the kernel is done with its pages. For a reader opened with
+ *          RINGIO_ZEROCOPY, buffers of 16 KB or more are sent to a socket
+ *          that takes MSG_ZEROCOPY from the pages of the data buffer, in
+ *          sends of up to 64 KB with up to 8 in flight, and released once
+ *          their completions come back on its error queue. SO_ZEROCOPY is
+ *          set on the socket for the call only, if it was not already. A
+ *          datagram socket is sent one datagram of up to 65507 bytes per
+ *          send, with or without RINGIO_ZEROCOPY. The other descriptors are
+ *          written to, with no copy at all when they are opened with
+ *          O_DIRECT. The data left unwritten stays valid.
+ *          The function blocks while a blocking descriptor does.
+ *
+ *  @arg    handle
+ *              Handle to the RingIO reader.
+ *  @arg    fd
+ *              File descriptor to write to.
+ *  @arg    size
+ *              Size of data to write. Returns the size written.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Operation successfully completed.
+ *          RINGIO_SPENDINGATTRIBUTE
+ *              The data up to an attribute has been written.
+ *          RINGIO_EBUFEMPTY, RINGIO_EBUFFULL
+ *              Less valid data than the size has been written.
+ *          RINGIO_EDROPPED
+ *              The writer of a broadcast RingIO dropped the reader.
+ *          DSP_EPENDING
+ *              The descriptor is non-blocking and takes no more data now.
+ *          DSP_EFILE
+ *              The write failed, errno tells why.
+ *          RINGIO_EFAILURE
+ *              The reader has a buffer acquired.
+ *          DSP_EINVALIDARG
+ *              Invalid arguments.
+ *
+ *  @enter  RingIO_open for reading has been successful.
+ *          No other MSG_ZEROCOPY send is pending on a socket, if the reader
+ *          was opened with RINGIO_ZEROCOPY.
+ *
+ *  @leave  The reader has no buffer acquired.
+ *
+ *  @see    RingIO_spliceIn, RingIO_acquire
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_spliceOut (IN     RingIO_Handle handle,
+                  IN     Int32         fd,
+                  IN OUT Uint32 *      size) ;
+
+
+/** ============================================================================
+ *  @func   RingIO_spliceIn
+ *
+ *  @desc   This function reads data for the writer from a file descriptor
+ *          straight into the data buffer: the buffers are acquired, filled
+ *          and released in turn, with no copy at all from a descriptor
+ *          opened with O_DIRECT. The space left unfilled stays empty. The
+ *          function blocks while a blocking descriptor does.
+ *
+ *  @arg    handle
+ *              Handle to the RingIO writer.
+ *  @arg    fd
+ *              File descriptor to read from.
+ *  @arg    size
+ *              Size of data to read. Returns the size read, less at the end
+ *              of the file.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Operation successfully completed, or the end of the file
+ *              reached.
+ *          RINGIO_EBUFFULL
+ *              Less empty space than the size has been filled.
+ *          DSP_EPENDING
+ *              The descriptor is non-blocking and has no more data now.
+ *          DSP_EFILE
+ *              The read failed, errno tells why.
+ *          RINGIO_EFAILURE
+ *              The writer has a buffer acquired.
+ *          DSP_EINVALIDARG
+ *              Invalid arguments.
+ *
+ *  @enter  RingIO_open for writing has been successful.
+ *
+ *  @leave  The writer has no buffer acquired.
+ *
+ *  @see    RingIO_spliceOut, RingIO_acquire
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+RingIO_spliceIn (IN     RingIO_Handle handle,
+                 IN     Int32         fd,
+                 IN OUT Uint32 *      size) ;
+
+
 /** ============================================================================
  *  @func   RingIO_sendNotify
  *
@@ -73,15 +73,18 @@ extern "C" {
 
 /** ============================================================================
  *  @const  RINGIO_DATABUF_CACHEUSE, RINGIO_ATTRBUF_CACHEUSE,
- *          RINGIO_ATTRBUF_CACHEUSE, RINGIO_NEED_EXACT_SIZE
+ *          RINGIO_ATTRBUF_CACHEUSE, RINGIO_NEED_EXACT_SIZE, RINGIO_ZEROCOPY
  *
  *  @desc   These constants denote the flags provided while opening the RingIO.
+ *          RINGIO_ZEROCOPY lets RingIO_spliceOut send the buffers of the
+ *          reader to a socket with MSG_ZEROCOPY.
  *  ============================================================================
  */
 #define RINGIO_DATABUF_CACHEUSE 0x1u
 #define RINGIO_ATTRBUF_CACHEUSE 0x2u
 #define RINGIO_CONTROL_CACHEUSE 0x4u
 #define RINGIO_NEED_EXACT_SIZE  0x8u
+#define RINGIO_ZEROCOPY         0x10u
 
 /** ============================================================================
  *  @macro  RINGIO_NAME_MAX_LEN
@@ -91,6 +94,34 @@ extern "C" {
  */
 #define RINGIO_NAME_MAX_LEN  32u
 
+/** ============================================================================
+ *  @const  RINGIO_MAX_READERS
+ *
+ *  @desc   Maximum number of readers of a broadcast RingIO.
+ *  ============================================================================
+ */
+#define RINGIO_MAX_READERS   8u
+
+/** ============================================================================
+ *  @const  RINGIO_ATTRS_VERSION
+ *
+ *  @desc   Value of RingIO_Attrs.version telling that the fields following
+ *          it are set. With any other value they are ignored, and the RingIO
+ *          has a single reader.
+ *  ============================================================================
+ */
+#define RINGIO_ATTRS_VERSION 0x52490001u
+
+/** ============================================================================
+ *  @macro  RINGIO_ATTRS_INIT
+ *
+ *  @desc   Initializer of a RingIO_Attrs giving the default attributes, to be
+ *          used before setting the pools and sizes.
+ *  ============================================================================
+ */
+#define RINGIO_ATTRS_INIT    { RINGIO_TRANSPORT_GPP_DSP, 0u, 0u, 0u, 0u,     \
+                               0u, 0u, 0u, RINGIO_ATTRS_VERSION, NULL }
+
 
 /** ============================================================================
  *  @name   RingIO_OpenMode
@@ -218,6 +249,46 @@ typedef Void (* RingIO_NotifyFunc) (RingIO_Handle handle,
                                     RingIO_NotifyParam param,
                                     RingIO_NotifyMsg msg) ;
 
+/** ============================================================================
+ *  @name   RingIO_BcastPolicy
+ *
+ *  @desc   Enumeration of the policies of a broadcast RingIO towards readers
+ *          that hold the writer back.
+ *
+ *  @field  RINGIO_BCAST_BLOCK
+ *              The writer waits for the slowest reader.
+ *  @field  RINGIO_BCAST_DROPSLOW
+ *              A writer short of room drops the slowest readers, as long as
+ *              one reader is ahead of them. A dropped reader is told so by
+ *              its next RingIO_acquire, RingIO_release or
+ *              RingIO_getvAttribute, and goes on from the position of the
+ *              slowest reader left.
+ *  ============================================================================
+ */
+typedef enum {
+    RINGIO_BCAST_BLOCK    = 0u,
+    RINGIO_BCAST_DROPSLOW = 1u
+} RingIO_BcastPolicy ;
+
+/** ============================================================================
+ *  @name   RingIO_BcastAttrs
+ *
+ *  @desc   This structure defines the readers of a broadcast RingIO. Every
+ *          reader has its own position in the data and in the attributes,
+ *          and sees the whole stream written from the time it is opened.
+ *
+ *  @field  numReaders
+ *              Maximum number of readers opened at a time, up to
+ *              RINGIO_MAX_READERS.
+ *  @field  policy
+ *              Policy towards readers holding the writer back.
+ *  ============================================================================
+ */
+typedef struct RingIO_BcastAttrs_tag {
+    Uint32              numReaders ;
+    RingIO_BcastPolicy  policy ;
+} RingIO_BcastAttrs ;
+
 
 /** ============================================================================
  *  @name   RingIO_Attrs
@@ -238,9 +309,17 @@ typedef Void (* RingIO_NotifyFunc) (RingIO_Handle handle,
  *  @field  dataBufSize
  *              Data Buffer Size in bytes.
  *  @field  footBufSize
- *              Footer area for providing contiguous buffer to a reader.
+ *              Footer area for providing contiguous buffer to a reader. Not
+ *              used, and may be zero, when the GPP can mirror the data buffer,
+ *              which needs dataBufSize to be a multiple of the page size.
  *  @field  attrBufSize
- *              Attribute buffer size in bytes.
+ *              Attribute buffer size in bytes. The GPP also allocates a
+ *              buffer of half this size from attrPoolId for the index of the
+ *              attributes, and goes without the index if that fails.
+ *  @field  version
+ *              RINGIO_ATTRS_VERSION when the following fields are set.
+ *  @field  bcastAttrs
+ *              Readers of a broadcast RingIO, NULL for a single reader.
  *  ============================================================================
  */
 typedef struct RingIO_Attrs_tag {
@@ -252,6 +331,8 @@ typedef struct RingIO_Attrs_tag {
     Uint32                 dataBufSize ;
     Uint32                 footBufSize ;
     Uint32                 attrBufSize ;
+    Uint32                 version ;
+    RingIO_BcastAttrs *    bcastAttrs ;
 } RingIO_Attrs ;
 
 /** ============================================================================
@@ -277,6 +358,9 @@ typedef struct RingIO_ControlStruct_tag RingIO_ControlStruct;
  *              Virtual start address of the data buffer
  *  @field  pAttrStart
  *              Virtual start address of the attr buffer
+ *  @field  pAttrIndex
+ *              Virtual address of the index of the attributes, NULL if the
+ *              RingIO has none.
  *  @field  acqStart
  *              Start offset of data buffer that has been acquired by the
  *              application.
@@ -286,6 +370,26 @@ typedef struct RingIO_ControlStruct_tag RingIO_ControlStruct;
  *              Start offset of the acquired attribute buffer
  *  @field  acqAttrSize
  *              Size of attribute data that has been acquired
+ *  @field  acqCount
+ *              Number of bytes acquired by the client since the RingIO was
+ *              created, modulo 2^32. Only the client updates it, except for
+ *              the flush of the writer.
+ *  @field  relCount
+ *              Number of bytes released by the client since the RingIO was
+ *              created, modulo 2^32. Only the client updates it, except for
+ *              the flush of the writer.
+ *  @field  posSeq
+ *              Odd while a reader of a broadcast RingIO moves acqStart and
+ *              relCount, for a joining reader to read them consistently.
+ *  @field  dropped
+ *              Non-zero once the writer of a broadcast RingIO has dropped
+ *              the reader.
+ *  @field  validAttrSize
+ *              Attribute bytes the reader has not taken yet.
+ *  @field  attrSeq
+ *              Number of attributes set by the writer, or taken or skipped
+ *              by the reader, modulo 2^32: the entry of the next one in the
+ *              index of the attributes.
  *  @field  notifyType
  *              Notification type
  *  @field  notifyFunc
@@ -329,10 +433,17 @@ typedef struct RingIO_Client_tag {
     Uint32                 openMode ;
     RingIO_BufPtr          pDataStart ;
     RingIO_BufPtr          pAttrStart ;
+    RingIO_BufPtr          pAttrIndex ;
     Uint32                 acqStart ;
     Uint32                 acqSize ;
     Uint32                 acqAttrStart ;
     Uint32                 acqAttrSize ;
+    volatile Uint32        acqCount ;
+    volatile Uint32        relCount ;
+    volatile Uint32        posSeq ;
+    volatile Uint32        dropped ;
+    Uint32                 validAttrSize ;
+    Uint32                 attrSeq ;
     Uint32                 notifyType ;
     RingIO_NotifyFunc      notifyFunc ;
     RingIO_NotifyParam     notifyParam ;
@@ -342,7 +453,7 @@ typedef struct RingIO_Client_tag {
     Void *                 virtLockHandle;
     Uint32                 isValid ;
     Uint32                 refCount ;
-    Uint16                 notifyFlag ;
+    volatile Uint16        notifyFlag ;
     ADD_PADDING            (padding, RINGIO_CLIENT_PADDING)
 } RingIO_Client ;
 
@@ -351,8 +462,8 @@ typedef struct RingIO_Client_tag {
  *
  *  @desc   This structure defines the RingIO Control Structure. This structure
  *          is stored in shared memory and is accessible by all clients. The
- *          control structure supports a single reader and a single writer for
- *          the ring buffer.
+ *          control structure supports a single writer and, unless the
+ *          RingIO is a broadcast one, a single reader for the ring buffer.
  *
  *  @field  procId
  *              ID of DSP processor.
@@ -379,12 +490,37 @@ typedef struct RingIO_Client_tag {
  *              Amount of valid data available in the data buffer. Valid Data is
  *              the total data that is readable by the reader using an acquire
  *              call. This  does not include the size of the data buffer already
- *              acquired by the reader
+ *              acquired by the reader. Not maintained on the GPP, which
+ *              derives it from the counters of the clients.
  *  @field  emptySize
  *              Amount of empty space in the data buffer. This does not include
-                the empty space already acquired by the writer
+ *              the empty space already acquired by the writer. Not maintained
+ *              on the GPP, which derives it from the counters of the clients.
+ *  @field  endCount
+ *              Number of bytes written before the early end of the data
+ *              buffer, valid while curBufEnd is below dataBufEnd.
+ *  @field  flushCount
+ *              Number of flushes of the writer, for the reader to detect that
+ *              the data it is acquiring may have been dropped.
+ *  @field  mirrored
+ *              Non-zero if the GPP clients map the data buffer twice
+ *              back-to-back, in which case the foot buffer is not used.
+ *  @field  bufOffset
+ *              Offset of the data buffer in the pool buffer holding it, which
+ *              is larger than the data buffer to align it for the mirror.
+ *  @field  bufSize
+ *              Size of the pool buffer holding the data buffer.
+ *  @field  numReaders
+ *              Number of reader clients. The clients beyond the first follow
+ *              the control structure, and a broadcast RingIO has one more
+ *              holding the position of the stream while no reader is open.
+ *  @field  bcastPolicy
+ *              Policy of a broadcast RingIO towards slow readers.
  *  @field  phyAttrStart
  *              Physical start address of the attr buffer
+ *  @field  phyAttrIndex
+ *              Physical address of the index of the attributes, NULL if it
+ *              could not be allocated.
  *  @field  phyAttrBufEnd
  *              Total Size of the attribute buffer (offset)
  *  @field  curAttrBufEnd
@@ -407,7 +543,7 @@ typedef struct RingIO_Client_tag {
  *  @field  writer
  *              Writer state information
  *  @field  reader
- *              Reader state information
+ *              Reader state information, of the first reader
  *  ============================================================================
  */
 struct RingIO_ControlStruct_tag {
@@ -422,7 +558,15 @@ struct RingIO_ControlStruct_tag {
     Uint32                footBufSize;
     Uint32                validSize;
     Uint32                emptySize;
+    volatile Uint32       endCount;
+    volatile Uint32       flushCount;
+    Uint32                mirrored;
+    Uint32                bufOffset;
+    Uint32                bufSize;
+    Uint32                numReaders;
+    Uint32                bcastPolicy;
     RingIO_BufPtr         phyAttrStart;
+    RingIO_BufPtr         phyAttrIndex;
     Uint32                phyAttrBufEnd;
     Uint32                curAttrBufEnd;
     Uint32                validAttrSize;
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2008, Jason Kridner, Texas Instruments
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Texas Instruments nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY Jason Kridner ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <copyright holder> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Sends a blob larger than any single message to the DSP and back, and to a
+ * local queue, first split into messages by hand and then as a large
+ * message, and compares the two.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <dsplink.h>
+#include <proc.h>
+#include <msgq.h>
+#include <pool.h>
+
+#define PROCESSOR_ID    0
+#define POOL_ID         0
+#define NUM_BUF_SIZES   2
+#define FRAG_SIZE       4096
+#define CHUNK_DATA      (FRAG_SIZE - sizeof (ChunkMsg))
+#define FRAG_DATA       (FRAG_SIZE - sizeof (MSGQ_FragMsg))
+#define GPP_QUEUE_NAME  "GPPMSGQ1"
+#define DSP_QUEUE_NAME  "DSPMSGQ0"
+#define DSP_EXECUTABLE  "loop.out"
+#define DEFAULT_SIZE    (1024 * 1024)
+#define DEFAULT_COUNT   100
+
+typedef struct ChunkMsg_tag {
+    MSGQ_MsgHeader header;
+    Uint32         offset;
+    Uint32         length;
+} ChunkMsg;
+
+static Uint32 bufSizes[NUM_BUF_SIZES] = {
+    DSPLINK_ALIGN(sizeof (MSGQ_AsyncLocateMsg), DSPLINK_BUF_ALIGN),
+    FRAG_SIZE
+};
+static Uint32 numBuffers[NUM_BUF_SIZES] = { 4, 0 };
+
+static double now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+static Uint32 checksum(Uint32 sum, const Uint8 *data, Uint32 size)
+{
+    Uint32 i;
+
+    for (i = 0; i < size; i++) {
+        sum = (sum * 31) + data[i];
+    }
+    return sum;
+}
+
+/* One round trip of the blob, split into messages by the application. */
+static DSP_STATUS sendChunks(MSGQ_Queue dspQueue, MSGQ_Queue gppQueue,
+                             Uint8 *blob, Uint8 *copy, Uint32 size,
+                             Uint32 *sum)
+{
+    DSP_STATUS status = DSP_SOK;
+    MSGQ_Msg   msg;
+    ChunkMsg  *chunk;
+    Uint32     offset;
+    Uint32     numChunks = 0;
+
+    for (offset = 0; (offset < size) && DSP_SUCCEEDED(status);
+         offset += CHUNK_DATA) {
+        status = MSGQ_alloc(POOL_makePoolId(PROCESSOR_ID, POOL_ID),
+                            FRAG_SIZE, &msg);
+        if (DSP_SUCCEEDED(status)) {
+            chunk = (ChunkMsg *) msg;
+            chunk->offset = offset;
+            chunk->length = size - offset;
+            if (chunk->length > CHUNK_DATA) {
+                chunk->length = CHUNK_DATA;
+            }
+            memcpy(chunk + 1, blob + offset, chunk->length);
+            MSGQ_setSrcQueue(msg, gppQueue);
+            status = MSGQ_put(dspQueue, msg);
+            numChunks++;
+        }
+    }
+
+    while ((numChunks != 0) && DSP_SUCCEEDED(status)) {
+        status = MSGQ_get(gppQueue, WAIT_FOREVER, &msg);
+        if (DSP_SUCCEEDED(status)) {
+            chunk = (ChunkMsg *) msg;
+            memcpy(copy + chunk->offset, chunk + 1, chunk->length);
+            MSGQ_free(msg);
+            numChunks--;
+        }
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        *sum = checksum(0, copy, size);
+    }
+    return status;
+}
+
+/* One round trip of the blob as a large message. */
+static DSP_STATUS sendLarge(MSGQ_Queue dspQueue, MSGQ_Queue gppQueue,
+                            Uint8 *blob, MSGQ_LargeMsg *largeMsg,
+                            Uint32 size, Uint32 *sum)
+{
+    DSP_STATUS status;
+    Uint32     offset = 0;
+    Uint32     i;
+
+    status = MSGQ_allocLarge(POOL_makePoolId(PROCESSOR_ID, POOL_ID),
+                             size, FRAG_SIZE, largeMsg);
+    if (DSP_SUCCEEDED(status)) {
+        for (i = 0; i < largeMsg->numFrags; i++) {
+            memcpy(largeMsg->frags[i].data, blob + offset,
+                   largeMsg->frags[i].size);
+            offset += largeMsg->frags[i].size;
+        }
+        largeMsg->msgId = 1;
+        MSGQ_setSrcQueue(largeMsg->frags[0].msg, gppQueue);
+        status = MSGQ_putLarge(dspQueue, largeMsg);
+        if (DSP_FAILED(status)) {
+            MSGQ_freeLarge(largeMsg);
+        }
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        status = MSGQ_getLarge(gppQueue, WAIT_FOREVER, largeMsg);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        /* The data is read in place, from the scatter list. */
+        *sum = 0;
+        for (i = 0; i < largeMsg->numFrags; i++) {
+            *sum = checksum(*sum, largeMsg->frags[i].data,
+                            largeMsg->frags[i].size);
+        }
+        if (largeMsg->size != size) {
+            status = DSP_EFAIL;
+        }
+        MSGQ_freeLarge(largeMsg);
+    }
+    return status;
+}
+
+int main(int argc, char** argv)
+{
+    DSP_STATUS       status;
+    SMAPOOL_Attrs    poolAttrs;
+    ZCPYMQT_Attrs    mqtAttrs;
+    MSGQ_LocateAttrs locateAttrs;
+    MSGQ_LargeMsg    largeMsg;
+    MSGQ_Queue       gppQueue = MSGQ_INVALIDMSGQ;
+    MSGQ_Queue       dspQueue = MSGQ_INVALIDMSGQ;
+    Uint32           size = DEFAULT_SIZE;
+    Uint32           count = DEFAULT_COUNT;
+    Uint32           maxFrags;
+    Uint32           expected;
+    Uint32           sum = 0;
+    Uint32           i;
+    Uint8           *blob;
+    Uint8           *copy;
+    double           start;
+    double           chunked[2] = { 0, 0 };
+    double           large[2] = { 0, 0 };
+    MSGQ_Queue       dstQueue[2];
+    const char      *dstName[2] = { "DSP", "local" };
+    Uint32           d;
+
+    if (argc > 1) {
+        size = (Uint32) strtoul(argv[1], NULL, 0);
+    }
+    if (argc > 2) {
+        count = (Uint32) strtoul(argv[2], NULL, 0);
+    }
+
+    maxFrags = (size + FRAG_DATA - 1) / FRAG_DATA;
+    numBuffers[1] = ((size + CHUNK_DATA - 1) / CHUNK_DATA) + 8;
+    blob = malloc(size);
+    copy = malloc(size);
+    largeMsg.frags = malloc(maxFrags * sizeof (MSGQ_Frag));
+    largeMsg.maxFrags = maxFrags;
+    if ((size == 0) || (blob == NULL) || (copy == NULL)
+        || (largeMsg.frags == NULL)) {
+        fprintf(stderr, "large_msg: invalid size %lu\n", (unsigned long) size);
+        return 1;
+    }
+    for (i = 0; i < size; i++) {
+        blob[i] = (Uint8) (i * 7 + (i >> 11));
+    }
+    expected = checksum(0, blob, size);
+
+    status = PROC_setup(NULL);
+    if (DSP_SUCCEEDED(status)) {
+        status = PROC_attach(PROCESSOR_ID, NULL);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        poolAttrs.numBufPools   = NUM_BUF_SIZES;
+        poolAttrs.bufSizes      = bufSizes;
+        poolAttrs.numBuffers    = numBuffers;
+        poolAttrs.exactMatchReq = TRUE;
+        status = POOL_open(POOL_makePoolId(PROCESSOR_ID, POOL_ID), &poolAttrs);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        status = MSGQ_open(GPP_QUEUE_NAME, &gppQueue, NULL);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        status = PROC_load(PROCESSOR_ID, DSP_EXECUTABLE, 0, NULL);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        status = PROC_start(PROCESSOR_ID);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        mqtAttrs.poolId = POOL_makePoolId(PROCESSOR_ID, POOL_ID);
+        status = MSGQ_transportOpen(PROCESSOR_ID, &mqtAttrs);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        locateAttrs.timeout = WAIT_FOREVER;
+        status = MSGQ_locate(DSP_QUEUE_NAME, &dspQueue, &locateAttrs);
+    }
+
+    dstQueue[0] = dspQueue;
+    dstQueue[1] = gppQueue;
+    for (d = 0; (d < 2) && DSP_SUCCEEDED(status); d++) {
+        start = now();
+        for (i = 0; (i < count) && DSP_SUCCEEDED(status); i++) {
+            memset(copy, 0, size);
+            status = sendChunks(dstQueue[d], gppQueue, blob, copy, size,
+                                &sum);
+            if (DSP_SUCCEEDED(status) && (sum != expected)) {
+                status = DSP_EFAIL;
+            }
+        }
+        chunked[d] = now() - start;
+
+        start = now();
+        for (i = 0; (i < count) && DSP_SUCCEEDED(status); i++) {
+            status = sendLarge(dstQueue[d], gppQueue, blob, &largeMsg, size,
+                               &sum);
+            if (DSP_SUCCEEDED(status) && (sum != expected)) {
+                status = DSP_EFAIL;
+            }
+        }
+        large[d] = now() - start;
+    }
+
+    if (DSP_SUCCEEDED(status) && (count != 0)) {
+        printf("%lu round trips of %lu bytes in %lu byte messages\n",
+               (unsigned long) count, (unsigned long) size,
+               (unsigned long) FRAG_SIZE);
+        for (d = 0; d < 2; d++) {
+            printf("  %-5s manual chunks: %.3f s, %.1f MB/s, %.1f us each\n",
+                   dstName[d], chunked[d],
+                   count * (size / 1e6) / chunked[d],
+                   chunked[d] * 1e6 / count);
+            printf("  %-5s large message: %.3f s, %.1f MB/s, %.1f us each\n",
+                   dstName[d], large[d], count * (size / 1e6) / large[d],
+                   large[d] * 1e6 / count);
+        }
+    }
+
+    if (dspQueue != MSGQ_INVALIDMSGQ) {
+        MSGQ_release(dspQueue);
+    }
+    MSGQ_transportClose(PROCESSOR_ID);
+    PROC_stop(PROCESSOR_ID);
+    if (gppQueue != MSGQ_INVALIDMSGQ) {
+        MSGQ_close(gppQueue);
+    }
+    POOL_close(POOL_makePoolId(PROCESSOR_ID, POOL_ID));
+    PROC_detach(PROCESSOR_ID);
+    PROC_destroy();
+    free(largeMsg.frags);
+    free(copy);
+    free(blob);
+
+    if (DSP_FAILED(status)) {
+        fprintf(stderr, "large_msg failed: 0x%lx\n", (unsigned long) (Uint32) status);
+        return 1;
+    }
+
+    return 0;
+}
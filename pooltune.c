@@ -0,0 +1,505 @@
+/*
+ * Copyright (c) 2008, Jason Kridner, Texas Instruments
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Texas Instruments nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY Jason Kridner ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <copyright holder> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Reads the allocation traces written by processes run with
+ * DSPLINK_POOL_TRACE set, and prints for every traced pool the SMAPOOL_Attrs
+ * with the smallest buffer footprint for which no more than the given
+ * fraction of the allocations would find their size class exhausted.
+ *
+ * Request sizes are rounded up to the buffer alignment. A size class then
+ * serves a contiguous range of rounded sizes, and needs enough buffers for
+ * the number of buffers of that range in use when an allocation is made, at
+ * the requested quantile. The ranges are chosen by dynamic programming over
+ * the sorted sizes, with at most MAX_SMABUFENTRIES classes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <dsplink.h>
+#include <pooldefs.h>
+#include <ldrv_pool.h>
+
+#define DEFAULT_PROBABILITY 0.001
+#define ROUND_SIZE(size)    DSPLINK_ALIGN((size), DSPLINK_BUF_ALIGN)
+
+typedef unsigned long long Time;
+
+typedef struct Event_tag {
+    Time    time;
+    Uint32  seq;
+    LDRV_POOL_TraceRecord record;
+} Event;
+
+/* Buffer in use, keyed by its physical address. */
+typedef struct Slot_tag {
+    Uint32  physAddr;
+    Uint32  sizeIndex;
+    Time    since;
+} Slot;
+
+typedef struct Table_tag {
+    Slot   *slots;
+    Uint32  mask;
+} Table;
+
+/* What the trace shows of one rounded size. */
+typedef struct SizeStats_tag {
+    Uint32  allocs;
+    Uint32  frees;
+    Uint32  peak;
+    Time    lifetime;
+} SizeStats;
+
+static Event  *events;
+static Uint32  numEvents;
+
+static int compareEvents(const void *a, const void *b)
+{
+    const Event *x = a;
+    const Event *y = b;
+    int          result;
+
+    if (x->record.poolId != y->record.poolId) {
+        result = (x->record.poolId < y->record.poolId) ? -1 : 1;
+    }
+    else if (x->time != y->time) {
+        result = (x->time < y->time) ? -1 : 1;
+    }
+    else {
+        result = (x->seq < y->seq) ? -1 : 1;
+    }
+    return result;
+}
+
+static int compareSizes(const void *a, const void *b)
+{
+    Uint32 x = *(const Uint32 *) a;
+    Uint32 y = *(const Uint32 *) b;
+
+    return (x < y) ? -1 : (x > y);
+}
+
+/*
+ * Appends the records of one trace file. Times are kept in microseconds
+ * since the first record of the first file, unwrapping the 32-bit stamps;
+ * the processes are assumed to start within half an hour of each other.
+ */
+static int readTrace(const char *name, int first, Uint32 *base)
+{
+    FILE                  *file;
+    LDRV_POOL_TraceRecord  record;
+    Uint32                 last = 0;
+    Time                   time = 0;
+    int                    started = 0;
+    Event                 *grown;
+    static Uint32          capacity;
+
+    file = fopen(name, "rb");
+    if (file == NULL) {
+        perror(name);
+        return -1;
+    }
+
+    while (fread(&record, sizeof (record), 1, file) == 1) {
+        if (started == 0) {
+            if (first) {
+                *base = record.usecs;
+            }
+            time = (Time) (long long) (Int32) (record.usecs - *base);
+            started = 1;
+        }
+        else {
+            time += (Uint32) (record.usecs - last);
+        }
+        last = record.usecs;
+
+        if (numEvents == capacity) {
+            capacity = (capacity == 0) ? 4096 : (capacity * 2);
+            grown = realloc(events, capacity * sizeof (Event));
+            if (grown == NULL) {
+                fprintf(stderr, "out of memory\n");
+                fclose(file);
+                return -1;
+            }
+            events = grown;
+        }
+        events[numEvents].time   = time;
+        events[numEvents].seq    = numEvents;
+        events[numEvents].record = record;
+        numEvents++;
+    }
+
+    fclose(file);
+    return 0;
+}
+
+static Slot *lookup(Table *table, Uint32 physAddr)
+{
+    Uint32 i = (physAddr / DSPLINK_BUF_ALIGN * 2654435761u) & table->mask;
+
+    while ((table->slots[i].physAddr != 0)
+           && (table->slots[i].physAddr != physAddr)) {
+        i = (i + 1) & table->mask;
+    }
+    return &table->slots[i];
+}
+
+/* Removes a slot, shifting back the slots of its probe sequence. */
+static void removeSlot(Table *table, Slot *slot)
+{
+    Uint32 hole = (Uint32) (slot - table->slots);
+    Uint32 i    = hole;
+    Uint32 home;
+
+    for (;;) {
+        i = (i + 1) & table->mask;
+        if (table->slots[i].physAddr == 0) {
+            break;
+        }
+        home = (table->slots[i].physAddr / DSPLINK_BUF_ALIGN * 2654435761u)
+               & table->mask;
+        if (((i - home) & table->mask) >= ((i - hole) & table->mask)) {
+            table->slots[hole] = table->slots[i];
+            hole = i;
+        }
+    }
+    table->slots[hole].physAddr = 0;
+}
+
+static Uint32 findSize(const Uint32 *sizes, Uint32 numSizes, Uint32 size)
+{
+    Uint32 low  = 0;
+    Uint32 high = numSizes;
+    Uint32 mid;
+
+    while (low < high) {
+        mid = (low + high) / 2;
+        if (sizes[mid] < size) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/*
+ * Replays the events of one pool and returns the peak number of buffers in
+ * use. Unless hist is NULL, for every allocation of size index t and every
+ * range i..j holding t, also counts in hist the number of buffers of the
+ * range in use at the time of the allocation, and fills stats.
+ */
+static Uint32 replay(const Event *first, Uint32 count, const Uint32 *sizes,
+                     Uint32 numSizes, Uint32 *hist, Uint32 histLen,
+                     SizeStats *stats)
+{
+    Table   table;
+    Uint32 *live;
+    Uint32 *prefix;
+    Uint32  inUse = 0;
+    Uint32  maxInUse = 0;
+    Uint32  tableSize = 16;
+    Uint32  e;
+    Uint32  i;
+    Uint32  j;
+    Uint32  t;
+    Slot   *slot;
+    const LDRV_POOL_TraceRecord *record;
+
+    while (tableSize < count * 2) {
+        tableSize *= 2;
+    }
+    table.slots = calloc(tableSize, sizeof (Slot));
+    table.mask  = tableSize - 1;
+    live   = calloc(numSizes, sizeof (Uint32));
+    prefix = calloc(numSizes + 1, sizeof (Uint32));
+    if ((table.slots == NULL) || (live == NULL) || (prefix == NULL)) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    for (e = 0; e < count; e++) {
+        record = &first[e].record;
+        if (record->op == LDRV_POOL_TRACEFREE) {
+            slot = lookup(&table, record->physAddr);
+            if (slot->physAddr != 0) {
+                live[slot->sizeIndex]--;
+                inUse--;
+                if (hist != NULL) {
+                    stats[slot->sizeIndex].frees++;
+                    stats[slot->sizeIndex].lifetime +=
+                                               first[e].time - slot->since;
+                }
+                removeSlot(&table, slot);
+            }
+            continue;
+        }
+
+        t = findSize(sizes, numSizes, ROUND_SIZE(record->size));
+        if (hist != NULL) {
+            stats[t].allocs++;
+            for (i = 0; i < numSizes; i++) {
+                prefix[i + 1] = prefix[i] + live[i];
+            }
+            for (i = 0; i <= t; i++) {
+                for (j = t; j < numSizes; j++) {
+                    hist[((i * numSizes) + j) * histLen
+                         + (prefix[j + 1] - prefix[i])]++;
+                }
+            }
+        }
+
+        if ((record->op == LDRV_POOL_TRACEALLOC) && (record->physAddr != 0)) {
+            slot = lookup(&table, record->physAddr);
+            if (slot->physAddr != 0) {
+                /* The free of the previous use was not traced. */
+                live[slot->sizeIndex]--;
+                inUse--;
+            }
+            slot->physAddr  = record->physAddr;
+            slot->sizeIndex = t;
+            slot->since     = first[e].time;
+            live[t]++;
+            inUse++;
+            if (inUse > maxInUse) {
+                maxInUse = inUse;
+            }
+            if ((hist != NULL) && (live[t] > stats[t].peak)) {
+                stats[t].peak = live[t];
+            }
+        }
+    }
+
+    free(table.slots);
+    free(live);
+    free(prefix);
+    return maxInUse;
+}
+
+/* Buffers a range needs so that at most a fraction of its allocations fail. */
+static Uint32 needed(const Uint32 *hist, Uint32 histLen, double probability)
+{
+    Uint32 total = 0;
+    Uint32 above = 0;
+    Uint32 n;
+
+    for (n = 0; n < histLen; n++) {
+        total += hist[n];
+    }
+    /* An allocation fails if n or more buffers are in use. */
+    for (n = histLen; n > 1; n--) {
+        if (above + hist[n - 1] > probability * total) {
+            break;
+        }
+        above += hist[n - 1];
+    }
+    return n;
+}
+
+static void tunePool(const Event *first, Uint32 count, double probability)
+{
+    Uint32 *sizes;
+    Uint32  numSizes = 0;
+    Uint32    *hist;
+    Uint32     histLen;
+    SizeStats *stats;
+    Time      *best;
+    Uint32 *from;
+    Uint32 *need;
+    Uint32  maxClasses;
+    Uint32  classes[MAX_SMABUFENTRIES];
+    Uint32  numBufs[MAX_SMABUFENTRIES];
+    Uint32  numClasses = 0;
+    Uint32  bestClasses = 0;
+    Uint32  failed = 0;
+    Uint32  total = 0;
+    Time    cost;
+    Uint32  e;
+    Uint32  i;
+    Uint32  j;
+    Uint32  k;
+    Uint32  low;
+    Uint32  high;
+    PoolId  poolId = first->record.poolId;
+
+    sizes = malloc(count * sizeof (Uint32));
+    if (sizes == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    for (e = 0; e < count; e++) {
+        if (first[e].record.op != LDRV_POOL_TRACEFREE) {
+            sizes[numSizes++] = ROUND_SIZE(first[e].record.size);
+            failed += (first[e].record.op == LDRV_POOL_TRACEFAIL);
+            total++;
+        }
+    }
+    if (numSizes == 0) {
+        free(sizes);
+        return;
+    }
+    qsort(sizes, numSizes, sizeof (Uint32), compareSizes);
+    for (i = 1, j = 1; i < numSizes; i++) {
+        if (sizes[i] != sizes[j - 1]) {
+            sizes[j++] = sizes[i];
+        }
+    }
+    numSizes = j;
+
+    histLen  = replay(first, count, sizes, numSizes, NULL, 0, NULL) + 1;
+    hist     = calloc((size_t) numSizes * numSizes * histLen, sizeof (Uint32));
+    stats    = calloc(numSizes, sizeof (SizeStats));
+    need     = calloc((size_t) numSizes * numSizes, sizeof (Uint32));
+    maxClasses = (numSizes < MAX_SMABUFENTRIES) ? numSizes
+                                                : MAX_SMABUFENTRIES;
+    best     = malloc((size_t) (maxClasses + 1) * numSizes * sizeof (Time));
+    from     = malloc((size_t) (maxClasses + 1) * numSizes * sizeof (Uint32));
+    if ((hist == NULL) || (stats == NULL) || (need == NULL) || (best == NULL)
+        || (from == NULL)) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    replay(first, count, sizes, numSizes, hist, histLen, stats);
+
+    for (i = 0; i < numSizes; i++) {
+        for (j = i; j < numSizes; j++) {
+            need[(i * numSizes) + j] =
+                needed(&hist[((i * numSizes) + j) * histLen], histLen,
+                       probability);
+        }
+    }
+
+    /* best[k][j]: smallest footprint of sizes 0..j in k + 1 classes. */
+    for (k = 0; k < maxClasses; k++) {
+        for (j = 0; j < numSizes; j++) {
+            best[(k * numSizes) + j] = ~(Time) 0;
+            /* The last class holds sizes i..j, the others sizes 0..i-1. */
+            low  = (k == 0) ? 0 : k;
+            high = (k == 0) ? 0 : j;
+            for (i = low; i <= high; i++) {
+                cost = (Time) need[(i * numSizes) + j] * sizes[j];
+                if (i != 0) {
+                    cost += best[((k - 1) * numSizes) + i - 1];
+                }
+                if (cost < best[(k * numSizes) + j]) {
+                    best[(k * numSizes) + j] = cost;
+                    from[(k * numSizes) + j] = i;
+                }
+            }
+        }
+        if ((k == 0) || (best[(k * numSizes) + numSizes - 1]
+                         < best[(bestClasses * numSizes) + numSizes - 1])) {
+            bestClasses = k;
+        }
+    }
+
+    cost = best[(bestClasses * numSizes) + numSizes - 1];
+    j = numSizes - 1;
+    for (k = bestClasses + 1; k > 0; k--) {
+        i = from[((k - 1) * numSizes) + j];
+        classes[k - 1] = sizes[j];
+        numBufs[k - 1] = need[(i * numSizes) + j];
+        j = i - 1;
+    }
+    numClasses = bestClasses + 1;
+
+    printf("/* Pool %u of processor %u: %u allocations, %u failed.\n",
+           (unsigned) POOL_getPoolNo(poolId),
+           (unsigned) POOL_getProcId(poolId), (unsigned) total,
+           (unsigned) failed);
+    printf(" *   size  allocations  peak in use  mean lifetime (us)\n");
+    for (i = 0; i < numSizes; i++) {
+        printf(" * %6u  %11u  %11u  %18.1f\n", (unsigned) sizes[i],
+               (unsigned) stats[i].allocs, (unsigned) stats[i].peak,
+               (stats[i].frees == 0) ? 0.0
+                   : ((double) stats[i].lifetime / stats[i].frees));
+    }
+    printf(" * %llu bytes of buffers for an exhaustion probability of %g.\n"
+           " */\n", cost, probability);
+    printf("static Uint32 pool%uBufSizes[%u] = {",
+           (unsigned) POOL_getPoolNo(poolId), (unsigned) numClasses);
+    for (k = 0; k < numClasses; k++) {
+        printf("%s %u", (k == 0) ? "" : ",", (unsigned) classes[k]);
+    }
+    printf(" };\nstatic Uint32 pool%uNumBuffers[%u] = {",
+           (unsigned) POOL_getPoolNo(poolId), (unsigned) numClasses);
+    for (k = 0; k < numClasses; k++) {
+        printf("%s %u", (k == 0) ? "" : ",", (unsigned) numBufs[k]);
+    }
+    printf(" };\nstatic SMAPOOL_Attrs pool%uAttrs = {\n"
+           "    %u, pool%uBufSizes, pool%uNumBuffers, FALSE\n};\n\n",
+           (unsigned) POOL_getPoolNo(poolId), (unsigned) numClasses,
+           (unsigned) POOL_getPoolNo(poolId),
+           (unsigned) POOL_getPoolNo(poolId));
+
+    free(sizes);
+    free(hist);
+    free(stats);
+    free(need);
+    free(best);
+    free(from);
+}
+
+int main(int argc, char **argv)
+{
+    double probability = DEFAULT_PROBABILITY;
+    Uint32 base = 0;
+    Uint32 start;
+    Uint32 e;
+    int    arg = 1;
+
+    if ((argc > 2) && (strcmp(argv[1], "-p") == 0)) {
+        probability = atof(argv[2]);
+        arg = 3;
+    }
+    if ((arg >= argc) || (probability < 0) || (probability >= 1)) {
+        fprintf(stderr, "usage: %s [-p probability] trace...\n", argv[0]);
+        return 1;
+    }
+
+    for (; arg < argc; arg++) {
+        if (readTrace(argv[arg], numEvents == 0, &base) != 0) {
+            return 1;
+        }
+    }
+
+    qsort(events, numEvents, sizeof (Event), compareEvents);
+    for (start = 0, e = 1; e <= numEvents; e++) {
+        if ((e == numEvents)
+            || (events[e].record.poolId != events[start].record.poolId)) {
+            tunePool(&events[start], e - start, probability);
+            start = e;
+        }
+    }
+
+    free(events);
+    return 0;
+}
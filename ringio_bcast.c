@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2008, Jason Kridner, Texas Instruments
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Texas Instruments nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY Jason Kridner ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <copyright holder> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * Streams data with an attribute after every block through a broadcast
+ * RingIO read by several readers at different paces, checking that every
+ * reader gets all the data and every attribute at its place.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <dsplink.h>
+#include <proc.h>
+#include <pool.h>
+#include <ringio.h>
+
+#define PROCESSOR_ID    0
+#define POOL_ID         0
+#define RINGIO_NAME     "BCASTRING"
+#define NUM_READERS     3
+#define BLOCK_SIZE      64
+#define DATA_BUF_SIZE   4096
+#define ATTR_BUF_SIZE   256
+#define ATTR_TYPE       1
+#define DEFAULT_COUNT   10000
+
+static Uint32 bufSizes[2] = { 1024, 8192 };
+static Uint32 numBuffers[2] = { 8, 4 };
+
+/* Reader i drains the RingIO every readEvery[i] blocks. */
+static Uint32 readEvery[NUM_READERS] = { 1, 3, 7 };
+
+static unsigned char pattern(Uint32 pos)
+{
+    return (unsigned char) ((pos * 2654435761u) >> 24);
+}
+
+static DSP_STATUS writeBlock(RingIO_Handle writer, Uint32 block)
+{
+    DSP_STATUS    status;
+    RingIO_BufPtr buf;
+    Uint32        size = BLOCK_SIZE;
+    Uint32        i;
+
+    status = RingIO_acquire(writer, &buf, &size);
+    if (DSP_SUCCEEDED(status) && (size != BLOCK_SIZE)) {
+        status = DSP_EFAIL;
+    }
+    if (DSP_SUCCEEDED(status)) {
+        for (i = 0; i < BLOCK_SIZE; i++) {
+            ((unsigned char *) buf)[i] = pattern(block * BLOCK_SIZE + i);
+        }
+        status = RingIO_release(writer, BLOCK_SIZE);
+    }
+    if (DSP_SUCCEEDED(status)) {
+        /* Placed after the block, where the next one starts. */
+        status = RingIO_setAttribute(writer, 0, ATTR_TYPE, block);
+    }
+
+    return status;
+}
+
+static DSP_STATUS drain(RingIO_Handle reader, Uint32 *pos, Uint32 *attrs)
+{
+    DSP_STATUS    status = DSP_SOK;
+    DSP_STATUS    attrStatus;
+    RingIO_BufPtr buf;
+    Uint32        size;
+    Uint32        param;
+    Uint16        type;
+    Uint32        i;
+    Bool          done = FALSE;
+
+    while ((done == FALSE) && DSP_SUCCEEDED(status)) {
+        attrStatus = RingIO_getAttribute(reader, &type, &param);
+        if (attrStatus == RINGIO_SUCCESS) {
+            /* The attribute of block n follows its last byte. */
+            if (   (type != ATTR_TYPE) || (param != *attrs)
+                || (*pos != (param + 1) * BLOCK_SIZE)) {
+                status = DSP_EFAIL;
+            }
+            (*attrs)++;
+            continue;
+        }
+
+        size = DATA_BUF_SIZE;
+        (void) RingIO_acquire(reader, &buf, &size);
+        if (size == 0) {
+            done = TRUE;
+        }
+        else {
+            for (i = 0; i < size; i++) {
+                if (((unsigned char *) buf)[i] != pattern(*pos + i)) {
+                    status = DSP_EFAIL;
+                }
+            }
+            *pos += size;
+            if (DSP_SUCCEEDED(status)) {
+                status = RingIO_release(reader, size);
+            }
+        }
+    }
+
+    return status;
+}
+
+int main(int argc, char** argv)
+{
+    DSP_STATUS        status;
+    SMAPOOL_Attrs     poolAttrs;
+    RingIO_BcastAttrs bcastAttrs;
+    RingIO_Attrs      ringAttrs;
+    PoolId            poolId = POOL_makePoolId(PROCESSOR_ID, POOL_ID);
+    RingIO_Handle     writer = NULL;
+    RingIO_Handle     readers[NUM_READERS] = { NULL, NULL, NULL };
+    Uint32            pos[NUM_READERS] = { 0, 0, 0 };
+    Uint32            attrs[NUM_READERS] = { 0, 0, 0 };
+    Uint32            count = DEFAULT_COUNT;
+    Uint32            block;
+    Uint32            i;
+    Bool              created = FALSE;
+
+    if (argc > 1) {
+        count = (Uint32) strtoul(argv[1], NULL, 0);
+    }
+
+    status = PROC_setup(NULL);
+    if (DSP_SUCCEEDED(status)) {
+        status = PROC_attach(PROCESSOR_ID, NULL);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        poolAttrs.numBufPools   = 2;
+        poolAttrs.bufSizes      = bufSizes;
+        poolAttrs.numBuffers    = numBuffers;
+        poolAttrs.exactMatchReq = FALSE;
+        status = POOL_open(poolId, &poolAttrs);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        bcastAttrs.numReaders   = NUM_READERS;
+        bcastAttrs.policy       = RINGIO_BCAST_BLOCK;
+        ringAttrs.transportType = RINGIO_TRANSPORT_GPP_DSP;
+        ringAttrs.ctrlPoolId    = poolId;
+        ringAttrs.dataPoolId    = poolId;
+        ringAttrs.attrPoolId    = poolId;
+        ringAttrs.lockPoolId    = poolId;
+        ringAttrs.dataBufSize   = DATA_BUF_SIZE;
+        ringAttrs.footBufSize   = 0;
+        ringAttrs.attrBufSize   = ATTR_BUF_SIZE;
+        ringAttrs.version       = RINGIO_ATTRS_VERSION;
+        ringAttrs.bcastAttrs    = &bcastAttrs;
+        status = RingIO_create(PROCESSOR_ID, RINGIO_NAME, &ringAttrs);
+        created = DSP_SUCCEEDED(status);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        writer = RingIO_open(RINGIO_NAME, RINGIO_MODE_WRITE, 0);
+        for (i = 0; i < NUM_READERS; i++) {
+            readers[i] = RingIO_open(RINGIO_NAME, RINGIO_MODE_READ, 0);
+            if (readers[i] == NULL) {
+                status = DSP_EFAIL;
+            }
+        }
+        if (writer == NULL) {
+            status = DSP_EFAIL;
+        }
+    }
+
+    for (block = 0; (block < count) && DSP_SUCCEEDED(status); block++) {
+        status = writeBlock(writer, block);
+        for (i = 0; (i < NUM_READERS) && DSP_SUCCEEDED(status); i++) {
+            if ((block % readEvery[i]) == (readEvery[i] - 1)) {
+                status = drain(readers[i], &pos[i], &attrs[i]);
+            }
+        }
+    }
+
+    for (i = 0; (i < NUM_READERS) && DSP_SUCCEEDED(status); i++) {
+        status = drain(readers[i], &pos[i], &attrs[i]);
+        if (   DSP_SUCCEEDED(status)
+            && ((pos[i] != count * BLOCK_SIZE) || (attrs[i] != count))) {
+            status = DSP_EFAIL;
+        }
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        printf("%lu blocks and attributes read by %d readers\n",
+               (unsigned long) count, NUM_READERS);
+    }
+
+    for (i = 0; i < NUM_READERS; i++) {
+        if (readers[i] != NULL) {
+            RingIO_close(readers[i]);
+        }
+    }
+    if (writer != NULL) {
+        RingIO_close(writer);
+    }
+    if (created) {
+        RingIO_delete(PROCESSOR_ID, RINGIO_NAME);
+    }
+    POOL_close(poolId);
+    PROC_detach(PROCESSOR_ID);
+    PROC_destroy();
+
+    if (DSP_FAILED(status)) {
+        fprintf(stderr, "ringio_bcast failed: 0x%lx\n", (unsigned long) (Uint32) status);
+        return 1;
+    }
+
+    return 0;
+}
@@ -26,15 +26,139 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
 #include <dsplink.h>
-/*
 #include <proc.h>
 #include <msgq.h>
 #include <pool.h>
-*/
 
-int argc(int argc, char** argv)
+#define PROCESSOR_ID    0
+#define POOL_ID         0
+#define NUM_BUF_SIZES   2
+#define MSG_SIZE        DSPLINK_ALIGN(sizeof (SampleMsg), DSPLINK_BUF_ALIGN)
+#define GPP_QUEUE_NAME  "GPPMSGQ1"
+#define DSP_QUEUE_NAME  "DSPMSGQ0"
+#define DSP_EXECUTABLE  "loop.out"
+#define DEFAULT_COUNT   10000
+
+typedef struct SampleMsg_tag {
+    MSGQ_MsgHeader header;
+    Uint32         seq;
+} SampleMsg;
+
+static Uint32 bufSizes[NUM_BUF_SIZES] = {
+    DSPLINK_ALIGN(sizeof (MSGQ_AsyncLocateMsg), DSPLINK_BUF_ALIGN),
+    MSG_SIZE
+};
+static Uint32 numBuffers[NUM_BUF_SIZES] = { 4, 4 };
+
+static double now(void)
 {
- return(0);
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
 }
 
+int main(int argc, char** argv)
+{
+    DSP_STATUS       status;
+    SMAPOOL_Attrs    poolAttrs;
+    ZCPYMQT_Attrs    mqtAttrs;
+    MSGQ_LocateAttrs locateAttrs;
+    MSGQ_Queue       gppQueue = MSGQ_INVALIDMSGQ;
+    MSGQ_Queue       dspQueue = MSGQ_INVALIDMSGQ;
+    MSGQ_Msg         msg;
+    Uint32           count = DEFAULT_COUNT;
+    Uint32           i;
+    double           start;
+    double           elapsed;
+
+    if (argc > 1) {
+        count = (Uint32) strtoul(argv[1], NULL, 0);
+    }
+
+    status = PROC_setup(NULL);
+    if (DSP_SUCCEEDED(status)) {
+        status = PROC_attach(PROCESSOR_ID, NULL);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        poolAttrs.numBufPools   = NUM_BUF_SIZES;
+        poolAttrs.bufSizes      = bufSizes;
+        poolAttrs.numBuffers    = numBuffers;
+        poolAttrs.exactMatchReq = TRUE;
+        status = POOL_open(POOL_makePoolId(PROCESSOR_ID, POOL_ID), &poolAttrs);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        status = MSGQ_open(GPP_QUEUE_NAME, &gppQueue, NULL);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        status = PROC_load(PROCESSOR_ID, DSP_EXECUTABLE, 0, NULL);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        status = PROC_start(PROCESSOR_ID);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        mqtAttrs.poolId = POOL_makePoolId(PROCESSOR_ID, POOL_ID);
+        status = MSGQ_transportOpen(PROCESSOR_ID, &mqtAttrs);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        locateAttrs.timeout = WAIT_FOREVER;
+        status = MSGQ_locate(DSP_QUEUE_NAME, &dspQueue, &locateAttrs);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        status = MSGQ_alloc(POOL_makePoolId(PROCESSOR_ID, POOL_ID),
+                            MSG_SIZE, &msg);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        start = now();
+        for (i = 0; (i < count) && DSP_SUCCEEDED(status); i++) {
+            ((SampleMsg *) msg)->seq = i;
+            MSGQ_setSrcQueue(msg, gppQueue);
+            status = MSGQ_put(dspQueue, msg);
+            if (DSP_SUCCEEDED(status)) {
+                status = MSGQ_get(gppQueue, WAIT_FOREVER, &msg);
+            }
+            if (DSP_SUCCEEDED(status) && (((SampleMsg *) msg)->seq != i)) {
+                status = DSP_EFAIL;
+            }
+        }
+        elapsed = now() - start;
+        MSGQ_free(msg);
+
+        if (DSP_SUCCEEDED(status) && (count != 0)) {
+            printf("%lu round trips in %.3f s: %.0f msg/s, %.2f us/round trip\n",
+                   (unsigned long) count, elapsed,
+                   count / elapsed, elapsed * 1e6 / count);
+        }
+    }
+
+    if (dspQueue != MSGQ_INVALIDMSGQ) {
+        MSGQ_release(dspQueue);
+    }
+    MSGQ_transportClose(PROCESSOR_ID);
+    PROC_stop(PROCESSOR_ID);
+    if (gppQueue != MSGQ_INVALIDMSGQ) {
+        MSGQ_close(gppQueue);
+    }
+    POOL_close(POOL_makePoolId(PROCESSOR_ID, POOL_ID));
+    PROC_detach(PROCESSOR_ID);
+    PROC_destroy();
+
+    if (DSP_FAILED(status)) {
+        fprintf(stderr, "simple_msg failed: 0x%lx\n", (unsigned long) (Uint32) status);
+        return 1;
+    }
+
+    return 0;
+}
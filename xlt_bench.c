@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2008, Jason Kridner, Texas Instruments
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Texas Instruments nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY Jason Kridner ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <copyright holder> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * Times POOL_translateAddr for every pair of address types, checking that
+ * each translation lands on the address of the buffer in the target space.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <dsplink.h>
+#include <proc.h>
+#include <pool.h>
+
+#define PROCESSOR_ID    0
+#define POOL_ID         0
+#define BUF_SIZE        DSPLINK_BUF_ALIGN
+#define NUM_ADDR_TYPES  4
+#define DEFAULT_COUNT   1000000
+
+static Uint32 bufSizes[1] = { BUF_SIZE };
+static Uint32 numBuffers[1] = { 4 };
+static const char *typeNames[NUM_ADDR_TYPES] = { "USR", "PHY", "KNL", "DSP" };
+
+static double now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+int main(int argc, char** argv)
+{
+    DSP_STATUS    status;
+    SMAPOOL_Attrs poolAttrs;
+    PoolId        poolId = POOL_makePoolId(PROCESSOR_ID, POOL_ID);
+    Pvoid         addr[NUM_ADDR_TYPES] = { NULL, NULL, NULL, NULL };
+    Pvoid         result = NULL;
+    Uint32        count = DEFAULT_COUNT;
+    Uint32        src;
+    Uint32        dst;
+    Uint32        i;
+    double        start;
+    double        elapsed;
+
+    if (argc > 1) {
+        count = (Uint32) strtoul(argv[1], NULL, 0);
+    }
+
+    status = PROC_setup(NULL);
+    if (DSP_SUCCEEDED(status)) {
+        status = PROC_attach(PROCESSOR_ID, NULL);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        poolAttrs.numBufPools   = 1;
+        poolAttrs.bufSizes      = bufSizes;
+        poolAttrs.numBuffers    = numBuffers;
+        poolAttrs.exactMatchReq = TRUE;
+        status = POOL_open(poolId, &poolAttrs);
+    }
+
+    if (DSP_SUCCEEDED(status)) {
+        status = POOL_alloc(poolId, &addr[AddrType_Usr], BUF_SIZE);
+    }
+
+    for (dst = 1; (dst < NUM_ADDR_TYPES) && DSP_SUCCEEDED(status); dst++) {
+        status = POOL_translateAddr(poolId, &addr[dst], (AddrType) dst,
+                                    addr[AddrType_Usr], AddrType_Usr);
+    }
+
+    for (src = 0; (src < NUM_ADDR_TYPES) && DSP_SUCCEEDED(status); src++) {
+        for (dst = 0; (dst < NUM_ADDR_TYPES) && DSP_SUCCEEDED(status); dst++) {
+            if (src == dst) {
+                continue;
+            }
+            start = now();
+            for (i = 0; (i < count) && DSP_SUCCEEDED(status); i++) {
+                status = POOL_translateAddr(poolId, &result, (AddrType) dst,
+                                            addr[src], (AddrType) src);
+            }
+            elapsed = now() - start;
+            if (DSP_SUCCEEDED(status) && (result != addr[dst])) {
+                status = DSP_EFAIL;
+            }
+            if (DSP_SUCCEEDED(status) && (count != 0)) {
+                printf("%s_TO_%s: %.1f ns/translation\n", typeNames[src],
+                       typeNames[dst], elapsed * 1e9 / count);
+            }
+        }
+    }
+
+    if (addr[AddrType_Usr] != NULL) {
+        POOL_free(poolId, addr[AddrType_Usr], BUF_SIZE);
+    }
+    POOL_close(poolId);
+    PROC_detach(PROCESSOR_ID);
+    PROC_destroy();
+
+    if (DSP_FAILED(status)) {
+        fprintf(stderr, "xlt_bench failed: 0x%lx\n",
+                (unsigned long) (Uint32) status);
+        return 1;
+    }
+
+    return 0;
+}